@@ -0,0 +1,836 @@
+#ifndef ACE_BTREE_MAP_T_CPP
+#define ACE_BTREE_MAP_T_CPP
+
+#include "ace/BTree_Map_T.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#if !defined (__ACE_INLINE__)
+# include "ace/BTree_Map_T.inl"
+#endif /* __ACE_INLINE__ */
+
+#include "ace/Malloc_Base.h"
+#include "ace/OS_NS_string.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+ACE_ALLOC_HOOK_DEFINE_Tc5(ACE_BTree_Map)
+ACE_ALLOC_HOOK_DEFINE_Tc5(ACE_BTree_Map_Iterator_Base)
+ACE_ALLOC_HOOK_DEFINE_Tc5(ACE_BTree_Map_Iterator)
+ACE_ALLOC_HOOK_DEFINE_Tc5(ACE_BTree_Map_Reverse_Iterator)
+
+template <class EXT_ID, class INT_ID> void
+ACE_BTree_Map_Entry<EXT_ID, INT_ID>::dump (void) const
+{
+#if defined (ACE_HAS_DUMP)
+  ACELIB_DEBUG ((LM_DEBUG, ACE_BEGIN_DUMP, this));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_END_DUMP));
+#endif /* ACE_HAS_DUMP */
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::ACE_BTree_Map (ACE_Allocator *alloc)
+  : root_ (0),
+    cur_size_ (0),
+    allocator_ (0)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::ACE_BTree_Map");
+  if (this->open (alloc) == -1)
+    ACELIB_ERROR ((LM_ERROR,
+                   ACE_TEXT ("%p\n"),
+                   ACE_TEXT ("ACE_BTree_Map::ACE_BTree_Map")));
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::open (ACE_Allocator *alloc)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::open");
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  // Calling open() on an existing map releases its current contents.
+  this->close_i (this->root_);
+  this->root_ = 0;
+  this->cur_size_ = 0;
+
+  if (alloc == 0)
+    alloc = ACE_Allocator::instance ();
+
+  this->allocator_ = alloc;
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::close (void)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::close");
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  this->close_i (this->root_);
+  this->root_ = 0;
+  this->cur_size_ = 0;
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> void
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::close_i (NODE *node)
+{
+  if (node == 0)
+    return;
+
+  for (size_t i = 0; i < node->count_; ++i)
+    this->free_entry_i (node->entries_[i]);
+
+  if (!node->leaf_)
+    for (size_t i = 0; i <= node->count_; ++i)
+      this->close_i (node->children_[i]);
+
+  this->free_node_i (node);
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_BTree_Map_Node<EXT_ID, INT_ID> *
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::make_node_i (bool leaf)
+{
+  NODE *node = 0;
+  ACE_NEW_MALLOC_RETURN (node,
+                         static_cast<NODE *> (this->allocator_->malloc (sizeof (NODE))),
+                         NODE (leaf),
+                         0);
+  return node;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> void
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::free_node_i (NODE *node)
+{
+  ACE_DES_FREE_TEMPLATE2 (node,
+                          this->allocator_->free,
+                          ACE_BTree_Map_Node,
+                          EXT_ID, INT_ID);
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> void
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::free_entry_i (ENTRY *entry)
+{
+  ACE_DES_FREE_TEMPLATE2 (entry,
+                          this->allocator_->free,
+                          ACE_BTree_Map_Entry,
+                          EXT_ID, INT_ID);
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> size_t
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::fence_prefix_i (NODE *node)
+{
+  // The keys routed to a node lie between the nearest separators on
+  // its left and on its right in the ancestors, and share whatever
+  // prefix these two share.
+  const EXT_ID *low = 0;
+  const EXT_ID *high = 0;
+  for (NODE *n = node; n->parent_ != 0 && (low == 0 || high == 0); n = n->parent_)
+    {
+      NODE *const parent = n->parent_;
+      if (low == 0 && n->index_ > 0)
+        low = &parent->entries_[n->index_ - 1]->ext_id_;
+      if (high == 0 && n->index_ < parent->count_)
+        high = &parent->entries_[n->index_]->ext_id_;
+    }
+
+  return (low != 0 && high != 0) ? this->key_prefix_.common (*low, *high) : 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> void
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::rebuild_i (NODE *node)
+{
+  node->prefix_ = this->fence_prefix_i (node);
+  for (size_t i = 0; i < node->count_; ++i)
+    this->place_i (node, i);
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> void
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::place_i (NODE *node,
+                                                                            size_t pos)
+{
+  node->heads_[pos] = this->key_prefix_.head (node->entries_[pos]->ext_id_,
+                                              node->prefix_);
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> void
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::adopt_i (NODE *node,
+                                                                            size_t from,
+                                                                            size_t to)
+{
+  for (size_t i = from; i <= to; ++i)
+    {
+      node->children_[i]->parent_ = node;
+      node->children_[i]->index_ = i;
+    }
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> size_t
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::search_i (NODE *node,
+                                                                             const EXT_ID &k,
+                                                                             bool &found)
+{
+  size_t const n = node->count_;
+  ACE_UINT64 const head = this->key_prefix_.head (k, node->prefix_);
+  bool const exact = this->key_prefix_.exact ();
+  size_t lo = 0;
+  size_t hi = n;
+  while (lo < hi)
+    {
+      size_t const mid = (lo + hi) / 2;
+      ACE_UINT64 const mid_head = node->heads_[mid];
+      if (mid_head < head
+          || (mid_head == head
+              && !exact
+              && this->lessthan (node->entries_[mid]->ext_id_, k)))
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  // lo is the first key not less than k, it is k unless k is less.
+  found = lo < n
+    && node->heads_[lo] == head
+    && (exact || !this->lessthan (k, node->entries_[lo]->ext_id_));
+  return lo;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_BTree_Map_Entry<EXT_ID, INT_ID> *
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::find_i (const EXT_ID &k)
+{
+  for (NODE *node = this->root_; node != 0; )
+    {
+      bool found = false;
+      size_t const pos = this->search_i (node, k, found);
+      if (found)
+        return node->entries_[pos];
+      if (node->leaf_)
+        break;
+      node = node->children_[pos];
+    }
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::split_child_i (NODE *parent,
+                                                                                  size_t i)
+{
+  size_t const t = NODE::MIN_DEGREE;
+  NODE *const y = parent->children_[i];
+  NODE *const z = this->make_node_i (y->leaf_);
+  if (z == 0)
+    return -1;
+
+  // The upper half of y goes to z, its median to the parent.
+  z->count_ = t - 1;
+  ACE_OS::memcpy (z->entries_, y->entries_ + t, (t - 1) * sizeof (ENTRY *));
+  if (!y->leaf_)
+    {
+      ACE_OS::memcpy (z->children_, y->children_ + t, t * sizeof (NODE *));
+      this->adopt_i (z, 0, t - 1);
+    }
+  y->count_ = t - 1;
+
+  size_t const n = parent->count_;
+  ACE_OS::memmove (parent->children_ + i + 2,
+                   parent->children_ + i + 1,
+                   (n - i) * sizeof (NODE *));
+  ACE_OS::memmove (parent->entries_ + i + 1,
+                   parent->entries_ + i,
+                   (n - i) * sizeof (ENTRY *));
+  ACE_OS::memmove (parent->heads_ + i + 1,
+                   parent->heads_ + i,
+                   (n - i) * sizeof (ACE_UINT64));
+  parent->children_[i + 1] = z;
+  parent->entries_[i] = y->entries_[t - 1];
+  ++parent->count_;
+  this->adopt_i (parent, i + 1, parent->count_);
+
+  // Both halves cover a narrower range of keys, they may share a
+  // longer prefix.
+  this->rebuild_i (y);
+  this->rebuild_i (z);
+  this->place_i (parent, i);
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::insert_i (const EXT_ID &k,
+                                                                             const INT_ID &t,
+                                                                             ENTRY *&entry)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::insert_i");
+
+  if (this->root_ == 0)
+    {
+      this->root_ = this->make_node_i (true);
+      if (this->root_ == 0)
+        return -1;
+    }
+
+  // Full nodes are split on the way down, so that there is always
+  // room in the parent for the median of a split.
+  if (this->root_->count_ == NODE::MAX_KEYS)
+    {
+      NODE *const root = this->make_node_i (false);
+      if (root == 0)
+        return -1;
+
+      root->children_[0] = this->root_;
+      this->adopt_i (root, 0, 0);
+      this->root_ = root;
+      if (this->split_child_i (root, 0) == -1)
+        {
+          this->root_ = root->children_[0];
+          this->root_->parent_ = 0;
+          this->free_node_i (root);
+          return -1;
+        }
+    }
+
+  NODE *node = this->root_;
+  for (;;)
+    {
+      bool found = false;
+      size_t pos = this->search_i (node, k, found);
+      if (found)
+        {
+          entry = node->entries_[pos];
+          return 1;
+        }
+
+      if (node->leaf_)
+        {
+          ENTRY *new_entry = 0;
+          ACE_NEW_MALLOC_RETURN (new_entry,
+                                 static_cast<ENTRY *> (this->allocator_->malloc (sizeof (ENTRY))),
+                                 ENTRY (k, t),
+                                 -1);
+
+          size_t const rest = node->count_ - pos;
+          ACE_OS::memmove (node->entries_ + pos + 1,
+                           node->entries_ + pos,
+                           rest * sizeof (ENTRY *));
+          ACE_OS::memmove (node->heads_ + pos + 1,
+                           node->heads_ + pos,
+                           rest * sizeof (ACE_UINT64));
+          node->entries_[pos] = new_entry;
+          ++node->count_;
+          this->place_i (node, pos);
+
+          ++this->cur_size_;
+          entry = new_entry;
+          return 0;
+        }
+
+      if (node->children_[pos]->count_ == NODE::MAX_KEYS)
+        {
+          if (this->split_child_i (node, pos) == -1)
+            return -1;
+
+          const EXT_ID &median = node->entries_[pos]->ext_id_;
+          if (this->lessthan (median, k))
+            ++pos;
+          else if (!this->lessthan (k, median))
+            {
+              entry = node->entries_[pos];
+              return 1;
+            }
+        }
+      node = node->children_[pos];
+    }
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_BTree_Map_Node<EXT_ID, INT_ID> *
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::merge_i (NODE *parent,
+                                                                            size_t i)
+{
+  NODE *const y = parent->children_[i];
+  NODE *const z = parent->children_[i + 1];
+
+  y->entries_[y->count_] = parent->entries_[i];
+  ACE_OS::memcpy (y->entries_ + y->count_ + 1,
+                  z->entries_,
+                  z->count_ * sizeof (ENTRY *));
+  if (!y->leaf_)
+    {
+      ACE_OS::memcpy (y->children_ + y->count_ + 1,
+                      z->children_,
+                      (z->count_ + 1) * sizeof (NODE *));
+      this->adopt_i (y, y->count_ + 1, y->count_ + 1 + z->count_);
+    }
+  y->count_ += 1 + z->count_;
+
+  size_t const rest = parent->count_ - i - 1;
+  ACE_OS::memmove (parent->entries_ + i,
+                   parent->entries_ + i + 1,
+                   rest * sizeof (ENTRY *));
+  ACE_OS::memmove (parent->heads_ + i,
+                   parent->heads_ + i + 1,
+                   rest * sizeof (ACE_UINT64));
+  ACE_OS::memmove (parent->children_ + i + 1,
+                   parent->children_ + i + 2,
+                   rest * sizeof (NODE *));
+  --parent->count_;
+  if (rest != 0)
+    this->adopt_i (parent, i + 1, parent->count_);
+
+  this->free_node_i (z);
+  this->rebuild_i (y);
+  return y;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_BTree_Map_Node<EXT_ID, INT_ID> *
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::fill_i (NODE *parent,
+                                                                           size_t i)
+{
+  NODE *const c = parent->children_[i];
+
+  if (i > 0 && parent->children_[i - 1]->count_ >= static_cast<size_t> (NODE::MIN_DEGREE))
+    {
+      // Rotate the last key of the left sibling through the parent.
+      NODE *const left = parent->children_[i - 1];
+      ACE_OS::memmove (c->entries_ + 1, c->entries_, c->count_ * sizeof (ENTRY *));
+      ACE_OS::memmove (c->heads_ + 1, c->heads_, c->count_ * sizeof (ACE_UINT64));
+      c->entries_[0] = parent->entries_[i - 1];
+      if (!c->leaf_)
+        {
+          ACE_OS::memmove (c->children_ + 1,
+                           c->children_,
+                           (c->count_ + 1) * sizeof (NODE *));
+          c->children_[0] = left->children_[left->count_];
+        }
+      ++c->count_;
+      if (!c->leaf_)
+        this->adopt_i (c, 0, c->count_);
+
+      parent->entries_[i - 1] = left->entries_[left->count_ - 1];
+      --left->count_;
+
+      // c may now receive keys from a wider range.
+      this->rebuild_i (c);
+      this->place_i (parent, i - 1);
+      return c;
+    }
+
+  if (i < parent->count_
+      && parent->children_[i + 1]->count_ >= static_cast<size_t> (NODE::MIN_DEGREE))
+    {
+      // Rotate the first key of the right sibling through the parent.
+      NODE *const right = parent->children_[i + 1];
+      c->entries_[c->count_] = parent->entries_[i];
+      if (!c->leaf_)
+        c->children_[c->count_ + 1] = right->children_[0];
+      ++c->count_;
+      if (!c->leaf_)
+        this->adopt_i (c, c->count_, c->count_);
+
+      parent->entries_[i] = right->entries_[0];
+      ACE_OS::memmove (right->entries_,
+                       right->entries_ + 1,
+                       (right->count_ - 1) * sizeof (ENTRY *));
+      ACE_OS::memmove (right->heads_,
+                       right->heads_ + 1,
+                       (right->count_ - 1) * sizeof (ACE_UINT64));
+      if (!right->leaf_)
+        ACE_OS::memmove (right->children_,
+                         right->children_ + 1,
+                         right->count_ * sizeof (NODE *));
+      --right->count_;
+      if (!right->leaf_)
+        this->adopt_i (right, 0, right->count_);
+
+      this->rebuild_i (c);
+      this->place_i (parent, i);
+      return c;
+    }
+
+  return i < parent->count_ ? this->merge_i (parent, i) : this->merge_i (parent, i - 1);
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_BTree_Map_Entry<EXT_ID, INT_ID> *
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::remove_i (const EXT_ID &k)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::remove_i");
+
+  if (this->root_ == 0)
+    return 0;
+
+  ENTRY *const entry = this->remove_i (this->root_, k, REMOVE_KEY);
+
+  // A merge of the two children of the root leaves it empty, the tree
+  // gets one level shorter.
+  if (this->root_->count_ == 0 && !this->root_->leaf_)
+    {
+      NODE *const root = this->root_;
+      this->root_ = root->children_[0];
+      this->root_->parent_ = 0;
+      this->root_->index_ = 0;
+      this->free_node_i (root);
+      this->rebuild_i (this->root_);
+    }
+
+  if (entry != 0)
+    --this->cur_size_;
+  return entry;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_BTree_Map_Entry<EXT_ID, INT_ID> *
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::remove_i (NODE *node,
+                                                                             const EXT_ID &k,
+                                                                             Remove_Mode mode)
+{
+  // Every node we go down into is first given at least MIN_DEGREE
+  // keys, so that removing one never needs to walk back up.
+  for (NODE *x = node; ; )
+    {
+      bool found = false;
+      size_t pos = 0;
+      if (mode == REMOVE_KEY)
+        pos = this->search_i (x, k, found);
+      else
+        {
+          found = x->leaf_;
+          if (mode == REMOVE_MAX)
+            pos = x->leaf_ ? x->count_ - 1 : x->count_;
+        }
+
+      if (x->leaf_)
+        {
+          if (!found)
+            return 0;
+
+          ENTRY *const entry = x->entries_[pos];
+          size_t const rest = x->count_ - pos - 1;
+          ACE_OS::memmove (x->entries_ + pos,
+                           x->entries_ + pos + 1,
+                           rest * sizeof (ENTRY *));
+          ACE_OS::memmove (x->heads_ + pos,
+                           x->heads_ + pos + 1,
+                           rest * sizeof (ACE_UINT64));
+          --x->count_;
+          return entry;
+        }
+
+      if (found)
+        {
+          // Replace the key by its predecessor or successor if a child
+          // can spare one, otherwise merge both children around it and
+          // carry on from there.
+          ENTRY *const entry = x->entries_[pos];
+          if (x->children_[pos]->count_ >= static_cast<size_t> (NODE::MIN_DEGREE))
+            {
+              x->entries_[pos] = this->remove_i (x->children_[pos], k, REMOVE_MAX);
+              this->place_i (x, pos);
+
+              // The separator moved left, the leftmost nodes of the
+              // right subtree receive keys from a wider range.
+              for (NODE *n = x->children_[pos + 1]; ; n = n->children_[0])
+                {
+                  this->rebuild_i (n);
+                  if (n->leaf_)
+                    break;
+                }
+              return entry;
+            }
+          if (x->children_[pos + 1]->count_ >= static_cast<size_t> (NODE::MIN_DEGREE))
+            {
+              x->entries_[pos] = this->remove_i (x->children_[pos + 1], k, REMOVE_MIN);
+              this->place_i (x, pos);
+
+              for (NODE *n = x->children_[pos]; ; n = n->children_[n->count_])
+                {
+                  this->rebuild_i (n);
+                  if (n->leaf_)
+                    break;
+                }
+              return entry;
+            }
+          x = this->merge_i (x, pos);
+          continue;
+        }
+
+      NODE *child = x->children_[pos];
+      if (child->count_ < static_cast<size_t> (NODE::MIN_DEGREE))
+        child = this->fill_i (x, pos);
+      x = child;
+    }
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::lower_bound (const EXT_ID &ext_id)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::lower_bound");
+  ACE_READ_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, ITERATOR ());
+
+  // The last greater key seen on the way down is the answer unless a
+  // leaf holds a closer one.
+  NODE *bound = 0;
+  size_t bound_pos = 0;
+  for (NODE *node = this->root_; node != 0; )
+    {
+      bool found = false;
+      size_t const pos = this->search_i (node, ext_id, found);
+      if (found)
+        return ITERATOR (node, pos);
+      if (pos < node->count_)
+        {
+          bound = node;
+          bound_pos = pos;
+        }
+      if (node->leaf_)
+        break;
+      node = node->children_[pos];
+    }
+  return ITERATOR (bound, bound_pos);
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::upper_bound (const EXT_ID &ext_id)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::upper_bound");
+
+  ITERATOR iter = this->lower_bound (ext_id);
+  if (!iter.done () && !this->lessthan (ext_id, iter->ext_id_))
+    ++iter;
+  return iter;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::test_invariant (void)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::test_invariant");
+  ACE_READ_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  if (this->root_ == 0)
+    return this->cur_size_ == 0 ? 0 : -1;
+
+  int leaf_depth = -1;
+  if (this->root_->parent_ != 0
+      || this->test_invariant_i (this->root_, 0, 0, 0, leaf_depth) == -1)
+    return -1;
+
+  // The iteration has to see every entry once, in increasing order.
+  size_t count = 0;
+  ENTRY *previous = 0;
+  for (ITERATOR iter (*this); !iter.done (); ++iter, ++count)
+    {
+      if (previous != 0 && !this->lessthan (previous->ext_id_, iter->ext_id_))
+        {
+          ACELIB_ERROR_RETURN ((LM_ERROR,
+                                ACE_TEXT ("ACE_BTree_Map::test_invariant: ")
+                                ACE_TEXT ("keys out of order\n")),
+                               -1);
+        }
+      previous = &*iter;
+    }
+
+  if (count != this->cur_size_)
+    ACELIB_ERROR_RETURN ((LM_ERROR,
+                          ACE_TEXT ("ACE_BTree_Map::test_invariant: ")
+                          ACE_TEXT ("%B entries iterated, size is %B\n"),
+                          count,
+                          this->cur_size_),
+                         -1);
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::test_invariant_i (NODE *node,
+                                                                                     NODE *parent,
+                                                                                     size_t index,
+                                                                                     int depth,
+                                                                                     int &leaf_depth)
+{
+  if (node->parent_ != parent || node->index_ != index
+      || node->count_ > static_cast<size_t> (NODE::MAX_KEYS)
+      || (parent != 0 && node->count_ < static_cast<size_t> (NODE::MIN_DEGREE - 1)))
+    ACELIB_ERROR_RETURN ((LM_ERROR,
+                          ACE_TEXT ("ACE_BTree_Map::test_invariant: bad node ")
+                          ACE_TEXT ("with %B keys at depth %d\n"),
+                          node->count_,
+                          depth),
+                         -1);
+
+  for (size_t i = 0; i < node->count_; ++i)
+    {
+      const EXT_ID &key = node->entries_[i]->ext_id_;
+      if (node->prefix_ > this->fence_prefix_i (node)
+          || node->heads_[i] != this->key_prefix_.head (key, node->prefix_))
+        ACELIB_ERROR_RETURN ((LM_ERROR,
+                              ACE_TEXT ("ACE_BTree_Map::test_invariant: ")
+                              ACE_TEXT ("stale head at depth %d\n"),
+                              depth),
+                             -1);
+    }
+
+  if (node->leaf_)
+    {
+      if (leaf_depth == -1)
+        leaf_depth = depth;
+      else if (leaf_depth != depth)
+        ACELIB_ERROR_RETURN ((LM_ERROR,
+                              ACE_TEXT ("ACE_BTree_Map::test_invariant: ")
+                              ACE_TEXT ("leaves at depth %d and %d\n"),
+                              leaf_depth,
+                              depth),
+                             -1);
+      return 0;
+    }
+
+  for (size_t i = 0; i <= node->count_; ++i)
+    if (this->test_invariant_i (node->children_[i], node, i, depth + 1, leaf_depth) == -1)
+      return -1;
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> void
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::dump (void) const
+{
+#if defined (ACE_HAS_DUMP)
+  ACELIB_DEBUG ((LM_DEBUG, ACE_BEGIN_DUMP, this));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_TEXT ("root_ = %@\n"), this->root_));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_TEXT ("cur_size_ = %B\n"), this->cur_size_));
+  this->lock_.dump ();
+  ACELIB_DEBUG ((LM_DEBUG, ACE_END_DUMP));
+#endif /* ACE_HAS_DUMP */
+}
+
+// ---
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> void
+ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::forward_i (void)
+{
+  NODE *node = this->node_;
+  if (node == 0)
+    return;
+
+  if (!node->leaf_)
+    {
+      // The next key is the first one of the subtree on its right.
+      node = node->children_[this->index_ + 1];
+      while (!node->leaf_)
+        node = node->children_[0];
+      this->node_ = node;
+      this->index_ = 0;
+      return;
+    }
+
+  if (this->index_ + 1 < node->count_)
+    {
+      ++this->index_;
+      return;
+    }
+
+  // Climb while we come from the last subtree of the parent.
+  while (node->parent_ != 0 && node->index_ == node->parent_->count_)
+    node = node->parent_;
+
+  this->index_ = node->index_;
+  this->node_ = node->parent_;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> void
+ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::reverse_i (void)
+{
+  NODE *node = this->node_;
+  if (node == 0)
+    return;
+
+  if (!node->leaf_)
+    {
+      // The previous key is the last one of the subtree on its left.
+      node = node->children_[this->index_];
+      while (!node->leaf_)
+        node = node->children_[node->count_];
+      this->node_ = node;
+      this->index_ = node->count_ - 1;
+      return;
+    }
+
+  if (this->index_ > 0)
+    {
+      --this->index_;
+      return;
+    }
+
+  // Climb while we come from the first subtree of the parent.
+  while (node->parent_ != 0 && node->index_ == 0)
+    node = node->parent_;
+
+  if (node->parent_ == 0)
+    {
+      this->node_ = 0;
+      this->index_ = 0;
+      return;
+    }
+
+  this->index_ = node->index_ - 1;
+  this->node_ = node->parent_;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> void
+ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::dump_i (void) const
+{
+#if defined (ACE_HAS_DUMP)
+  ACELIB_DEBUG ((LM_DEBUG, ACE_BEGIN_DUMP, this));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_TEXT ("node_ = %@, index_ = %B\n"),
+                 this->node_, this->index_));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_END_DUMP));
+#endif /* ACE_HAS_DUMP */
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::ACE_BTree_Map_Iterator (ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> &map)
+{
+  NODE *node = map.root_;
+  if (node == 0 || node->count_ == 0)
+    return;
+
+  while (!node->leaf_)
+    node = node->children_[0];
+  this->node_ = node;
+  this->index_ = 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> void
+ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::dump (void) const
+{
+#if defined (ACE_HAS_DUMP)
+  this->dump_i ();
+#endif /* ACE_HAS_DUMP */
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::ACE_BTree_Map_Reverse_Iterator (ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> &map)
+{
+  NODE *node = map.root_;
+  if (node == 0 || node->count_ == 0)
+    return;
+
+  while (!node->leaf_)
+    node = node->children_[node->count_];
+  this->node_ = node;
+  this->index_ = node->count_ - 1;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> void
+ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::dump (void) const
+{
+#if defined (ACE_HAS_DUMP)
+  this->dump_i ();
+#endif /* ACE_HAS_DUMP */
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* ACE_BTREE_MAP_T_CPP */
@@ -0,0 +1,579 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    BTree_Map_T.h
+ *
+ *  Ordered map kept in a B-tree with wide nodes, an alternative to
+ *  ACE_RB_Tree when lookups dominate.
+ */
+//=============================================================================
+
+#ifndef ACE_BTREE_MAP_T_H
+#define ACE_BTREE_MAP_T_H
+#include /**/ "ace/pre.h"
+
+#include /**/ "ace/config-all.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/Basic_Types.h"
+#include "ace/Log_Category.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class ACE_Allocator;
+
+/**
+ * @class ACE_BTree_Map_Entry
+ *
+ * @brief An entry of ACE_BTree_Map.
+ *
+ * Entries are allocated once and never move, the nodes of the tree
+ * only hold pointers to them.  A pointer to an entry therefore stays
+ * valid until that entry is unbound, as with ACE_RB_Tree.
+ */
+template <class EXT_ID, class INT_ID>
+class ACE_BTree_Map_Entry
+{
+public:
+  ACE_BTree_Map_Entry (const EXT_ID &ext_id, const INT_ID &int_id);
+
+  /// Key accessor.
+  EXT_ID &key (void);
+
+  /// Item accessor.
+  INT_ID &item (void);
+
+  /// Dump the state of an object.
+  void dump (void) const;
+
+  /// Key used to look up an entry.
+  EXT_ID ext_id_;
+
+  /// The contents of the entry itself.
+  INT_ID int_id_;
+};
+
+/**
+ * @class ACE_BTree_Map_Node
+ *
+ * @brief A node of ACE_BTree_Map.
+ *
+ * Besides the entry pointers each node keeps a 64 bit "head" per
+ * key, see ACE_BTree_Map_No_Prefix, so that the search inside a node
+ * is a binary search over one contiguous array that only touches an
+ * entry when two heads are equal.
+ */
+template <class EXT_ID, class INT_ID>
+class ACE_BTree_Map_Node
+{
+public:
+  enum
+  {
+    /// Minimum degree of the tree, every node but the root holds at
+    /// least MIN_DEGREE - 1 keys.
+    MIN_DEGREE = 16,
+    /// Maximum number of keys in a node.
+    MAX_KEYS = 2 * MIN_DEGREE - 1
+  };
+
+  explicit ACE_BTree_Map_Node (bool leaf);
+
+  /// Number of keys in the node.
+  size_t count_;
+
+  /// Whether the node has no children.
+  bool leaf_;
+
+  /// Number of leading key units shared by all the keys that can be
+  /// routed to the node, i.e. those between the separators bounding
+  /// it in its ancestors.  The heads are computed past them.
+  size_t prefix_;
+
+  /// Parent of the node, 0 for the root.
+  ACE_BTree_Map_Node<EXT_ID, INT_ID> *parent_;
+
+  /// Position of the node in the children of its parent.
+  size_t index_;
+
+  /// Heads of the keys, in key order.
+  ACE_UINT64 heads_[MAX_KEYS];
+
+  /// The entries, in key order.
+  ACE_BTree_Map_Entry<EXT_ID, INT_ID> *entries_[MAX_KEYS];
+
+  /// Subtrees, children_[i] holds the keys less than entries_[i].
+  ACE_BTree_Map_Node<EXT_ID, INT_ID> *children_[MAX_KEYS + 1];
+};
+
+/**
+ * @class ACE_BTree_Map_No_Prefix
+ *
+ * @brief Default key prefix policy of ACE_BTree_Map, does no prefix
+ * compression at all.
+ *
+ * A key prefix policy lets ACE_BTree_Map compare keys without
+ * touching them.  It sees a key as a sequence of units (bytes for
+ * an octet sequence) whose lexicographic order is the order of
+ * COMPARE_KEYS, and provides:
+ *
+ * - <common (a, b)>, the number of leading units @a a and @a b
+ *   share.
+ * - <head (k, skip)>, an unsigned 64 bit summary of the units of @a k
+ *   following the first @a skip ones.  For two keys sharing their
+ *   first @a skip units a smaller head must mean a smaller key and
+ *   equal keys must have equal heads.
+ * - <exact ()>, true when equal heads also mean equal keys, the map
+ *   then never looks at the keys themselves.
+ *
+ * Each node skips the prefix shared by all its keys, so keys with a
+ * long common prefix, like the object keys of one POA, are told
+ * apart by their heads alone.  This policy returns the same head for
+ * all keys, every comparison then goes through COMPARE_KEYS.
+ */
+template <class EXT_ID>
+class ACE_BTree_Map_No_Prefix
+{
+public:
+  size_t common (const EXT_ID &, const EXT_ID &) const { return 0; }
+  ACE_UINT64 head (const EXT_ID &, size_t) const { return 0; }
+  bool exact (void) const { return false; }
+};
+
+/**
+ * @class ACE_BTree_Map_Integer_Prefix
+ *
+ * @brief Key prefix policy for integer keys of up to 64 bits ordered
+ * by ACE_Less_Than.
+ *
+ * The head is the key itself, the search in a node never leaves the
+ * node.
+ */
+template <class EXT_ID>
+class ACE_BTree_Map_Integer_Prefix
+{
+public:
+  size_t common (const EXT_ID &, const EXT_ID &) const { return 0; }
+  ACE_UINT64 head (const EXT_ID &k, size_t) const
+  {
+    // Flip the sign bit of signed keys so that negative ones come
+    // first.
+    return static_cast<ACE_UINT64> (static_cast<ACE_INT64> (k))
+      ^ (static_cast<EXT_ID> (-1) < static_cast<EXT_ID> (0)
+         ? ACE_UINT64_LITERAL (0x8000000000000000)
+         : 0);
+  }
+  bool exact (void) const { return true; }
+};
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK,
+          class KEY_PREFIX>
+class ACE_BTree_Map_Iterator;
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK,
+          class KEY_PREFIX>
+class ACE_BTree_Map_Reverse_Iterator;
+
+/**
+ * @class ACE_BTree_Map
+ *
+ * @brief An ordered map kept in a B-tree.
+ *
+ * Each node holds up to 31 keys in arrays, a lookup in a map of a
+ * million entries visits four or five nodes instead of the twenty
+ * or so nodes ACE_RB_Tree chases, and the search inside a node reads
+ * contiguous memory.  The interface follows ACE_RB_Tree so that one
+ * can replace the other through a typedef; in addition lower_bound()
+ * and upper_bound() return iterators for range scans.
+ *
+ * The extra comparisons within a node cost more than they save for
+ * now: BTree_Map_Test binds and finds faster with ACE_RB_Tree, the
+ * B-tree only pulls ahead on keys sharing long prefixes.
+ *
+ * Unlike ACE_RB_Tree, binding or unbinding an entry invalidates the
+ * iterators of the map, although the entries themselves never move.
+ *
+ * <EXT_ID> and <INT_ID> must be copy constructible, COMPARE_KEYS is
+ * a strict weak ordering as for ACE_RB_Tree and KEY_PREFIX is a key
+ * prefix policy as described for ACE_BTree_Map_No_Prefix.
+ */
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK,
+          class KEY_PREFIX = ACE_BTree_Map_No_Prefix<EXT_ID> >
+class ACE_BTree_Map
+{
+public:
+  friend class ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>;
+  friend class ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>;
+
+  typedef EXT_ID KEY;
+  typedef INT_ID VALUE;
+  typedef ACE_LOCK lock_type;
+  typedef ACE_BTree_Map_Entry<EXT_ID, INT_ID> ENTRY;
+  typedef ACE_BTree_Map_Node<EXT_ID, INT_ID> NODE;
+
+  // = ACE-style iterator typedefs.
+  typedef ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> ITERATOR;
+  typedef ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> REVERSE_ITERATOR;
+
+  // = STL-style iterator typedefs.
+  typedef ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> iterator;
+  typedef ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> reverse_iterator;
+
+  // = Initialization and termination methods.
+
+  /// Constructor.
+  ACE_BTree_Map (ACE_Allocator *alloc = 0);
+
+  /// Initialize the map, frees the current entries if any.
+  int open (ACE_Allocator *alloc = 0);
+
+  /// Unbind all the entries and release the memory of the map.
+  int close (void);
+
+  /// Destructor.
+  ~ACE_BTree_Map (void);
+
+  // = Insertion, removal and search methods.
+
+  /**
+   * Associate @a ext_id with @a int_id.  If @a ext_id is already in
+   * the map it is not changed.  Returns 0 if a new entry is bound
+   * successfully, returns 1 if an attempt is made to bind an existing
+   * entry, and returns -1 if failures occur.
+   */
+  int bind (const EXT_ID &ext_id, const INT_ID &int_id);
+
+  /// Same as a normal bind, except the map entry is also passed back
+  /// to the caller, either the new one or the existing one.
+  int bind (const EXT_ID &ext_id, const INT_ID &int_id, ENTRY *&entry);
+
+  /**
+   * Same as bind() except that if @a ext_id is already in the map
+   * then @a int_id is overwritten with the existing value.  Returns 0
+   * if a new entry is bound successfully, 1 if an existing entry was
+   * found and -1 if failures occur.
+   */
+  int trybind (const EXT_ID &ext_id, INT_ID &int_id);
+
+  /**
+   * Reassociate @a ext_id with @a int_id.  If @a ext_id is not in the
+   * map then behaves just like bind().  Returns 0 if a new entry is
+   * bound successfully, 1 if an existing entry was rebound and -1 if
+   * failures occur.
+   */
+  int rebind (const EXT_ID &ext_id, const INT_ID &int_id);
+
+  /// Same as above, also passes back the previous value of @a ext_id
+  /// in @a old_int_id.
+  int rebind (const EXT_ID &ext_id,
+              const INT_ID &int_id,
+              INT_ID &old_int_id);
+
+  /// Returns 0 if @a ext_id is in the map, otherwise -1.
+  int find (const EXT_ID &ext_id);
+
+  /// Locate @a ext_id and pass out its value.  Returns 0 if found,
+  /// -1 if not.
+  int find (const EXT_ID &ext_id, INT_ID &int_id);
+
+  /// Locate @a ext_id and pass out its entry.  Returns 0 if found,
+  /// -1 if not.
+  int find (const EXT_ID &ext_id, ENTRY *&entry);
+
+  /// Unbind @a ext_id.  Returns 0 if successful, -1 if not found.
+  int unbind (const EXT_ID &ext_id);
+
+  /// Unbind @a ext_id and pass out its value.  Returns 0 if
+  /// successful, -1 if not found.
+  int unbind (const EXT_ID &ext_id, INT_ID &int_id);
+
+  /// Remove @a entry from the map.  Returns 0 if successful, -1 if
+  /// the entry is not in the map.
+  int unbind (ENTRY *entry);
+
+  /// Returns the current number of entries in the map.
+  size_t current_size (void) const;
+
+  /// Returns a reference to the underlying lock.
+  ACE_LOCK &mutex (void);
+
+  /// Dump the state of an object.
+  void dump (void) const;
+
+  // = Iteration, in key order.
+
+  /// Iterator positioned on the first entry.
+  ITERATOR begin (void);
+
+  /// Iterator positioned past the last entry.
+  ITERATOR end (void);
+
+  /// Reverse iterator positioned on the last entry.
+  REVERSE_ITERATOR rbegin (void);
+
+  /// Reverse iterator positioned before the first entry.
+  REVERSE_ITERATOR rend (void);
+
+  /// Iterator positioned on the first entry whose key is not less
+  /// than @a ext_id.
+  ITERATOR lower_bound (const EXT_ID &ext_id);
+
+  /// Iterator positioned on the first entry whose key is greater than
+  /// @a ext_id.
+  ITERATOR upper_bound (const EXT_ID &ext_id);
+
+  /// Checks the ordering, fill and linking of all the nodes, returns
+  /// 0 if the tree is sound and -1 otherwise.
+  int test_invariant (void);
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+
+protected:
+  /// Less than comparison of two keys.
+  bool lessthan (const EXT_ID &k1, const EXT_ID &k2);
+
+  /// Returns the position of the first key of @a node not less than
+  /// @a k, sets @a found if that key is equal to @a k.
+  size_t search_i (NODE *node, const EXT_ID &k, bool &found);
+
+  /// Finds the entry of @a k, returns 0 if there is none.
+  ENTRY *find_i (const EXT_ID &k);
+
+  /// Insert @a k and @a t unless @a k is already in the map, @a entry
+  /// is set to the entry of @a k.  Returns 0, 1 or -1 as bind().
+  int insert_i (const EXT_ID &k, const INT_ID &t, ENTRY *&entry);
+
+  /// Removes @a k from the map and returns its entry, 0 if @a k is
+  /// not in the map.  The entry has to be freed by the caller.
+  ENTRY *remove_i (const EXT_ID &k);
+
+  /// Frees @a entry.
+  void free_entry_i (ENTRY *entry);
+
+  /// Frees @a node and all its subtrees, with the entries.
+  void close_i (NODE *node);
+
+private:
+  enum Remove_Mode
+  {
+    REMOVE_KEY,
+    REMOVE_MIN,
+    REMOVE_MAX
+  };
+
+  /// Removes the key or the extreme entry the mode designates from
+  /// the subtree of @a node.  @a node must have at least MIN_DEGREE
+  /// keys unless it is the root.
+  ENTRY *remove_i (NODE *node, const EXT_ID &k, Remove_Mode mode);
+
+  /// Allocates a node, returns 0 on failure.
+  NODE *make_node_i (bool leaf);
+
+  /// Frees @a node alone.
+  void free_node_i (NODE *node);
+
+  /// Splits the full child @a i of @a parent, the median key moves up
+  /// into @a parent.
+  int split_child_i (NODE *parent, size_t i);
+
+  /// Merges the children @a i and @a i + 1 of @a parent around the key
+  /// @a i of @a parent, returns the merged node.
+  NODE *merge_i (NODE *parent, size_t i);
+
+  /// Makes sure child @a i of @a parent has at least MIN_DEGREE keys,
+  /// either by moving a key from a sibling or by merging with one.
+  /// Returns the node holding the keys of that child afterwards.
+  NODE *fill_i (NODE *parent, size_t i);
+
+  /// Returns the number of key units shared by all the keys that can
+  /// be routed to @a node.
+  size_t fence_prefix_i (NODE *node);
+
+  /// Recomputes the prefix and all the heads of @a node, after the
+  /// range of keys routed to it changed.
+  void rebuild_i (NODE *node);
+
+  /// Sets the head of the key at @a pos in @a node.
+  void place_i (NODE *node, size_t pos);
+
+  /// Sets the parent links of the children [@a from, @a to] of
+  /// @a node.
+  void adopt_i (NODE *node, size_t from, size_t to);
+
+  /// Checks the subtree of @a node for test_invariant().
+  int test_invariant_i (NODE *node, NODE *parent, size_t index,
+                        int depth, int &leaf_depth);
+
+  /// The root of the tree, 0 until the first bind.
+  NODE *root_;
+
+  /// The number of entries in the map.
+  size_t cur_size_;
+
+  /// Allocator of the nodes and of the entries.
+  ACE_Allocator *allocator_;
+
+  /// Synchronization variable for the map.
+  ACE_LOCK lock_;
+
+  /// Key ordering.
+  COMPARE_KEYS compare_keys_;
+
+  /// Key prefix policy.
+  KEY_PREFIX key_prefix_;
+
+  // = Disallow these operations.
+  ACE_UNIMPLEMENTED_FUNC (ACE_BTree_Map (const ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> &))
+  ACE_UNIMPLEMENTED_FUNC (void operator= (const ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> &))
+};
+
+/**
+ * @class ACE_BTree_Map_Iterator_Base
+ *
+ * @brief Common position handling of the ACE_BTree_Map iterators.
+ *
+ * An iterator is a node and a key position in that node, stepping to
+ * the next key goes down to the leftmost leaf of the next subtree or
+ * up through the parent links.  Iterators are invalidated by any
+ * bind or unbind.
+ */
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK,
+          class KEY_PREFIX>
+class ACE_BTree_Map_Iterator_Base
+{
+public:
+  typedef ACE_BTree_Map_Entry<EXT_ID, INT_ID> ENTRY;
+  typedef ACE_BTree_Map_Node<EXT_ID, INT_ID> NODE;
+
+  /// Returns 1 when the iteration has completed, otherwise 0.
+  int done (void) const;
+
+  /// Pass back the entry the iterator is positioned on, returns 0 if
+  /// the iteration has completed.
+  int next (ENTRY *&next_entry) const;
+
+  /// STL-like iterator dereference operator.
+  ENTRY &operator* (void) const;
+
+  /// STL-like iterator dereference operator.
+  ENTRY *operator-> (void) const;
+
+  /// Comparison operators.
+  bool operator== (const ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> &) const;
+  bool operator!= (const ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> &) const;
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+
+protected:
+  /// Iterator positioned on the key @a index of @a node, a null
+  /// @a node stands for the end of the iteration.
+  ACE_BTree_Map_Iterator_Base (NODE *node = 0, size_t index = 0);
+
+  /// Move to the next key in key order.
+  void forward_i (void);
+
+  /// Move to the previous key in key order.
+  void reverse_i (void);
+
+  /// Dump the state of an object.
+  void dump_i (void) const;
+
+  /// Node the iterator is positioned in.
+  NODE *node_;
+
+  /// Position in @c node_.
+  size_t index_;
+};
+
+/**
+ * @class ACE_BTree_Map_Iterator
+ *
+ * @brief Forward iterator for ACE_BTree_Map.
+ */
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK,
+          class KEY_PREFIX>
+class ACE_BTree_Map_Iterator
+  : public ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>
+{
+public:
+  typedef ACE_BTree_Map_Node<EXT_ID, INT_ID> NODE;
+
+  /// Iterator positioned past the last entry.
+  ACE_BTree_Map_Iterator (void);
+
+  /// Iterator positioned on the first entry of @a map.
+  ACE_BTree_Map_Iterator (ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> &map);
+
+  /// Iterator positioned on key @a index of @a node.
+  ACE_BTree_Map_Iterator (NODE *node, size_t index);
+
+  /// Move forward by one element, returns 0 when the iteration has
+  /// completed.
+  int advance (void);
+
+  /// Dump the state of an object.
+  void dump (void) const;
+
+  // = STL styled iteration.
+  ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> &operator++ (void);
+  ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> operator++ (int);
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+};
+
+/**
+ * @class ACE_BTree_Map_Reverse_Iterator
+ *
+ * @brief Reverse iterator for ACE_BTree_Map.
+ */
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK,
+          class KEY_PREFIX>
+class ACE_BTree_Map_Reverse_Iterator
+  : public ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>
+{
+public:
+  typedef ACE_BTree_Map_Node<EXT_ID, INT_ID> NODE;
+
+  /// Iterator positioned before the first entry.
+  ACE_BTree_Map_Reverse_Iterator (void);
+
+  /// Iterator positioned on the last entry of @a map.
+  ACE_BTree_Map_Reverse_Iterator (ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> &map);
+
+  /// Move backward by one element, returns 0 when the iteration has
+  /// completed.
+  int advance (void);
+
+  /// Dump the state of an object.
+  void dump (void) const;
+
+  // = STL styled iteration.
+  ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> &operator++ (void);
+  ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> operator++ (int);
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#if defined (__ACE_INLINE__)
+#  include "ace/BTree_Map_T.inl"
+#endif /* __ACE_INLINE__ */
+
+#if defined (ACE_TEMPLATES_REQUIRE_SOURCE)
+#include "ace/BTree_Map_T.cpp"
+#endif /* ACE_TEMPLATES_REQUIRE_SOURCE */
+
+#if defined (ACE_TEMPLATES_REQUIRE_PRAGMA)
+#pragma implementation ("BTree_Map_T.cpp")
+#endif /* ACE_TEMPLATES_REQUIRE_PRAGMA */
+
+#include /**/ "ace/post.h"
+#endif /* ACE_BTREE_MAP_T_H */
@@ -0,0 +1,356 @@
+// -*- C++ -*-
+#include "ace/Guard_T.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+template <class EXT_ID, class INT_ID> ACE_INLINE
+ACE_BTree_Map_Entry<EXT_ID, INT_ID>::ACE_BTree_Map_Entry (const EXT_ID &ext_id,
+                                                          const INT_ID &int_id)
+  : ext_id_ (ext_id),
+    int_id_ (int_id)
+{
+}
+
+template <class EXT_ID, class INT_ID> ACE_INLINE EXT_ID &
+ACE_BTree_Map_Entry<EXT_ID, INT_ID>::key (void)
+{
+  return this->ext_id_;
+}
+
+template <class EXT_ID, class INT_ID> ACE_INLINE INT_ID &
+ACE_BTree_Map_Entry<EXT_ID, INT_ID>::item (void)
+{
+  return this->int_id_;
+}
+
+template <class EXT_ID, class INT_ID> ACE_INLINE
+ACE_BTree_Map_Node<EXT_ID, INT_ID>::ACE_BTree_Map_Node (bool leaf)
+  : count_ (0),
+    leaf_ (leaf),
+    prefix_ (0),
+    parent_ (0),
+    index_ (0)
+{
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::~ACE_BTree_Map (void)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::~ACE_BTree_Map");
+  this->close ();
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::bind (const EXT_ID &ext_id,
+                                                                         const INT_ID &int_id)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::bind");
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  ENTRY *entry = 0;
+  return this->insert_i (ext_id, int_id, entry);
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::bind (const EXT_ID &ext_id,
+                                                                         const INT_ID &int_id,
+                                                                         ENTRY *&entry)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::bind");
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  return this->insert_i (ext_id, int_id, entry);
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::trybind (const EXT_ID &ext_id,
+                                                                            INT_ID &int_id)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::trybind");
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  ENTRY *entry = 0;
+  int const result = this->insert_i (ext_id, int_id, entry);
+  if (result == 1)
+    int_id = entry->int_id_;
+  return result;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::rebind (const EXT_ID &ext_id,
+                                                                           const INT_ID &int_id)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::rebind");
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  ENTRY *entry = 0;
+  int const result = this->insert_i (ext_id, int_id, entry);
+  if (result == 1)
+    entry->int_id_ = int_id;
+  return result;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::rebind (const EXT_ID &ext_id,
+                                                                           const INT_ID &int_id,
+                                                                           INT_ID &old_int_id)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::rebind");
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  ENTRY *entry = 0;
+  int const result = this->insert_i (ext_id, int_id, entry);
+  if (result == 1)
+    {
+      old_int_id = entry->int_id_;
+      entry->int_id_ = int_id;
+    }
+  return result;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::find (const EXT_ID &ext_id)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::find");
+  ACE_READ_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  return this->find_i (ext_id) == 0 ? -1 : 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::find (const EXT_ID &ext_id,
+                                                                         INT_ID &int_id)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::find");
+  ACE_READ_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  ENTRY *const entry = this->find_i (ext_id);
+  if (entry == 0)
+    return -1;
+
+  int_id = entry->int_id_;
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::find (const EXT_ID &ext_id,
+                                                                         ENTRY *&entry)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::find");
+  ACE_READ_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  entry = this->find_i (ext_id);
+  return entry == 0 ? -1 : 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::unbind (const EXT_ID &ext_id)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::unbind");
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  ENTRY *const entry = this->remove_i (ext_id);
+  if (entry == 0)
+    return -1;
+
+  this->free_entry_i (entry);
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::unbind (const EXT_ID &ext_id,
+                                                                           INT_ID &int_id)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::unbind");
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  ENTRY *const entry = this->remove_i (ext_id);
+  if (entry == 0)
+    return -1;
+
+  int_id = entry->int_id_;
+  this->free_entry_i (entry);
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::unbind (ENTRY *entry)
+{
+  ACE_TRACE ("ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::unbind");
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  // The key has to be found again to locate the node of the entry,
+  // check that it leads to this very entry.
+  if (this->find_i (entry->ext_id_) != entry)
+    return -1;
+
+  this->free_entry_i (this->remove_i (entry->ext_id_));
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE size_t
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::current_size (void) const
+{
+  return this->cur_size_;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE ACE_LOCK &
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::mutex (void)
+{
+  return this->lock_;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE bool
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::lessthan (const EXT_ID &k1,
+                                                                             const EXT_ID &k2)
+{
+  return this->compare_keys_ (k1, k2);
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_INLINE ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::begin (void)
+{
+  return ITERATOR (*this);
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_INLINE ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::end (void)
+{
+  return ITERATOR ();
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_INLINE ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::rbegin (void)
+{
+  return REVERSE_ITERATOR (*this);
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_INLINE ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>
+ACE_BTree_Map<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::rend (void)
+{
+  return REVERSE_ITERATOR ();
+}
+
+// ---
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE
+ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::ACE_BTree_Map_Iterator_Base (NODE *node,
+                                                                                                              size_t index)
+  : node_ (node),
+    index_ (index)
+{
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::done (void) const
+{
+  return this->node_ == 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::next (ENTRY *&next_entry) const
+{
+  if (this->node_ == 0)
+    return 0;
+
+  next_entry = this->node_->entries_[this->index_];
+  return 1;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_INLINE ACE_BTree_Map_Entry<EXT_ID, INT_ID> &
+ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::operator* (void) const
+{
+  return *this->node_->entries_[this->index_];
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_INLINE ACE_BTree_Map_Entry<EXT_ID, INT_ID> *
+ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::operator-> (void) const
+{
+  return this->node_->entries_[this->index_];
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE bool
+ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::operator== (const ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> &rhs) const
+{
+  return this->node_ == rhs.node_
+    && (this->node_ == 0 || this->index_ == rhs.index_);
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE bool
+ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::operator!= (const ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> &rhs) const
+{
+  return !this->operator== (rhs);
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE
+ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::ACE_BTree_Map_Iterator (void)
+{
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE
+ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::ACE_BTree_Map_Iterator (NODE *node,
+                                                                                                    size_t index)
+  : ACE_BTree_Map_Iterator_Base<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> (node, index)
+{
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::advance (void)
+{
+  this->forward_i ();
+  return this->node_ != 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_INLINE ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> &
+ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::operator++ (void)
+{
+  this->forward_i ();
+  return *this;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_INLINE ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>
+ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::operator++ (int)
+{
+  ACE_BTree_Map_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> retv (*this);
+  this->forward_i ();
+  return retv;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE
+ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::ACE_BTree_Map_Reverse_Iterator (void)
+{
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX> ACE_INLINE int
+ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::advance (void)
+{
+  this->reverse_i ();
+  return this->node_ != 0;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_INLINE ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> &
+ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::operator++ (void)
+{
+  this->reverse_i ();
+  return *this;
+}
+
+template <class EXT_ID, class INT_ID, class COMPARE_KEYS, class ACE_LOCK, class KEY_PREFIX>
+ACE_INLINE ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>
+ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX>::operator++ (int)
+{
+  ACE_BTree_Map_Reverse_Iterator<EXT_ID, INT_ID, COMPARE_KEYS, ACE_LOCK, KEY_PREFIX> retv (*this);
+  this->reverse_i ();
+  return retv;
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
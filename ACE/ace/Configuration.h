@@ -35,6 +35,10 @@
 #include "ace/Local_Memory_Pool.h"
 #include "ace/Synch_Traits.h"
 
+#if defined (ACE_CONFIGURATION_HEAP_USES_SLAB_MALLOC)
+# include "ace/Slab_Malloc_T.h"
+#endif /* ACE_CONFIGURATION_HEAP_USES_SLAB_MALLOC */
+
 
 #if !defined (ACE_LACKS_PRAGMA_ONCE)
 # pragma once
@@ -538,12 +542,23 @@ protected:
 
 // ACE_Allocator version
 
+#if defined (ACE_CONFIGURATION_HEAP_USES_SLAB_MALLOC)
+// Persistent heaps written with ACE_Malloc cannot be read back with
+// ACE_Slab_Malloc, and the other way around.
+typedef ACE_Allocator_Adapter <ACE_Slab_Malloc <ACE_MMAP_MEMORY_POOL,
+                                                ACE_SYNCH_MUTEX> >
+        PERSISTENT_ALLOCATOR;
+typedef ACE_Allocator_Adapter <ACE_Slab_Malloc <ACE_LOCAL_MEMORY_POOL,
+                                                ACE_SYNCH_MUTEX> >
+        HEAP_ALLOCATOR;
+#else
 typedef ACE_Allocator_Adapter <ACE_Malloc <ACE_MMAP_MEMORY_POOL,
                                            ACE_SYNCH_MUTEX> >
         PERSISTENT_ALLOCATOR;
 typedef ACE_Allocator_Adapter <ACE_Malloc <ACE_LOCAL_MEMORY_POOL,
                                            ACE_SYNCH_MUTEX> >
         HEAP_ALLOCATOR;
+#endif /* ACE_CONFIGURATION_HEAP_USES_SLAB_MALLOC */
 
 /**
  * @class ACE_Configuration_ExtId
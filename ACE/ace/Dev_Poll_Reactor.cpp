@@ -48,7 +48,11 @@ ACE_ALLOC_HOOK_DEFINE(ACE_Dev_Poll_Reactor_Notify)
 
 ACE_Dev_Poll_Reactor_Notify::ACE_Dev_Poll_Reactor_Notify (void)
   : dp_reactor_ (0)
+#if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
+  , notification_wakeup_ ()
+#else
   , notification_pipe_ ()
+#endif  /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
   , max_notify_iterations_ (-1)
 #if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
   , notification_queue_ ()
@@ -73,10 +77,20 @@ ACE_Dev_Poll_Reactor_Notify::open (ACE_Reactor_Impl *r,
           return -1;
         }
 
+#if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
+      if (notification_queue_.open () == -1)
+        {
+          return -1;
+        }
+
+      // The wakeup handles are non-blocking and close-on-exec.
+      if (this->notification_wakeup_.open () == -1)
+        return -1;
+#else
       if (this->notification_pipe_.open () == -1)
         return -1;
 
-#if defined (F_SETFD) && !defined (ACE_LACKS_FCNTL)
+# if defined (F_SETFD) && !defined (ACE_LACKS_FCNTL)
       // close-on-exec
       if (ACE_OS::fcntl (this->notification_pipe_.read_handle (), F_SETFD, 1) == -1)
         {
@@ -86,18 +100,7 @@ ACE_Dev_Poll_Reactor_Notify::open (ACE_Reactor_Impl *r,
         {
           return -1;
         }
-#endif /* F_SETFD */
-
-#if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
-      if (notification_queue_.open () == -1)
-        {
-          return -1;
-        }
-
-      if (ACE::set_flags (this->notification_pipe_.write_handle (),
-                          ACE_NONBLOCK) == -1)
-        return -1;
-#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
+# endif /* F_SETFD */
 
       // Set the read handle into non-blocking mode since we need to
       // perform a "speculative" read when determining if there are
@@ -105,6 +108,7 @@ ACE_Dev_Poll_Reactor_Notify::open (ACE_Reactor_Impl *r,
       if (ACE::set_flags (this->notification_pipe_.read_handle (),
                           ACE_NONBLOCK) == -1)
         return -1;
+#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
     }
 
   return 0;
@@ -117,9 +121,11 @@ ACE_Dev_Poll_Reactor_Notify::close (void)
 
 #if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
   notification_queue_.reset ();
-#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 
+  return this->notification_wakeup_.close ();
+#else
   return this->notification_pipe_.close ();
+#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 }
 
 int
@@ -140,28 +146,23 @@ ACE_Dev_Poll_Reactor_Notify::notify (ACE_Event_Handler *eh,
   ACE_UNUSED_ARG (timeout);
   ACE_Dev_Poll_Handler_Guard eh_guard (eh);
 
-  // When using the queue, always try to write to the notify pipe. If it
-  // fills up, ignore it safely because the already-written bytes will
-  // eventually cause the notify handler to be dispatched.
-  if (-1 == this->notification_queue_.push_new_notification (buffer))
+  int const notification_required =
+    this->notification_queue_.push_new_notification (buffer);
+  if (notification_required == -1)
     return -1;             // Also decrement eh's reference count
 
   // The notification has been queued, so it will be delivered at some
   // point (and may have been already); release the refcnt guard.
   eh_guard.release ();
 
-  // Now pop the pipe to force the callback for dispatching when ready. If
-  // the send fails due to a full pipe, don't fail - assume the already-sent
-  // pipe bytes will cause the entire notification queue to be processed.
-  // Note that we don't need a timeout since the pipe is already in
-  // nonblocking mode and all we want is one attempt.
-  ssize_t n = ACE::send (this->notification_pipe_.write_handle (),
-                         (char *) &buffer,
-                         1);             // Only need one byte to pop the pipe
-  if (n == -1 && (errno != EAGAIN))
-    return -1;
+  // Only the thread that found the queue empty has to wake up the
+  // reactor, the others can count on the notify handler to keep
+  // dequeuing until the queue is empty.  A wakeup that is still
+  // pending is not an error.
+  if (notification_required == 0)
+    return 0;
 
-  return 0;
+  return this->notification_wakeup_.signal ();
 #else
 
   ACE_Dev_Poll_Handler_Guard eh_guard (eh);
@@ -210,21 +211,16 @@ ACE_Dev_Poll_Reactor_Notify::read_notify_pipe (ACE_HANDLE handle,
   // by "walking" the array of pollfd structures returned from
   // `/dev/poll' or `/dev/epoll' but that is potentially much more
   // expensive than simply checking for an EWOULDBLOCK.
-  size_t to_read;
-  char *read_p;
-
 #if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
   // The idea in the queued case is to be sure we never end up with a notify
-  // queued but no byte in the pipe. If that happens, the notify won't be
-  // dispatched. So always try to empty the pipe, read the queue, then put
-  // a byte in if needed. The notify() method is enqueueing then writing the
-  // pipe, so be sure to do it in the reverse order here to avoid a race
-  // between removing the last notification from the queue and the notify
-  // side writing its byte.
-  char b[1024];
-  read_p = b;
-  to_read = sizeof(b);
-  (void)ACE::recv (handle, read_p, to_read);
+  // queued but no wakeup pending. If that happens, the notify won't be
+  // dispatched. So always try to clear the wakeup, read the queue, then
+  // signal it again if needed. The notify() method is enqueueing then
+  // signaling, so be sure to do it in the reverse order here to avoid a
+  // race between removing the last notification from the queue and the
+  // notify side signaling.
+  ACE_UNUSED_ARG (handle);
+  (void) this->notification_wakeup_.clear ();
 
   bool more_messages_queued = false;
   ACE_Notification_Buffer next;
@@ -243,17 +239,15 @@ ACE_Dev_Poll_Reactor_Notify::read_notify_pipe (ACE_HANDLE handle,
         break;
     }
 
-  // If there are more messages, ensure there's a byte in the pipe
-  // in case the notification limit stops dequeuing notifies before
-  // emptying the queue.
+  // If there are more messages, ensure the wakeup is pending in case
+  // the notification limit stops dequeuing notifies before emptying
+  // the queue.
   if (more_messages_queued)
-    (void) ACE::send (this->notification_pipe_.write_handle (),
-                      (char *)&next,
-                      1); /* one byte is enough */
+    (void) this->notification_wakeup_.signal ();
   return 1;
 #else
-  to_read = sizeof buffer;
-  read_p = (char *)&buffer;
+  size_t to_read = sizeof buffer;
+  char *read_p = (char *)&buffer;
 
   ssize_t n = ACE::recv (handle, read_p, to_read);
 
@@ -296,7 +290,11 @@ ACE_Dev_Poll_Reactor_Notify::notify_handle (void)
 {
   ACE_TRACE ("ACE_Dev_Poll_Reactor_Notify::notify_handle");
 
+#if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
+  return this->notification_wakeup_.handle ();
+#else
   return this->notification_pipe_.read_handle ();
+#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 }
 
 int
@@ -399,7 +397,11 @@ ACE_Dev_Poll_Reactor_Notify::dump (void) const
   ACELIB_DEBUG ((LM_DEBUG,
               ACE_TEXT ("dp_reactor_ = %@"),
               this->dp_reactor_));
+#if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
+  this->notification_wakeup_.dump ();
+#else
   this->notification_pipe_.dump ();
+#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
   ACELIB_DEBUG ((LM_DEBUG, ACE_END_DUMP));
 #endif /* ACE_HAS_DUMP */
 }
@@ -607,6 +609,7 @@ ACE_Dev_Poll_Reactor::ACE_Dev_Poll_Reactor (ACE_Sig_Handler *sh,
   , delete_notify_handler_ (false)
   , mask_signals_ (mask_signals)
   , restart_ (0)
+  , leaderless_ (false)
 {
   ACE_TRACE ("ACE_Dev_Poll_Reactor::ACE_Dev_Poll_Reactor");
 
@@ -650,6 +653,7 @@ ACE_Dev_Poll_Reactor::ACE_Dev_Poll_Reactor (size_t size,
   , delete_notify_handler_ (false)
   , mask_signals_ (mask_signals)
   , restart_ (0)
+  , leaderless_ (false)
 {
   if (this->open (size,
                   rs,
@@ -842,6 +846,9 @@ ACE_Dev_Poll_Reactor::close (void)
   ACE_OS::memset (&this->event_, 0, sizeof (this->event_));
   this->event_.data.fd = ACE_INVALID_HANDLE;
 
+  this->wakeup_all_pipe_.close ();
+  this->leaderless_ = false;
+
 #else
 
   delete [] this->dp_fds_;
@@ -901,6 +908,11 @@ ACE_Dev_Poll_Reactor::work_pending (const ACE_Time_Value & max_wait_time)
   ACE_Time_Value mwt (max_wait_time);
   ACE_MT (ACE_Countdown_Time countdown (&mwt));
 
+#if defined (ACE_HAS_EVENT_POLL)
+  if (this->leaderless_)
+    return this->work_pending_leaderless (&mwt);
+#endif /* ACE_HAS_EVENT_POLL */
+
   Token_Guard guard (this->token_);
   int const result = guard.acquire_quietly (&mwt);
 
@@ -990,6 +1002,11 @@ ACE_Dev_Poll_Reactor::handle_events (ACE_Time_Value *max_wait_time)
   // time elapsed since this method was called.
   ACE_Countdown_Time countdown (max_wait_time);
 
+#if defined (ACE_HAS_EVENT_POLL)
+  if (this->leaderless_)
+    return this->handle_events_leaderless (max_wait_time);
+#endif /* ACE_HAS_EVENT_POLL */
+
   Token_Guard guard (this->token_);
   int const result = guard.acquire_quietly (max_wait_time);
 
@@ -1053,6 +1070,126 @@ ACE_Dev_Poll_Reactor::handle_events_i (ACE_Time_Value *max_wait_time,
   return this->dispatch (guard);
 }
 
+#if defined (ACE_HAS_EVENT_POLL)
+int
+ACE_Dev_Poll_Reactor::work_pending_leaderless (ACE_Time_Value *max_wait_time)
+{
+  ACE_TRACE ("ACE_Dev_Poll_Reactor::work_pending_leaderless");
+
+  if (this->deactivated_)
+    return 0;
+
+  ACE_Time_Value timer_buf (0);
+  ACE_Time_Value *this_timeout =
+    this->timer_queue_->calculate_timeout (max_wait_time, &timer_buf);
+
+  // Check if we have timers to fire.
+  int const timers_pending =
+    ((this_timeout != 0 && max_wait_time == 0)
+     || (this_timeout != 0 && max_wait_time != 0
+         && *this_timeout != *max_wait_time) ? 1 : 0);
+
+  int const timeout =
+    (this_timeout == 0
+     ? -1 /* Infinity */
+     : static_cast<int> (this_timeout->msec ()));
+
+  struct epoll_event event;
+  int const nfds = ::epoll_wait (this->poll_fd_, &event, 1, timeout);
+
+  if (nfds > 0 && event.data.fd != this->wakeup_all_pipe_.read_handle ())
+    {
+      // There's no event_ to keep the retrieved event in until the next
+      // handle_events() call. The oneshot registration disarmed the
+      // handle, so arm it again to have the event reported once more.
+      ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, grd, this->repo_lock_, -1);
+      Event_Tuple *info = this->handler_rep_.find (event.data.fd);
+      if (info != 0 && !info->suspended)
+        {
+          info->suspended = true;
+          this->resume_handler_i (event.data.fd);
+        }
+    }
+
+  // If timers are pending, override any timeout from the poll.
+  return (nfds == 0 && timers_pending != 0 ? 1 : nfds);
+}
+
+int
+ACE_Dev_Poll_Reactor::handle_events_leaderless (ACE_Time_Value *max_wait_time)
+{
+  ACE_TRACE ("ACE_Dev_Poll_Reactor::handle_events_leaderless");
+
+  if (this->deactivated_)
+    {
+      errno = ESHUTDOWN;
+      return -1;
+    }
+
+  // The guard never owns the token, releasing it before an upcall is
+  // a no-op.
+  Token_Guard guard (this->token_);
+
+  // Handle timers early since they may have higher latency
+  // constraints than I/O handlers. The timer queue serializes the
+  // threads expiring timers itself.
+  int result = this->dispatch_timer_handler (guard);
+  if (result != 0)
+    return result;
+
+  ACE_Time_Value timer_buf (0);
+  ACE_Time_Value *this_timeout =
+    this->timer_queue_->calculate_timeout (max_wait_time, &timer_buf);
+  int const timeout =
+    (this_timeout == 0
+     ? -1 /* Infinity */
+     : static_cast<int> (this_timeout->msec ()));
+
+  // Every waiter has its own event; the oneshot registrations make sure
+  // an event is retrieved by one of them only.
+  struct epoll_event event;
+  do
+    {
+      result = ::epoll_wait (this->poll_fd_, &event, 1, timeout);
+      if (result == -1 && (this->restart_ == 0 || errno != EINTR))
+        ACELIB_ERROR ((LM_ERROR, ACE_TEXT("%t: %p\n"), ACE_TEXT("epoll_wait")));
+    }
+  while (result == -1 && this->restart_ != 0 && errno == EINTR);
+
+  if (result == 0)
+    // Timed out, possibly because a timer is due.
+    return this->dispatch_timer_handler (guard);
+  else if (result == -1)
+    {
+      if (errno != EINTR)
+        return -1;
+
+      // See handle_events_i().
+      if (ACE_Sig_Handler::sig_pending () != 0)
+        {
+          ACE_Sig_Handler::sig_pending (0);
+          return 1;
+        }
+      return -1;
+    }
+
+  // wakeup_all_threads() was called. Leave the pipe readable while the
+  // reactor is deactivated so it releases all the other waiters too.
+  if (event.data.fd == this->wakeup_all_pipe_.read_handle ())
+    {
+      if (!this->deactivated_)
+        {
+          char buf[64];
+          (void) ACE::recv (event.data.fd, buf, sizeof buf);
+        }
+      return 0;
+    }
+
+  Poll_Events revents = event.events;
+  return this->dispatch_io_event_i (event.data.fd, revents, guard);
+}
+#endif /* ACE_HAS_EVENT_POLL */
+
 // Dispatch an event. On entry, the token is held by the caller. If an
 // event is found to dispatch, the token is released before dispatching it.
 int
@@ -1117,31 +1254,16 @@ ACE_Dev_Poll_Reactor::dispatch_notification_handlers (
 int
 ACE_Dev_Poll_Reactor::dispatch_io_event (Token_Guard &guard)
 {
-
-  // Dispatch a ready event.
-
-  // Define bits to check for while dispatching.
-#if defined (ACE_HAS_EVENT_POLL)
-  const __uint32_t out_event = EPOLLOUT;
-  const __uint32_t exc_event = EPOLLPRI;
-  const __uint32_t in_event  = EPOLLIN;
-  const __uint32_t err_event = EPOLLHUP | EPOLLERR;
-#else
-  const short out_event = POLLOUT;
-  const short exc_event = POLLPRI;
-  const short in_event  = POLLIN;
-  const short err_event = 0;              // No known bits for this
-#endif /* ACE_HAS_EVENT_POLL */
-
 #if defined (ACE_HAS_EVENT_POLL)
   // epoll_wait() pulls one event which is stored in event_. If the handle
   // is invalid, there's no event there. Else process it. In any event, we
   // have the event, so clear event_ for the next thread.
   const ACE_HANDLE handle = this->event_.data.fd;
-  __uint32_t revents      = this->event_.events;
+  Poll_Events revents     = this->event_.events;
   this->event_.data.fd = ACE_INVALID_HANDLE;
   this->event_.events = 0;
   if (handle != ACE_INVALID_HANDLE)
+    return this->dispatch_io_event_i (handle, revents, guard);
 
 #else
   // Since the underlying event demultiplexing mechansim (`/dev/poll'
@@ -1159,201 +1281,237 @@ ACE_Dev_Poll_Reactor::dispatch_io_event (Token_Guard &guard)
   //
   // Notice that pfds only contains file descriptors that have
   // received events.
-  struct pollfd *& pfds = this->start_pfds_;
-  const ACE_HANDLE handle = pfds->fd;
-  short &revents          = pfds->revents;
+  struct pollfd *pfds = this->start_pfds_;
   if (pfds < this->end_pfds_)
+    return this->dispatch_io_event_i (pfds->fd, pfds->revents, guard);
 #endif /* ACE_HAS_EVENT_POLL */
 
-    {
-      /* When using sys_epoll, we can attach arbitrary user
-         data to the descriptor, so it can be delivered when
-         activity is detected. Perhaps we should store event
-         handler together with descriptor, instead of looking
-         it up in a repository ? Could it boost performance ?
-      */
-
-      // Going to access handler repo, so lock it. If the lock is
-      // unobtainable, something is very wrong so bail out.
-      Event_Tuple *info = 0;
-      ACE_Reactor_Mask disp_mask = 0;
-      ACE_Event_Handler *eh = 0;
-      int (ACE_Event_Handler::*callback)(ACE_HANDLE) = 0;
-      bool reactor_resumes_eh = false;
+  return 0;
+}
+
+int
+ACE_Dev_Poll_Reactor::dispatch_io_event_i (ACE_HANDLE handle,
+                                           Poll_Events &revents,
+                                           Token_Guard &guard)
+{
+  // Dispatch a ready event.
+
+  // Define bits to check for while dispatching.
+#if defined (ACE_HAS_EVENT_POLL)
+  const __uint32_t out_event = EPOLLOUT;
+  const __uint32_t exc_event = EPOLLPRI;
+  const __uint32_t in_event  = EPOLLIN;
+  const __uint32_t err_event = EPOLLHUP | EPOLLERR;
+#else
+  const short out_event = POLLOUT;
+  const short exc_event = POLLPRI;
+  const short in_event  = POLLIN;
+  const short err_event = 0;              // No known bits for this
+#endif /* ACE_HAS_EVENT_POLL */
+
+  /* When using sys_epoll, we can attach arbitrary user
+     data to the descriptor, so it can be delivered when
+     activity is detected. Perhaps we should store event
+     handler together with descriptor, instead of looking
+     it up in a repository ? Could it boost performance ?
+  */
+
+  // Going to access handler repo, so lock it. If the lock is
+  // unobtainable, something is very wrong so bail out.
+  Event_Tuple *info = 0;
+  ACE_Reactor_Mask disp_mask = 0;
+  ACE_Event_Handler *eh = 0;
+  int (ACE_Event_Handler::*callback)(ACE_HANDLE) = 0;
+  bool reactor_resumes_eh = false;
+  {
+    ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, grd, this->repo_lock_, -1);
+    info = this->handler_rep_.find (handle);
+    if (info == 0)   // No registered handler any longer
+      return 0;
+
+    // It is possible another thread has changed (and possibly re-armed)
+    // this handle mask before current thread obtained the repo lock.
+    // If that did happen and this handler is still suspended, don't
+    // dispatch on top of another callback. See Bugzilla 4129.
+    if (info->suspended)
+      return 0;
+
+    // Figure out what to do first in order to make it easier to manage
+    // the bit twiddling and possible pfds increment before releasing
+    // the token for dispatch.
+    // Note that if there's an error (such as the handle was closed
+    // without being removed from the event set) the EPOLLHUP and/or
+    // EPOLLERR bits will be set in revents.
+    eh = info->event_handler;
+    if (ACE_BIT_ENABLED (revents, out_event))
       {
-        ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, grd, this->repo_lock_, -1);
-        info = this->handler_rep_.find (handle);
-        if (info == 0)   // No registered handler any longer
-          return 0;
-
-        // It is possible another thread has changed (and possibly re-armed)
-        // this handle mask before current thread obtained the repo lock.
-        // If that did happen and this handler is still suspended, don't
-        // dispatch on top of another callback. See Bugzilla 4129.
-        if (info->suspended)
-          return 0;
-
-        // Figure out what to do first in order to make it easier to manage
-        // the bit twiddling and possible pfds increment before releasing
-        // the token for dispatch.
-        // Note that if there's an error (such as the handle was closed
-        // without being removed from the event set) the EPOLLHUP and/or
-        // EPOLLERR bits will be set in revents.
-        eh = info->event_handler;
-        if (ACE_BIT_ENABLED (revents, out_event))
-          {
-            disp_mask = ACE_Event_Handler::WRITE_MASK;
-            callback = &ACE_Event_Handler::handle_output;
-            ACE_CLR_BITS (revents, out_event);
-          }
-        else if (ACE_BIT_ENABLED (revents, exc_event))
-          {
-            disp_mask = ACE_Event_Handler::EXCEPT_MASK;
-            callback = &ACE_Event_Handler::handle_exception;
-            ACE_CLR_BITS (revents, exc_event);
-          }
-        else if (ACE_BIT_ENABLED (revents, in_event))
-          {
-            disp_mask = ACE_Event_Handler::READ_MASK;
-            callback = &ACE_Event_Handler::handle_input;
-            ACE_CLR_BITS (revents, in_event);
-          }
-        else if (ACE_BIT_ENABLED (revents, err_event))
-          {
-            this->remove_handler_i (handle,
-                                    ACE_Event_Handler::ALL_EVENTS_MASK,
-                                    grd,
-                                    info->event_handler);
+        disp_mask = ACE_Event_Handler::WRITE_MASK;
+        callback = &ACE_Event_Handler::handle_output;
+        ACE_CLR_BITS (revents, out_event);
+      }
+    else if (ACE_BIT_ENABLED (revents, exc_event))
+      {
+        disp_mask = ACE_Event_Handler::EXCEPT_MASK;
+        callback = &ACE_Event_Handler::handle_exception;
+        ACE_CLR_BITS (revents, exc_event);
+      }
+    else if (ACE_BIT_ENABLED (revents, in_event))
+      {
+        disp_mask = ACE_Event_Handler::READ_MASK;
+        callback = &ACE_Event_Handler::handle_input;
+        ACE_CLR_BITS (revents, in_event);
+      }
+    else if (ACE_BIT_ENABLED (revents, err_event))
+      {
+        this->remove_handler_i (handle,
+                                ACE_Event_Handler::ALL_EVENTS_MASK,
+                                grd,
+                                info->event_handler);
 #ifdef ACE_HAS_DEV_POLL
-            ++pfds;
+        ++this->start_pfds_;
 #endif /* ACE_HAS_DEV_POLL */
-            return 1;
-          }
-        else
-          {
-            ACELIB_ERROR ((LM_ERROR,
-                           ACE_TEXT ("(%t) dispatch_io h %d unknown events 0x%x\n"),
-                           handle, revents));
-          }
+        return 1;
+      }
+    else
+      {
+        ACELIB_ERROR ((LM_ERROR,
+                       ACE_TEXT ("(%t) dispatch_io h %d unknown events 0x%x\n"),
+                       handle, revents));
+      }
 
 #ifdef ACE_HAS_DEV_POLL
-        // Increment the pointer to the next element before we
-        // release the token.  Otherwise event handlers end up being
-        // dispatched multiple times for the same poll.
-        if (revents == 0)
-          ++pfds;
+    // Increment the pointer to the next element before we
+    // release the token.  Otherwise event handlers end up being
+    // dispatched multiple times for the same poll.
+    if (revents == 0)
+      ++this->start_pfds_;
 #else
-        // With epoll, events are registered with oneshot, so the handle is
-        // effectively suspended; future calls to epoll_wait() will select
-        // the next event, so they're not managed here.
-        // The hitch to this is that the notify handler is always registered
-        // WITHOUT oneshot and is never suspended/resumed. This avoids endless
-        // notify loops caused by the notify handler requiring a resumption
-        // which requires the token, which requires a notify, etc. described
-        // in Bugzilla 3714. So, never suspend the notify handler.
-        if (eh != this->notify_handler_)
-          {
-            info->suspended = true;
+    // With epoll, events are registered with oneshot, so the handle is
+    // effectively suspended; future calls to epoll_wait() will select
+    // the next event, so they're not managed here.
+    // The hitch to this is that the notify handler is always registered
+    // WITHOUT oneshot and is never suspended/resumed. This avoids endless
+    // notify loops caused by the notify handler requiring a resumption
+    // which requires the token, which requires a notify, etc. described
+    // in Bugzilla 3714. So, never suspend the notify handler.
+    // In leaderless mode there's no token to wait for, the notify
+    // handler is registered with oneshot too and it is re-armed as
+    // soon as a notification is dequeued, see below.
+    if (eh != this->notify_handler_)
+      {
+        info->suspended = true;
 
-            reactor_resumes_eh =
-              eh->resume_handler () ==
-              ACE_Event_Handler::ACE_REACTOR_RESUMES_HANDLER;
-          }
+        reactor_resumes_eh =
+          eh->resume_handler () ==
+          ACE_Event_Handler::ACE_REACTOR_RESUMES_HANDLER;
+      }
+    else if (this->leaderless_)
+      info->suspended = true;
 #endif /* ACE_HAS_DEV_POLL */
 
-      }     // End scope for ACE_GUARD holding repo lock
+  }     // End scope for ACE_GUARD holding repo lock
 
-      int status = 0;   // gets callback status, below.
+  int status = 0;   // gets callback status, below.
 
-      // Dispatch notifies directly. The notify dispatcher locates a
-      // notification then releases the token prior to dispatching it.
-      // NOTE: If notify_handler_->dispatch_one() returns a fail condition
-      // it has not releases the guard. Else, it has.
-      if (eh == this->notify_handler_)
+  // Dispatch notifies directly. The notify dispatcher locates a
+  // notification then releases the token prior to dispatching it.
+  // NOTE: If notify_handler_->dispatch_one() returns a fail condition
+  // it has not releases the guard. Else, it has.
+  if (eh == this->notify_handler_)
+    {
+      ACE_Notification_Buffer b;
+      status =
+        dynamic_cast<ACE_Dev_Poll_Reactor_Notify *>(notify_handler_)->dequeue_one (b);
+#ifdef ACE_HAS_EVENT_POLL
+      // Without the token, dequeue_one() is serialized by the oneshot
+      // registration of the notify handle. Re-arm it right away so
+      // the next notification is picked up by another thread while
+      // this one is dispatched.
+      if (this->leaderless_)
         {
-          ACE_Notification_Buffer b;
-          status =
-            dynamic_cast<ACE_Dev_Poll_Reactor_Notify *>(notify_handler_)->dequeue_one (b);
-          if (status == -1)
-            return status;
-          guard.release_token ();
-          return notify_handler_->dispatch_notify (b);
+          ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, grd, this->repo_lock_, -1);
+          info = this->handler_rep_.find (handle);
+          if (info != 0 && info->event_handler == eh)
+            this->resume_handler_i (handle);
         }
+#endif /* ACE_HAS_EVENT_POLL */
+      if (status == -1)
+        return status;
+      guard.release_token ();
+      return notify_handler_->dispatch_notify (b);
+    }
 
+  {
+    // Modify the reference count in an exception-safe way.
+    // Note that eh could be the notify handler. It's not strictly
+    // necessary to manage its refcount, but since we don't enable
+    // the counting policy, it won't do much. Management of the
+    // notified handlers themselves is done in the notify handler.
+    ACE_Dev_Poll_Handler_Guard eh_guard (eh);
+
+    // Release the reactor token before upcall.
+    guard.release_token ();
+
+    // Dispatch the detected event; will do the repeated upcalls
+    // if callback returns > 0, unless it's the notify handler (which
+    // returns the number of notfies dispatched, not an indication of
+    // re-callback requested). If anything other than the notify, come
+    // back with either 0 or < 0.
+    status = this->upcall (eh, callback, handle);
+
+    // If the callback returned 0, epoll-based needs to resume the
+    // suspended handler but dev/poll doesn't.
+    // In both epoll and dev/poll cases, if the callback returns <0,
+    // the token needs to be acquired and the handler checked and
+    // removed if it hasn't already been.
+    if (status == 0)
       {
-        // Modify the reference count in an exception-safe way.
-        // Note that eh could be the notify handler. It's not strictly
-        // necessary to manage its refcount, but since we don't enable
-        // the counting policy, it won't do much. Management of the
-        // notified handlers themselves is done in the notify handler.
-        ACE_Dev_Poll_Handler_Guard eh_guard (eh);
-
-        // Release the reactor token before upcall.
-        guard.release_token ();
-
-        // Dispatch the detected event; will do the repeated upcalls
-        // if callback returns > 0, unless it's the notify handler (which
-        // returns the number of notfies dispatched, not an indication of
-        // re-callback requested). If anything other than the notify, come
-        // back with either 0 or < 0.
-        status = this->upcall (eh, callback, handle);
-
-        // If the callback returned 0, epoll-based needs to resume the
-        // suspended handler but dev/poll doesn't.
-        // In both epoll and dev/poll cases, if the callback returns <0,
-        // the token needs to be acquired and the handler checked and
-        // removed if it hasn't already been.
-        if (status == 0)
+#ifdef ACE_HAS_EVENT_POLL
+        // epoll-based effectively suspends handlers around the upcall.
+        // If the handler must be resumed, check to be sure it's the
+        // same handle/handler combination still.
+        if (reactor_resumes_eh)
+          {
+            ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, grd, this->repo_lock_, -1);
+            info = this->handler_rep_.find (handle);
+            if (info != 0 && info->event_handler == eh)
+              this->resume_handler_i (handle);
+          }
+#endif /* ACE_HAS_EVENT_POLL */
+        return 1;
+      }
+
+    // All state in the handler repository may have changed during the
+    // upcall. Thus, reacquire the repo lock and evaluate what's needed.
+    // If the upcalled handler is still the handler of record for handle,
+    // continue with checking whether or not to remove or resume the
+    // handler.
+    ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, grd, this->repo_lock_, 1);
+    info = this->handler_rep_.find (handle);
+    if (info != 0 && info->event_handler == eh)
+      {
+        if (status < 0)
           {
+            this->remove_handler_i (handle, disp_mask, grd);
 #ifdef ACE_HAS_EVENT_POLL
             // epoll-based effectively suspends handlers around the upcall.
             // If the handler must be resumed, check to be sure it's the
             // same handle/handler combination still.
             if (reactor_resumes_eh)
               {
-                ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, grd, this->repo_lock_, -1);
                 info = this->handler_rep_.find (handle);
                 if (info != 0 && info->event_handler == eh)
-                  this->resume_handler_i (handle);
-              }
-#endif /* ACE_HAS_EVENT_POLL */
-            return 1;
-          }
-
-        // All state in the handler repository may have changed during the
-        // upcall. Thus, reacquire the repo lock and evaluate what's needed.
-        // If the upcalled handler is still the handler of record for handle,
-        // continue with checking whether or not to remove or resume the
-        // handler.
-        ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, grd, this->repo_lock_, 1);
-        info = this->handler_rep_.find (handle);
-        if (info != 0 && info->event_handler == eh)
-          {
-            if (status < 0)
-              {
-                this->remove_handler_i (handle, disp_mask, grd);
-#ifdef ACE_HAS_EVENT_POLL
-                // epoll-based effectively suspends handlers around the upcall.
-                // If the handler must be resumed, check to be sure it's the
-                // same handle/handler combination still.
-                if (reactor_resumes_eh)
                   {
-                    info = this->handler_rep_.find (handle);
-                    if (info != 0 && info->event_handler == eh)
-                      {
-                        this->resume_handler_i (handle);
-                      }
+                    this->resume_handler_i (handle);
                   }
-#endif /* ACE_HAS_EVENT_POLL */
               }
+#endif /* ACE_HAS_EVENT_POLL */
           }
       }
-      // Scope close handles eh ref count decrement, if needed.
+  }
+  // Scope close handles eh ref count decrement, if needed.
 
-      return 1;
-    }
-
-  return 0;
+  return 1;
 }
 
 int
@@ -1393,6 +1551,86 @@ ACE_Dev_Poll_Reactor::deactivate (int do_stop)
   this->wakeup_all_threads ();
 }
 
+int
+ACE_Dev_Poll_Reactor::leaderless (bool enable)
+{
+  ACE_TRACE ("ACE_Dev_Poll_Reactor::leaderless");
+
+#if defined (ACE_HAS_EVENT_POLL)
+  ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, grd, this->repo_lock_, -1);
+
+  if (this->leaderless_ == enable)
+    return 0;
+
+  if (!this->initialized_)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+  struct epoll_event epev;
+  ACE_OS::memset (&epev, 0, sizeof (epev));
+
+  if (enable)
+    {
+      if (this->wakeup_all_pipe_.open () == -1)
+        return -1;
+      ACE::set_flags (this->wakeup_all_pipe_.read_handle (), ACE_NONBLOCK);
+      ACE::set_flags (this->wakeup_all_pipe_.write_handle (), ACE_NONBLOCK);
+
+      // Level-triggered on purpose, see handle_events_leaderless().
+      epev.data.fd = this->wakeup_all_pipe_.read_handle ();
+      epev.events = EPOLLIN;
+      if (::epoll_ctl (this->poll_fd_,
+                       EPOLL_CTL_ADD,
+                       epev.data.fd,
+                       &epev) == -1)
+        {
+          this->wakeup_all_pipe_.close ();
+          return -1;
+        }
+    }
+
+  // The notify handler is the only handler the token based mode
+  // registers without oneshot, switch its registration.
+  ACE_HANDLE const handle =
+    this->notify_handler_ == 0
+    ? ACE_INVALID_HANDLE
+    : this->notify_handler_->notify_handle ();
+  Event_Tuple *info =
+    handle == ACE_INVALID_HANDLE ? 0 : this->handler_rep_.find (handle);
+  if (info != 0 && info->controlled)
+    {
+      epev.data.fd = handle;
+      epev.events = this->reactor_mask_to_poll_event (info->mask);
+      if (enable)
+        epev.events |= EPOLLONESHOT;
+      if (::epoll_ctl (this->poll_fd_, EPOLL_CTL_MOD, handle, &epev) == -1)
+        {
+          if (enable)
+            this->wakeup_all_pipe_.close ();
+          return -1;
+        }
+      info->suspended = false;
+    }
+
+  if (!enable)
+    this->wakeup_all_pipe_.close ();
+
+  this->leaderless_ = enable;
+  return 0;
+#else
+  ACE_UNUSED_ARG (enable);
+  ACE_NOTSUP_RETURN (-1);
+#endif /* ACE_HAS_EVENT_POLL */
+}
+
+bool
+ACE_Dev_Poll_Reactor::leaderless (void) const
+{
+  return this->leaderless_;
+}
+
 int
 ACE_Dev_Poll_Reactor::register_handler (ACE_Event_Handler *handler,
                                         ACE_Reactor_Mask mask)
@@ -1453,7 +1691,7 @@ ACE_Dev_Poll_Reactor::register_handler_i (ACE_HANDLE handle,
      // All but the notify handler get registered with oneshot to facilitate
      // auto suspend before the upcall. See dispatch_io_event for more
      // information.
-     if (event_handler != this->notify_handler_)
+     if (event_handler != this->notify_handler_ || this->leaderless_)
        epev.events |= EPOLLONESHOT;
 
      if (::epoll_ctl (this->poll_fd_, op, handle, &epev) == -1)
@@ -1958,11 +2196,26 @@ ACE_Dev_Poll_Reactor::schedule_timer (ACE_Event_Handler *event_handler,
   ACE_MT (ACE_GUARD_RETURN (ACE_Dev_Poll_Reactor_Token, mon, this->token_, -1));
 
   if (0 != this->timer_queue_)
-    return this->timer_queue_->schedule
-      (event_handler,
-       arg,
-       this->timer_queue_->gettimeofday () + delay,
-       interval);
+    {
+      ACE_Time_Value const expiry =
+        this->timer_queue_->gettimeofday () + delay;
+      long const timer_id =
+        this->timer_queue_->schedule (event_handler, arg, expiry, interval);
+
+#if defined (ACE_HAS_EVENT_POLL)
+      // Taking the token above wakes the leader, which then recomputes
+      // its timeout. Leaderless waiters are not woken by that, so if the
+      // new timer is due first wake one of them.
+      if (this->leaderless_
+          && timer_id != -1
+          && this->timer_queue_->earliest_time () == expiry)
+        this->notify (0,
+                      ACE_Event_Handler::NULL_MASK,
+                      (ACE_Time_Value *) &ACE_Time_Value::zero);
+#endif /* ACE_HAS_EVENT_POLL */
+
+      return timer_id;
+    }
 
   errno = ESHUTDOWN;
   return -1;
@@ -2184,6 +2437,16 @@ ACE_Dev_Poll_Reactor::wakeup_all_threads (void)
 {
   ACE_TRACE ("ACE_Dev_Poll_Reactor::wakeup_all_threads");
 
+#if defined (ACE_HAS_EVENT_POLL)
+  // A notification wakes a single leaderless waiter, make the
+  // level-triggered pipe readable to wake them all.
+  if (this->leaderless_)
+    {
+      (void) ACE::send (this->wakeup_all_pipe_.write_handle (), "", 1);
+      return;
+    }
+#endif /* ACE_HAS_EVENT_POLL */
+
   // Send a notification, but don't block if there's no one to receive
   // it.
   this->notify (0,
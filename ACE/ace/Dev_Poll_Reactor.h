@@ -177,12 +177,22 @@ protected:
    */
   ACE_Dev_Poll_Reactor *dp_reactor_;
 
+#if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
+  /**
+   * Contains the ACE_HANDLE the ACE_Dev_Poll_Reactor is listening on.
+   * Threads wanting the attention of the ACE_Dev_Poll_Reactor queue
+   * their notification and signal this wakeup when they find the
+   * queue empty.
+   */
+  ACE_Notification_Wakeup notification_wakeup_;
+#else
   /**
    * Contains the ACE_HANDLE the ACE_Dev_Poll_Reactor is listening
    * on, as well as the ACE_HANDLE that threads wanting the attention
    * of the ACE_Dev_Poll_Reactor will write to.
    */
   ACE_Pipe notification_pipe_;
+#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 
   /**
    * Keeps track of the maximum number of times that the
@@ -201,11 +211,11 @@ protected:
    * is, no more than a certain number of bytes may be stored in the
    * pipe without blocking.  This limit may be too small for certain
    * applications.  In this case, ACE can be configured to store all
-   * the events in user-space.  The pipe is still needed to wake up
-   * the reactor thread, but only one event is sent through the pipe
-   * at a time.
+   * the events in user-space.  The notification_wakeup_ is still
+   * needed to wake up the reactor thread, but it is only signaled
+   * when the queue was found empty.
    */
-  ACE_Notification_Queue notification_queue_;
+  ACE_Reactor_Notification_Queue notification_queue_;
 #endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 };
 
@@ -542,6 +552,28 @@ public:
    */
   virtual void deactivate (int do_stop);
 
+  /// Let the event loop threads wait for events concurrently.
+  /**
+   * By default the threads running the event loop take turns waiting
+   * for events: the reactor token elects the one thread allowed to
+   * poll and the others queue behind it.  In leaderless mode there is
+   * no such election, all threads block in @c epoll_wait() on the same
+   * set of handles.  Every handle, including the notification handle,
+   * is registered with @c EPOLLONESHOT so an event is handed to exactly
+   * one thread, and the handle is re-armed once after its upcall.
+   *
+   * The mode must be selected before any thread runs the event loop.
+   * Timers scheduled from other threads wake one waiter when they
+   * become the earliest timer, and deactivate() wakes all of them.
+   *
+   * @return 0 on success, -1 on failure.  errno is set to ENOTSUP when
+   *         the reactor is not built on epoll.
+   */
+  int leaderless (bool enable);
+
+  /// Is the reactor in leaderless mode?
+  bool leaderless (void) const;
+
   // = Register and remove Handlers.
 
   /// Register @a event_handler with @a mask.  The I/O handle will
@@ -963,6 +995,26 @@ protected:
   ///         -1 on error (token still held).
   int dispatch_io_event (Token_Guard &guard);
 
+#if defined (ACE_HAS_EVENT_POLL)
+  typedef __uint32_t Poll_Events;
+#else
+  typedef short Poll_Events;
+#endif /* ACE_HAS_EVENT_POLL */
+
+  /// Dispatch the events @a revents reported for @a handle, the
+  /// dispatched event bits are cleared from @a revents.  Returns as
+  /// dispatch_io_event().
+  int dispatch_io_event_i (ACE_HANDLE handle,
+                           Poll_Events &revents,
+                           Token_Guard &guard);
+
+#if defined (ACE_HAS_EVENT_POLL)
+  /// Leaderless versions of work_pending() and handle_events(), they
+  /// are called without the token.
+  int work_pending_leaderless (ACE_Time_Value *max_wait_time);
+  int handle_events_leaderless (ACE_Time_Value *max_wait_time);
+#endif /* ACE_HAS_EVENT_POLL */
+
   /// Register the given event handler with the reactor.
   int register_handler_i (ACE_HANDLE handle,
                           ACE_Event_Handler *eh,
@@ -1095,6 +1147,15 @@ protected:
   /// via an EINTR signal.
   bool restart_;
 
+  /// Do the event loop threads wait for events without the token?
+  bool leaderless_;
+
+#if defined (ACE_HAS_EVENT_POLL)
+  /// Registered level-triggered in leaderless mode, and made readable
+  /// by wakeup_all_threads() to release every waiter at once.
+  ACE_Pipe wakeup_all_pipe_;
+#endif /* ACE_HAS_EVENT_POLL */
+
 protected:
 
   /**
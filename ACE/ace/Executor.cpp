@@ -0,0 +1,13 @@
+#include "ace/Executor.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+ACE_Executor::ACE_Executor (void)
+{
+}
+
+ACE_Executor::~ACE_Executor (void)
+{
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,63 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Executor.h
+ *
+ *  Interface of the objects that run ACE_Method_Requests on behalf
+ *  of their callers.
+ */
+//=============================================================================
+
+#ifndef ACE_EXECUTOR_H
+#define ACE_EXECUTOR_H
+
+#include /**/ "ace/pre.h"
+
+#include /**/ "ace/ACE_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/Method_Request.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class ACE_Executor
+ *
+ * @brief Runs method requests, in some thread, at some point.
+ *
+ * Unlike an ACE_Activation_Queue, which only stores the requests
+ * until a scheduler dequeues them, an executor owns the threads that
+ * call them.  It is the extension point used by ACE_Future::then() to
+ * run continuations outside of the thread that sets the value.
+ *
+ * @sa ACE_Work_Stealing_Executor
+ */
+class ACE_Export ACE_Executor
+{
+public:
+  /// Destructor.
+  virtual ~ACE_Executor (void);
+
+  /**
+   * Arrange for @a request to be called.  On success the executor
+   * takes ownership of @a request and deletes it once its @c call()
+   * method returns.  On failure, for instance after the executor has
+   * been shut down, -1 is returned and @a request still belongs to
+   * the caller.
+   */
+  virtual int execute (ACE_Method_Request *request) = 0;
+
+protected:
+  /// Constructor.
+  ACE_Executor (void);
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* ACE_EXECUTOR_H */
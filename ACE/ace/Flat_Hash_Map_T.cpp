@@ -0,0 +1,340 @@
+#ifndef ACE_FLAT_HASH_MAP_T_CPP
+#define ACE_FLAT_HASH_MAP_T_CPP
+
+#include "ace/Flat_Hash_Map_T.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#if !defined (__ACE_INLINE__)
+# include "ace/Flat_Hash_Map_T.inl"
+#endif /* __ACE_INLINE__ */
+
+#include "ace/Malloc_Base.h"
+#include "ace/OS_NS_string.h"
+#include <new>
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+ACE_ALLOC_HOOK_DEFINE_Tc5(ACE_Flat_Hash_Map_Ex)
+ACE_ALLOC_HOOK_DEFINE_Tc5(ACE_Flat_Hash_Map_Iterator_Base_Ex)
+ACE_ALLOC_HOOK_DEFINE_Tc5(ACE_Flat_Hash_Map_Iterator_Ex)
+ACE_ALLOC_HOOK_DEFINE_Tc5(ACE_Flat_Hash_Map_Const_Iterator_Ex)
+ACE_ALLOC_HOOK_DEFINE_Tc5(ACE_Flat_Hash_Map_Reverse_Iterator_Ex)
+
+template <class EXT_ID, class INT_ID> void
+ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID>::dump (void) const
+{
+#if defined (ACE_HAS_DUMP)
+  ACELIB_DEBUG ((LM_DEBUG, ACE_BEGIN_DUMP, this));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_END_DUMP));
+#endif /* ACE_HAS_DUMP */
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> void
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::dump (void) const
+{
+#if defined (ACE_HAS_DUMP)
+  ACELIB_DEBUG ((LM_DEBUG, ACE_BEGIN_DUMP, this));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_TEXT ("capacity_ = %d\n"), this->capacity_));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_TEXT ("cur_size_ = %d\n"), this->cur_size_));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_TEXT ("growth_left_ = %d\n"), this->growth_left_));
+  this->table_allocator_->dump ();
+  this->lock_.dump ();
+  ACELIB_DEBUG ((LM_DEBUG, ACE_END_DUMP));
+#endif /* ACE_HAS_DUMP */
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::open (size_t size,
+                                                                             ACE_Allocator *table_alloc)
+{
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  // Calling this->close_i () to ensure we release previous allocated
+  // memory before allocating new one.
+  this->close_i ();
+
+  if (table_alloc == 0)
+    table_alloc = ACE_Allocator::instance ();
+
+  this->table_allocator_ = table_alloc;
+
+  if (size == 0)
+    return -1;
+
+  // The table has a power of 2 number of slots, at least a group.
+  size_t capacity = ACE_Flat_Hash_Map_Group::WIDTH;
+  while (capacity < size)
+    capacity *= 2;
+
+  return this->resize_i (capacity);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::close_i (void)
+{
+  // Protect against "double-deletion" in case the destructor also
+  // gets called.
+  if (this->slots_ != 0)
+    {
+      this->destroy_entries_i ();
+      this->table_allocator_->free (this->slots_);
+      this->slots_ = 0;
+      this->ctrl_ = 0;
+      this->capacity_ = 0;
+      this->growth_left_ = 0;
+    }
+
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::unbind_all_i (void)
+{
+  if (this->slots_ != 0)
+    {
+      this->destroy_entries_i ();
+      ACE_OS::memset (this->ctrl_,
+                      ACE_Flat_Hash_Map_Group::EMPTY,
+                      this->capacity_ + ACE_Flat_Hash_Map_Group::WIDTH);
+      this->growth_left_ = this->capacity_ - this->capacity_ / 8;
+    }
+
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> void
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::destroy_entries_i (void)
+{
+  for (size_t i = 0; i < this->capacity_ && this->cur_size_ > 0; ++i)
+    if (this->ctrl_[i] >= 0)
+      {
+        ACE_DES_FREE_TEMPLATE2 (&this->slots_[i], ACE_NOOP,
+                                ACE_Flat_Hash_Map_Entry, EXT_ID, INT_ID);
+        --this->cur_size_;
+      }
+
+  this->cur_size_ = 0;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::resize_i (size_t capacity)
+{
+  size_t const width = ACE_Flat_Hash_Map_Group::WIDTH;
+
+  // The entries and the control bytes are in a single block, the
+  // control bytes last since they are not aligned.
+  void *ptr = 0;
+  ACE_ALLOCATOR_RETURN (ptr,
+                        this->table_allocator_->malloc (capacity * sizeof (ENTRY)
+                                                        + capacity + width),
+                        -1);
+
+  ENTRY *const old_slots = this->slots_;
+  signed char *const old_ctrl = this->ctrl_;
+  size_t const old_capacity = this->capacity_;
+
+  this->slots_ = reinterpret_cast<ENTRY *> (ptr);
+  this->ctrl_ = reinterpret_cast<signed char *> (this->slots_ + capacity);
+  this->capacity_ = capacity;
+  this->growth_left_ = capacity - capacity / 8 - this->cur_size_;
+  ACE_OS::memset (this->ctrl_,
+                  ACE_Flat_Hash_Map_Group::EMPTY,
+                  capacity + width);
+
+  for (size_t i = 0; i < old_capacity; ++i)
+    if (old_ctrl[i] >= 0)
+      {
+        ACE_UINT64 const h = this->mixed_hash (old_slots[i].ext_id_);
+        size_t const slot = this->find_non_full_i (h);
+        this->set_ctrl_i (slot, static_cast<signed char> (h & 0x7F));
+        new (&this->slots_[slot]) ENTRY (old_slots[i].ext_id_,
+                                         old_slots[i].int_id_);
+        ACE_DES_FREE_TEMPLATE2 (&old_slots[i], ACE_NOOP,
+                                ACE_Flat_Hash_Map_Entry, EXT_ID, INT_ID);
+      }
+
+  if (old_slots != 0)
+    this->table_allocator_->free (old_slots);
+
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::grow_i (void)
+{
+  // When the table is mostly deleted slots, clean it up instead of
+  // growing it.
+  if (this->capacity_ > 0 && this->cur_size_ <= this->capacity_ * 7 / 16)
+    return this->resize_i (this->capacity_);
+
+  return this->resize_i (this->capacity_ == 0
+                         ? static_cast<size_t> (ACE_Flat_Hash_Map_Group::WIDTH)
+                         : this->capacity_ * 2);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> size_t
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::find_non_full_i (ACE_UINT64 h) const
+{
+  size_t const mask = this->capacity_ - 1;
+  size_t pos = static_cast<size_t> (h >> 7) & mask;
+
+  // Triangular probing visits every group once since the number of
+  // groups is a power of 2, and there always is an empty slot.
+  for (size_t step = ACE_Flat_Hash_Map_Group::WIDTH; ; step += ACE_Flat_Hash_Map_Group::WIDTH)
+    {
+      ACE_Flat_Hash_Map_Group const g (this->ctrl_ + pos);
+      ACE_Flat_Hash_Map_Group::Mask const m = g.match_empty_or_deleted ();
+      if (m != 0)
+        return (pos + ACE_Flat_Hash_Map_Group::lowest (m)) & mask;
+      pos = (pos + step) & mask;
+    }
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ssize_t
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::find_i (const EXT_ID &ext_id,
+                                                                               ACE_UINT64 h)
+{
+  if (this->capacity_ == 0)
+    return -1;
+
+  size_t const mask = this->capacity_ - 1;
+  size_t pos = static_cast<size_t> (h >> 7) & mask;
+  signed char const h2 = static_cast<signed char> (h & 0x7F);
+
+  for (size_t step = ACE_Flat_Hash_Map_Group::WIDTH; ; step += ACE_Flat_Hash_Map_Group::WIDTH)
+    {
+      ACE_Flat_Hash_Map_Group const g (this->ctrl_ + pos);
+      for (ACE_Flat_Hash_Map_Group::Mask m = g.match (h2); m != 0; )
+        {
+          size_t const slot = (pos + ACE_Flat_Hash_Map_Group::next (m)) & mask;
+          if (this->equal (this->slots_[slot].ext_id_, ext_id))
+            return static_cast<ssize_t> (slot);
+        }
+
+      // The key would have been put in an empty slot of this group.
+      if (g.match_empty () != 0)
+        return -1;
+
+      pos = (pos + step) & mask;
+    }
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::find_or_bind_i (const EXT_ID &ext_id,
+                                                                                       const INT_ID &int_id,
+                                                                                       size_t &slot)
+{
+  ACE_UINT64 const h = this->mixed_hash (ext_id);
+
+  ssize_t const found = this->find_i (ext_id, h);
+  if (found != -1)
+    {
+      slot = static_cast<size_t> (found);
+      return 1;
+    }
+
+  if (this->capacity_ == 0 && this->grow_i () == -1)
+    return -1;
+
+  slot = this->find_non_full_i (h);
+
+  // Reusing a deleted slot doesn't use up an empty one.
+  if (this->growth_left_ == 0
+      && this->ctrl_[slot] != ACE_Flat_Hash_Map_Group::DELETED)
+    {
+      if (this->grow_i () == -1)
+        return -1;
+      slot = this->find_non_full_i (h);
+    }
+
+  new (&this->slots_[slot]) ENTRY (ext_id, int_id);
+
+  if (this->ctrl_[slot] == ACE_Flat_Hash_Map_Group::EMPTY)
+    --this->growth_left_;
+  this->set_ctrl_i (slot, static_cast<signed char> (h & 0x7F));
+  ++this->cur_size_;
+
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> void
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::unbind_i (size_t slot)
+{
+  size_t const width = ACE_Flat_Hash_Map_Group::WIDTH;
+  size_t const mask = this->capacity_ - 1;
+
+  ACE_DES_FREE_TEMPLATE2 (&this->slots_[slot], ACE_NOOP,
+                          ACE_Flat_Hash_Map_Entry, EXT_ID, INT_ID);
+  --this->cur_size_;
+
+  // A lookup stops at the first group with an empty slot.  If every
+  // group holding this slot has an empty slot no lookup went past
+  // this slot, so it can be made empty again, otherwise it has to be
+  // marked as deleted to keep the lookups going.
+  ACE_Flat_Hash_Map_Group::Mask const empty_before =
+    ACE_Flat_Hash_Map_Group (this->ctrl_ + ((slot - width) & mask)).match_empty ();
+  ACE_Flat_Hash_Map_Group::Mask const empty_after =
+    ACE_Flat_Hash_Map_Group (this->ctrl_ + slot).match_empty ();
+
+  bool const was_never_full =
+    empty_before != 0 && empty_after != 0
+    && (width - 1 - ACE_Flat_Hash_Map_Group::highest (empty_before))
+       + ACE_Flat_Hash_Map_Group::lowest (empty_after) < width;
+
+  if (was_never_full)
+    {
+      this->set_ctrl_i (slot, static_cast<signed char> (ACE_Flat_Hash_Map_Group::EMPTY));
+      ++this->growth_left_;
+    }
+  else
+    this->set_ctrl_i (slot, static_cast<signed char> (ACE_Flat_Hash_Map_Group::DELETED));
+}
+
+// ------------------------------------------------------------
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> void
+ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::dump_i (void) const
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::dump_i");
+
+  ACELIB_DEBUG ((LM_DEBUG, ACE_BEGIN_DUMP, this));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_TEXT ("index_ = %d "), this->index_));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_END_DUMP));
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> void
+ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::dump (void) const
+{
+#if defined (ACE_HAS_DUMP)
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::dump");
+
+  this->dump_i ();
+#endif /* ACE_HAS_DUMP */
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> void
+ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::dump (void) const
+{
+#if defined (ACE_HAS_DUMP)
+  ACE_TRACE ("ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::dump");
+
+  this->dump_i ();
+#endif /* ACE_HAS_DUMP */
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> void
+ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::dump (void) const
+{
+#if defined (ACE_HAS_DUMP)
+  ACE_TRACE ("ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::dump");
+
+  this->dump_i ();
+#endif /* ACE_HAS_DUMP */
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* ACE_FLAT_HASH_MAP_T_CPP */
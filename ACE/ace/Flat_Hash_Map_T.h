@@ -0,0 +1,719 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Flat_Hash_Map_T.h
+ *
+ *  Open addressing hash map with the interface of
+ *  ACE_Hash_Map_Manager_Ex.
+ */
+//=============================================================================
+
+#ifndef ACE_FLAT_HASH_MAP_T_H
+#define ACE_FLAT_HASH_MAP_T_H
+#include /**/ "ace/pre.h"
+
+#include /**/ "ace/config-all.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/Default_Constants.h"
+#include "ace/Functor_T.h"
+#include "ace/Log_Category.h"
+#include "ace/Basic_Types.h"
+#include <iterator>
+
+#if !defined (ACE_FLAT_HASH_MAP_LACKS_SSE2)
+# if defined (__SSE2__) || defined (_M_X64) \
+     || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define ACE_FLAT_HASH_MAP_HAS_SSE2
+#   include /**/ <emmintrin.h>
+# endif
+#endif /* !ACE_FLAT_HASH_MAP_LACKS_SSE2 */
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class ACE_Allocator;
+
+/**
+ * @class ACE_Flat_Hash_Map_Entry
+ *
+ * @brief Define an entry in the flat hash table.
+ *
+ * Entries are stored in the table itself, there are no links.
+ */
+template <class EXT_ID, class INT_ID>
+class ACE_Flat_Hash_Map_Entry
+{
+public:
+  ACE_Flat_Hash_Map_Entry (const EXT_ID &ext_id,
+                           const INT_ID &int_id);
+
+  /// Key accessor.
+  EXT_ID& key (void);
+
+  /// Read-only key accessor.
+  const EXT_ID& key (void) const;
+
+  /// Item accessor.
+  INT_ID& item (void);
+
+  /// Read-only item accessor.
+  const INT_ID& item (void) const;
+
+  /// Key used to look up an entry.
+  EXT_ID ext_id_;
+
+  /// The contents of the entry itself.
+  INT_ID int_id_;
+
+  /// Dump the state of an object.
+  void dump (void) const;
+};
+
+/**
+ * @class ACE_Flat_Hash_Map_Group
+ *
+ * @brief A group of control bytes of an ACE_Flat_Hash_Map_Ex that is
+ * probed at once.
+ *
+ * Every slot of the table has a control byte telling whether the
+ * slot is empty, deleted, or full.  For a full slot the byte holds 7
+ * bits of the hash of its key, so most of the slots that don't hold
+ * the key looked for are rejected without comparing keys.  With SSE2
+ * a group is 16 bytes compared with a single instruction, otherwise
+ * it is 8 bytes compared within a 64 bit word.
+ *
+ * A match is returned as a mask, next() pops the index of the lowest
+ * matching slot from it.
+ */
+class ACE_Flat_Hash_Map_Group
+{
+public:
+  enum
+  {
+    EMPTY = -128,
+    DELETED = -2,
+#if defined (ACE_FLAT_HASH_MAP_HAS_SSE2)
+    WIDTH = 16
+#else
+    WIDTH = 8
+#endif /* ACE_FLAT_HASH_MAP_HAS_SSE2 */
+  };
+
+#if defined (ACE_FLAT_HASH_MAP_HAS_SSE2)
+  typedef ACE_UINT32 Mask;
+#else
+  typedef ACE_UINT64 Mask;
+#endif /* ACE_FLAT_HASH_MAP_HAS_SSE2 */
+
+  /// Load the WIDTH control bytes starting at @a ctrl.
+  explicit ACE_Flat_Hash_Map_Group (const signed char *ctrl);
+
+  /// Slots whose hash bits are @a h2.
+  Mask match (signed char h2) const;
+
+  /// Empty slots.
+  Mask match_empty (void) const;
+
+  /// Empty or deleted slots.
+  Mask match_empty_or_deleted (void) const;
+
+  /// Index of the lowest slot in @a mask, which is removed from it.
+  static size_t next (Mask &mask);
+
+  /// Index of the lowest and highest slot in a non-empty @a mask.
+  static size_t lowest (Mask mask);
+  static size_t highest (Mask mask);
+
+private:
+#if defined (ACE_FLAT_HASH_MAP_HAS_SSE2)
+  __m128i ctrl_;
+#else
+  ACE_UINT64 ctrl_;
+#endif /* ACE_FLAT_HASH_MAP_HAS_SSE2 */
+};
+
+// Forward decl.
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK>
+class ACE_Flat_Hash_Map_Iterator_Base_Ex;
+
+// Forward decl.
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK>
+class ACE_Flat_Hash_Map_Iterator_Ex;
+
+// Forward decl.
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK>
+class ACE_Flat_Hash_Map_Const_Iterator_Ex;
+
+// Forward decl.
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK>
+class ACE_Flat_Hash_Map_Reverse_Iterator_Ex;
+
+/**
+ * @class ACE_Flat_Hash_Map_Ex
+ *
+ * @brief Define a map abstraction that associates @c EXT_ID type
+ * objects with @c INT_ID type objects in a single open addressing
+ * table.
+ *
+ * This map offers the interface of ACE_Hash_Map_Manager_Ex, with
+ * the same @c HASH_KEY, @c COMPARE_KEYS and @c ACE_LOCK parameters and
+ * return values, so it can replace it where lookups dominate.  The
+ * entries live in one array allocated through an ACE_Allocator
+ * together with a control byte per entry, so binding a key does not
+ * allocate and a lookup touches one or two cache lines.  Lookups probe
+ * a group of control bytes at once, see ACE_Flat_Hash_Map_Group.  The
+ * table grows by doubling when it is 7/8 full.
+ *
+ * Unlike with ACE_Hash_Map_Manager_Ex, entries move when the table
+ * grows: an entry pointer or iterator is only valid until the next
+ * bind.  Unbinding does not move any entry, so the current entry can be
+ * unbound while iterating.
+ */
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK>
+class ACE_Flat_Hash_Map_Ex
+{
+public:
+  friend class ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>;
+
+  typedef EXT_ID
+          KEY;
+  typedef INT_ID
+          VALUE;
+  typedef ACE_LOCK lock_type;
+  typedef ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID>
+          ENTRY;
+
+  // = ACE-style iterator typedefs.
+  typedef ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+          ITERATOR;
+  typedef ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+          CONST_ITERATOR;
+  typedef ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+          REVERSE_ITERATOR;
+
+  // = STL-style iterator typedefs.
+  typedef ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+          iterator;
+  typedef ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+          const_iterator;
+  typedef ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+          reverse_iterator;
+
+  // = STL-style typedefs/traits.
+  typedef EXT_ID                                  key_type;
+  typedef INT_ID                                  data_type;
+  typedef ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID> value_type;
+  typedef value_type &                            reference;
+  typedef value_type const &                      const_reference;
+  typedef value_type *                            pointer;
+  typedef value_type const *                      const_pointer;
+  typedef ptrdiff_t                               difference_type;
+  typedef size_t                                  size_type;
+
+  // = Initialization and termination methods.
+
+  /**
+   * Initialize an ACE_Flat_Hash_Map_Ex with a default number of
+   * elements.
+   *
+   * @param table_alloc is the allocator of the table.  If @a
+   *        table_alloc is 0 it defaults to ACE_Allocator::instance().
+   */
+  ACE_Flat_Hash_Map_Ex (ACE_Allocator *table_alloc = 0);
+
+  /// Initialize an ACE_Flat_Hash_Map_Ex with room for @a size
+  /// elements.
+  ACE_Flat_Hash_Map_Ex (size_t size,
+                        ACE_Allocator *table_alloc = 0);
+
+  /// Initialize an ACE_Flat_Hash_Map_Ex with room for @a size
+  /// elements.
+  /// @return -1 on failure, 0 on success
+  int open (size_t size = ACE_DEFAULT_MAP_SIZE,
+            ACE_Allocator *table_alloc = 0);
+
+  /// Close down the ACE_Flat_Hash_Map_Ex and release dynamically
+  /// allocated resources.
+  int close (void);
+
+  /// Removes all the entries in the ACE_Flat_Hash_Map_Ex, the table
+  /// keeps its size.
+  int unbind_all (void);
+
+  /// Cleanup the ACE_Flat_Hash_Map_Ex.
+  ~ACE_Flat_Hash_Map_Ex (void);
+
+  /**
+   * Associate @a ext_id with @a int_id.  If @a ext_id is already in
+   * the map then the map is not changed.
+   *
+   * @retval  0 If a new entry is bound successfully.
+   * @retval  1 If an attempt is made to bind an existing entry.
+   * @retval -1 If a failure occurs; check @c errno for more information.
+   */
+  int bind (const EXT_ID &ext_id,
+            const INT_ID &int_id);
+
+  /// Same as the bind() above, also returns the new entry in @a entry.
+  int bind (const EXT_ID &ext_id,
+            const INT_ID &int_id,
+            ENTRY *&entry);
+
+  /**
+   * Associate @a ext_id with @a int_id if and only if @a ext_id is not
+   * in the map.  If @a ext_id is already in the map then the @a int_id
+   * parameter is assigned the existing value in the map.  Returns 0 if
+   * a new entry is bound successfully, returns 1 if an attempt is made
+   * to bind an existing entry, and returns -1 if failures occur.
+   */
+  int trybind (const EXT_ID &ext_id,
+               INT_ID &int_id);
+
+  /// Same as the trybind() above, also returns the entry in @a entry.
+  int trybind (const EXT_ID &ext_id,
+               INT_ID &int_id,
+               ENTRY *&entry);
+
+  /**
+   * Reassociate @a ext_id with @a int_id.  If @a ext_id is not in the
+   * map then behaves just like bind().  Returns 0 if a new entry is
+   * bound successfully, returns 1 if an existing entry was rebound,
+   * and returns -1 if failures occur.
+   */
+  int rebind (const EXT_ID &ext_id,
+              const INT_ID &int_id);
+
+  /// Same as the rebind() above, also returns the entry in @a entry.
+  int rebind (const EXT_ID &ext_id,
+              const INT_ID &int_id,
+              ENTRY *&entry);
+
+  /// Same as the rebind() above, also returns the previous value in
+  /// @a old_int_id when an existing entry was rebound.
+  int rebind (const EXT_ID &ext_id,
+              const INT_ID &int_id,
+              INT_ID &old_int_id);
+
+  /// Same as the rebind() above, also returns the previous key and
+  /// value when an existing entry was rebound.
+  int rebind (const EXT_ID &ext_id,
+              const INT_ID &int_id,
+              EXT_ID &old_ext_id,
+              INT_ID &old_int_id);
+
+  /// Locate @a ext_id and pass out parameter via @a int_id.
+  /// Return 0 if found, returns -1 if not found.
+  int find (const EXT_ID &ext_id,
+            INT_ID &int_id) const;
+
+  /// Returns 0 if the @a ext_id is in the mapping, otherwise -1.
+  int find (const EXT_ID &ext_id) const;
+
+  /// Locate @a ext_id and pass out parameter via @a entry.  If found,
+  /// return 0, returns -1 if not found.
+  int find (const EXT_ID &ext_id,
+            ENTRY *&entry) const;
+
+  /**
+   * Unbind (remove) the @a ext_id from the map.  Don't return the
+   * @a int_id to the caller (this is useful for collections where the
+   * @c int_ids are *not* dynamically allocated...)
+   */
+  int unbind (const EXT_ID &ext_id);
+
+  /// Break any association of @a ext_id.  Returns the value of @a int_id
+  /// in case the caller needs to deallocate memory. Return 0 if the
+  /// unbind was successful, and returns -1 if there was no such
+  /// @a ext_id.
+  int unbind (const EXT_ID &ext_id,
+              INT_ID &int_id);
+
+  /// Remove @a entry from map. Return 0 if the unbind was successful,
+  /// and returns -1 if @a entry is not an entry of the map.
+  int unbind (ENTRY *entry);
+
+  /// Returns the current number of ACE_Flat_Hash_Map_Entry objects in
+  /// the map.
+  size_t current_size (void) const;
+
+  /// Return the number of slots of the table.
+  size_t total_size (void) const;
+
+  /**
+   * Returns a reference to the underlying @c ACE_LOCK.  This makes it
+   * possible to acquire the lock explicitly, which can be useful in
+   * some cases if you instantiate the ACE_Atomic_Op with an
+   * ACE_Recursive_Mutex or ACE_Process_Mutex, or if you need to
+   * guard the state of an iterator.
+   * @note The right name would be lock, but HP/C++ will choke on that!
+   */
+  ACE_LOCK &mutex (void);
+
+  /// Dump the state of an object.
+  void dump (void) const;
+
+  // = STL styled iterator factory functions.
+
+  /// Return forward iterator.
+  iterator begin (void);
+  iterator end (void);
+  const_iterator begin (void) const;
+  const_iterator end (void) const;
+
+  /// Return reverse iterator.
+  reverse_iterator rbegin (void);
+  reverse_iterator rend (void);
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+
+protected:
+  // = The following methods do the actual work.
+
+  /// Returns 1 if @a id1 == @a id2, else 0.  This is defined as a
+  /// separate method to facilitate template specialization.
+  int equal (const EXT_ID &id1, const EXT_ID &id2);
+
+  /// Compute the hash value of the @a ext_id.  This is defined as a
+  /// separate method to facilitate template specialization.
+  u_long hash (const EXT_ID &ext_id);
+
+  // = These methods assume locks are held by private methods.
+
+  /// Performs the lookup of @a ext_id.  Returns the slot of the entry
+  /// or -1 if it is not in the map.  @a h is the mixed hash of @a
+  /// ext_id.
+  ssize_t find_i (const EXT_ID &ext_id, ACE_UINT64 h);
+
+  /// Find the slot of @a ext_id, or else bind it to @a int_id.  @a
+  /// slot is the slot of the entry in either case.  Returns 0 if a new
+  /// entry was bound, 1 if the key was found and -1 on failure.
+  int find_or_bind_i (const EXT_ID &ext_id,
+                      const INT_ID &int_id,
+                      size_t &slot);
+
+  /// Remove the entry in @a slot.
+  void unbind_i (size_t slot);
+
+  /// Resize the table to @a capacity slots, a power of 2, and rebind
+  /// all the entries.
+  int resize_i (size_t capacity);
+
+  /// Make room for one more entry.
+  int grow_i (void);
+
+  /// First empty or deleted slot on the probe sequence of @a h.
+  size_t find_non_full_i (ACE_UINT64 h) const;
+
+  /// Set the control byte of @a slot, and its copy after the end of
+  /// the table.
+  void set_ctrl_i (size_t slot, signed char c);
+
+  /// Destroy all the entries without releasing the table.
+  void destroy_entries_i (void);
+
+  /// Close down a <Map_Manager_Ex>.  Must be called with locks held.
+  int close_i (void);
+
+  /// Removes all the entries in <Map_Manager_Ex>.  Must be called with
+  /// locks held.
+  int unbind_all_i (void);
+
+  /// Mixed hash value of @a ext_id, its low 7 bits are kept in the
+  /// control byte and the rest selects the first group to probe.
+  ACE_UINT64 mixed_hash (const EXT_ID &ext_id);
+
+  /// Pointer to a memory allocator used for the table.
+  ACE_Allocator *table_allocator_;
+
+  /// Synchronization variable for the MT_SAFE
+  /// @c ACE_Flat_Hash_Map_Ex.
+  mutable ACE_LOCK lock_;
+
+  /// Function object used for hashing keys.
+  HASH_KEY hash_key_;
+
+  /// Function object used for comparing keys.
+  COMPARE_KEYS compare_keys_;
+
+  /// The entries, @c capacity_ of them.
+  ENTRY *slots_;
+
+  /// The control bytes, one per slot followed by a copy of the first
+  /// group so that a group can be loaded at any slot.
+  signed char *ctrl_;
+
+  /// Number of slots, 0 or a power of 2 no smaller than a group.
+  size_t capacity_;
+
+  /// Current number of entries in the table.
+  size_t cur_size_;
+
+  /// Number of empty slots that can be filled before the table must
+  /// grow.
+  size_t growth_left_;
+
+private:
+  // = Disallow these operations.
+  ACE_UNIMPLEMENTED_FUNC (void operator= (const ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &))
+  ACE_UNIMPLEMENTED_FUNC (ACE_Flat_Hash_Map_Ex (const ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &))
+};
+
+/**
+ * @class ACE_Flat_Hash_Map_Iterator_Base_Ex
+ *
+ * @brief Base iterator for the ACE_Flat_Hash_Map_Ex
+ *
+ * This class factors out common code from its templatized
+ * subclasses.
+ */
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK>
+class ACE_Flat_Hash_Map_Iterator_Base_Ex
+{
+public:
+  // = STL-style typedefs/traits.
+  typedef ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+          container_type;
+
+  // = std::iterator_traits typedefs/traits.
+  typedef typename container_type::value_type      value_type;
+  typedef typename container_type::reference       reference;
+  typedef typename container_type::pointer         pointer;
+  typedef typename container_type::difference_type difference_type;
+
+  /// Constructor, positioned at the slot @a index, which is moved
+  /// forward or backward to a full slot according to @a forward.
+  ACE_Flat_Hash_Map_Iterator_Base_Ex (const container_type &mm,
+                                      ssize_t index,
+                                      bool forward);
+
+  // = ITERATION methods.
+
+  /// Pass back the next <entry> that hasn't been seen in the Set.
+  /// Returns 0 when all items have been seen, else 1.
+  int next (ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID> *&next_entry) const;
+
+  /// Returns 1 when all items have been seen, else 0.
+  int done (void) const;
+
+  /// Returns a reference to the interal element @c this is pointing to.
+  ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID>& operator* (void) const;
+
+  /// Returns a pointer to the interal element @c this is pointing to.
+  ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID>* operator-> (void) const;
+
+  /// Returns reference the Flat_Hash_Map_Ex that is being iterated
+  /// over.
+  container_type& map (void);
+
+  /// Check if two iterators point to the same position
+  bool operator== (const ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &) const;
+  bool operator!= (const ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &) const;
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+
+protected:
+  /// Move forward by one element in the set.  Returns 0 when there's
+  /// no more item in the set after the current items, else 1.
+  int forward_i (void);
+
+  /// Move backward by one element in the set.  Returns 0 when there's
+  /// no more item in the set before the current item, else 1.
+  int reverse_i (void);
+
+  /// Move forward to the first full slot at or after index_.
+  void skip_forward_i (void);
+
+  /// Move backward to the first full slot at or before index_.
+  void skip_reverse_i (void);
+
+  /// Dump the state of an object.
+  void dump_i (void) const;
+
+  /// Map we are iterating over.
+  container_type *map_man_;
+
+  /// Slot of the current entry, -1 or the capacity of the table
+  /// when done.
+  ssize_t index_;
+};
+
+/**
+ * @class ACE_Flat_Hash_Map_Iterator_Ex
+ *
+ * @brief Forward iterator for the ACE_Flat_Hash_Map_Ex.
+ *
+ * This class does not perform any internal locking of the
+ * ACE_Flat_Hash_Map_Ex it is iterating upon since locking is
+ * inherently inefficient and/or error-prone within an STL-style
+ * iterator.  If you require locking, you can explicitly use an
+ * ACE_GUARD or ACE_READ_GUARD on the ACE_Flat_Hash_Map_Ex's
+ * internal lock, which is accessible via its mutex() method.
+ */
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK>
+class ACE_Flat_Hash_Map_Iterator_Ex : public ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+{
+public:
+  // = STL-style traits/typedefs
+  typedef typename ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::container_type
+          container_type;
+
+  typedef std::bidirectional_iterator_tag          iterator_category;
+  typedef typename container_type::value_type      value_type;
+  typedef typename container_type::reference       reference;
+  typedef typename container_type::pointer         pointer;
+  typedef typename container_type::difference_type difference_type;
+
+  // = Initialization method.
+  ACE_Flat_Hash_Map_Iterator_Ex (container_type &mm,
+                                 int tail = 0);
+
+  // = Iteration methods.
+  /// Move forward by one element in the set.  Returns 0 when all the
+  /// items in the set have been seen, else 1.
+  int advance (void);
+
+  /// Dump the state of an object.
+  void dump (void) const;
+
+  // = STL styled iteration, compare, and reference functions.
+
+  /// Prefix advance.
+  ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &operator++ (void);
+
+  /// Postfix advance.
+  ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> operator++ (int);
+
+  /// Prefix reverse.
+  ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &operator-- (void);
+
+  /// Postfix reverse.
+  ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> operator-- (int);
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+};
+
+/**
+ * @class ACE_Flat_Hash_Map_Const_Iterator_Ex
+ *
+ * @brief Const forward iterator for the ACE_Flat_Hash_Map_Ex.
+ *
+ * See ACE_Flat_Hash_Map_Iterator_Ex about locking.
+ */
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK>
+class ACE_Flat_Hash_Map_Const_Iterator_Ex : public ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+{
+public:
+  // = STL-style traits/typedefs
+  typedef typename ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::container_type
+          container_type;
+
+  typedef std::bidirectional_iterator_tag          iterator_category;
+  typedef typename container_type::value_type      value_type;
+  typedef typename container_type::const_reference reference;
+  typedef typename container_type::const_pointer   pointer;
+  typedef typename container_type::difference_type difference_type;
+
+  // = Initialization method.
+  ACE_Flat_Hash_Map_Const_Iterator_Ex (const container_type &mm,
+                                       int tail = 0);
+
+  // = Iteration methods.
+  /// Move forward by one element in the set.  Returns 0 when all the
+  /// items in the set have been seen, else 1.
+  int advance (void);
+
+  /// Dump the state of an object.
+  void dump (void) const;
+
+  // = STL styled iteration, compare, and reference functions.
+
+  /// Prefix advance.
+  ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &operator++ (void);
+
+  /// Postfix advance.
+  ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> operator++ (int);
+
+  /// Prefix reverse.
+  ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &operator-- (void);
+
+  /// Postfix reverse.
+  ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> operator-- (int);
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+};
+
+/**
+ * @class ACE_Flat_Hash_Map_Reverse_Iterator_Ex
+ *
+ * @brief Reverse iterator for the ACE_Flat_Hash_Map_Ex.
+ *
+ * See ACE_Flat_Hash_Map_Iterator_Ex about locking.
+ */
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK>
+class ACE_Flat_Hash_Map_Reverse_Iterator_Ex : public ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+{
+public:
+  // = STL-style traits/typedefs
+  typedef typename ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::container_type
+          container_type;
+
+  typedef std::bidirectional_iterator_tag          iterator_category;
+  typedef typename container_type::value_type      value_type;
+  typedef typename container_type::reference       reference;
+  typedef typename container_type::pointer         pointer;
+  typedef typename container_type::difference_type difference_type;
+
+  // = Initialization method.
+  ACE_Flat_Hash_Map_Reverse_Iterator_Ex (container_type &mm,
+                                         bool head = false);
+
+  // = Iteration methods.
+  /// Move forward by one element in the set.  Returns 0 when all the
+  /// items in the set have been seen, else 1.
+  int advance (void);
+
+  /// Dump the state of an object.
+  void dump (void) const;
+
+  // = STL styled iteration, compare, and reference functions.
+
+  /// Prefix reverse.
+  ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &operator++ (void);
+
+  /// Postfix reverse.
+  ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> operator++ (int);
+
+  /// Prefix advance.
+  ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &operator-- (void);
+
+  /// Postfix advance.
+  ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> operator-- (int);
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#if defined (__ACE_INLINE__)
+#  include "ace/Flat_Hash_Map_T.inl"
+#endif /* __ACE_INLINE__ */
+
+#if defined (ACE_TEMPLATES_REQUIRE_SOURCE)
+#include "ace/Flat_Hash_Map_T.cpp"
+#endif /* ACE_TEMPLATES_REQUIRE_SOURCE */
+
+#if defined (ACE_TEMPLATES_REQUIRE_PRAGMA)
+#pragma implementation ("Flat_Hash_Map_T.cpp")
+#endif /* ACE_TEMPLATES_REQUIRE_PRAGMA */
+
+#include /**/ "ace/post.h"
+#endif /* ACE_FLAT_HASH_MAP_T_H */
@@ -0,0 +1,801 @@
+// -*- C++ -*-
+#include "ace/Guard_T.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+// The group methods are not templates, they have to be inline even
+// when the other methods are not.
+
+inline
+ACE_Flat_Hash_Map_Group::ACE_Flat_Hash_Map_Group (const signed char *ctrl)
+{
+#if defined (ACE_FLAT_HASH_MAP_HAS_SSE2)
+  this->ctrl_ = _mm_loadu_si128 (reinterpret_cast<const __m128i *> (ctrl));
+#else
+  this->ctrl_ = 0;
+  for (size_t i = 0; i < WIDTH; ++i)
+    this->ctrl_ |= static_cast<ACE_UINT64> (static_cast<unsigned char> (ctrl[i])) << (8 * i);
+#endif /* ACE_FLAT_HASH_MAP_HAS_SSE2 */
+}
+
+#if defined (ACE_FLAT_HASH_MAP_HAS_SSE2)
+
+inline ACE_Flat_Hash_Map_Group::Mask
+ACE_Flat_Hash_Map_Group::match (signed char h2) const
+{
+  return static_cast<Mask> (
+    _mm_movemask_epi8 (_mm_cmpeq_epi8 (_mm_set1_epi8 (h2), this->ctrl_)));
+}
+
+inline ACE_Flat_Hash_Map_Group::Mask
+ACE_Flat_Hash_Map_Group::match_empty (void) const
+{
+  return this->match (static_cast<signed char> (EMPTY));
+}
+
+inline ACE_Flat_Hash_Map_Group::Mask
+ACE_Flat_Hash_Map_Group::match_empty_or_deleted (void) const
+{
+  // Only the empty and deleted control bytes are negative.
+  return static_cast<Mask> (_mm_movemask_epi8 (this->ctrl_));
+}
+
+#else
+
+// Each byte of the group is tested in parallel within a 64 bit word.
+// match() may report a slot just after a matching slot as matching
+// as well, this only costs a key comparison.
+
+inline ACE_Flat_Hash_Map_Group::Mask
+ACE_Flat_Hash_Map_Group::match (signed char h2) const
+{
+  Mask const lsbs = ACE_UINT64_LITERAL (0x0101010101010101);
+  Mask const msbs = ACE_UINT64_LITERAL (0x8080808080808080);
+  Mask const x = this->ctrl_ ^ (lsbs * static_cast<unsigned char> (h2));
+  return (x - lsbs) & ~x & msbs;
+}
+
+inline ACE_Flat_Hash_Map_Group::Mask
+ACE_Flat_Hash_Map_Group::match_empty (void) const
+{
+  // EMPTY is the only control byte with the high bit set and bit 1
+  // clear.
+  Mask const msbs = ACE_UINT64_LITERAL (0x8080808080808080);
+  return this->ctrl_ & (~this->ctrl_ << 6) & msbs;
+}
+
+inline ACE_Flat_Hash_Map_Group::Mask
+ACE_Flat_Hash_Map_Group::match_empty_or_deleted (void) const
+{
+  Mask const msbs = ACE_UINT64_LITERAL (0x8080808080808080);
+  return this->ctrl_ & msbs;
+}
+
+#endif /* ACE_FLAT_HASH_MAP_HAS_SSE2 */
+
+inline size_t
+ACE_Flat_Hash_Map_Group::lowest (Mask mask)
+{
+  size_t bit = 0;
+#if defined (__GNUC__)
+  bit = sizeof (Mask) == 8 ? __builtin_ctzll (mask) : __builtin_ctz (mask);
+#else
+  while ((mask & 1) == 0)
+    {
+      mask >>= 1;
+      ++bit;
+    }
+#endif /* __GNUC__ */
+#if defined (ACE_FLAT_HASH_MAP_HAS_SSE2)
+  return bit;
+#else
+  return bit >> 3;
+#endif /* ACE_FLAT_HASH_MAP_HAS_SSE2 */
+}
+
+inline size_t
+ACE_Flat_Hash_Map_Group::highest (Mask mask)
+{
+  size_t bit = 0;
+  while (mask >>= 1)
+    ++bit;
+#if defined (ACE_FLAT_HASH_MAP_HAS_SSE2)
+  return bit;
+#else
+  return bit >> 3;
+#endif /* ACE_FLAT_HASH_MAP_HAS_SSE2 */
+}
+
+inline size_t
+ACE_Flat_Hash_Map_Group::next (Mask &mask)
+{
+  size_t const i = lowest (mask);
+  mask &= mask - 1;
+  return i;
+}
+
+template <class EXT_ID, class INT_ID> ACE_INLINE
+ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID>::ACE_Flat_Hash_Map_Entry (const EXT_ID &ext_id,
+                                                                  const INT_ID &int_id)
+  : ext_id_ (ext_id),
+    int_id_ (int_id)
+{
+}
+
+template <class EXT_ID, class INT_ID> ACE_INLINE EXT_ID &
+ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID>::key ()
+{
+  return ext_id_;
+}
+
+template <class EXT_ID, class INT_ID> ACE_INLINE const EXT_ID &
+ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID>::key () const
+{
+  return ext_id_;
+}
+
+template <class EXT_ID, class INT_ID> ACE_INLINE INT_ID &
+ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID>::item ()
+{
+  return int_id_;
+}
+
+template <class EXT_ID, class INT_ID> ACE_INLINE const INT_ID &
+ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID>::item () const
+{
+  return int_id_;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::ACE_Flat_Hash_Map_Ex (size_t size,
+                                                                                              ACE_Allocator *table_alloc)
+  : table_allocator_ (table_alloc),
+    slots_ (0),
+    ctrl_ (0),
+    capacity_ (0),
+    cur_size_ (0),
+    growth_left_ (0)
+{
+  if (this->open (size, table_alloc) == -1)
+    ACELIB_ERROR ((LM_ERROR, ACE_TEXT ("ACE_Flat_Hash_Map_Ex\n")));
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::ACE_Flat_Hash_Map_Ex (ACE_Allocator *table_alloc)
+  : table_allocator_ (table_alloc),
+    slots_ (0),
+    ctrl_ (0),
+    capacity_ (0),
+    cur_size_ (0),
+    growth_left_ (0)
+{
+  if (this->open (ACE_DEFAULT_MAP_SIZE, table_alloc) == -1)
+    ACELIB_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"),
+                ACE_TEXT ("ACE_Flat_Hash_Map_Ex open")));
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::close (void)
+{
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  return this->close_i ();
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::unbind_all (void)
+{
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  return this->unbind_all_i ();
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::~ACE_Flat_Hash_Map_Ex (void)
+{
+  this->close ();
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE size_t
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::current_size (void) const
+{
+  return this->cur_size_;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE size_t
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::total_size (void) const
+{
+  return this->capacity_;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE ACE_LOCK &
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::mutex (void)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Ex::mutex");
+  return this->lock_;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE u_long
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::hash (const EXT_ID &ext_id)
+{
+  return this->hash_key_ (ext_id);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::equal (const EXT_ID &id1,
+                                                                              const EXT_ID &id2)
+{
+  return this->compare_keys_ (id1, id2);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE ACE_UINT64
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::mixed_hash (const EXT_ID &ext_id)
+{
+  // Spread the bits of hash functions that only vary in their low
+  // bits, like the identity used for integers, over the whole word.
+  ACE_UINT64 const h =
+    static_cast<ACE_UINT64> (this->hash (ext_id)) * ACE_UINT64_LITERAL (0x9E3779B97F4A7C15);
+  return h ^ (h >> 32);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE void
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::set_ctrl_i (size_t slot,
+                                                                                   signed char c)
+{
+  this->ctrl_[slot] = c;
+  if (slot < static_cast<size_t> (ACE_Flat_Hash_Map_Group::WIDTH))
+    this->ctrl_[this->capacity_ + slot] = c;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::bind (const EXT_ID &ext_id,
+                                                                             const INT_ID &int_id)
+{
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  size_t slot = 0;
+  return this->find_or_bind_i (ext_id, int_id, slot);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::bind (const EXT_ID &ext_id,
+                                                                             const INT_ID &int_id,
+                                                                             ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID> *&entry)
+{
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  size_t slot = 0;
+  int const result = this->find_or_bind_i (ext_id, int_id, slot);
+  if (result != -1)
+    entry = this->slots_ + slot;
+  return result;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::trybind (const EXT_ID &ext_id,
+                                                                                INT_ID &int_id)
+{
+  ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID> *entry = 0;
+  return this->trybind (ext_id, int_id, entry);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::trybind (const EXT_ID &ext_id,
+                                                                                INT_ID &int_id,
+                                                                                ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID> *&entry)
+{
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  size_t slot = 0;
+  int const result = this->find_or_bind_i (ext_id, int_id, slot);
+  if (result != -1)
+    entry = this->slots_ + slot;
+  if (result == 1)
+    int_id = entry->int_id_;
+  return result;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::rebind (const EXT_ID &ext_id,
+                                                                               const INT_ID &int_id)
+{
+  ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID> *entry = 0;
+  return this->rebind (ext_id, int_id, entry);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::rebind (const EXT_ID &ext_id,
+                                                                               const INT_ID &int_id,
+                                                                               ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID> *&entry)
+{
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  size_t slot = 0;
+  int const result = this->find_or_bind_i (ext_id, int_id, slot);
+  if (result != -1)
+    entry = this->slots_ + slot;
+  if (result == 1)
+    entry->int_id_ = int_id;
+  return result;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::rebind (const EXT_ID &ext_id,
+                                                                               const INT_ID &int_id,
+                                                                               INT_ID &old_int_id)
+{
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  size_t slot = 0;
+  int const result = this->find_or_bind_i (ext_id, int_id, slot);
+  if (result == 1)
+    {
+      old_int_id = this->slots_[slot].int_id_;
+      this->slots_[slot].int_id_ = int_id;
+    }
+  return result;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::rebind (const EXT_ID &ext_id,
+                                                                               const INT_ID &int_id,
+                                                                               EXT_ID &old_ext_id,
+                                                                               INT_ID &old_int_id)
+{
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  size_t slot = 0;
+  int const result = this->find_or_bind_i (ext_id, int_id, slot);
+  if (result == 1)
+    {
+      old_ext_id = this->slots_[slot].ext_id_;
+      old_int_id = this->slots_[slot].int_id_;
+      this->slots_[slot].ext_id_ = ext_id;
+      this->slots_[slot].int_id_ = int_id;
+    }
+  return result;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::find (const EXT_ID &ext_id,
+                                                                             INT_ID &int_id) const
+{
+  ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> *nc_this =
+    const_cast <ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> *>
+    (this);
+
+  ACE_READ_GUARD_RETURN (ACE_LOCK, ace_mon, nc_this->lock_, -1);
+
+  ssize_t const slot = nc_this->find_i (ext_id, nc_this->mixed_hash (ext_id));
+  if (slot == -1)
+    return -1;
+  int_id = this->slots_[slot].int_id_;
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::find (const EXT_ID &ext_id) const
+{
+  ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> *nc_this =
+    const_cast <ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> *>
+    (this);
+
+  ACE_READ_GUARD_RETURN (ACE_LOCK, ace_mon, nc_this->lock_, -1);
+
+  return nc_this->find_i (ext_id, nc_this->mixed_hash (ext_id)) == -1 ? -1 : 0;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::find (const EXT_ID &ext_id,
+                                                                             ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID> *&entry) const
+{
+  ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> *nc_this =
+    const_cast <ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> *>
+    (this);
+
+  ACE_READ_GUARD_RETURN (ACE_LOCK, ace_mon, nc_this->lock_, -1);
+
+  ssize_t const slot = nc_this->find_i (ext_id, nc_this->mixed_hash (ext_id));
+  if (slot == -1)
+    return -1;
+  entry = nc_this->slots_ + slot;
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::unbind (const EXT_ID &ext_id)
+{
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  ssize_t const slot = this->find_i (ext_id, this->mixed_hash (ext_id));
+  if (slot == -1)
+    {
+      errno = ENOENT;
+      return -1;
+    }
+  this->unbind_i (slot);
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::unbind (const EXT_ID &ext_id,
+                                                                               INT_ID &int_id)
+{
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  ssize_t const slot = this->find_i (ext_id, this->mixed_hash (ext_id));
+  if (slot == -1)
+    {
+      errno = ENOENT;
+      return -1;
+    }
+  int_id = this->slots_[slot].int_id_;
+  this->unbind_i (slot);
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::unbind (ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID> *entry)
+{
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, this->lock_, -1);
+
+  if (entry < this->slots_ || entry >= this->slots_ + this->capacity_
+      || this->ctrl_[entry - this->slots_] < 0)
+    {
+      errno = ENOENT;
+      return -1;
+    }
+  this->unbind_i (entry - this->slots_);
+  return 0;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+typename ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::iterator
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::begin (void)
+{
+  return iterator (*this);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+typename ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::iterator
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::end (void)
+{
+  return iterator (*this, 1);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+typename ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::const_iterator
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::begin (void) const
+{
+  return const_iterator (*this);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+typename ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::const_iterator
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::end (void) const
+{
+  return const_iterator (*this, 1);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+typename ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::reverse_iterator
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::rbegin (void)
+{
+  return reverse_iterator (*this);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+typename ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::reverse_iterator
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::rend (void)
+{
+  return reverse_iterator (*this, true);
+}
+
+// ------------------------------------------------------------
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::ACE_Flat_Hash_Map_Iterator_Base_Ex (const container_type &mm,
+                                                                                                                          ssize_t index,
+                                                                                                                          bool forward)
+  : map_man_ (const_cast<container_type *> (&mm)),
+    index_ (index)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::ACE_Flat_Hash_Map_Iterator_Base_Ex");
+
+  if (forward)
+    this->skip_forward_i ();
+  else
+    this->skip_reverse_i ();
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::next (ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID> *&entry) const
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::next");
+
+  if (this->done ())
+    return 0;
+
+  entry = this->map_man_->slots_ + this->index_;
+  return 1;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::done (void) const
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::done");
+
+  return this->index_ < 0
+    || this->index_ >= static_cast<ssize_t> (this->map_man_->capacity_);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID> &
+ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator* (void) const
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator*");
+  return this->map_man_->slots_[this->index_];
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Entry<EXT_ID, INT_ID> *
+ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator-> (void) const
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator->");
+  return this->map_man_->slots_ + this->index_;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &
+ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::map (void)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::map");
+  return *this->map_man_;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE bool
+ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator== (const ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &rhs) const
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator==");
+  // All the done positions are the same.
+  return this->map_man_ == rhs.map_man_
+    && (this->index_ == rhs.index_ || (this->done () && rhs.done ()));
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE bool
+ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator!= (const ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &rhs) const
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator!=");
+  return !(*this == rhs);
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE void
+ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::skip_forward_i (void)
+{
+  ssize_t const capacity = static_cast<ssize_t> (this->map_man_->capacity_);
+  if (this->index_ < 0)
+    this->index_ = 0;
+  while (this->index_ < capacity && this->map_man_->ctrl_[this->index_] < 0)
+    ++this->index_;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE void
+ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::skip_reverse_i (void)
+{
+  ssize_t const capacity = static_cast<ssize_t> (this->map_man_->capacity_);
+  if (this->index_ >= capacity)
+    this->index_ = capacity - 1;
+  while (this->index_ >= 0 && this->map_man_->ctrl_[this->index_] < 0)
+    --this->index_;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::forward_i (void)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::forward_i");
+
+  if (this->index_ < static_cast<ssize_t> (this->map_man_->capacity_))
+    {
+      ++this->index_;
+      this->skip_forward_i ();
+    }
+  return !this->done ();
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::reverse_i (void)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::reverse_i");
+
+  if (this->index_ >= 0)
+    {
+      --this->index_;
+      this->skip_reverse_i ();
+    }
+  return !this->done ();
+}
+
+// ------------------------------------------------------------
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::ACE_Flat_Hash_Map_Iterator_Ex (container_type &mm,
+                                                                                                                int tail)
+  : ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> (mm,
+                                                                                          tail == 0 ? 0 : static_cast<ssize_t> (mm.total_size ()),
+                                                                                          true)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::ACE_Flat_Hash_Map_Iterator_Ex");
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::advance (void)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::advance");
+  return this->forward_i ();
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &
+ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator++ (void)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator++ (void)");
+
+  this->forward_i ();
+  return *this;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator++ (int)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator++ (int)");
+
+  ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> retv (*this);
+  ++*this;
+  return retv;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &
+ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator-- (void)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator-- (void)");
+
+  this->reverse_i ();
+  return *this;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator-- (int)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator-- (int)");
+
+  ACE_Flat_Hash_Map_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> retv (*this);
+  --*this;
+  return retv;
+}
+
+// ------------------------------------------------------------
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::ACE_Flat_Hash_Map_Const_Iterator_Ex (const container_type &mm,
+                                                                                                                            int tail)
+  : ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> (mm,
+                                                                                          tail == 0 ? 0 : static_cast<ssize_t> (mm.total_size ()),
+                                                                                          true)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::ACE_Flat_Hash_Map_Const_Iterator_Ex");
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::advance (void)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::advance");
+  return this->forward_i ();
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &
+ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator++ (void)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator++ (void)");
+
+  this->forward_i ();
+  return *this;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator++ (int)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator++ (int)");
+
+  ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> retv (*this);
+  ++*this;
+  return retv;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &
+ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator-- (void)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator-- (void)");
+
+  this->reverse_i ();
+  return *this;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator-- (int)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator-- (int)");
+
+  ACE_Flat_Hash_Map_Const_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> retv (*this);
+  --*this;
+  return retv;
+}
+
+// ------------------------------------------------------------
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::ACE_Flat_Hash_Map_Reverse_Iterator_Ex (container_type &mm,
+                                                                                                                                bool head)
+  : ACE_Flat_Hash_Map_Iterator_Base_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> (mm,
+                                                                                          head ? -1 : static_cast<ssize_t> (mm.total_size ()) - 1,
+                                                                                          false)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::ACE_Flat_Hash_Map_Reverse_Iterator_Ex");
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE int
+ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::advance (void)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::advance");
+  return this->reverse_i ();
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &
+ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator++ (void)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator++ (void)");
+
+  this->reverse_i ();
+  return *this;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator++ (int)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator++ (int)");
+
+  ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> retv (*this);
+  ++*this;
+  return retv;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> &
+ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator-- (void)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator-- (void)");
+
+  this->forward_i ();
+  return *this;
+}
+
+template <class EXT_ID, class INT_ID, class HASH_KEY, class COMPARE_KEYS, class ACE_LOCK> ACE_INLINE
+ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>
+ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator-- (int)
+{
+  ACE_TRACE ("ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK>::operator-- (int)");
+
+  ACE_Flat_Hash_Map_Reverse_Iterator_Ex<EXT_ID, INT_ID, HASH_KEY, COMPARE_KEYS, ACE_LOCK> retv (*this);
+  --*this;
+  return retv;
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
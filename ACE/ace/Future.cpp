@@ -18,6 +18,11 @@ ACE_ALLOC_HOOK_DEFINE_Tc(ACE_Future_Holder)
 ACE_ALLOC_HOOK_DEFINE_Tc(ACE_Future_Observer)
 ACE_ALLOC_HOOK_DEFINE_Tc(ACE_Future_Rep)
 ACE_ALLOC_HOOK_DEFINE_Tc(ACE_Future)
+ACE_ALLOC_HOOK_DEFINE_Tc(ACE_Future_When_State)
+ACE_ALLOC_HOOK_DEFINE_Tc(ACE_Future_When_Observer)
+#if defined (ACE_HAS_CPP11)
+ACE_ALLOC_HOOK_DEFINE_Tccc(ACE_Future_Continuation)
+#endif /* ACE_HAS_CPP11 */
 
 template <class T>
 ACE_Future_Holder<T>::ACE_Future_Holder (void)
@@ -45,6 +50,11 @@ ACE_Future_Observer<T>::~ACE_Future_Observer (void)
 {
 }
 
+template <class T> void
+ACE_Future_Observer<T>::abandon (void)
+{
+}
+
 // Dump the state of an object.
 
 template <class T> void
@@ -54,9 +64,9 @@ ACE_Future_Rep<T>::dump (void) const
   ACELIB_DEBUG ((LM_DEBUG, ACE_BEGIN_DUMP, this));
   ACELIB_DEBUG ((LM_DEBUG,
               "ref_count_ = %d\n",
- (int) this->ref_count_));
+ (int) this->ref_count_.value ()));
   ACELIB_DEBUG ((LM_INFO,"value_:\n"));
-  if (this->value_)
+  if (this->ready ())
     ACELIB_DEBUG ((LM_DEBUG, ACE_TEXT (" (NON-NULL)\n")));
   else
     //FUZZ: disable check_for_NULL
@@ -100,8 +110,6 @@ template <class T> ACE_Future_Rep<T> *
 ACE_Future_Rep<T>::attach (ACE_Future_Rep<T>*& rep)
 {
   ACE_ASSERT (rep != 0);
-  // Use value_ready_mutex_ for both condition and ref count management
-  ACE_GUARD_RETURN (ACE_SYNCH_RECURSIVE_MUTEX, r_mon, rep->value_ready_mutex_, 0);
   ++rep->ref_count_;
   return rep;
 }
@@ -110,17 +118,10 @@ template <class T> void
 ACE_Future_Rep<T>::detach (ACE_Future_Rep<T>*& rep)
 {
   ACE_ASSERT (rep != 0);
-  // Use value_ready_mutex_ for both condition and ref count management
-  ACE_GUARD (ACE_SYNCH_RECURSIVE_MUTEX, r_mon, rep->value_ready_mutex_);
 
-  if (rep->ref_count_-- == 0)
-    {
-      ACE_MT (r_mon.release ());
-      // We do not need the lock when deleting the representation.
-      // There should be no side effects from deleting rep and we don
-      // not want to release a deleted mutex.
-      delete rep;
-    }
+  // The count starts at zero for the first reference.
+  if (--rep->ref_count_ == -1)
+    delete rep;
 }
 
 template <class T> void
@@ -128,21 +129,13 @@ ACE_Future_Rep<T>::assign (ACE_Future_Rep<T>*& rep, ACE_Future_Rep<T>* new_rep)
 {
   ACE_ASSERT (rep != 0);
   ACE_ASSERT (new_rep != 0);
-  // Use value_ready_mutex_ for both condition and ref count management
-  ACE_GUARD (ACE_SYNCH_RECURSIVE_MUTEX, r_mon, rep->value_ready_mutex_);
 
   ACE_Future_Rep<T>* old = rep;
   rep = new_rep;
 
   // detached old last for exception safety
-  if (old->ref_count_-- == 0)
-    {
-      ACE_MT (r_mon.release ());
-      // We do not need the lock when deleting the representation.
-      // There should be no side effects from deleting rep and we don
-      // not want to release a deleted mutex.
-      delete old;
-    }
+  if (--old->ref_count_ == -1)
+    delete old;
 }
 
 template <class T>
@@ -156,7 +149,27 @@ ACE_Future_Rep<T>::ACE_Future_Rep (void)
 template <class T>
 ACE_Future_Rep<T>::~ACE_Future_Rep (void)
 {
-  delete this->value_;
+  T *value = this->value_;
+  delete value;
+
+  // The observers of a value that is never going to be set.  They are
+  // taken out under the lock, since when_any() may detach them from
+  // another thread.
+  OBSERVER_COLLECTION observers;
+  {
+    ACE_GUARD (ACE_SYNCH_RECURSIVE_MUTEX, ace_mon, this->value_ready_mutex_);
+    observers = this->observer_collection_;
+    this->observer_collection_.reset ();
+  }
+
+  typename OBSERVER_COLLECTION::iterator iterator = observers.begin ();
+  typename OBSERVER_COLLECTION::iterator end = observers.end ();
+  while (iterator != end)
+    {
+      OBSERVER *observer = *iterator++;
+      if (observer)
+        observer->abandon ();
+    }
 }
 
 template <class T> int
@@ -170,43 +183,51 @@ ACE_Future_Rep<T>::set (const T &r,
                         ACE_Future<T> &caller)
 {
   // If the value is already produced, ignore it...
-  if (this->value_ == 0)
+  if (this->value_ != 0)
+    return 0;
+
+  OBSERVER_COLLECTION observers;
+  int result = 0;
+  {
+    ACE_GUARD_RETURN (ACE_SYNCH_RECURSIVE_MUTEX,
+                      ace_mon,
+                      this->value_ready_mutex_,
+                      -1);
+    // Otherwise, create a new result value.  Note the use of the
+    // Double-checked locking pattern to avoid multiple allocations.
+
+    if (this->value_ != 0)
+      return 0;
+
+    // Only publish the value once it is constructed.
+    T *value = 0;
+    ACE_NEW_RETURN (value,
+                    T (r),
+                    -1);
+    this->value_ = value;
+
+    // Remove all subscribed observers, no more are attached now.
+    observers = this->observer_collection_;
+    this->observer_collection_.reset ();
+
+    // Signal all the waiting threads.
+    result = this->value_ready_.broadcast ();
+
+    // Destructor releases the lock.
+  }
+
+  // Notify the observers without the lock held, so that they may
+  // detach observers from other futures.
+  typename OBSERVER_COLLECTION::iterator iterator = observers.begin ();
+  typename OBSERVER_COLLECTION::iterator end = observers.end ();
+  while (iterator != end)
     {
-      ACE_GUARD_RETURN (ACE_SYNCH_RECURSIVE_MUTEX,
-                        ace_mon,
-                        this->value_ready_mutex_,
-                        -1);
-      // Otherwise, create a new result value.  Note the use of the
-      // Double-checked locking pattern to avoid multiple allocations.
-
-      if (this->value_ == 0)       // Still no value, so proceed
-        {
-          ACE_NEW_RETURN (this->value_,
-                          T (r),
-                          -1);
-
-          // Remove and notify all subscribed observers.
-          typename OBSERVER_COLLECTION::iterator iterator =
-            this->observer_collection_.begin ();
-
-          typename OBSERVER_COLLECTION::iterator end =
-            this->observer_collection_.end ();
-
-          while (iterator != end)
-            {
-              OBSERVER *observer = *iterator++;
-              if (observer)
-              {
-                observer->update (caller);
-              }
-            }
-
-          // Signal all the waiting threads.
-          return this->value_ready_.broadcast ();
-        }
-      // Destructor releases the lock.
+      OBSERVER *observer = *iterator++;
+      if (observer)
+        observer->update (caller);
     }
-  return 0;
+
+  return result;
 }
 
 template <class T> int
@@ -214,7 +235,8 @@ ACE_Future_Rep<T>::get (T &value,
                         ACE_Time_Value *tv) const
 {
   // If the value is already produced, return it.
-  if (this->value_ == 0)
+  T *result = this->value_;
+  if (result == 0)
     {
       ACE_GUARD_RETURN (ACE_SYNCH_RECURSIVE_MUTEX, ace_mon,
                         this->value_ready_mutex_,
@@ -222,7 +244,7 @@ ACE_Future_Rep<T>::get (T &value,
       // If the value is not yet defined we must block until the
       // producer writes to it.
 
-      while (this->value_ == 0)
+      while ((result = this->value_) == 0)
         // Perform a timed wait.
         if (this->value_ready_.wait (tv) == -1)
           return -1;
@@ -230,7 +252,7 @@ ACE_Future_Rep<T>::get (T &value,
       // Destructor releases the lock.
     }
 
-  value = *this->value_;
+  value = *result;
   return 0;
 }
 
@@ -238,20 +260,20 @@ template <class T> int
 ACE_Future_Rep<T>::attach (ACE_Future_Observer<T> *observer,
                           ACE_Future<T> &caller)
 {
-  ACE_GUARD_RETURN (ACE_SYNCH_RECURSIVE_MUTEX, ace_mon, this->value_ready_mutex_, -1);
+  {
+    ACE_GUARD_RETURN (ACE_SYNCH_RECURSIVE_MUTEX, ace_mon, this->value_ready_mutex_, -1);
 
-  // Otherwise, create a new result value.  Note the use of the
-  // Double-checked locking pattern to avoid corrupting the list.
+    // Note the use of the Double-checked locking pattern to avoid
+    // corrupting the list.
+    if (this->value_ == 0)
+      return this->observer_collection_.insert (observer);
+  }
 
-  int result = 1;
+  // The value is already produced, notify the observer like set()
+  // does, without the lock held.
+  observer->update (caller);
 
-  // If the value is already produced, then notify observer
-  if (this->value_ == 0)
-    result = this->observer_collection_.insert (observer);
-  else
-      observer->update (caller);
-
-  return result;
+  return 1;
 }
 
 template <class T> int
@@ -268,7 +290,8 @@ template <class T>
 ACE_Future_Rep<T>::operator T ()
 {
   // If the value is already produced, return it.
-  if (this->value_ == 0)
+  T *result = this->value_;
+  if (result == 0)
     {
       // Constructor of ace_mon acquires the mutex.
       ACE_GUARD_RETURN (ACE_SYNCH_RECURSIVE_MUTEX, ace_mon, this->value_ready_mutex_, 0);
@@ -278,7 +301,7 @@ ACE_Future_Rep<T>::operator T ()
 
       // Wait ``forever.''
 
-      while (this->value_ == 0)
+      while ((result = this->value_) == 0)
         if (this->value_ready_.wait () == -1)
           // What to do in this case since we've got to indicate
           // failure somehow?  Exceptions would be nice, but they're
@@ -288,7 +311,7 @@ ACE_Future_Rep<T>::operator T ()
       // Destructor releases the mutex
     }
 
-  return *this->value_;
+  return *result;
 }
 
 template <class T>
@@ -410,6 +433,74 @@ ACE_Future<T>::operator = (const ACE_Future<T> &rhs)
                       FUTURE_REP::attach (r.future_rep_));
 }
 
+#if defined (ACE_HAS_CPP11)
+template <class T>
+template <class F>
+ACE_Future<typename ACE_Future_Continuation_Result<T, F>::type>
+ACE_Future<T>::then (F f, ACE_Executor *executor) const
+{
+  typedef typename ACE_Future_Continuation_Result<T, F>::type RESULT;
+  typedef ACE_Future_Continuation<T, RESULT, F> CONTINUATION;
+
+  ACE_Future<RESULT> result;
+  ACE_Future<T> source (*this);
+
+  CONTINUATION *continuation = 0;
+  ACE_NEW_RETURN (continuation,
+                  CONTINUATION (std::move (f), result, executor),
+                  result);
+
+  // If the value is already set this runs the continuation.
+  if (source.attach (continuation) == -1)
+    delete continuation;
+
+  return result;
+}
+#endif /* ACE_HAS_CPP11 */
+
+template <class T> ACE_Future<size_t>
+ACE_Future<T>::when_all (const ACE_Future<T> futures[], size_t n)
+{
+  ACE_Future<size_t> result;
+  if (n == 0)
+    {
+      result.set (0);
+      return result;
+    }
+
+  typedef ACE_Future_When_State<T> STATE;
+  STATE *state = 0;
+  ACE_NEW_RETURN (state,
+                  STATE (result, n, false),
+                  result);
+
+  for (size_t i = 0; i != n && state->attach (futures[i], i); ++i)
+    continue;
+
+  state->release ();
+  return result;
+}
+
+template <class T> ACE_Future<size_t>
+ACE_Future<T>::when_any (const ACE_Future<T> futures[], size_t n)
+{
+  ACE_Future<size_t> result;
+  if (n == 0)
+    return result;
+
+  typedef ACE_Future_When_State<T> STATE;
+  STATE *state = 0;
+  ACE_NEW_RETURN (state,
+                  STATE (result, n, true),
+                  result);
+
+  for (size_t i = 0; i != n && state->attach (futures[i], i); ++i)
+    continue;
+
+  state->release ();
+  return result;
+}
+
 template <class T> void
 ACE_Future<T>::dump (void) const
 {
@@ -431,6 +522,214 @@ ACE_Future<T>::get_rep ()
   return this->future_rep_;
 }
 
+template <class T>
+ACE_Future_When_State<T>::ACE_Future_When_State (
+  const ACE_Future<size_t> &result,
+  size_t n,
+  bool any)
+  : result_ (result),
+    n_ (n),
+    any_ (any),
+    done_ (false),
+    remaining_ (n),
+    observers_ (0),
+    reps_ (0),
+    ref_count_ (1)
+{
+  ACE_NEW (this->observers_, OBSERVER *[n]);
+  ACE_NEW (this->reps_, ACE_Future_Rep<T> *[n]);
+  for (size_t i = 0; i != n; ++i)
+    {
+      this->observers_[i] = 0;
+      this->reps_[i] = 0;
+    }
+}
+
+template <class T>
+ACE_Future_When_State<T>::~ACE_Future_When_State (void)
+{
+  delete [] this->observers_;
+  delete [] this->reps_;
+}
+
+template <class T> bool
+ACE_Future_When_State<T>::attach (const ACE_Future<T> &future,
+                                  size_t index)
+{
+  ACE_GUARD_RETURN (ACE_SYNCH_RECURSIVE_MUTEX, ace_mon, this->lock_, false);
+
+  if (this->done_ || this->observers_ == 0 || this->reps_ == 0)
+    return false;
+
+  OBSERVER *observer = 0;
+  ACE_NEW_NORETURN (observer, OBSERVER (this, index));
+
+  ACE_Future<T> source (future);
+  if (observer != 0)
+    {
+      this->observers_[index] = observer;
+      this->reps_[index] = source.get_rep ();
+
+      // If the value is already set this notifies the observer, which
+      // deletes itself.
+      if (source.attach (observer) != -1)
+        return !this->done_;
+
+      this->observers_[index] = 0;
+      this->reps_[index] = 0;
+      delete observer;
+    }
+
+  // The future cannot be observed, do not wait for it.
+  this->done (index, true);
+  return !this->done_;
+}
+
+template <class T> void
+ACE_Future_When_State<T>::done (size_t index, bool set)
+{
+  bool set_result = false;
+  {
+    ACE_GUARD (ACE_SYNCH_RECURSIVE_MUTEX, ace_mon, this->lock_);
+
+    // The observer is no longer attached and deletes itself.
+    this->observers_[index] = 0;
+    this->reps_[index] = 0;
+
+    if (this->done_)
+      return;
+
+    if (this->any_)
+      {
+        // A future destroyed without a value is just not waited for.
+        if (!set)
+          return;
+
+        this->done_ = true;
+        set_result = true;
+
+        // Detach the observers from the other futures.  Those that
+        // are not attached any more are being notified, they delete
+        // themselves.
+        for (size_t i = 0; i != this->n_; ++i)
+          {
+            OBSERVER *observer = this->observers_[i];
+            if (observer == 0)
+              continue;
+
+            ACE_Future_Rep<T> *rep = this->reps_[i];
+            this->observers_[i] = 0;
+            this->reps_[i] = 0;
+            if (rep->detach (observer) == 0)
+              delete observer;
+          }
+      }
+    else if (--this->remaining_ == 0)
+      {
+        this->done_ = true;
+        set_result = true;
+        index = this->n_;
+      }
+  }
+
+  // Without the lock held, the continuations of the result run now.
+  // The caller still holds a reference on the state.
+  if (set_result)
+    this->result_.set (index);
+}
+
+template <class T> void
+ACE_Future_When_State<T>::add_ref (void)
+{
+  ACE_GUARD (ACE_SYNCH_RECURSIVE_MUTEX, ace_mon, this->lock_);
+  ++this->ref_count_;
+}
+
+template <class T> void
+ACE_Future_When_State<T>::release (void)
+{
+  {
+    ACE_GUARD (ACE_SYNCH_RECURSIVE_MUTEX, ace_mon, this->lock_);
+    if (--this->ref_count_ != 0)
+      return;
+  }
+
+  delete this;
+}
+
+template <class T>
+ACE_Future_When_Observer<T>::ACE_Future_When_Observer (
+  ACE_Future_When_State<T> *state,
+  size_t index)
+  : state_ (state),
+    index_ (index)
+{
+  this->state_->add_ref ();
+}
+
+template <class T>
+ACE_Future_When_Observer<T>::~ACE_Future_When_Observer (void)
+{
+  this->state_->release ();
+}
+
+template <class T> void
+ACE_Future_When_Observer<T>::update (const ACE_Future<T> &)
+{
+  this->state_->done (this->index_, true);
+  delete this;
+}
+
+template <class T> void
+ACE_Future_When_Observer<T>::abandon (void)
+{
+  this->state_->done (this->index_, false);
+  delete this;
+}
+
+#if defined (ACE_HAS_CPP11)
+template <class T, class R, class F>
+ACE_Future_Continuation<T, R, F>::ACE_Future_Continuation (
+  F &&f,
+  const ACE_Future<R> &result,
+  ACE_Executor *executor)
+  : value_ (),
+    f_ (std::move (f)),
+    result_ (result),
+    executor_ (executor)
+{
+}
+
+template <class T, class R, class F> void
+ACE_Future_Continuation<T, R, F>::update (const ACE_Future<T> &future)
+{
+  // The future is ready, this does not block.
+  if (future.get (this->value_) == -1)
+    {
+      delete this;
+      return;
+    }
+
+  if (this->executor_ == 0 || this->executor_->execute (this) == -1)
+    {
+      this->call ();
+      delete this;
+    }
+}
+
+template <class T, class R, class F> void
+ACE_Future_Continuation<T, R, F>::abandon (void)
+{
+  delete this;
+}
+
+template <class T, class R, class F> int
+ACE_Future_Continuation<T, R, F>::call (void)
+{
+  return this->result_.set (this->f_ (this->value_));
+}
+#endif /* ACE_HAS_CPP11 */
+
 ACE_END_VERSIONED_NAMESPACE_DECL
 
 #endif /* ACE_HAS_THREADS */
@@ -26,8 +26,17 @@
 #if defined (ACE_HAS_THREADS)
 
 #include "ace/Synch_Traits.h"
+#include "ace/Thread_Mutex.h"
 #include "ace/Recursive_Thread_Mutex.h"
 #include "ace/Condition_Recursive_Thread_Mutex.h"
+#include "ace/Atomic_Op.h"
+#include "ace/Executor.h"
+
+#if defined (ACE_HAS_CPP11)
+# include <atomic>
+# include <type_traits>
+# include <utility>
+#endif /* ACE_HAS_CPP11 */
 
 ACE_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -36,6 +45,25 @@ template <class T> class ACE_Future_Holder;
 template <class T> class ACE_Future_Observer;
 template <class T> class ACE_Future_Rep;
 template <class T> class ACE_Future;
+template <class T> class ACE_Future_When_State;
+
+#if defined (ACE_HAS_CPP11)
+/**
+ * @class ACE_Future_Continuation_Result
+ *
+ * @internal
+ *
+ * @brief The type returned by a continuation @a F of an
+ * ACE_Future<T>, i.e. the value type of the future returned by
+ * ACE_Future<T>::then().
+ */
+template <class T, class F>
+struct ACE_Future_Continuation_Result
+{
+  typedef typename std::decay<
+    decltype (std::declval<F &> () (std::declval<const T &> ()))>::type type;
+};
+#endif /* ACE_HAS_CPP11 */
 
 /**
  * @class ACE_Future_Holder
@@ -79,6 +107,11 @@ public:
   /// its value is written to.
   virtual void update (const ACE_Future<T> &future) = 0;
 
+  /// Called when the last ACE_Future we are subscribed to is
+  /// destroyed before its value was written to.  Does nothing by
+  /// default.
+  virtual void abandon (void);
+
   /// Declare the dynamic allocation hooks.
   ACE_ALLOC_HOOK_DECLARE;
 protected:
@@ -104,6 +137,7 @@ class ACE_Future_Rep
 {
 private:
   friend class ACE_Future<T>;
+  friend class ACE_Future_When_State<T>;
 
   /**
    * Set the result value.  The specified @a caller represents the
@@ -172,9 +206,7 @@ private:
   static ACE_Future_Rep<T> *create (void);
 
   /**
-   * Increase the reference count and return argument. Uses the
-   * attribute "value_ready_mutex_" to synchronize reference count
-   * updating.
+   * Increase the reference count and return argument.
    *
    * Precondition (rep != 0).
    */
@@ -199,11 +231,18 @@ private:
   /// Is result available?
   int ready (void) const;
 
-  /// Pointer to the result.
+  /// Pointer to the result.  It is written once, under
+  /// @c value_ready_mutex_, after the result is constructed, so
+  /// readers that find it set need no lock.
+#if defined (ACE_HAS_CPP11)
+  std::atomic<T *> value_;
+#else
   T *value_;
+#endif /* ACE_HAS_CPP11 */
 
-  /// Reference count.
-  int ref_count_;
+  /// Reference count, minus one.  Copying and destroying an
+  /// ACE_Future does not take @c value_ready_mutex_.
+  ACE_Atomic_Op<ACE_SYNCH_MUTEX, long> ref_count_;
 
   typedef ACE_Future_Observer<T> OBSERVER;
 
@@ -347,6 +386,41 @@ public:
    */
   int detach (ACE_Future_Observer<T> *observer);
 
+#if defined (ACE_HAS_CPP11)
+  /**
+   * Chain a continuation to this ACE_Future.  Once the value is set,
+   * @a f is called with it and the future returned by this method is
+   * set to what @a f returns, so that the next step of a pipeline can
+   * in turn be chained to it with then().  @a f must not return void.
+   *
+   * If @a executor is 0, or refuses the request, @a f is called by the
+   * thread that sets the value, from within set(), or right away by
+   * the calling thread if the value is already set.  Otherwise it is
+   * handed to @a executor, which must outlive the continuation.
+   */
+  template <class F>
+  ACE_Future<typename ACE_Future_Continuation_Result<T, F>::type>
+  then (F f, ACE_Executor *executor = 0) const;
+#endif /* ACE_HAS_CPP11 */
+
+  /**
+   * Return a future that is set, to @a n, once all the @a n
+   * @a futures are set.  Its continuations run in the thread setting
+   * the last of them.  A future that cannot be observed, or that is
+   * destroyed without a value, counts as set.
+   */
+  static ACE_Future<size_t> when_all (const ACE_Future<T> futures[],
+                                      size_t n);
+
+  /**
+   * Return a future that is set, to the index of the first of the
+   * @a n @a futures whose value is set, once any of them is.  The
+   * internal observers attached to the other futures are detached
+   * then.  A future that cannot be observed counts as set.
+   */
+  static ACE_Future<size_t> when_any (const ACE_Future<T> futures[],
+                                      size_t n);
+
   /// Dump the state of an object.
   void dump (void) const;
 
@@ -368,6 +442,154 @@ private:
   FUTURE_REP *future_rep_;
 };
 
+template <class T> class ACE_Future_When_Observer;
+
+/**
+ * @class ACE_Future_When_State
+ *
+ * @internal
+ *
+ * @brief State shared by the observers that ACE_Future<T>::when_all()
+ * or ACE_Future<T>::when_any() attach to each of their futures.
+ *
+ * The observers are owned by the state until they are notified, when
+ * they delete themselves.  Once the future of when_any() is set, the
+ * observers still attached to the other futures are detached and
+ * deleted.  The state is deleted with the last observer.
+ */
+template <class T>
+class ACE_Future_When_State
+{
+public:
+  typedef ACE_Future_When_Observer<T> OBSERVER;
+
+  /// The future set by when_all() if @a any is false, by when_any()
+  /// otherwise.  The state starts with a reference for the caller.
+  ACE_Future_When_State (const ACE_Future<size_t> &result,
+                         size_t n,
+                         bool any);
+
+  ~ACE_Future_When_State (void);
+
+  /// Attach an observer to @a future, the @a index th of them.
+  /// Returns false once no more futures need to be observed.
+  bool attach (const ACE_Future<T> &future, size_t index);
+
+  /// The @a index th future was set if @a set is true, destroyed
+  /// without a value otherwise.  Its observer is no longer attached.
+  void done (size_t index, bool set);
+
+  /// Take another reference.
+  void add_ref (void);
+
+  /// Release a reference, the last one deletes the state.
+  void release (void);
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+
+private:
+  ACE_Future<size_t> result_;
+  size_t n_;
+  bool any_;
+
+  /// Set once @c result_ is, no more futures need to be observed.
+  bool done_;
+
+  /// Futures of when_all() not set yet.
+  size_t remaining_;
+
+  /// The observers still attached, and the representations of the
+  /// futures they are attached to.  Only the observers are owned.
+  OBSERVER **observers_;
+  ACE_Future_Rep<T> **reps_;
+
+  /// The caller of when_all() or when_any(), and the observers.
+  long ref_count_;
+
+  /// Protects the members above.  Recursive, since observers attached
+  /// to a future that is already set are notified right away.
+  ACE_SYNCH_RECURSIVE_MUTEX lock_;
+};
+
+/**
+ * @class ACE_Future_When_Observer
+ *
+ * @internal
+ *
+ * @brief Observer attached by ACE_Future<T>::when_all() and
+ * ACE_Future<T>::when_any() to each of their futures.  It deletes
+ * itself once notified, unless it is detached and deleted by its
+ * ACE_Future_When_State first.
+ */
+template <class T>
+class ACE_Future_When_Observer : public ACE_Future_Observer<T>
+{
+public:
+  ACE_Future_When_Observer (ACE_Future_When_State<T> *state,
+                            size_t index);
+
+  virtual ~ACE_Future_When_Observer (void);
+
+  virtual void update (const ACE_Future<T> &future);
+
+  virtual void abandon (void);
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+
+private:
+  ACE_Future_When_State<T> *state_;
+  size_t index_;
+};
+
+#if defined (ACE_HAS_CPP11)
+/**
+ * @class ACE_Future_Continuation
+ *
+ * @internal
+ *
+ * @brief A continuation registered by ACE_Future<T>::then().
+ *
+ * It observes the source future and, once notified, calls @a F
+ * either directly or as a method request given to an ACE_Executor.
+ * It deletes itself, or is deleted by the executor, once @a F has
+ * been called, or when the source future is destroyed without a
+ * value.  It keeps a copy of the value rather than the source
+ * future, whose representation holds the continuation until then.
+ */
+template <class T, class R, class F>
+class ACE_Future_Continuation
+  : public ACE_Future_Observer<T>,
+    public ACE_Method_Request
+{
+public:
+  ACE_Future_Continuation (F &&f,
+                           const ACE_Future<R> &result,
+                           ACE_Executor *executor);
+
+  /// Run the continuation or hand it to the executor.
+  virtual void update (const ACE_Future<T> &future);
+
+  /// The source future was destroyed without a value, delete the
+  /// continuation.
+  virtual void abandon (void);
+
+  /// Call the function and set the result.
+  virtual int call (void);
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+
+private:
+  /// The value of the source future, set by update().
+  T value_;
+  F f_;
+  ACE_Future<R> result_;
+  ACE_Executor *executor_;
+};
+#endif /* ACE_HAS_CPP11 */
+
 ACE_END_VERSIONED_NAMESPACE_DECL
 
 #if defined (ACE_TEMPLATES_REQUIRE_SOURCE)
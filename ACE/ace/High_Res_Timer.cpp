@@ -31,7 +31,7 @@ ACE_END_VERSIONED_NAMESPACE_DECL
 // by zero errors.
 #if (defined (ACE_WIN32) || defined (ACE_HAS_POWERPC_TIMER) || \
      defined (ACE_HAS_PENTIUM) || defined (ACE_HAS_ALPHA_TIMER)) && \
-    !defined (ACE_HAS_HI_RES_TIMER)
+    !defined (ACE_HAS_HI_RES_TIMER) && !defined (ACE_USES_TSC_GETHRTIME)
 
 # include "ace/Guard_T.h"
 # include "ace/Recursive_Thread_Mutex.h"
@@ -190,7 +190,7 @@ ACE_High_Res_Timer::global_scale_factor (void)
 {
 #if (defined (ACE_WIN32) || defined (ACE_HAS_POWERPC_TIMER) || \
      defined (ACE_HAS_PENTIUM) || defined (ACE_HAS_ALPHA_TIMER)) && \
-    !defined (ACE_HAS_HI_RES_TIMER) && \
+    !defined (ACE_HAS_HI_RES_TIMER) && !defined (ACE_USES_TSC_GETHRTIME) && \
     (defined (ACE_WIN32) || \
      defined (ghs) || defined (__GNUG__) || \
      defined (__INTEL_COMPILER))
@@ -0,0 +1,349 @@
+#include "ace/Latency_Histogram.h"
+#include "ace/CDR_Stream.h"
+#include "ace/Log_Category.h"
+#include "ace/OS_NS_string.h"
+#include "ace/OS_Memory.h"
+
+#if !defined (__ACE_INLINE__)
+#include "ace/Latency_Histogram.inl"
+#endif /* __ACE_INLINE__ */
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace
+{
+  unsigned int const min_precision_bits = 1;
+  unsigned int const max_precision_bits = 16;
+}
+
+ACE_Latency_Histogram::ACE_Latency_Histogram (unsigned int precision_bits)
+  : precision_bits_ (precision_bits < min_precision_bits
+                     ? min_precision_bits
+                     : precision_bits > max_precision_bits
+                     ? max_precision_bits
+                     : precision_bits)
+  , bucket_count_ (bucket_count_of (precision_bits_))
+  , counts_ (0)
+  , samples_count_ (0)
+  , min_ (0)
+  , max_ (0)
+  , sum_ (0)
+{
+}
+
+ACE_Latency_Histogram::ACE_Latency_Histogram (const ACE_Latency_Histogram &rhs)
+  : precision_bits_ (rhs.precision_bits_)
+  , bucket_count_ (rhs.bucket_count_)
+  , counts_ (0)
+  , samples_count_ (0)
+  , min_ (0)
+  , max_ (0)
+  , sum_ (0)
+{
+  this->accumulate (rhs);
+}
+
+ACE_Latency_Histogram &
+ACE_Latency_Histogram::operator= (const ACE_Latency_Histogram &rhs)
+{
+  if (this != &rhs)
+    {
+      this->reset ();
+      this->accumulate (rhs);
+    }
+  return *this;
+}
+
+ACE_Latency_Histogram::~ACE_Latency_Histogram (void)
+{
+  delete [] this->counts_;
+}
+
+size_t
+ACE_Latency_Histogram::bucket_count_of (unsigned int bits)
+{
+  // 2^bits buckets for the values below 2^bits, then 2^(bits - 1)
+  // buckets for each of the 64 - bits powers of two above.
+  return static_cast<size_t> (66 - bits) << (bits - 1);
+}
+
+ACE_UINT64
+ACE_Latency_Histogram::lowest_of (size_t index, unsigned int bits)
+{
+  if (index < (size_t (1) << bits))
+    return index;
+
+  unsigned int const shift =
+    static_cast<unsigned int> (index >> (bits - 1)) - 1;
+  ACE_UINT64 const sub = index - (static_cast<size_t> (shift) << (bits - 1));
+  return sub << shift;
+}
+
+ACE_UINT64
+ACE_Latency_Histogram::highest_of (size_t index, unsigned int bits)
+{
+  if (index < (size_t (1) << bits))
+    return index;
+
+  unsigned int const shift =
+    static_cast<unsigned int> (index >> (bits - 1)) - 1;
+  return lowest_of (index, bits) + ((ACE_UINT64 (1) << shift) - 1);
+}
+
+int
+ACE_Latency_Histogram::allocate_i (void)
+{
+  ACE_NEW_RETURN (this->counts_, ACE_UINT64[this->bucket_count_], -1);
+  ACE_OS::memset (this->counts_, 0, this->bucket_count_ * sizeof (ACE_UINT64));
+  return 0;
+}
+
+void
+ACE_Latency_Histogram::reset (void)
+{
+  if (this->counts_ != 0)
+    ACE_OS::memset (this->counts_,
+                    0,
+                    this->bucket_count_ * sizeof (ACE_UINT64));
+  this->samples_count_ = 0;
+  this->min_ = 0;
+  this->max_ = 0;
+  this->sum_ = 0;
+}
+
+void
+ACE_Latency_Histogram::add_i (unsigned int bits,
+                              size_t index,
+                              ACE_UINT64 count)
+{
+  if (bits != this->precision_bits_)
+    // Going by the largest value of the other bucket keeps the
+    // percentiles on the safe side when that bucket is wider.
+    index = index_of (highest_of (index, bits), this->precision_bits_);
+  this->counts_[index] += count;
+}
+
+int
+ACE_Latency_Histogram::accumulate (const ACE_Latency_Histogram &rhs)
+{
+  if (rhs.samples_count_ == 0 || this == &rhs)
+    return 0;
+
+  if (this->counts_ == 0 && this->allocate_i () == -1)
+    return -1;
+
+  for (size_t i = 0; i != rhs.bucket_count_; ++i)
+    if (rhs.counts_[i] != 0)
+      this->add_i (rhs.precision_bits_, i, rhs.counts_[i]);
+
+  if (this->samples_count_ == 0 || rhs.min_ < this->min_)
+    this->min_ = rhs.min_;
+  if (rhs.max_ > this->max_)
+    this->max_ = rhs.max_;
+  this->samples_count_ += rhs.samples_count_;
+  this->sum_ += rhs.sum_;
+  return 0;
+}
+
+int
+ACE_Latency_Histogram::encode (ACE_OutputCDR &cdr) const
+{
+  ACE_CDR::ULong used = 0;
+  for (size_t i = 0; this->counts_ != 0 && i != this->bucket_count_; ++i)
+    if (this->counts_[i] != 0)
+      ++used;
+
+  cdr.write_ulong (this->precision_bits_);
+  cdr.write_ulonglong (this->samples_count_);
+  cdr.write_ulonglong (this->min_);
+  cdr.write_ulonglong (this->max_);
+  cdr.write_ulonglong (this->sum_);
+  cdr.write_ulong (used);
+
+  for (size_t i = 0; used != 0 && i != this->bucket_count_; ++i)
+    if (this->counts_[i] != 0)
+      {
+        cdr.write_ulong (static_cast<ACE_CDR::ULong> (i));
+        cdr.write_ulonglong (this->counts_[i]);
+      }
+
+  return cdr.good_bit () ? 0 : -1;
+}
+
+int
+ACE_Latency_Histogram::accumulate (ACE_InputCDR &cdr)
+{
+  ACE_CDR::ULong bits = 0;
+  ACE_CDR::ULongLong count = 0;
+  ACE_CDR::ULongLong min_value = 0;
+  ACE_CDR::ULongLong max_value = 0;
+  ACE_CDR::ULongLong sum = 0;
+  ACE_CDR::ULong used = 0;
+
+  if (!cdr.read_ulong (bits)
+      || !cdr.read_ulonglong (count)
+      || !cdr.read_ulonglong (min_value)
+      || !cdr.read_ulonglong (max_value)
+      || !cdr.read_ulonglong (sum)
+      || !cdr.read_ulong (used)
+      || bits < min_precision_bits
+      || bits > max_precision_bits)
+    return -1;
+
+  if (count == 0)
+    return 0;
+
+  if (this->counts_ == 0 && this->allocate_i () == -1)
+    return -1;
+
+  size_t const buckets = bucket_count_of (bits);
+  for (ACE_CDR::ULong i = 0; i != used; ++i)
+    {
+      ACE_CDR::ULong index = 0;
+      ACE_CDR::ULongLong bucket_count = 0;
+      if (!cdr.read_ulong (index)
+          || !cdr.read_ulonglong (bucket_count)
+          || index >= buckets)
+        return -1;
+      this->add_i (bits, index, bucket_count);
+    }
+
+  if (this->samples_count_ == 0 || min_value < this->min_)
+    this->min_ = min_value;
+  if (max_value > this->max_)
+    this->max_ = max_value;
+  this->samples_count_ += count;
+  this->sum_ += sum;
+  return 0;
+}
+
+ACE_UINT64
+ACE_Latency_Histogram::percentile (double percent) const
+{
+  if (this->samples_count_ == 0)
+    return 0;
+  if (percent <= 0.0)
+    return this->min_;
+  if (percent >= 100.0)
+    return this->max_;
+
+  // The rank of the sample we are after, counting from 1.
+  double const exact =
+    percent / 100.0
+    * static_cast<double> (ACE_UINT64_DBLCAST_ADAPTER (this->samples_count_));
+  ACE_UINT64 rank = static_cast<ACE_UINT64> (exact);
+  if (static_cast<double> (ACE_UINT64_DBLCAST_ADAPTER (rank)) < exact
+      || rank == 0)
+    ++rank;
+
+  ACE_UINT64 seen = 0;
+  for (size_t i = 0; i != this->bucket_count_; ++i)
+    {
+      seen += this->counts_[i];
+      if (seen >= rank)
+        {
+          ACE_UINT64 const value = highest_of (i, this->precision_bits_);
+          return value < this->max_ ? value : this->max_;
+        }
+    }
+  return this->max_;
+}
+
+void
+ACE_Latency_Histogram::dump_results (
+  const ACE_TCHAR *msg,
+  ACE_Latency_Histogram::scale_factor_type sf) const
+{
+#ifndef ACE_NLOGGING
+  if (this->samples_count_ == 0)
+    {
+      ACELIB_DEBUG ((LM_DEBUG,
+                  ACE_TEXT ("%s : no data collected\n"), msg));
+      return;
+    }
+
+  ACE_UINT64 const l_min = this->min_ / sf;
+  ACE_UINT64 const l_max = this->max_ / sf;
+  ACE_UINT64 const l_avg = this->mean () / sf;
+
+  ACELIB_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("%s latency   : %Q/%Q/%Q (min/avg/max) over %Q samples\n"),
+              msg,
+              l_min,
+              l_avg,
+              l_max,
+              this->samples_count_));
+
+  this->dump_percentiles (msg, sf);
+#else
+  ACE_UNUSED_ARG (msg);
+  ACE_UNUSED_ARG (sf);
+#endif /* ACE_NLOGGING */
+}
+
+void
+ACE_Latency_Histogram::dump_percentiles (
+  const ACE_TCHAR *msg,
+  ACE_Latency_Histogram::scale_factor_type sf) const
+{
+#ifndef ACE_NLOGGING
+  if (this->samples_count_ == 0)
+    return;
+
+  ACELIB_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("%s percentiles: %Q/%Q/%Q/%Q/%Q/%Q ")
+              ACE_TEXT ("(50/90/99/99.9/99.99/99.999)\n"),
+              msg,
+              this->percentile (50.0) / sf,
+              this->percentile (90.0) / sf,
+              this->percentile (99.0) / sf,
+              this->percentile (99.9) / sf,
+              this->percentile (99.99) / sf,
+              this->percentile (99.999) / sf));
+#else
+  ACE_UNUSED_ARG (msg);
+  ACE_UNUSED_ARG (sf);
+#endif /* ACE_NLOGGING */
+}
+
+void
+ACE_Latency_Histogram::dump_cdf (
+  const ACE_TCHAR *msg,
+  ACE_Latency_Histogram::scale_factor_type sf) const
+{
+#ifndef ACE_NLOGGING
+  if (this->samples_count_ == 0)
+    {
+      ACELIB_DEBUG ((LM_DEBUG,
+                  ACE_TEXT ("%s : no data collected\n"), msg));
+      return;
+    }
+
+  double const total =
+    static_cast<double> (ACE_UINT64_DBLCAST_ADAPTER (this->samples_count_));
+  ACE_UINT64 seen = 0;
+  for (size_t i = 0; i != this->bucket_count_; ++i)
+    {
+      if (this->counts_[i] == 0)
+        continue;
+
+      seen += this->counts_[i];
+      ACE_UINT64 value = highest_of (i, this->precision_bits_);
+      if (value > this->max_)
+        value = this->max_;
+
+      ACELIB_DEBUG ((LM_DEBUG,
+                  ACE_TEXT ("%s: %Q\t%Q\t%.6f\n"),
+                  msg,
+                  value / sf,
+                  this->counts_[i],
+                  static_cast<double> (ACE_UINT64_DBLCAST_ADAPTER (seen))
+                    / total));
+    }
+#else
+  ACE_UNUSED_ARG (msg);
+  ACE_UNUSED_ARG (sf);
+#endif /* ACE_NLOGGING */
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
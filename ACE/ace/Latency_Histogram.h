@@ -0,0 +1,166 @@
+
+//=============================================================================
+/**
+ *  @file    Latency_Histogram.h
+ *
+ *  A fixed size, log-linear histogram of latency samples.
+ */
+//=============================================================================
+
+#ifndef ACE_LATENCY_HISTOGRAM_H
+#define ACE_LATENCY_HISTOGRAM_H
+#include /**/ "ace/pre.h"
+
+#include /**/ "ace/config-all.h"
+#include "ace/Basic_Stats.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#if !defined (ACE_LATENCY_HISTOGRAM_PRECISION_BITS)
+/// Default number of bits of each sample kept by ACE_Latency_Histogram,
+/// which bounds the relative error of the reported values to
+/// 2^(1 - bits).  With 8 bits that is 0.8%, and the histogram takes
+/// 58 KB.
+# define ACE_LATENCY_HISTOGRAM_PRECISION_BITS 8
+#endif /* ACE_LATENCY_HISTOGRAM_PRECISION_BITS */
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class ACE_OutputCDR;
+class ACE_InputCDR;
+
+/// Collect the distribution of a series of samples in constant space.
+/**
+ * ACE_Sample_History keeps every sample, so the percentiles of a long
+ * run need a lot of memory, while ACE_Basic_Stats only keeps the
+ * minimum, average and maximum.  This class counts the samples in
+ * buckets whose width grows with the value, in the manner of an HDR
+ * histogram: values below 2^bits have a bucket each, and every power
+ * of two above that is split in 2^(bits - 1) buckets.  Any 64 bit value
+ * can be recorded, the bucket of a value is found with a couple of
+ * shifts, and the values reported for the percentiles are within
+ * 2^(1 - bits) of the real ones.
+ *
+ * Recording does not lock anything: each thread should record in its
+ * own histogram, and the results be merged with accumulate() at the
+ * end.  Histograms from other processes can be merged too, after
+ * being sent with encode() and accumulate(ACE_InputCDR &).
+ *
+ * The counters are allocated on the first sample.
+ */
+class ACE_Export ACE_Latency_Histogram
+{
+public:
+  typedef ACE_Basic_Stats::scale_factor_type scale_factor_type;
+
+  /// Constructor.  @a precision_bits is clamped to [1, 16].
+  explicit ACE_Latency_Histogram (
+    unsigned int precision_bits = ACE_LATENCY_HISTOGRAM_PRECISION_BITS);
+
+  ACE_Latency_Histogram (const ACE_Latency_Histogram &rhs);
+  ACE_Latency_Histogram &operator= (const ACE_Latency_Histogram &rhs);
+
+  /// Destructor
+  ~ACE_Latency_Histogram (void);
+
+  /// Record one sample.
+  /**
+   * Return 0 on success, -1 if the counters could not be allocated.
+   */
+  int sample (ACE_UINT64 value);
+
+  /// Forget all the samples.
+  void reset (void);
+
+  /// Add the samples of @a rhs, which may have a different precision.
+  int accumulate (const ACE_Latency_Histogram &rhs);
+
+  /// Add the samples of a histogram written by encode().
+  /**
+   * Returns -1 if @a cdr does not contain a valid histogram, in which
+   * case this histogram may have been partially updated.
+   */
+  int accumulate (ACE_InputCDR &cdr);
+
+  /// Write the histogram in @a cdr; only the buckets in use are sent.
+  int encode (ACE_OutputCDR &cdr) const;
+
+  /// The number of samples received so far
+  ACE_UINT64 samples_count (void) const;
+
+  /// The smallest and largest samples, 0 if there is none.
+  ACE_UINT64 min_value (void) const;
+  ACE_UINT64 max_value (void) const;
+
+  /// The average of the samples, 0 if there is none.
+  ACE_UINT64 mean (void) const;
+
+  /// The value below which @a percent percent of the samples are.
+  /**
+   * The result is the largest value of the bucket holding that sample,
+   * bounded by the largest sample, so it is never below the exact
+   * percentile.
+   */
+  ACE_UINT64 percentile (double percent) const;
+
+  /// The precision requested at construction, after clamping.
+  unsigned int precision_bits (void) const;
+
+  /// Print the minimum, average, maximum and percentiles.
+  /**
+   * Uses @a msg as a prefix for each message and scales all the
+   * numbers by @a scale_factor, like ACE_Basic_Stats::dump_results().
+   */
+  void dump_results (const ACE_TCHAR *msg,
+                     scale_factor_type scale_factor) const;
+
+  /// Print the 50, 90, 99, 99.9, 99.99 and 99.999 percentiles.
+  void dump_percentiles (const ACE_TCHAR *msg,
+                         scale_factor_type scale_factor) const;
+
+  /// Print the cumulative distribution, one line per bucket in use
+  /// with the largest value of the bucket, its count and the fraction
+  /// of the samples up to that bucket.
+  void dump_cdf (const ACE_TCHAR *msg,
+                 scale_factor_type scale_factor) const;
+
+private:
+  /// Allocate the counters, on the first sample.
+  int allocate_i (void);
+
+  /// Count @a count samples whose bucket, in a histogram of @a bits
+  /// bits of precision, is @a index.
+  void add_i (unsigned int bits, size_t index, ACE_UINT64 count);
+
+  /// The bucket of @a value with @a bits of precision.
+  static size_t index_of (ACE_UINT64 value, unsigned int bits);
+
+  /// The smallest and largest value in bucket @a index.
+  static ACE_UINT64 lowest_of (size_t index, unsigned int bits);
+  static ACE_UINT64 highest_of (size_t index, unsigned int bits);
+
+  /// The number of buckets needed to hold any 64 bit value.
+  static size_t bucket_count_of (unsigned int bits);
+
+  unsigned int precision_bits_;
+  size_t bucket_count_;
+
+  /// The counters, or 0 until the first sample.
+  ACE_UINT64 *counts_;
+
+  ACE_UINT64 samples_count_;
+  ACE_UINT64 min_;
+  ACE_UINT64 max_;
+  ACE_UINT64 sum_;
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#if defined (__ACE_INLINE__)
+#include "ace/Latency_Histogram.inl"
+#endif /* __ACE_INLINE__ */
+
+#include /**/ "ace/post.h"
+#endif /* ACE_LATENCY_HISTOGRAM_H */
@@ -0,0 +1,72 @@
+// -*- C++ -*-
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+ACE_INLINE size_t
+ACE_Latency_Histogram::index_of (ACE_UINT64 value, unsigned int bits)
+{
+  if (value < (ACE_UINT64 (1) << bits))
+    return static_cast<size_t> (value);
+
+  // The position of the most significant bit of value.
+#if defined (__GNUC__)
+  unsigned int const msb = 63 - __builtin_clzll (value);
+#else
+  unsigned int msb = bits;
+  while ((value >> msb) > 1)
+    ++msb;
+#endif /* __GNUC__ */
+
+  unsigned int const shift = msb - bits + 1;
+  return (static_cast<size_t> (shift) << (bits - 1))
+    + static_cast<size_t> (value >> shift);
+}
+
+ACE_INLINE int
+ACE_Latency_Histogram::sample (ACE_UINT64 value)
+{
+  if (this->counts_ == 0 && this->allocate_i () == -1)
+    return -1;
+
+  ++this->counts_[index_of (value, this->precision_bits_)];
+
+  if (this->samples_count_ == 0 || value < this->min_)
+    this->min_ = value;
+  if (value > this->max_)
+    this->max_ = value;
+
+  ++this->samples_count_;
+  this->sum_ += value;
+  return 0;
+}
+
+ACE_INLINE ACE_UINT64
+ACE_Latency_Histogram::samples_count (void) const
+{
+  return this->samples_count_;
+}
+
+ACE_INLINE ACE_UINT64
+ACE_Latency_Histogram::min_value (void) const
+{
+  return this->min_;
+}
+
+ACE_INLINE ACE_UINT64
+ACE_Latency_Histogram::max_value (void) const
+{
+  return this->max_;
+}
+
+ACE_INLINE ACE_UINT64
+ACE_Latency_Histogram::mean (void) const
+{
+  return this->samples_count_ == 0 ? 0 : this->sum_ / this->samples_count_;
+}
+
+ACE_INLINE unsigned int
+ACE_Latency_Histogram::precision_bits (void) const
+{
+  return this->precision_bits_;
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
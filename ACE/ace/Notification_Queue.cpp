@@ -5,6 +5,16 @@
 #endif /* __ACE_INLINE__ */
 
 #include "ace/Guard_T.h"
+#include "ace/ACE.h"
+#include "ace/Flag_Manip.h"
+#include "ace/Log_Category.h"
+#include "ace/OS_NS_errno.h"
+#include "ace/OS_NS_fcntl.h"
+#include "ace/OS_NS_unistd.h"
+
+#if defined (ACE_HAS_EVENTFD)
+# include /**/ <sys/eventfd.h>
+#endif /* ACE_HAS_EVENTFD */
 
 ACE_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -222,4 +232,319 @@ ACE_Notification_Queue::pop_next_notification(
   return 1;
 }
 
+#if defined (ACE_HAS_MPSC_NOTIFICATION_QUEUE)
+
+ACE_MPSC_Notification_Queue::
+ACE_MPSC_Notification_Queue()
+  : ACE_Copy_Disabled()
+  , pushed_(0)
+  , notify_queue_()
+{
+}
+
+ACE_MPSC_Notification_Queue::
+~ACE_MPSC_Notification_Queue()
+{
+  reset();
+}
+
+int
+ACE_MPSC_Notification_Queue::open()
+{
+  ACE_TRACE ("ACE_MPSC_Notification_Queue::open");
+
+  return 0;
+}
+
+void
+ACE_MPSC_Notification_Queue::release(ACE_Notification_Queue_Node * node)
+{
+  while (node != 0)
+    {
+      ACE_Notification_Queue_Node * next = node->next();
+      if (node->get().eh_ != 0)
+        {
+          (void) node->get().eh_->remove_reference();
+        }
+      delete node;
+      node = next;
+    }
+}
+
+void
+ACE_MPSC_Notification_Queue::reset()
+{
+  ACE_TRACE ("ACE_MPSC_Notification_Queue::reset");
+
+  ACE_GUARD (ACE_SYNCH_MUTEX, mon, this->consumer_lock_);
+
+  release(this->pushed_.exchange(0, std::memory_order_acquire));
+
+  while (!this->notify_queue_.is_empty ())
+    {
+      ACE_Notification_Queue_Node * node = this->notify_queue_.pop_front();
+      node->next(0);
+      release(node);
+    }
+}
+
+void
+ACE_MPSC_Notification_Queue::take_pushed_nodes()
+{
+  ACE_Notification_Queue_Node * node =
+    this->pushed_.exchange(0, std::memory_order_acquire);
+
+  // The stack is in LIFO order, reverse it ...
+  ACE_Notification_Queue_Node * fifo = 0;
+  while (node != 0)
+    {
+      ACE_Notification_Queue_Node * next = node->next();
+      node->next(fifo);
+      fifo = node;
+      node = next;
+    }
+
+  // ... and append it to the nodes taken before.
+  while (fifo != 0)
+    {
+      ACE_Notification_Queue_Node * next = fifo->next();
+      this->notify_queue_.push_back(fifo);
+      fifo = next;
+    }
+}
+
+int
+ACE_MPSC_Notification_Queue::purge_pending_notifications(
+  ACE_Event_Handler * eh,
+  ACE_Reactor_Mask mask)
+{
+  ACE_TRACE ("ACE_MPSC_Notification_Queue::purge_pending_notifications");
+
+  ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, mon, this->consumer_lock_, -1);
+
+  this->take_pushed_nodes();
+
+  int number_purged = 0;
+  ACE_Notification_Queue_Node * node = this->notify_queue_.head();
+  while (node != 0)
+    {
+      ACE_Notification_Queue_Node * next = node->next();
+
+      if (node->matches_for_purging(eh))
+        {
+          if (node->mask_disables_all_notifications(mask))
+            {
+              this->notify_queue_.unsafe_remove(node);
+              ++number_purged;
+              node->get().eh_->remove_reference();
+              delete node;
+            }
+          else
+            {
+              node->clear_mask(mask);
+            }
+        }
+
+      node = next;
+    }
+
+  return number_purged;
+}
+
+int
+ACE_MPSC_Notification_Queue::push_new_notification(
+  ACE_Notification_Buffer const & buffer)
+{
+  ACE_TRACE ("ACE_MPSC_Notification_Queue::push_new_notification");
+
+  ACE_Notification_Queue_Node * node = 0;
+  ACE_NEW_RETURN (node, ACE_Notification_Queue_Node, -1);
+  node->set(buffer);
+
+  ACE_Notification_Queue_Node * top =
+    this->pushed_.load(std::memory_order_relaxed);
+  do
+    {
+      node->next(top);
+    }
+  while (!this->pushed_.compare_exchange_weak(top,
+                                              node,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
+
+  // Whoever pushed on a non-empty stack can count on the thread that
+  // found it empty to wake up the reactor, and the reactor does not
+  // stop popping while there are nodes left.
+  return top == 0 ? 1 : 0;
+}
+
+int
+ACE_MPSC_Notification_Queue::pop_next_notification(
+  ACE_Notification_Buffer & current,
+  bool & more_messages_queued,
+  ACE_Notification_Buffer & next)
+{
+  ACE_TRACE ("ACE_MPSC_Notification_Queue::pop_next_notification");
+
+  more_messages_queued = false;
+
+  ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, mon, this->consumer_lock_, -1);
+
+  if (this->notify_queue_.is_empty ())
+    {
+      this->take_pushed_nodes();
+
+      if (this->notify_queue_.is_empty ())
+        {
+          return 0;
+        }
+    }
+
+  ACE_Notification_Queue_Node * node = this->notify_queue_.pop_front();
+  current = node->get();
+  delete node;
+
+  if (this->notify_queue_.is_empty ())
+    {
+      this->take_pushed_nodes();
+    }
+
+  if (!this->notify_queue_.is_empty ())
+    {
+      more_messages_queued = true;
+      next = this->notify_queue_.head()->get();
+    }
+
+  return 1;
+}
+
+#endif /* ACE_HAS_MPSC_NOTIFICATION_QUEUE */
+
+ACE_Notification_Wakeup::ACE_Notification_Wakeup()
+  : ACE_Copy_Disabled()
+#if defined (ACE_HAS_EVENTFD)
+  , eventfd_(ACE_INVALID_HANDLE)
+#endif /* ACE_HAS_EVENTFD */
+{
+}
+
+ACE_Notification_Wakeup::~ACE_Notification_Wakeup()
+{
+  this->close();
+}
+
+int
+ACE_Notification_Wakeup::open()
+{
+  ACE_TRACE ("ACE_Notification_Wakeup::open");
+
+#if defined (ACE_HAS_EVENTFD)
+  this->eventfd_ = ::eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+  return this->eventfd_ == ACE_INVALID_HANDLE ? -1 : 0;
+#else
+  if (this->pipe_.open () == -1)
+    return -1;
+
+# if defined (F_SETFD) && !defined (ACE_LACKS_FCNTL)
+  if (ACE_OS::fcntl (this->pipe_.read_handle (), F_SETFD, 1) == -1
+      || ACE_OS::fcntl (this->pipe_.write_handle (), F_SETFD, 1) == -1)
+    return -1;
+# endif /* F_SETFD */
+
+  // A full pipe already holds a pending wakeup, so neither side may
+  // block.
+  if (ACE::set_flags (this->pipe_.read_handle (), ACE_NONBLOCK) == -1
+      || ACE::set_flags (this->pipe_.write_handle (), ACE_NONBLOCK) == -1)
+    return -1;
+
+  return 0;
+#endif /* ACE_HAS_EVENTFD */
+}
+
+int
+ACE_Notification_Wakeup::close()
+{
+  ACE_TRACE ("ACE_Notification_Wakeup::close");
+
+#if defined (ACE_HAS_EVENTFD)
+  int result = 0;
+  if (this->eventfd_ != ACE_INVALID_HANDLE)
+    {
+      result = ACE_OS::close (this->eventfd_);
+      this->eventfd_ = ACE_INVALID_HANDLE;
+    }
+  return result;
+#else
+  return this->pipe_.close ();
+#endif /* ACE_HAS_EVENTFD */
+}
+
+ACE_HANDLE
+ACE_Notification_Wakeup::handle() const
+{
+#if defined (ACE_HAS_EVENTFD)
+  return this->eventfd_;
+#else
+  return this->pipe_.read_handle ();
+#endif /* ACE_HAS_EVENTFD */
+}
+
+int
+ACE_Notification_Wakeup::signal()
+{
+#if defined (ACE_HAS_EVENTFD)
+  ACE_UINT64 const one = 1;
+  ssize_t const n = ACE_OS::write (this->eventfd_, &one, sizeof one);
+#else
+  char const byte = 0;
+  ssize_t const n = ACE::send (this->pipe_.write_handle (), &byte, 1);
+#endif /* ACE_HAS_EVENTFD */
+
+  // A full pipe, or a saturated counter, means the reactor has not
+  // cleared the previous wakeup yet.
+  if (n == -1 && errno != EWOULDBLOCK && errno != EAGAIN)
+    return -1;
+
+  return 0;
+}
+
+int
+ACE_Notification_Wakeup::clear()
+{
+#if defined (ACE_HAS_EVENTFD)
+  // Reading the counter resets it, however many wakeups were sent.
+  ACE_UINT64 count = 0;
+  ssize_t const n = ACE_OS::read (this->eventfd_, &count, sizeof count);
+#else
+  char buffer[1024];
+  ssize_t const n = ACE::recv (this->pipe_.read_handle (),
+                               buffer,
+                               sizeof buffer);
+#endif /* ACE_HAS_EVENTFD */
+
+  if (n > 0)
+    return 1;
+
+  if (n == -1 && errno != EWOULDBLOCK && errno != EAGAIN)
+    return -1;
+
+  return 0;
+}
+
+void
+ACE_Notification_Wakeup::dump() const
+{
+#if defined (ACE_HAS_DUMP)
+  ACE_TRACE ("ACE_Notification_Wakeup::dump");
+
+# if defined (ACE_HAS_EVENTFD)
+  ACELIB_DEBUG ((LM_DEBUG, ACE_BEGIN_DUMP, this));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_TEXT ("eventfd_ = %d"), this->eventfd_));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_END_DUMP));
+# else
+  this->pipe_.dump ();
+# endif /* ACE_HAS_EVENTFD */
+#endif /* ACE_HAS_DUMP */
+}
+
 ACE_END_VERSIONED_NAMESPACE_DECL
@@ -14,6 +14,12 @@
 #include "ace/Intrusive_List.h"
 #include "ace/Intrusive_List_Node.h"
 #include "ace/Unbounded_Queue.h"
+#include "ace/Pipe.h"
+
+#if defined (ACE_HAS_CPP11)
+# define ACE_HAS_MPSC_NOTIFICATION_QUEUE
+# include <atomic>
+#endif /* ACE_HAS_CPP11 */
 
 ACE_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -146,6 +152,140 @@ private:
   ACE_SYNCH_MUTEX notify_queue_lock_;
 };
 
+#if defined (ACE_HAS_MPSC_NOTIFICATION_QUEUE)
+/**
+ * @class ACE_MPSC_Notification_Queue
+ *
+ * @brief A user-space notification queue that never blocks the
+ * notifying threads.
+ *
+ * Offers the same operations as ACE_Notification_Queue.  The notifying
+ * threads (the many producers) push their notification on an atomic
+ * stack without taking any lock.  Only the thread that finds the stack
+ * empty is told to wake up the reactor, so a burst of notifications
+ * from many threads costs a single wakeup.
+ *
+ * The reactor side (the single consumer) takes the whole stack at once
+ * and appends it, in FIFO order, to a private list.  Popping, purging
+ * and resetting are serialized by a lock the producers never take.
+ */
+class ACE_Export ACE_MPSC_Notification_Queue : private ACE_Copy_Disabled
+{
+public:
+  ACE_MPSC_Notification_Queue();
+  ~ACE_MPSC_Notification_Queue();
+
+  /**
+   * @brief Nothing to pre-allocate, the nodes are allocated by the
+   * notifying threads.
+   */
+  int open();
+
+  /**
+   * @brief Release all resources in the queue
+   */
+  void reset();
+
+  /**
+   * @brief Remove all elements in the queue matching @c eh and @c mask
+   */
+  int purge_pending_notifications(ACE_Event_Handler * eh,
+                                  ACE_Reactor_Mask mask);
+
+  /**
+   * @brief Add a new notification to the queue
+   *
+   * @return -1 on failure, 1 if the reactor must be woken up and 0
+   * otherwise.
+   */
+  int push_new_notification(ACE_Notification_Buffer const & buffer);
+
+  /**
+   * @brief Extract the next notification from the queue
+   *
+   * @return -1 on failure, 1 if a message was popped, 0 otherwise
+   */
+  int pop_next_notification(
+      ACE_Notification_Buffer & current,
+      bool & more_messages_queued,
+      ACE_Notification_Buffer & next);
+
+private:
+  /**
+   * @brief Move the nodes pushed since the last call to the end of
+   * notify_queue_.  The caller must hold consumer_lock_.
+   */
+  void take_pushed_nodes();
+
+  /// Release a list of nodes and the references they hold.
+  static void release(ACE_Notification_Queue_Node * node);
+
+private:
+  typedef ACE_Intrusive_List<ACE_Notification_Queue_Node> Buffer_List;
+
+  /// The nodes pushed and not taken by the consumer yet, most recent
+  /// first, linked through their next pointer.
+  std::atomic<ACE_Notification_Queue_Node *> pushed_;
+
+  /// The notifications taken by the consumer, oldest first.
+  Buffer_List notify_queue_;
+
+  /// Serializes the consumer side operations.
+  ACE_SYNCH_MUTEX consumer_lock_;
+};
+
+typedef ACE_MPSC_Notification_Queue ACE_Reactor_Notification_Queue;
+#else
+typedef ACE_Notification_Queue ACE_Reactor_Notification_Queue;
+#endif /* ACE_HAS_MPSC_NOTIFICATION_QUEUE */
+
+/**
+ * @class ACE_Notification_Wakeup
+ *
+ * @brief Wakes up the reactor when notifications have been queued.
+ *
+ * When the notifications are kept in user-space the reactor only has
+ * to be told that there is something to look at.  An eventfd does that
+ * with a single 8 byte counter that never fills up, on platforms that
+ * lack it a non-blocking pipe is used.  Waking up a reactor that has
+ * not cleared the previous wakeup is a no-op.
+ */
+class ACE_Export ACE_Notification_Wakeup : private ACE_Copy_Disabled
+{
+public:
+  ACE_Notification_Wakeup();
+  ~ACE_Notification_Wakeup();
+
+  /// Create the non-blocking, close-on-exec, handles.
+  int open();
+
+  int close();
+
+  /// The handle to register with the reactor for reading.
+  ACE_HANDLE handle() const;
+
+  /// Make the handle readable.  Returns 0 on success, or when a
+  /// previous wakeup is still pending, and -1 on failure.
+  int signal();
+
+  /**
+   * @brief Consume the pending wakeups
+   *
+   * @return -1 on failure, 1 if a wakeup was pending, 0 otherwise
+   */
+  int clear();
+
+  /// Dump the state of an object.
+  void dump() const;
+
+private:
+#if defined (ACE_HAS_EVENTFD)
+  ACE_HANDLE eventfd_;
+#else
+  ACE_Pipe pipe_;
+#endif /* ACE_HAS_EVENTFD */
+};
+
 ACE_END_VERSIONED_NAMESPACE_DECL
 
 #if defined (__ACE_INLINE__)
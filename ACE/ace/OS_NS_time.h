@@ -26,6 +26,9 @@
 #include "ace/Basic_Types.h"
 #include "ace/os_include/os_time.h"
 #include "ace/OS_NS_errno.h"
+#if defined (ACE_USES_TSC_GETHRTIME)
+# include "ace/TSC_Clock.h"
+#endif /* ACE_USES_TSC_GETHRTIME */
 
 #include /**/ "ace/ACE_export.h"
 
@@ -253,7 +253,10 @@ ACE_INLINE ACE_hrtime_t
 ACE_OS::gethrtime (const ACE_HRTimer_Op op)
 {
   ACE_OS_TRACE ("ACE_OS::gethrtime");
-#if defined (ACE_HAS_HI_RES_TIMER)
+#if defined (ACE_USES_TSC_GETHRTIME)
+  ACE_UNUSED_ARG (op);
+  return ACE_TSC_Clock::now ();
+#elif defined (ACE_HAS_HI_RES_TIMER)
   ACE_UNUSED_ARG (op);
   return ::gethrtime ();
 #elif defined (ACE_HAS_AIX_HI_RES_TIMER)
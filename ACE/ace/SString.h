@@ -91,6 +91,19 @@ public:
   /// Copy constructor.
   ACE_NS_WString (const ACE_NS_WString &s);
 
+#if defined (ACE_HAS_CPP11)
+  /// Move constructor, @a s is left empty.
+  ACE_NS_WString (ACE_NS_WString &&s) noexcept;
+#endif /* ACE_HAS_CPP11 */
+
+  /// Assignment operator (does copy memory).
+  ACE_NS_WString &operator= (const ACE_NS_WString &s);
+
+#if defined (ACE_HAS_CPP11)
+  /// Move assignment operator, @a s is left empty.
+  ACE_NS_WString &operator= (ACE_NS_WString &&s) noexcept;
+#endif /* ACE_HAS_CPP11 */
+
   /// Constructor that copies @a c into dynamically allocated memory.
   ACE_NS_WString (ACE_WSTRING_TYPE c, ACE_Allocator *alloc = 0);
 
@@ -43,6 +43,30 @@ ACE_NS_WString::ACE_NS_WString (const ACE_NS_WString &s)
 {
 }
 
+#if defined (ACE_HAS_CPP11)
+ACE_INLINE
+ACE_NS_WString::ACE_NS_WString (ACE_NS_WString &&s) noexcept
+  : ACE_WString (std::move (s))
+{
+}
+#endif /* ACE_HAS_CPP11 */
+
+ACE_INLINE ACE_NS_WString &
+ACE_NS_WString::operator= (const ACE_NS_WString &s)
+{
+  ACE_WString::operator= (s);
+  return *this;
+}
+
+#if defined (ACE_HAS_CPP11)
+ACE_INLINE ACE_NS_WString &
+ACE_NS_WString::operator= (ACE_NS_WString &&s) noexcept
+{
+  ACE_WString::operator= (std::move (s));
+  return *this;
+}
+#endif /* ACE_HAS_CPP11 */
+
 ACE_INLINE
 ACE_NS_WString::ACE_NS_WString (ACE_WSTRING_TYPE c, ACE_Allocator *alloc)
   : ACE_WString (c, alloc)
@@ -0,0 +1,286 @@
+/**
+ * @file Scalable_RW_Mutex.cpp
+ */
+
+#include "ace/Scalable_RW_Mutex.h"
+
+#if defined (ACE_HAS_THREADS) && defined (ACE_HAS_CPP11)
+
+#if defined (ACE_HAS_ALLOC_HOOKS)
+# include "ace/Malloc_Base.h"
+#endif /* ACE_HAS_ALLOC_HOOKS */
+
+#if !defined (__ACE_INLINE__)
+#include "ace/Scalable_RW_Mutex.inl"
+#endif /* __ACE_INLINE__ */
+
+#include "ace/Log_Category.h"
+#include "ace/OS_NS_errno.h"
+#include "ace/OS_NS_Thread.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace
+{
+  size_t const slot_count = size_t (1) << ACE_SCALABLE_RW_MUTEX_SLOT_BITS;
+
+  /// The reader slots.  A slot holds the lock a reader acquired
+  /// through it, or null.
+  std::atomic<ACE_Scalable_RW_Mutex *> reader_slots[slot_count];
+
+  /// The slots held by a thread, so release() can tell a read lock
+  /// taken through a slot from one taken through the underlying lock.
+  struct Held_Slots
+  {
+    enum { MAX_HELD = 8 };
+
+    /// Index in @c slots_ of the slot held for @a lock, or MAX_HELD.
+    size_t find (const ACE_Scalable_RW_Mutex *lock) const
+    {
+      for (size_t i = this->count_; i-- != 0; )
+        if (this->locks_[i] == lock)
+          return i;
+      return MAX_HELD;
+    }
+
+    /// Forget the slot at index @a i and return it.
+    std::atomic<ACE_Scalable_RW_Mutex *> *remove (size_t i)
+    {
+      std::atomic<ACE_Scalable_RW_Mutex *> *slot = this->slots_[i];
+      --this->count_;
+      this->locks_[i] = this->locks_[this->count_];
+      this->slots_[i] = this->slots_[this->count_];
+      return slot;
+    }
+
+    size_t count_;
+    const ACE_Scalable_RW_Mutex *locks_[MAX_HELD];
+    std::atomic<ACE_Scalable_RW_Mutex *> *slots_[MAX_HELD];
+  };
+
+  thread_local Held_Slots held_slots;
+
+  std::atomic<ACE_Scalable_RW_Mutex *> &
+  reader_slot (const Held_Slots &held, const ACE_Scalable_RW_Mutex *lock)
+  {
+    // The address of a thread local object identifies the thread.
+    ACE_UINT64 h =
+      ACE_UINT64 (reinterpret_cast<uintptr_t> (&held))
+        * ACE_UINT64_LITERAL (0x9E3779B97F4A7C15)
+      + ACE_UINT64 (reinterpret_cast<uintptr_t> (lock));
+    h ^= h >> 32;
+    h *= ACE_UINT64_LITERAL (0xD6E8FEB86659FD93);
+    return reader_slots[h >> (64 - ACE_SCALABLE_RW_MUTEX_SLOT_BITS)];
+  }
+}
+
+ACE_ALLOC_HOOK_DEFINE(ACE_Scalable_RW_Mutex)
+
+ACE_Scalable_RW_Mutex::ACE_Scalable_RW_Mutex (const ACE_TCHAR *name,
+                                              void *arg)
+  : lock_ (name, arg),
+    read_bias_ (true),
+    inhibit_until_ (0)
+{
+// ACE_TRACE ("ACE_Scalable_RW_Mutex::ACE_Scalable_RW_Mutex");
+}
+
+ACE_Scalable_RW_Mutex::~ACE_Scalable_RW_Mutex (void)
+{
+// ACE_TRACE ("ACE_Scalable_RW_Mutex::~ACE_Scalable_RW_Mutex");
+}
+
+bool
+ACE_Scalable_RW_Mutex::acquire_slot_i (void)
+{
+  if (!this->read_bias_.load (std::memory_order_relaxed))
+    return false;
+
+  Held_Slots &held = held_slots;
+  if (held.count_ == Held_Slots::MAX_HELD)
+    return false;
+
+  Slot &slot = reader_slot (held, this);
+  ACE_Scalable_RW_Mutex *expected = 0;
+  if (!slot.compare_exchange_strong (expected, this))
+    return false;
+
+  // Publishing the slot and then checking the bias pairs with the
+  // writer clearing the bias and then scanning the slots: either the
+  // writer sees the slot or we see the bias is gone.
+  if (this->read_bias_.load ())
+    {
+      held.locks_[held.count_] = this;
+      held.slots_[held.count_] = &slot;
+      ++held.count_;
+      return true;
+    }
+
+  slot.store (0, std::memory_order_release);
+  return false;
+}
+
+void
+ACE_Scalable_RW_Mutex::rebias_i (void)
+{
+  if (!this->read_bias_.load (std::memory_order_relaxed)
+      && ACE_OS::gethrtime ()
+           >= this->inhibit_until_.load (std::memory_order_relaxed))
+    this->read_bias_.store (true);
+}
+
+int
+ACE_Scalable_RW_Mutex::revoke_i (bool wait, Slot *own)
+{
+  // Only the holder of the write lock clears the bias, and readers only
+  // set it while holding the read lock, so it cannot change under us.
+  if (!this->read_bias_.load (std::memory_order_relaxed))
+    return 0;
+
+  this->read_bias_.store (false);
+
+  ACE_hrtime_t const start = ACE_OS::gethrtime ();
+  int result = 0;
+
+  for (size_t i = 0; i != slot_count && result == 0; ++i)
+    {
+      Slot *slot = &reader_slots[i];
+      if (slot == own)
+        continue;
+
+      while (slot->load () == this)
+        {
+          if (!wait)
+            {
+              // The readers still inside need the bias to stay on, so
+              // that the next writer waits for them.
+              this->read_bias_.store (true);
+              result = -1;
+              break;
+            }
+          ACE_OS::thr_yield ();
+        }
+    }
+
+  ACE_hrtime_t const now = ACE_OS::gethrtime ();
+  this->inhibit_until_.store (now
+                              + (now - start) * ACE_SCALABLE_RW_MUTEX_INHIBIT_FACTOR,
+                              std::memory_order_relaxed);
+  return result;
+}
+
+int
+ACE_Scalable_RW_Mutex::acquire_read (void)
+{
+// ACE_TRACE ("ACE_Scalable_RW_Mutex::acquire_read");
+  if (this->acquire_slot_i ())
+    return 0;
+
+  int const result = this->lock_.acquire_read ();
+  if (result == 0)
+    this->rebias_i ();
+  return result;
+}
+
+int
+ACE_Scalable_RW_Mutex::tryacquire_read (void)
+{
+// ACE_TRACE ("ACE_Scalable_RW_Mutex::tryacquire_read");
+  if (this->acquire_slot_i ())
+    return 0;
+
+  int const result = this->lock_.tryacquire_read ();
+  if (result == 0)
+    this->rebias_i ();
+  return result;
+}
+
+int
+ACE_Scalable_RW_Mutex::acquire_write (void)
+{
+// ACE_TRACE ("ACE_Scalable_RW_Mutex::acquire_write");
+  if (this->lock_.acquire_write () == -1)
+    return -1;
+
+  return this->revoke_i (true);
+}
+
+int
+ACE_Scalable_RW_Mutex::tryacquire_write (void)
+{
+// ACE_TRACE ("ACE_Scalable_RW_Mutex::tryacquire_write");
+  if (this->lock_.tryacquire_write () == -1)
+    return -1;
+
+  if (this->revoke_i (false) == -1)
+    {
+      this->lock_.release ();
+      errno = EBUSY;
+      return -1;
+    }
+  return 0;
+}
+
+int
+ACE_Scalable_RW_Mutex::tryacquire_write_upgrade (void)
+{
+// ACE_TRACE ("ACE_Scalable_RW_Mutex::tryacquire_write_upgrade");
+  Held_Slots &held = held_slots;
+  size_t const index = held.find (this);
+
+  if (index == Held_Slots::MAX_HELD)
+    {
+      // Our read lock is on the underlying lock, upgrade it there.  The
+      // readers using slots cannot stop us any more, wait for them.
+      if (this->lock_.tryacquire_write_upgrade () == -1)
+        return -1;
+      return this->revoke_i (true);
+    }
+
+  // Our read lock is a slot, the underlying lock is free of us.
+  Slot *slot = held.slots_[index];
+  if (this->lock_.tryacquire_write () == -1)
+    return -1;
+
+  if (this->revoke_i (false, slot) == -1)
+    {
+      this->lock_.release ();
+      errno = EBUSY;
+      return -1;
+    }
+
+  held.remove (index)->store (0, std::memory_order_release);
+  return 0;
+}
+
+int
+ACE_Scalable_RW_Mutex::release (void)
+{
+// ACE_TRACE ("ACE_Scalable_RW_Mutex::release");
+  Held_Slots &held = held_slots;
+  size_t const index = held.find (this);
+
+  if (index == Held_Slots::MAX_HELD)
+    return this->lock_.release ();
+
+  held.remove (index)->store (0, std::memory_order_release);
+  return 0;
+}
+
+void
+ACE_Scalable_RW_Mutex::dump (void) const
+{
+#if defined (ACE_HAS_DUMP)
+// ACE_TRACE ("ACE_Scalable_RW_Mutex::dump");
+  ACELIB_DEBUG ((LM_DEBUG, ACE_BEGIN_DUMP, this));
+  ACELIB_DEBUG ((LM_DEBUG,
+                 ACE_TEXT ("read_bias_ = %d\n"),
+                 this->read_bias_.load () ? 1 : 0));
+  this->lock_.dump ();
+  ACELIB_DEBUG ((LM_DEBUG, ACE_END_DUMP));
+#endif /* ACE_HAS_DUMP */
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* ACE_HAS_THREADS && ACE_HAS_CPP11 */
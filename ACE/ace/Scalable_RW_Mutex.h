@@ -0,0 +1,187 @@
+// -*- C++ -*-
+
+//==========================================================================
+/**
+ *  @file    Scalable_RW_Mutex.h
+ *
+ *  A readers/writer lock whose readers do not share a cache line.
+ */
+//==========================================================================
+
+#ifndef ACE_SCALABLE_RW_MUTEX_H
+#define ACE_SCALABLE_RW_MUTEX_H
+#include /**/ "ace/pre.h"
+
+#include /**/ "ace/ACE_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#if !defined (ACE_HAS_THREADS)
+#  include "ace/Null_Mutex.h"
+#else /* ACE_HAS_THREADS */
+
+#include "ace/RW_Thread_Mutex.h"
+
+#if !defined (ACE_SCALABLE_RW_MUTEX_SLOT_BITS)
+/// log2 of the number of reader slots shared by all the
+/// ACE_Scalable_RW_Mutex instances of the process.
+# define ACE_SCALABLE_RW_MUTEX_SLOT_BITS 12
+#endif /* ACE_SCALABLE_RW_MUTEX_SLOT_BITS */
+
+#if !defined (ACE_SCALABLE_RW_MUTEX_INHIBIT_FACTOR)
+/// After a writer had to revoke the reader bias, readers go through
+/// the underlying lock for this many times as long as the revocation
+/// took.
+# define ACE_SCALABLE_RW_MUTEX_INHIBIT_FACTOR 9
+#endif /* ACE_SCALABLE_RW_MUTEX_INHIBIT_FACTOR */
+
+#if defined (ACE_HAS_CPP11)
+
+#include "ace/OS_NS_time.h"
+#include <atomic>
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class ACE_Scalable_RW_Mutex
+ *
+ * @brief Readers/writer lock for data that is read far more often
+ * than it is written.
+ *
+ * Every acquisition of an ACE_RW_Thread_Mutex, read or write, updates
+ * the same word, so the cache line holding it moves between CPUs even
+ * when only readers are around.  This lock wraps an
+ * ACE_RW_Thread_Mutex and, while it is "read biased", lets readers
+ * skip it altogether: a reader publishes itself in one slot of a table
+ * shared by all the locks of the process, picked by hashing the
+ * calling thread and the lock.  Different readers touch different
+ * slots, so they do not disturb each other.
+ *
+ * A writer takes the underlying lock, which stops the readers coming
+ * through it, clears the bias and waits until no slot refers to this
+ * lock any more.  Because that scan is expensive, readers keep using
+ * the underlying lock for a while after a revocation (see
+ * ACE_SCALABLE_RW_MUTEX_INHIBIT_FACTOR), after which the first of them
+ * turns the bias back on.  Readers whose slot is taken by somebody
+ * else also use the underlying lock.
+ *
+ * The operations are those of ACE_RW_Thread_Mutex, so the class can be
+ * used with ACE_Read_Guard, ACE_Write_Guard, ACE_Lock_Adapter and as
+ * the ACE_LOCK parameter of the ACE containers.  A thread remembers the
+ * slots it holds, so it must release the lock itself; as with any
+ * readers/writer lock a read lock must not be acquired recursively
+ * while a writer may be waiting.
+ */
+class ACE_Export ACE_Scalable_RW_Mutex
+{
+public:
+  ACE_Scalable_RW_Mutex (const ACE_TCHAR *name = 0,
+                         void *arg = 0);
+
+  /// Implicitly destroy the lock.
+  ~ACE_Scalable_RW_Mutex (void);
+
+  /// Explicitly destroy the lock.
+  int remove (void);
+
+  /// Acquire a read lock, but block if a writer hold the lock.
+  int acquire_read (void);
+
+  /// Acquire a write lock, but block if any readers or a
+  /// writer hold the lock.
+  int acquire_write (void);
+
+  /**
+   * Conditionally acquire a read lock (i.e., won't block).  Returns
+   * -1 on failure.  If we "failed" because someone else already had
+   * the lock, @c errno is set to @c EBUSY.
+   */
+  int tryacquire_read (void);
+
+  /// Conditionally acquire a write lock (i.e., won't block).
+  int tryacquire_write (void);
+
+  /**
+   * Conditionally upgrade a read lock to a write lock.  This only
+   * works if there are no other readers present, in which case the
+   * method returns 0.  Otherwise, the method returns -1 and sets
+   * @c errno to @c EBUSY.  The caller of this method *must* already
+   * possess this lock as a read lock.
+   */
+  int tryacquire_write_upgrade (void);
+
+  /// Same as acquire_write(), for interface uniformity with the
+  /// other synchronization wrappers.
+  int acquire (void);
+
+  /// Same as tryacquire_write().
+  int tryacquire (void);
+
+  /// Release a read or a write lock held by the calling thread.
+  int release (void);
+
+  /// Return the underlying lock.
+  const ACE_rwlock_t &lock (void) const;
+
+  /// Dump the state of an object.
+  void dump (void) const;
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+
+private:
+  typedef std::atomic<ACE_Scalable_RW_Mutex *> Slot;
+
+  /// Try to take a reader slot.  Returns false if the lock is not read
+  /// biased or the slot is busy.
+  bool acquire_slot_i (void);
+
+  /// Turn the read bias back on once the inhibition period is over.
+  /// Called by readers holding the underlying lock.
+  void rebias_i (void);
+
+  /**
+   * Clear the read bias.  Called with the underlying write lock held.
+   * If @a wait, blocks until no reader slot refers to this lock;
+   * otherwise returns -1 if any does, ignoring the slot of
+   * @a own (held by the caller).
+   */
+  int revoke_i (bool wait, Slot *own = 0);
+
+  /// Lock used by writers, and by readers when there is no read bias.
+  ACE_RW_Thread_Mutex lock_;
+
+  /// True if readers may use the slot table.
+  std::atomic<bool> read_bias_;
+
+  /// High resolution time before which readers must not set
+  /// @c read_bias_ again.
+  std::atomic<ACE_hrtime_t> inhibit_until_;
+
+  // = Prevent assignment and initialization.
+  void operator= (const ACE_Scalable_RW_Mutex &);
+  ACE_Scalable_RW_Mutex (const ACE_Scalable_RW_Mutex &);
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#if defined (__ACE_INLINE__)
+#include "ace/Scalable_RW_Mutex.inl"
+#endif /* __ACE_INLINE__ */
+
+#else /* ACE_HAS_CPP11 */
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+typedef ACE_RW_Thread_Mutex ACE_Scalable_RW_Mutex;
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* ACE_HAS_CPP11 */
+
+#endif /* !ACE_HAS_THREADS */
+
+#include /**/ "ace/post.h"
+#endif /* ACE_SCALABLE_RW_MUTEX_H */
@@ -0,0 +1,32 @@
+// -*- C++ -*-
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+ACE_INLINE const ACE_rwlock_t &
+ACE_Scalable_RW_Mutex::lock (void) const
+{
+// ACE_TRACE ("ACE_Scalable_RW_Mutex::lock");
+  return this->lock_.lock ();
+}
+
+ACE_INLINE int
+ACE_Scalable_RW_Mutex::remove (void)
+{
+// ACE_TRACE ("ACE_Scalable_RW_Mutex::remove");
+  return this->lock_.remove ();
+}
+
+ACE_INLINE int
+ACE_Scalable_RW_Mutex::acquire (void)
+{
+// ACE_TRACE ("ACE_Scalable_RW_Mutex::acquire");
+  return this->acquire_write ();
+}
+
+ACE_INLINE int
+ACE_Scalable_RW_Mutex::tryacquire (void)
+{
+// ACE_TRACE ("ACE_Scalable_RW_Mutex::tryacquire");
+  return this->tryacquire_write ();
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
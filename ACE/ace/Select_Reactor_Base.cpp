@@ -586,7 +586,11 @@ ACE_Select_Reactor_Notify::dump (void) const
 
   ACELIB_DEBUG ((LM_DEBUG, ACE_BEGIN_DUMP, this));
   ACELIB_DEBUG ((LM_DEBUG, ACE_TEXT ("select_reactor_ = %x"), this->select_reactor_));
+#if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
+  this->notification_wakeup_.dump ();
+#else
   this->notification_pipe_.dump ();
+#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
   ACELIB_DEBUG ((LM_DEBUG, ACE_END_DUMP));
 #endif /* ACE_HAS_DUMP */
 }
@@ -608,33 +612,34 @@ ACE_Select_Reactor_Notify::open (ACE_Reactor_Impl *r,
           return -1;
         }
 
-      if (this->notification_pipe_.open () == -1)
-        return -1;
-#if defined (F_SETFD) && !defined (ACE_LACKS_FCNTL)
-      if (ACE_OS::fcntl (this->notification_pipe_.read_handle (), F_SETFD, 1) == -1)
+#if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
+      if (notification_queue_.open() == -1)
         {
           return -1;
         }
 
-      if (ACE_OS::fcntl (this->notification_pipe_.write_handle (), F_SETFD, 1) == -1)
+      // The wakeup handles are non-blocking and close-on-exec.
+      if (this->notification_wakeup_.open () == -1)
+        return -1;
+
+      return this->select_reactor_->register_handler
+        (this->notification_wakeup_.handle (),
+         this,
+         ACE_Event_Handler::READ_MASK);
+#else
+      if (this->notification_pipe_.open () == -1)
+        return -1;
+# if defined (F_SETFD) && !defined (ACE_LACKS_FCNTL)
+      if (ACE_OS::fcntl (this->notification_pipe_.read_handle (), F_SETFD, 1) == -1)
         {
           return -1;
         }
-#endif /* F_SETFD */
 
-#if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
-      if (notification_queue_.open() == -1)
+      if (ACE_OS::fcntl (this->notification_pipe_.write_handle (), F_SETFD, 1) == -1)
         {
           return -1;
         }
-
-# if defined (ACE_LACKS_LISTEN) && defined (ACE_LACKS_SOCKETPAIR) \
-  && !defined (ACE_HAS_STREAM_PIPES)
-      if (ACE::set_flags (this->notification_pipe_.write_handle (),
-                          ACE_NONBLOCK) == -1)
-        return -1;
-# endif
-#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
+# endif /* F_SETFD */
 
       // There seems to be a Win32 bug with this...  Set this into
       // non-blocking mode.
@@ -646,6 +651,7 @@ ACE_Select_Reactor_Notify::open (ACE_Reactor_Impl *r,
           (this->notification_pipe_.read_handle (),
            this,
            ACE_Event_Handler::READ_MASK);
+#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
     }
   else
     {
@@ -661,6 +667,8 @@ ACE_Select_Reactor_Notify::close (void)
 
 #if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
   notification_queue_.reset();
+
+  return this->notification_wakeup_.close ();
 #else
   if (this->notification_pipe_.read_handle() != ACE_INVALID_HANDLE)
     {
@@ -680,9 +688,9 @@ ACE_Select_Reactor_Notify::close (void)
             }
         }
     }
-#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 
   return this->notification_pipe_.close ();
+#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 }
 
 int
@@ -707,6 +715,8 @@ ACE_Select_Reactor_Notify::notify (ACE_Event_Handler *event_handler,
   ACE_Notification_Buffer buffer (event_handler, mask);
 
 #if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
+  ACE_UNUSED_ARG (timeout);
+
   int const notification_required =
     notification_queue_.push_new_notification(buffer);
 
@@ -715,15 +725,19 @@ ACE_Select_Reactor_Notify::notify (ACE_Event_Handler *event_handler,
       return -1;
     }
 
+  // No failures, the handler is now owned by the notification queue
+  safe_handler.release ();
+
+  // Only the first notification queued since the reactor last emptied
+  // the queue has to wake it up, the reactor keeps popping until the
+  // queue is empty.
   if (notification_required == 0)
     {
-      // No failures, the handler is now owned by the notification queue
-      safe_handler.release ();
-
       return 0;
     }
-#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 
+  return this->notification_wakeup_.signal ();
+#else
   ssize_t const n = ACE::send (this->notification_pipe_.write_handle (),
                                (char *) &buffer,
                                sizeof buffer,
@@ -737,6 +751,7 @@ ACE_Select_Reactor_Notify::notify (ACE_Event_Handler *event_handler,
   safe_handler.release ();
 
   return 0;
+#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 }
 
 // Handles pending threads (if any) that are waiting to unblock the
@@ -748,8 +763,7 @@ ACE_Select_Reactor_Notify::dispatch_notifications (int &number_of_active_handles
 {
   ACE_TRACE ("ACE_Select_Reactor_Notify::dispatch_notifications");
 
-  ACE_HANDLE const read_handle =
-    this->notification_pipe_.read_handle ();
+  ACE_HANDLE const read_handle = this->notify_handle ();
 
   if (read_handle != ACE_INVALID_HANDLE
       && rd_mask.is_set (read_handle))
@@ -768,7 +782,11 @@ ACE_Select_Reactor_Notify::notify_handle (void)
 {
   ACE_TRACE ("ACE_Select_Reactor_Notify::notify_handle");
 
+#if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
+  return this->notification_wakeup_.handle ();
+#else
   return this->notification_pipe_.read_handle ();
+#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 }
 
 
@@ -799,19 +817,18 @@ ACE_Select_Reactor_Notify::is_dispatchable (ACE_Notification_Buffer &buffer)
 int
 ACE_Select_Reactor_Notify::dispatch_notify (ACE_Notification_Buffer &buffer)
 {
-  int result = 0;
-
 #if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
-  // Dispatch one message from the notify queue, and put another in
-  // the pipe if one is available.  Remember, the idea is to keep
-  // exactly one message in the pipe at a time.
+  // Dispatch one message from the notify queue, and signal the wakeup
+  // again if more are available, so that the reactor comes back for
+  // them even if it stops dispatching after this one.
 
   bool more_messages_queued = false;
   ACE_Notification_Buffer next;
 
-  result = notification_queue_.pop_next_notification(buffer,
-                                                     more_messages_queued,
-                                                     next);
+  int const result =
+    notification_queue_.pop_next_notification(buffer,
+                                              more_messages_queued,
+                                              next);
 
   if (result == 0 || result == -1)
     {
@@ -820,11 +837,18 @@ ACE_Select_Reactor_Notify::dispatch_notify (ACE_Notification_Buffer &buffer)
 
   if(more_messages_queued)
     {
-      (void) ACE::send(this->notification_pipe_.write_handle(),
-            (char *)&next, sizeof(ACE_Notification_Buffer));
+      (void) this->notification_wakeup_.signal ();
     }
 #endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 
+  return this->dispatch_notify_i (buffer);
+}
+
+int
+ACE_Select_Reactor_Notify::dispatch_notify_i (ACE_Notification_Buffer &buffer)
+{
+  int result = 0;
+
   // If eh == 0 then another thread is unblocking the
   // <ACE_Select_Reactor> to update the <ACE_Select_Reactor>'s
   // internal structures.  Otherwise, we need to dispatch the
@@ -882,6 +906,14 @@ ACE_Select_Reactor_Notify::read_notify_pipe (ACE_HANDLE handle,
 {
   ACE_TRACE ("ACE_Select_Reactor_Notify::read_notify_pipe");
 
+#if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
+  // The notifications are in the queue, the handle only tells whether
+  // there are any.  dispatch_notify() fills in the buffer.
+  ACE_UNUSED_ARG (handle);
+  buffer.eh_ = 0;
+  buffer.mask_ = 0;
+  return this->notification_wakeup_.clear ();
+#else
   // This is kind of a weird, fragile beast.  We first read with a
   // regular read.  The read side of this socket is non-blocking, so
   // the read may end up being short.
@@ -929,6 +961,7 @@ ACE_Select_Reactor_Notify::read_notify_pipe (ACE_HANDLE handle,
     return -1;
 
   return 0;
+#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 }
 
 
@@ -943,6 +976,37 @@ ACE_Select_Reactor_Notify::handle_input (ACE_HANDLE handle)
   int result = 0;
   ACE_Notification_Buffer buffer;
 
+#if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
+  ACE_UNUSED_ARG (handle);
+
+  // A single wakeup covers all the notifications queued so far, so
+  // pop them straight from the queue instead of signaling the wakeup
+  // again for each of them.
+  result = this->notification_wakeup_.clear ();
+  while (result > 0)
+    {
+      bool more_messages_queued = false;
+      ACE_Notification_Buffer next;
+
+      result = notification_queue_.pop_next_notification (buffer,
+                                                          more_messages_queued,
+                                                          next);
+      if (result <= 0)
+        break;
+
+      if (this->dispatch_notify_i (buffer) > 0)
+        ++number_dispatched;
+
+      // Bail out if we've reached the <notify_threshold_>, and make
+      // sure we get back to the remaining notifications.
+      if (number_dispatched == this->max_notify_iterations_)
+        {
+          if (more_messages_queued)
+            (void) this->notification_wakeup_.signal ();
+          break;
+        }
+    }
+#else
   // If there is only one buffer in the pipe, this will loop and call
   // read_notify_pipe() twice.  The first time will read the buffer, and
   // the second will read the fact that the pipe is empty.
@@ -959,6 +1023,7 @@ ACE_Select_Reactor_Notify::handle_input (ACE_HANDLE handle)
       if (number_dispatched == this->max_notify_iterations_)
         break;
     }
+#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 
   // Reassign number_dispatched to -1 if things have gone seriously
   // wrong.
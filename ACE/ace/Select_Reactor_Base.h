@@ -229,6 +229,9 @@ public:
   ACE_ALLOC_HOOK_DECLARE;
 
 protected:
+  /// Make the upcall requested by @a buffer, if any.
+  int dispatch_notify_i (ACE_Notification_Buffer &buffer);
+
   /**
    * Keep a back pointer to the ACE_Select_Reactor.  If this value
    * if NULL then the ACE_Select_Reactor has been initialized with
@@ -236,12 +239,22 @@ protected:
    */
   ACE_Select_Reactor_Impl *select_reactor_;
 
+#if defined (ACE_HAS_REACTOR_NOTIFICATION_QUEUE)
+  /**
+   * Contains the ACE_HANDLE the ACE_Select_Reactor is listening on.
+   * Threads wanting the attention of the ACE_Select_Reactor queue
+   * their notification and signal this wakeup when they find the
+   * queue empty.
+   */
+  ACE_Notification_Wakeup notification_wakeup_;
+#else
   /**
    * Contains the ACE_HANDLE the ACE_Select_Reactor is listening
    * on, as well as the ACE_HANDLE that threads wanting the
    * attention of the ACE_Select_Reactor will write to.
    */
   ACE_Pipe notification_pipe_;
+#endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 
   /**
    * Keeps track of the maximum number of times that the
@@ -260,11 +273,11 @@ protected:
    * is, no more than a certain number of bytes may be stored in the
    * pipe without blocking.  This limit may be too small for certain
    * applications.  In this case, ACE can be configured to store all
-   * the events in user-space.  The pipe is still needed to wake up
-   * the reactor thread, but only one event is sent through the pipe
-   * at a time.
+   * the events in user-space.  The notification_wakeup_ is still
+   * needed to wake up the reactor thread, but it is only signaled
+   * when the queue was found empty.
    */
-  ACE_Notification_Queue notification_queue_;
+  ACE_Reactor_Notification_Queue notification_queue_;
 #endif /* ACE_HAS_REACTOR_NOTIFICATION_QUEUE */
 };
 
@@ -0,0 +1,151 @@
+/**
+ * @file Slab_Malloc.cpp
+ */
+
+#include "ace/Slab_Malloc.h"
+
+#if !defined (__ACE_INLINE__)
+#include "ace/Slab_Malloc.inl"
+#endif /* __ACE_INLINE__ */
+
+#include "ace/Log_Category.h"
+#include "ace/OS_NS_errno.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+ACE_Slab_Control_Block::Size_Class::Size_Class (void)
+  : head_ (0),
+    free_count_ (0)
+{
+}
+
+int
+ACE_Slab_Control_Block::Size_Class::open (void)
+{
+#if defined (ACE_SLAB_MALLOC_HAS_CLASS_LOCKS)
+  pthread_mutexattr_t attributes;
+  int result = ::pthread_mutexattr_init (&attributes);
+  if (result == 0)
+    {
+      result = ::pthread_mutexattr_setpshared (&attributes,
+                                               PTHREAD_PROCESS_SHARED);
+      if (result == 0)
+        result = ::pthread_mutexattr_setrobust (&attributes,
+                                                PTHREAD_MUTEX_ROBUST);
+      if (result == 0)
+        result = ::pthread_mutex_init (&this->lock_, &attributes);
+      ::pthread_mutexattr_destroy (&attributes);
+    }
+
+  if (result != 0)
+    {
+      errno = result;
+      return -1;
+    }
+#endif /* ACE_SLAB_MALLOC_HAS_CLASS_LOCKS */
+  return 0;
+}
+
+int
+ACE_Slab_Control_Block::Size_Class::acquire (void)
+{
+#if defined (ACE_SLAB_MALLOC_HAS_CLASS_LOCKS)
+  int const result = ::pthread_mutex_lock (&this->lock_);
+  if (result == EOWNERDEAD)
+    return 1;
+
+  if (result != 0)
+    {
+      errno = result;
+      return -1;
+    }
+#endif /* ACE_SLAB_MALLOC_HAS_CLASS_LOCKS */
+  return 0;
+}
+
+void
+ACE_Slab_Control_Block::Size_Class::consistent (void)
+{
+#if defined (ACE_SLAB_MALLOC_HAS_CLASS_LOCKS)
+  ::pthread_mutex_consistent (&this->lock_);
+#endif /* ACE_SLAB_MALLOC_HAS_CLASS_LOCKS */
+}
+
+ACE_Slab_Control_Block::ACE_Slab_Control_Block (void)
+  : magic_ (0),
+    ref_counter_ (1),
+    name_head_ (0),
+    pool_bytes_ (0)
+{
+  for (size_t i = 0; i <= MAX_ORDER; ++i)
+    this->buddy_lists_[i] = 0;
+}
+
+int
+ACE_Slab_Control_Block::open (void)
+{
+  for (size_t i = 0; i != NUM_CLASSES; ++i)
+    if (this->size_classes_[i].open () == -1)
+      return -1;
+
+  return 0;
+}
+
+void
+ACE_Slab_Control_Block::repair_class (size_t size_class)
+{
+  Size_Class &sc = this->size_classes_[size_class];
+
+  // No class has more blocks than fit in the whole pool, should the
+  // list loop.
+  ACE_UINT64 const limit =
+    this->pool_bytes_ / ACE_Slab_Control_Block::class_bytes (size_class);
+
+  ACE_UINT64 count = 0;
+  Offset *link = &sc.head_;
+  while (*link != 0)
+    {
+      Free_Block *block = reinterpret_cast<Free_Block *> (
+        reinterpret_cast<char *> (this) + *link);
+      if (count == limit
+          || block->header_.kind_ != SMALL_BLOCK
+          || block->header_.size_class_ != size_class)
+        {
+          *link = 0;
+          break;
+        }
+      ++count;
+      link = &block->next_;
+    }
+
+  ACELIB_DEBUG ((LM_WARNING,
+                 ACE_TEXT ("(%P|%t) ACE_Slab_Control_Block::repair_class, ")
+                 ACE_TEXT ("the owner of the %B byte class died, %Q of %Q ")
+                 ACE_TEXT ("blocks left\n"),
+                 ACE_Slab_Control_Block::class_bytes (size_class),
+                 count,
+                 sc.free_count_));
+
+  sc.free_count_ = count;
+}
+
+void
+ACE_Slab_Control_Block::dump (void) const
+{
+#if defined (ACE_HAS_DUMP)
+  ACELIB_DEBUG ((LM_DEBUG, ACE_BEGIN_DUMP, this));
+  ACELIB_DEBUG ((LM_DEBUG,
+                 ACE_TEXT ("ref_counter_ = %d, pool_bytes_ = %Q\n"),
+                 this->ref_counter_,
+                 this->pool_bytes_));
+  for (size_t i = 0; i != NUM_CLASSES; ++i)
+    if (this->size_classes_[i].free_count_ != 0)
+      ACELIB_DEBUG ((LM_DEBUG,
+                     ACE_TEXT ("%B byte blocks: %Q free\n"),
+                     ACE_Slab_Control_Block::class_bytes (i),
+                     this->size_classes_[i].free_count_));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_END_DUMP));
+#endif /* ACE_HAS_DUMP */
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,269 @@
+// -*- C++ -*-
+
+//==========================================================================
+/**
+ *  @file    Slab_Malloc.h
+ *
+ *  Layout of the memory managed by ACE_Slab_Malloc.
+ */
+//==========================================================================
+
+#ifndef ACE_SLAB_MALLOC_H
+#define ACE_SLAB_MALLOC_H
+#include /**/ "ace/pre.h"
+
+#include /**/ "ace/ACE_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/Basic_Types.h"
+#include "ace/os_include/os_stddef.h"
+
+#if defined (ACE_HAS_CPP11) && defined (ACE_HAS_PTHREAD_MUTEX_ROBUST)
+/// The size classes have locks of their own, robust process shared
+/// mutexes, instead of relying on the pool lock.
+# define ACE_SLAB_MALLOC_HAS_CLASS_LOCKS
+#endif /* ACE_HAS_CPP11 && ACE_HAS_PTHREAD_MUTEX_ROBUST */
+
+#if defined (ACE_SLAB_MALLOC_HAS_CLASS_LOCKS)
+# include "ace/os_include/os_pthread.h"
+# include <atomic>
+#endif /* ACE_SLAB_MALLOC_HAS_CLASS_LOCKS */
+
+#if !defined (ACE_SLAB_MALLOC_SLAB_ORDER)
+/// log2 of the size of the slabs carved into small blocks.
+# define ACE_SLAB_MALLOC_SLAB_ORDER 16
+#endif /* ACE_SLAB_MALLOC_SLAB_ORDER */
+
+#if !defined (ACE_SLAB_MALLOC_CHUNK_ORDER)
+/// log2 of the size of the chunks requested from the memory pool.
+# define ACE_SLAB_MALLOC_CHUNK_ORDER 20
+#endif /* ACE_SLAB_MALLOC_CHUNK_ORDER */
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class ACE_Slab_Control_Block
+ *
+ * @brief The control block ACE_Slab_Malloc keeps at the start of its
+ * memory pool.
+ *
+ * Everything in the pool refers to everything else by its offset from
+ * the control block, so processes may map the pool at different
+ * addresses, as with ACE_PI_Control_Block, without the cost of
+ * ACE_Based_Pointer.
+ *
+ * Every block starts with a Block_Header.  Blocks of up to
+ * MAX_SMALL_BYTES, header included, are rounded up to one of
+ * NUM_CLASSES size classes (four per power of two) and carved out of
+ * slabs of 2^ACE_SLAB_MALLOC_SLAB_ORDER bytes.  Each class has its own
+ * free list and, with ACE_SLAB_MALLOC_HAS_CLASS_LOCKS, its own lock, so
+ * allocations of different sizes do not contend.  Larger blocks and the slabs come from a binary buddy
+ * allocator over chunks of at least 2^ACE_SLAB_MALLOC_CHUNK_ORDER
+ * bytes, which coalesces freed blocks with their buddies.
+ */
+class ACE_Export ACE_Slab_Control_Block
+{
+public:
+  /// Offset from the control block; 0 stands for "none".
+  typedef ACE_INT64 Offset;
+
+  enum
+  {
+    /// Identifies a pool formatted by ACE_Slab_Malloc.
+    MAGIC = 0x41534c42,
+    NUM_CLASSES = 27,
+    MIN_BLOCK_BYTES = 32,
+    MAX_SMALL_BYTES = 4096,
+    /// Smallest block of the buddy allocator, used for blocks just
+    /// over MAX_SMALL_BYTES.
+    MIN_ORDER = 13,
+    MAX_ORDER = 47
+  };
+
+  enum Block_Kind
+  {
+    /// A free block of the buddy allocator.
+    FREE_BLOCK = 0x5a,
+    /// A block of the buddy allocator in use.
+    LARGE_BLOCK = 0xa5,
+    /// A block of a slab, in use or in its class free list.
+    SMALL_BLOCK = 0x3c
+  };
+
+  /**
+   * @class Block_Header
+   *
+   * @brief Precedes every block, keeps user data 16 byte aligned.
+   */
+  class Block_Header
+  {
+  public:
+    /// Offset of the buddy chunk the block belongs to.
+    Offset chunk_;
+
+    /// One of the Block_Kind values.
+    ACE_UINT8 kind_;
+
+    /// log2 of the size of a buddy block.
+    ACE_UINT8 order_;
+
+    /// Size class of a small block.
+    ACE_UINT8 size_class_;
+
+    /// log2 of the size of the chunk.
+    ACE_UINT8 chunk_order_;
+
+    ACE_UINT32 reserved_;
+  };
+
+  /**
+   * @class Free_Block
+   *
+   * @brief A free block; its links overlay the user data.
+   */
+  class Free_Block
+  {
+  public:
+    Block_Header header_;
+    Offset next_;
+    Offset prev_;
+  };
+
+  /**
+   * @class Size_Class
+   *
+   * @brief The free list of one size class and the lock guarding it.
+   *
+   * The lock is a robust process shared mutex.  When its owner dies
+   * holding it, the next process taking it is told so and repairs the
+   * list before using it, see ACE_Slab_Control_Block::acquire_class().
+   * The list only changes when its head is stored, after the blocks
+   * moved to it are linked, so the repair only has to count the blocks
+   * again; the blocks the dead owner was moving may be lost.
+   *
+   * Without ACE_SLAB_MALLOC_HAS_CLASS_LOCKS there is no lock, the
+   * caller holds the pool lock instead.
+   */
+  class ACE_Export Size_Class
+  {
+  public:
+    Size_Class (void);
+
+    /// Initialize the lock, once, when the pool is formatted.
+    int open (void);
+
+    /// Take the lock.  Returns 1 if its previous owner died holding
+    /// it, consistent() must then be called once the list is repaired.
+    /// Returns 0 on success and -1 on failure.
+    int acquire (void);
+
+    /// Mark the lock taken over from a dead owner usable again.
+    void consistent (void);
+
+    /// Release the lock.
+    void release (void);
+
+    /// Make @a head the first free block, once the blocks in front of
+    /// the old head are linked to it.
+    void publish (Offset head);
+
+#if defined (ACE_SLAB_MALLOC_HAS_CLASS_LOCKS)
+    pthread_mutex_t lock_;
+#endif /* ACE_SLAB_MALLOC_HAS_CLASS_LOCKS */
+
+    /// First free block of the class.
+    Offset head_;
+
+    /// Number of blocks in the free list.
+    ACE_UINT64 free_count_;
+
+    /// Keep the classes on separate 64 byte cache lines.
+#if defined (ACE_SLAB_MALLOC_HAS_CLASS_LOCKS)
+    char pad_[64 - (sizeof (pthread_mutex_t) + 16) % 64];
+#else
+    char pad_[64 - 16];
+#endif /* ACE_SLAB_MALLOC_HAS_CLASS_LOCKS */
+  };
+
+  /**
+   * @class Name_Node
+   *
+   * @brief A named memory region, see ACE_Slab_Malloc::bind().
+   */
+  class Name_Node
+  {
+  public:
+    Offset next_;
+    Offset pointer_;
+
+    /// The name follows the node.
+    char *name (void);
+  };
+
+  ACE_Slab_Control_Block (void);
+
+  /// Initialize the locks of the size classes, once, when the pool is
+  /// formatted.
+  int open (void);
+
+  /// Take the lock of @a size_class.  If its previous owner died
+  /// holding it, the free list is repaired first.  Returns 0 on
+  /// success and -1 on failure.
+  int acquire_class (size_t size_class);
+
+  /// Release the lock of @a size_class.
+  void release_class (size_t size_class);
+
+  /// Size class of a block of @a block_bytes, header included.
+  static size_t size_class (size_t block_bytes);
+
+  /// Size of the blocks of @a size_class, header included.
+  static size_t class_bytes (size_t size_class);
+
+  /// Smallest order of a buddy block holding @a block_bytes.
+  static size_t order_of (size_t block_bytes);
+
+  /// Largest order of a buddy block fitting in @a bytes.
+  static size_t floor_order (size_t bytes);
+
+  /// Dump the state of an object.
+  void dump (void) const;
+
+  /// Set to MAGIC once the control block is initialized.
+  ACE_UINT32 magic_;
+
+  /// Reference counter.
+  int ref_counter_;
+
+  /// Head of the list of named regions.
+  Offset name_head_;
+
+  /// Free blocks of the buddy allocator, one doubly linked list per
+  /// order.
+  Offset buddy_lists_[MAX_ORDER + 1];
+
+  /// Bytes obtained from the memory pool.
+  ACE_UINT64 pool_bytes_;
+
+  /// Small block free lists.
+  Size_Class size_classes_[NUM_CLASSES];
+
+private:
+  /// Count the blocks of the free list of @a size_class again, after
+  /// its lock was taken over from a dead owner.  The list is cut at the
+  /// first block that is not a free block of the class, in case the
+  /// owner did any worse than lose blocks.
+  void repair_class (size_t size_class);
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#if defined (__ACE_INLINE__)
+#include "ace/Slab_Malloc.inl"
+#endif /* __ACE_INLINE__ */
+
+#include /**/ "ace/post.h"
+#endif /* ACE_SLAB_MALLOC_H */
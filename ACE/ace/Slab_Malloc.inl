@@ -0,0 +1,87 @@
+// -*- C++ -*-
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+ACE_INLINE char *
+ACE_Slab_Control_Block::Name_Node::name (void)
+{
+  return reinterpret_cast<char *> (this + 1);
+}
+
+ACE_INLINE size_t
+ACE_Slab_Control_Block::size_class (size_t block_bytes)
+{
+  if (block_bytes <= 128)
+    return block_bytes <= MIN_BLOCK_BYTES ? 0 : (block_bytes + 15) / 16 - 2;
+
+  // Four classes between each power of two past 128.
+  size_t const k = ACE_Slab_Control_Block::floor_order (block_bytes - 1);
+  return 7 + (k - 7) * 4 + ((block_bytes - 1 - (size_t (1) << k)) >> (k - 2));
+}
+
+ACE_INLINE size_t
+ACE_Slab_Control_Block::class_bytes (size_t size_class)
+{
+  if (size_class < 7)
+    return (size_class + 2) * 16;
+
+  size_t const k = 7 + (size_class - 7) / 4;
+  return (size_t (1) << k) + ((size_class - 7) % 4 + 1) * (size_t (1) << (k - 2));
+}
+
+ACE_INLINE size_t
+ACE_Slab_Control_Block::floor_order (size_t bytes)
+{
+  size_t order = 0;
+  while ((bytes >>= 1) != 0)
+    ++order;
+  return order;
+}
+
+ACE_INLINE size_t
+ACE_Slab_Control_Block::order_of (size_t block_bytes)
+{
+  size_t order = ACE_Slab_Control_Block::floor_order (block_bytes);
+  if ((size_t (1) << order) < block_bytes)
+    ++order;
+  return order < MIN_ORDER ? size_t (MIN_ORDER) : order;
+}
+
+ACE_INLINE void
+ACE_Slab_Control_Block::Size_Class::release (void)
+{
+#if defined (ACE_SLAB_MALLOC_HAS_CLASS_LOCKS)
+  ::pthread_mutex_unlock (&this->lock_);
+#endif /* ACE_SLAB_MALLOC_HAS_CLASS_LOCKS */
+}
+
+ACE_INLINE void
+ACE_Slab_Control_Block::Size_Class::publish (Offset head)
+{
+#if defined (ACE_SLAB_MALLOC_HAS_CLASS_LOCKS)
+  // The links written before must not be delayed past the head: the
+  // process may die right after storing it.
+  std::atomic_signal_fence (std::memory_order_release);
+#endif /* ACE_SLAB_MALLOC_HAS_CLASS_LOCKS */
+  this->head_ = head;
+}
+
+ACE_INLINE int
+ACE_Slab_Control_Block::acquire_class (size_t size_class)
+{
+  Size_Class &sc = this->size_classes_[size_class];
+  int const result = sc.acquire ();
+  if (result == 1)
+    {
+      this->repair_class (size_class);
+      sc.consistent ();
+    }
+  return result == -1 ? -1 : 0;
+}
+
+ACE_INLINE void
+ACE_Slab_Control_Block::release_class (size_t size_class)
+{
+  this->size_classes_[size_class].release ();
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,723 @@
+#ifndef ACE_SLAB_MALLOC_T_CPP
+#define ACE_SLAB_MALLOC_T_CPP
+
+#include "ace/Slab_Malloc_T.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#if !defined (__ACE_INLINE__)
+#include "ace/Slab_Malloc_T.inl"
+#endif /* __ACE_INLINE__ */
+
+#include "ace/Log_Category.h"
+#include "ace/OS_NS_errno.h"
+#include "ace/OS_NS_string.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+ACE_ALLOC_HOOK_DEFINE_Tmc(ACE_Slab_Malloc)
+
+template <ACE_MEM_POOL_1, class ACE_LOCK>
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::ACE_Slab_Malloc (const ACE_TCHAR *pool_name)
+  : cb_ptr_ (0),
+    memory_pool_ (pool_name),
+    lock_ (0),
+    delete_lock_ (false),
+    bad_flag_ (0)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::ACE_Slab_Malloc");
+  this->lock_ = ACE_Malloc_Lock_Adapter_T<ACE_LOCK> ()(pool_name);
+  if (this->lock_ != 0)
+    {
+      this->delete_lock_ = true;
+
+      this->bad_flag_ = this->open ();
+      if (this->bad_flag_ == -1)
+        ACELIB_ERROR ((LM_ERROR,
+                       ACE_TEXT ("%p\n"),
+                       ACE_TEXT ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::ACE_Slab_Malloc")));
+    }
+  else
+    this->bad_flag_ = -1;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK>
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::ACE_Slab_Malloc (const ACE_TCHAR *pool_name,
+                                                            const ACE_TCHAR *lock_name,
+                                                            const ACE_MEM_POOL_OPTIONS *options)
+  : cb_ptr_ (0),
+    memory_pool_ (pool_name, options),
+    lock_ (0),
+    delete_lock_ (false),
+    bad_flag_ (0)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::ACE_Slab_Malloc");
+  // Use pool_name for lock_name if lock_name not passed.
+  const ACE_TCHAR *name = lock_name ? lock_name : pool_name;
+  this->lock_ = ACE_Malloc_Lock_Adapter_T<ACE_LOCK> ()(name);
+  if (this->lock_ != 0)
+    {
+      this->delete_lock_ = true;
+
+      this->bad_flag_ = this->open ();
+      if (this->bad_flag_ == -1)
+        ACELIB_ERROR ((LM_ERROR,
+                       ACE_TEXT ("%p\n"),
+                       ACE_TEXT ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::ACE_Slab_Malloc")));
+    }
+  else
+    this->bad_flag_ = -1;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK>
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::ACE_Slab_Malloc (const ACE_TCHAR *pool_name,
+                                                            const ACE_MEM_POOL_OPTIONS *options,
+                                                            ACE_LOCK *lock)
+  : cb_ptr_ (0),
+    memory_pool_ (pool_name, options),
+    lock_ (lock),
+    delete_lock_ (false),
+    bad_flag_ (0)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::ACE_Slab_Malloc");
+
+  if (lock == 0)
+    {
+      this->bad_flag_ = -1;
+      errno = EINVAL;
+      return;
+    }
+
+  this->bad_flag_ = this->open ();
+  if (this->bad_flag_ == -1)
+    ACELIB_ERROR ((LM_ERROR,
+                   ACE_TEXT ("%p\n"),
+                   ACE_TEXT ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::ACE_Slab_Malloc")));
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK>
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::~ACE_Slab_Malloc (void)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::~ACE_Slab_Malloc");
+  if (this->delete_lock_)
+    {
+      delete this->lock_;
+      this->lock_ = 0;
+    }
+}
+
+// The first time in, format the control block at the start of the
+// pool and hand the rest of the first segment to the buddy allocator.
+// Later on, and in other processes, just check the format.
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::open (void)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::open");
+  ACE_GUARD_RETURN (ACE_LOCK, ace_mon, *this->lock_, -1);
+
+  size_t rounded_bytes = 0;
+  int first_time = 0;
+
+  this->cb_ptr_ = static_cast<CONTROL_BLOCK *> (
+    this->memory_pool_.init_acquire (sizeof *this->cb_ptr_,
+                                     rounded_bytes,
+                                     first_time));
+  if (this->cb_ptr_ == 0)
+    ACELIB_ERROR_RETURN ((LM_ERROR,
+                          ACE_TEXT ("(%P|%t) %p\n"),
+                          ACE_TEXT ("init_acquire failed")),
+                         -1);
+
+  if (first_time)
+    {
+      new (this->cb_ptr_) CONTROL_BLOCK;
+      this->cb_ptr_->pool_bytes_ = rounded_bytes;
+      if (this->cb_ptr_->open () == -1)
+        {
+          this->cb_ptr_ = 0;
+          ACELIB_ERROR_RETURN ((LM_ERROR,
+                                ACE_TEXT ("(%P|%t) %p\n"),
+                                ACE_TEXT ("ACE_Slab_Malloc: class locks")),
+                               -1);
+        }
+
+      size_t const cb_bytes = (sizeof *this->cb_ptr_ + 15) & ~size_t (15);
+      if (rounded_bytes > cb_bytes)
+        this->add_region (reinterpret_cast<char *> (this->cb_ptr_) + cb_bytes,
+                          rounded_bytes - cb_bytes);
+
+      this->cb_ptr_->magic_ = CONTROL_BLOCK::MAGIC;
+    }
+  else if (this->cb_ptr_->magic_ != CONTROL_BLOCK::MAGIC)
+    {
+      this->cb_ptr_ = 0;
+      errno = EINVAL;
+      ACELIB_ERROR_RETURN ((LM_ERROR,
+                            ACE_TEXT ("(%P|%t) ACE_Slab_Malloc: the pool ")
+                            ACE_TEXT ("was not created by ACE_Slab_Malloc\n")),
+                           -1);
+    }
+  else
+    ++this->cb_ptr_->ref_counter_;
+
+  return 0;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::release (int close)
+{
+  ACE_GUARD_RETURN (ACE_LOCK, ace_mon, *this->lock_, -1);
+  if (this->cb_ptr_ != 0)
+    {
+      int const retv = --this->cb_ptr_->ref_counter_;
+
+      if (close)
+        this->memory_pool_.release (0);
+
+      if (retv == 0)
+        {
+          ace_mon.release ();
+          this->remove ();
+        }
+
+      return retv;
+    }
+  return -1;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::remove (void)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::remove");
+
+#if defined (ACE_HAS_MALLOC_STATS)
+  this->print_stats ();
+#endif /* ACE_HAS_MALLOC_STATS */
+
+  // Remove the ACE_LOCK.
+  if (this->delete_lock_)
+    this->lock_->remove ();
+
+  // Give the memory pool a chance to release its resources.
+  int const result = this->memory_pool_.release ();
+
+  this->cb_ptr_ = 0;
+
+  return result;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> void
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::add_region (char *start,
+                                                       size_t bytes)
+{
+  // Block headers go on 16 byte boundaries.
+  size_t const misalignment =
+    static_cast<size_t> (this->offset (start)) & size_t (15);
+  if (misalignment != 0)
+    {
+      if (bytes < 16 - misalignment)
+        return;
+      start += 16 - misalignment;
+      bytes -= 16 - misalignment;
+    }
+
+  while (bytes >= (size_t (1) << CONTROL_BLOCK::MIN_ORDER))
+    {
+      size_t order = CONTROL_BLOCK::floor_order (bytes);
+      if (order > CONTROL_BLOCK::MAX_ORDER)
+        order = CONTROL_BLOCK::MAX_ORDER;
+
+      FREE_BLOCK *chunk = reinterpret_cast<FREE_BLOCK *> (start);
+      chunk->header_.chunk_ = this->offset (chunk);
+      chunk->header_.chunk_order_ = static_cast<ACE_UINT8> (order);
+      chunk->header_.size_class_ = 0;
+      chunk->header_.reserved_ = 0;
+      this->buddy_push (chunk, order);
+
+      start += size_t (1) << order;
+      bytes -= size_t (1) << order;
+    }
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::grow (size_t order)
+{
+  if (order < ACE_SLAB_MALLOC_CHUNK_ORDER)
+    order = ACE_SLAB_MALLOC_CHUNK_ORDER;
+
+  size_t rounded_bytes = 0;
+  void *chunk = this->memory_pool_.acquire (size_t (1) << order,
+                                            rounded_bytes);
+
+  // The pool may have been mapped somewhere else to grow it.
+  void *remap_addr = this->memory_pool_.base_addr ();
+  if (remap_addr != 0)
+    this->cb_ptr_ = static_cast<CONTROL_BLOCK *> (remap_addr);
+
+  if (chunk == 0)
+    return -1;
+
+  this->cb_ptr_->pool_bytes_ += rounded_bytes;
+  this->add_region (static_cast<char *> (chunk), rounded_bytes);
+  return 0;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> void
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::buddy_push (FREE_BLOCK *block,
+                                                       size_t order)
+{
+  Offset const self = this->offset (block);
+  Offset &head = this->cb_ptr_->buddy_lists_[order];
+
+  block->header_.kind_ = CONTROL_BLOCK::FREE_BLOCK;
+  block->header_.order_ = static_cast<ACE_UINT8> (order);
+  block->next_ = head;
+  block->prev_ = 0;
+  if (head != 0)
+    this->block (head)->prev_ = self;
+  head = self;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> void
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::buddy_unlink (FREE_BLOCK *block)
+{
+  if (block->prev_ != 0)
+    this->block (block->prev_)->next_ = block->next_;
+  else
+    this->cb_ptr_->buddy_lists_[block->header_.order_] = block->next_;
+
+  if (block->next_ != 0)
+    this->block (block->next_)->prev_ = block->prev_;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK>
+typename ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::FREE_BLOCK *
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::buddy_malloc (size_t order)
+{
+  if (order > CONTROL_BLOCK::MAX_ORDER)
+    return 0;
+
+  for (bool grown = false; ; grown = true)
+    {
+      size_t found = order;
+      while (found <= CONTROL_BLOCK::MAX_ORDER
+             && this->cb_ptr_->buddy_lists_[found] == 0)
+        ++found;
+
+      if (found > CONTROL_BLOCK::MAX_ORDER)
+        {
+          if (grown || this->grow (order) == -1)
+            return 0;
+          continue;
+        }
+
+      FREE_BLOCK *result = this->block (this->cb_ptr_->buddy_lists_[found]);
+      this->buddy_unlink (result);
+
+      // Give back the upper halves until the block has the right size.
+      while (found > order)
+        {
+          --found;
+          FREE_BLOCK *half = reinterpret_cast<FREE_BLOCK *> (
+            reinterpret_cast<char *> (result) + (size_t (1) << found));
+          half->header_.chunk_ = result->header_.chunk_;
+          half->header_.chunk_order_ = result->header_.chunk_order_;
+          half->header_.size_class_ = 0;
+          half->header_.reserved_ = 0;
+          this->buddy_push (half, found);
+        }
+
+      result->header_.kind_ = CONTROL_BLOCK::LARGE_BLOCK;
+      result->header_.order_ = static_cast<ACE_UINT8> (order);
+      return result;
+    }
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> void
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::buddy_free (FREE_BLOCK *block)
+{
+  Offset const chunk = block->header_.chunk_;
+  size_t const chunk_order = block->header_.chunk_order_;
+  size_t order = block->header_.order_;
+  Offset self = this->offset (block);
+
+  // The buddy of a block is the other half of the block it was split
+  // from.  Its header says whether it is free and whole; a slab starts
+  // with the header of a small block, which is never free here.
+  while (order < chunk_order)
+    {
+      Offset const buddy_offset = chunk + ((self - chunk) ^ (Offset (1) << order));
+      FREE_BLOCK *buddy = this->block (buddy_offset);
+      if (buddy->header_.kind_ != CONTROL_BLOCK::FREE_BLOCK
+          || buddy->header_.order_ != order)
+        break;
+
+      this->buddy_unlink (buddy);
+      if (buddy_offset < self)
+        self = buddy_offset;
+      ++order;
+    }
+
+  FREE_BLOCK *merged = this->block (self);
+  merged->header_.chunk_ = chunk;
+  merged->header_.chunk_order_ = static_cast<ACE_UINT8> (chunk_order);
+  this->buddy_push (merged, order);
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK>
+typename ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::FREE_BLOCK *
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::refill (size_t size_class)
+{
+  // Another thread may have refilled the class while we waited for
+  // the pool lock.
+  FREE_BLOCK *result = this->pop_small (size_class);
+  if (result != 0)
+    return result;
+
+  char *slab = reinterpret_cast<char *> (
+    this->buddy_malloc (ACE_SLAB_MALLOC_SLAB_ORDER));
+  if (slab == 0)
+    return 0;
+
+  size_t const bytes = CONTROL_BLOCK::class_bytes (size_class);
+  size_t const count = (size_t (1) << ACE_SLAB_MALLOC_SLAB_ORDER) / bytes;
+
+  FREE_BLOCK *last = 0;
+  for (size_t i = count; i-- != 0; )
+    {
+      FREE_BLOCK *block = reinterpret_cast<FREE_BLOCK *> (slab + i * bytes);
+      block->header_.chunk_ = 0;
+      block->header_.kind_ = CONTROL_BLOCK::SMALL_BLOCK;
+      block->header_.order_ = 0;
+      block->header_.size_class_ = static_cast<ACE_UINT8> (size_class);
+      block->header_.chunk_order_ = 0;
+      block->header_.reserved_ = 0;
+      block->next_ = i + 1 < count ? this->offset (slab + (i + 1) * bytes) : 0;
+      if (i + 1 == count)
+        last = block;
+    }
+
+  // Keep the first block, chain the others in front of the free list.
+  result = reinterpret_cast<FREE_BLOCK *> (slab);
+  if (count > 1)
+    {
+      CONTROL_BLOCK::Size_Class &sc = this->cb_ptr_->size_classes_[size_class];
+      // The rest of the slab is lost if the lock cannot be taken.
+      if (this->cb_ptr_->acquire_class (size_class) == -1)
+        return result;
+      last->next_ = sc.head_;
+      sc.publish (result->next_);
+      sc.free_count_ += count - 1;
+      this->cb_ptr_->release_class (size_class);
+    }
+
+  return result;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> void *
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::shared_malloc (size_t nbytes)
+{
+  if (this->cb_ptr_ == 0)
+    return 0;
+
+  size_t const block_bytes = nbytes + sizeof (BLOCK_HEADER);
+  if (block_bytes < nbytes)
+    return 0;
+
+  FREE_BLOCK *block = 0;
+  if (block_bytes <= CONTROL_BLOCK::MAX_SMALL_BYTES)
+    {
+      size_t const size_class = CONTROL_BLOCK::size_class (block_bytes);
+      block = this->pop_small (size_class);
+      if (block == 0)
+        block = this->refill (size_class);
+    }
+  else
+    block = this->buddy_malloc (CONTROL_BLOCK::order_of (block_bytes));
+
+  return block == 0 ? 0 : &block->next_;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> void *
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::malloc (size_t nbytes)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::malloc");
+
+#if defined (ACE_SLAB_MALLOC_HAS_CLASS_LOCKS)
+  // Small blocks only need the lock of their class, unless the class
+  // is empty.
+  if (this->cb_ptr_ != 0
+      && nbytes <= CONTROL_BLOCK::MAX_SMALL_BYTES - sizeof (BLOCK_HEADER))
+    {
+      FREE_BLOCK *block =
+        this->pop_small (CONTROL_BLOCK::size_class (nbytes + sizeof (BLOCK_HEADER)));
+      if (block != 0)
+        return &block->next_;
+    }
+#endif /* ACE_SLAB_MALLOC_HAS_CLASS_LOCKS */
+
+  ACE_GUARD_RETURN (ACE_LOCK, ace_mon, *this->lock_, 0);
+  return this->shared_malloc (nbytes);
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> void *
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::calloc (size_t nbytes,
+                                                   char initial_value)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::calloc");
+  void *ptr = this->malloc (nbytes);
+
+  if (ptr != 0)
+    ACE_OS::memset (ptr, initial_value, nbytes);
+
+  return ptr;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> void *
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::calloc (size_t n_elem,
+                                                   size_t elem_size,
+                                                   char initial_value)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::calloc");
+
+  return this->calloc (n_elem * elem_size, initial_value);
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> void
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::shared_free (void *ptr)
+{
+  if (ptr == 0 || this->cb_ptr_ == 0)
+    return;
+
+  FREE_BLOCK *block = reinterpret_cast<FREE_BLOCK *> (
+    static_cast<char *> (ptr) - sizeof (BLOCK_HEADER));
+
+  if (block->header_.kind_ == CONTROL_BLOCK::SMALL_BLOCK)
+    this->push_small (block);
+  else if (block->header_.kind_ == CONTROL_BLOCK::LARGE_BLOCK)
+    this->buddy_free (block);
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> void
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::free (void *ptr)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::free");
+
+  if (ptr == 0 || this->cb_ptr_ == 0)
+    return;
+
+#if defined (ACE_SLAB_MALLOC_HAS_CLASS_LOCKS)
+  FREE_BLOCK *block = reinterpret_cast<FREE_BLOCK *> (
+    static_cast<char *> (ptr) - sizeof (BLOCK_HEADER));
+  if (block->header_.kind_ == CONTROL_BLOCK::SMALL_BLOCK)
+    {
+      this->push_small (block);
+      return;
+    }
+#endif /* ACE_SLAB_MALLOC_HAS_CLASS_LOCKS */
+
+  ACE_GUARD (ACE_LOCK, ace_mon, *this->lock_);
+  this->shared_free (ptr);
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK>
+typename ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::NAME_NODE *
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::shared_find (const char *name,
+                                                        Offset *prev)
+{
+  if (this->cb_ptr_ == 0)
+    return 0;
+
+  Offset before = 0;
+  for (Offset current = this->cb_ptr_->name_head_;
+       current != 0;
+       current = reinterpret_cast<NAME_NODE *> (this->block (current))->next_)
+    {
+      NAME_NODE *node = reinterpret_cast<NAME_NODE *> (this->block (current));
+      if (ACE_OS::strcmp (node->name (), name) == 0)
+        {
+          if (prev != 0)
+            *prev = before;
+          return node;
+        }
+      before = current;
+    }
+  return 0;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::shared_bind (const char *name,
+                                                        void *pointer)
+{
+  if (this->cb_ptr_ == 0)
+    return -1;
+
+  size_t const name_bytes = ACE_OS::strlen (name) + 1;
+  NAME_NODE *node = 0;
+  ACE_ALLOCATOR_RETURN (node,
+                        static_cast<NAME_NODE *> (
+                          this->shared_malloc (sizeof (NAME_NODE) + name_bytes)),
+                        -1);
+
+  ACE_OS::memcpy (node->name (), name, name_bytes);
+  node->pointer_ = pointer == 0 ? 0 : this->offset (pointer);
+  node->next_ = this->cb_ptr_->name_head_;
+  this->cb_ptr_->name_head_ = this->offset (node);
+  return 0;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::trybind (const char *name,
+                                                    void *&pointer)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::trybind");
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, *this->lock_, -1);
+
+  NAME_NODE *node = this->shared_find (name);
+
+  if (node == 0)
+    // Didn't find it, so insert it.
+    return this->shared_bind (name, pointer);
+
+  // Found it, so return a copy of the current entry.
+  pointer = node->pointer_ == 0 ? 0 : this->block (node->pointer_);
+  return 1;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::bind (const char *name,
+                                                 void *pointer,
+                                                 int duplicates)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::bind");
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, *this->lock_, -1);
+
+  if (duplicates == 0 && this->shared_find (name) != 0)
+    // If we're not allowing duplicates, then if the name is already
+    // present, return 1.
+    return 1;
+
+  return this->shared_bind (name, pointer);
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::find (const char *name,
+                                                 void *&pointer)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::find");
+  ACE_READ_GUARD_RETURN (ACE_LOCK, ace_mon, *this->lock_, -1);
+
+  NAME_NODE *node = this->shared_find (name);
+
+  if (node == 0)
+    return -1;
+
+  pointer = node->pointer_ == 0 ? 0 : this->block (node->pointer_);
+  return 0;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::find (const char *name)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::find");
+  ACE_READ_GUARD_RETURN (ACE_LOCK, ace_mon, *this->lock_, -1);
+
+  return this->shared_find (name) == 0 ? -1 : 0;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::unbind (const char *name,
+                                                   void *&pointer)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::unbind");
+  ACE_WRITE_GUARD_RETURN (ACE_LOCK, ace_mon, *this->lock_, -1);
+
+  Offset prev = 0;
+  NAME_NODE *node = this->shared_find (name, &prev);
+  if (node == 0)
+    return -1;
+
+  if (prev == 0)
+    this->cb_ptr_->name_head_ = node->next_;
+  else
+    reinterpret_cast<NAME_NODE *> (this->block (prev))->next_ = node->next_;
+
+  pointer = node->pointer_ == 0 ? 0 : this->block (node->pointer_);
+  this->shared_free (node);
+  return 0;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::unbind (const char *name)
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::unbind");
+  void *temp = 0;
+  return this->unbind (name, temp);
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> ssize_t
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::avail_chunks (size_t size) const
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::avail_chunks");
+  ACE_READ_GUARD_RETURN (ACE_LOCK, ace_mon, *this->lock_, -1);
+
+  if (this->cb_ptr_ == 0)
+    return -1;
+
+  size_t const block_bytes = size + sizeof (BLOCK_HEADER);
+  size_t count = 0;
+
+  // Blocks of the buddy allocator at least as large as needed.
+  size_t order = CONTROL_BLOCK::order_of (block_bytes);
+  size_t per_block = 1;
+  if (block_bytes <= CONTROL_BLOCK::MAX_SMALL_BYTES)
+    {
+      size_t const size_class = CONTROL_BLOCK::size_class (block_bytes);
+      count = static_cast<size_t> (
+        this->cb_ptr_->size_classes_[size_class].free_count_);
+      order = ACE_SLAB_MALLOC_SLAB_ORDER;
+      per_block = (size_t (1) << order) / CONTROL_BLOCK::class_bytes (size_class);
+    }
+
+  for (size_t o = order; o <= CONTROL_BLOCK::MAX_ORDER; ++o)
+    for (Offset current = this->cb_ptr_->buddy_lists_[o];
+         current != 0;
+         current = this->block (current)->next_)
+      count += per_block << (o - order);
+
+  return static_cast<ssize_t> (count);
+}
+
+#if defined (ACE_HAS_MALLOC_STATS)
+template <ACE_MEM_POOL_1, class ACE_LOCK> void
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::print_stats (void) const
+{
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::print_stats");
+  ACE_GUARD (ACE_LOCK, ace_mon, *this->lock_);
+
+  if (this->cb_ptr_ != 0)
+    this->cb_ptr_->dump ();
+}
+#endif /* ACE_HAS_MALLOC_STATS */
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> void
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::dump (void) const
+{
+#if defined (ACE_HAS_DUMP)
+  ACE_TRACE ("ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::dump");
+
+  ACELIB_DEBUG ((LM_DEBUG, ACE_BEGIN_DUMP, this));
+  this->memory_pool_.dump ();
+  ACELIB_DEBUG ((LM_DEBUG, ACE_TEXT ("cb_ptr_ = %@\n"), this->cb_ptr_));
+  if (this->cb_ptr_ != 0)
+    this->cb_ptr_->dump ();
+  ACELIB_DEBUG ((LM_DEBUG, ACE_END_DUMP));
+#endif /* ACE_HAS_DUMP */
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* ACE_SLAB_MALLOC_T_CPP */
@@ -0,0 +1,249 @@
+// -*- C++ -*-
+
+//==========================================================================
+/**
+ *  @file    Slab_Malloc_T.h
+ *
+ *  A size class allocator for shared and mapped memory pools.
+ */
+//==========================================================================
+
+#ifndef ACE_SLAB_MALLOC_T_H
+#define ACE_SLAB_MALLOC_T_H
+#include /**/ "ace/pre.h"
+
+#include "ace/Slab_Malloc.h"
+#include "ace/Malloc_T.h"             /* Need ACE_Malloc_Lock_Adapter_T */
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class ACE_Slab_Malloc
+ *
+ * @brief An allocator with the interface of ACE_Malloc whose
+ * allocation time does not depend on the state of the pool.
+ *
+ * ACE_Malloc_T searches a single first-fit free list under the lock
+ * of the pool, so allocations get slower as the pool fragments, and
+ * all the threads and processes sharing the pool contend on that lock.
+ * ACE_Slab_Malloc keeps a free list per size class for blocks of up to
+ * ACE_Slab_Control_Block::MAX_SMALL_BYTES.  Where robust process shared
+ * mutexes are available (ACE_HAS_PTHREAD_MUTEX_ROBUST), each has its
+ * own lock in the pool: allocating or freeing a small block takes one
+ * list operation under that lock, and never the pool lock.  A process
+ * dying while holding one only loses the blocks it was moving.
+ * Elsewhere the free lists are guarded by the pool lock.  Larger blocks,
+ * and the slabs the small blocks are carved from, come from a buddy
+ * allocator under the pool lock.  Memory of freed small blocks stays
+ * in their size class.
+ *
+ * The pool only holds offsets, so it is position independent and may
+ * be mapped at different addresses by the processes sharing it.  The
+ * format differs from that of ACE_Malloc, which cannot open a pool
+ * created by this class nor the other way around.
+ *
+ * It can be used wherever ACE_Malloc is, in particular through
+ * ACE_Allocator_Adapter, for instance with
+ * ACE_Hash_Map_With_Allocator, or for ACE_Configuration_Heap when
+ * ACE_CONFIGURATION_HEAP_USES_SLAB_MALLOC is defined.  There are no
+ * iterators over the named regions.
+ */
+template <ACE_MEM_POOL_1, class ACE_LOCK>
+class ACE_Slab_Malloc
+{
+public:
+  typedef ACE_MEM_POOL MEMORY_POOL;
+  typedef ACE_MEM_POOL_OPTIONS MEMORY_POOL_OPTIONS;
+
+  /**
+   * Initialize the allocator.  This constructor passes @a pool_name
+   * to initialize the memory pool, and uses it for the lock name.
+   */
+  ACE_Slab_Malloc (const ACE_TCHAR *pool_name = 0);
+
+  /**
+   * Initialize the allocator.  This constructor passes @a pool_name
+   * and @a options to initialize the memory pool, and uses
+   * @a lock_name for the lock.
+   */
+  ACE_Slab_Malloc (const ACE_TCHAR *pool_name,
+                   const ACE_TCHAR *lock_name,
+                   const ACE_MEM_POOL_OPTIONS *options = 0);
+
+  /// Initialize the allocator with an external @a lock, which must be
+  /// ready for use.
+  ACE_Slab_Malloc (const ACE_TCHAR *pool_name,
+                   const ACE_MEM_POOL_OPTIONS *options,
+                   ACE_LOCK *lock);
+
+  /// Destructor
+  ~ACE_Slab_Malloc (void);
+
+  /// Get Reference counter.
+  int ref_counter (void);
+
+  /// Release ref counter.
+  int release (int close = 0);
+
+  /// Releases resources allocated by this object.
+  int remove (void);
+
+  // = Memory management
+
+  /// Allocate @a nbytes, but don't give them any initial value.
+  void *malloc (size_t nbytes);
+
+  /// Allocate @a nbytes, giving them @a initial_value.
+  void *calloc (size_t nbytes, char initial_value = '\0');
+
+  /// Allocate @a n_elem each of size @a elem_size, giving them
+  /// @a initial_value.
+  void *calloc (size_t n_elem,
+                size_t elem_size,
+                char initial_value = '\0');
+
+  /// Deallocate memory pointed to by @a ptr, which must have been
+  /// allocated previously by malloc().
+  void free (void *ptr);
+
+  /// Returns a reference to the underlying memory pool.
+  MEMORY_POOL &memory_pool (void);
+
+  // = Map manager like functions, see ACE_Malloc_T.
+
+  int bind (const char *name, void *pointer, int duplicates = 0);
+  int trybind (const char *name, void *&pointer);
+  int find (const char *name, void *&pointer);
+  int find (const char *name);
+  int unbind (const char *name);
+  int unbind (const char *name, void *&pointer);
+
+  // = Protection and "sync" (i.e., flushing data to backing store).
+
+  int sync (ssize_t len = -1, int flags = MS_SYNC);
+  int sync (void *addr, size_t len, int flags = MS_SYNC);
+  int protect (ssize_t len = -1, int prot = PROT_RDWR);
+  int protect (void *addr, size_t len, int prot = PROT_RDWR);
+
+  /// Returns the number of blocks of @a size bytes that can be
+  /// allocated without growing the pool.
+  ssize_t avail_chunks (size_t size) const;
+
+#if defined (ACE_HAS_MALLOC_STATS)
+  /// Dump statistics of how malloc is behaving.
+  void print_stats (void) const;
+#endif /* ACE_HAS_MALLOC_STATS */
+
+  /// Returns the lock guarding the buddy allocator and the named
+  /// regions.
+  ACE_LOCK &mutex (void);
+
+  /// Dump the state of an object.
+  void dump (void) const;
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+
+  /// Return cb_ptr value.
+  void *base_addr (void);
+
+  /// Returns non-zero if the constructor failed, see
+  /// ACE_Malloc_T::bad().
+  int bad (void);
+
+private:
+  typedef ACE_Slab_Control_Block CONTROL_BLOCK;
+  typedef ACE_Slab_Control_Block::Offset Offset;
+  typedef ACE_Slab_Control_Block::Block_Header BLOCK_HEADER;
+  typedef ACE_Slab_Control_Block::Free_Block FREE_BLOCK;
+  typedef ACE_Slab_Control_Block::Name_Node NAME_NODE;
+
+  /// Initialize the pool.
+  int open (void);
+
+  /// The block at @a offset.
+  FREE_BLOCK *block (Offset offset) const;
+
+  /// Offset of @a p.
+  Offset offset (const void *p) const;
+
+  /// Pop a block from the free list of @a size_class, 0 if empty.
+  FREE_BLOCK *pop_small (size_t size_class);
+
+  /// Push @a block back on the free list of its size class.
+  void push_small (FREE_BLOCK *block);
+
+  /// Carve a slab for @a size_class, return one block and put the
+  /// others in the free list.  Assumes the pool lock is held.
+  FREE_BLOCK *refill (size_t size_class);
+
+  /// Allocate a buddy block of 2^order bytes, growing the pool if
+  /// needed.  Assumes the pool lock is held.
+  FREE_BLOCK *buddy_malloc (size_t order);
+
+  /// Free a buddy block, merging it with its free buddies.  Assumes
+  /// the pool lock is held.
+  void buddy_free (FREE_BLOCK *block);
+
+  /// Link/unlink a free buddy block.  Assume the pool lock is held.
+  void buddy_push (FREE_BLOCK *block, size_t order);
+  void buddy_unlink (FREE_BLOCK *block);
+
+  /// Hand the @a bytes at @a start to the buddy allocator, as chunks
+  /// of decreasing powers of two.  Assumes the pool lock is held.
+  void add_region (char *start, size_t bytes);
+
+  /// Get at least 2^order more bytes from the memory pool.  Assumes
+  /// the pool lock is held.
+  int grow (size_t order);
+
+  /// Allocate memory.  Assumes the pool lock is held.
+  void *shared_malloc (size_t nbytes);
+
+  /// Deallocate memory.  Assumes the pool lock is held.
+  void shared_free (void *ptr);
+
+  /// Find the region bound to @a name, and the offset of the node
+  /// before it in @a prev.  Assumes the pool lock is held.
+  NAME_NODE *shared_find (const char *name, Offset *prev = 0);
+
+  /// Associate @a name with @a pointer.  Assumes the pool lock is held.
+  int shared_bind (const char *name, void *pointer);
+
+  /// Pointer to the control block that is stored in memory controlled
+  /// by <MEMORY_POOL>.
+  CONTROL_BLOCK *cb_ptr_;
+
+  /// Pool of memory used to manage the freestore.
+  MEMORY_POOL memory_pool_;
+
+  /// Lock guarding the buddy allocator and the named regions.
+  ACE_LOCK *lock_;
+
+  /// True if destructor should delete the lock
+  bool delete_lock_;
+
+  /// Keep track of failure in constructor.
+  int bad_flag_;
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#if defined (__ACE_INLINE__)
+#include "ace/Slab_Malloc_T.inl"
+#endif /* __ACE_INLINE__ */
+
+#if defined (ACE_TEMPLATES_REQUIRE_SOURCE)
+#include "ace/Slab_Malloc_T.cpp"
+#endif /* ACE_TEMPLATES_REQUIRE_SOURCE */
+
+#if defined (ACE_TEMPLATES_REQUIRE_PRAGMA)
+#pragma implementation ("Slab_Malloc_T.cpp")
+#endif /* ACE_TEMPLATES_REQUIRE_PRAGMA */
+
+#include /**/ "ace/post.h"
+#endif /* ACE_SLAB_MALLOC_T_H */
@@ -0,0 +1,117 @@
+// -*- C++ -*-
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> ACE_INLINE int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::ref_counter (void)
+{
+  ACE_GUARD_RETURN (ACE_LOCK, ace_mon, *this->lock_, -1);
+  if (this->cb_ptr_ != 0)
+    return this->cb_ptr_->ref_counter_;
+
+  return -1;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> ACE_INLINE int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::bad (void)
+{
+  return this->bad_flag_;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> ACE_INLINE ACE_MEM_POOL &
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::memory_pool (void)
+{
+  return this->memory_pool_;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> ACE_INLINE int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::sync (ssize_t len, int flags)
+{
+  return this->memory_pool_.sync (len, flags);
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> ACE_INLINE int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::sync (void *addr,
+                                                 size_t len,
+                                                 int flags)
+{
+  return this->memory_pool_.sync (addr, len, flags);
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> ACE_INLINE int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::protect (ssize_t len, int flags)
+{
+  return this->memory_pool_.protect (len, flags);
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> ACE_INLINE int
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::protect (void *addr,
+                                                    size_t len,
+                                                    int flags)
+{
+  return this->memory_pool_.protect (addr, len, flags);
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> ACE_INLINE ACE_LOCK &
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::mutex (void)
+{
+  return *this->lock_;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> ACE_INLINE void *
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::base_addr (void)
+{
+  return this->cb_ptr_;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK>
+ACE_INLINE typename ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::FREE_BLOCK *
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::block (Offset offset) const
+{
+  return reinterpret_cast<FREE_BLOCK *> (
+    reinterpret_cast<char *> (this->cb_ptr_) + offset);
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK>
+ACE_INLINE typename ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::Offset
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::offset (const void *p) const
+{
+  return static_cast<Offset> (static_cast<const char *> (p)
+                              - reinterpret_cast<const char *> (this->cb_ptr_));
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK>
+ACE_INLINE typename ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::FREE_BLOCK *
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::pop_small (size_t size_class)
+{
+  CONTROL_BLOCK::Size_Class &sc = this->cb_ptr_->size_classes_[size_class];
+  FREE_BLOCK *result = 0;
+
+  if (this->cb_ptr_->acquire_class (size_class) == -1)
+    return 0;
+  if (sc.head_ != 0)
+    {
+      result = this->block (sc.head_);
+      sc.publish (result->next_);
+      --sc.free_count_;
+    }
+  this->cb_ptr_->release_class (size_class);
+
+  return result;
+}
+
+template <ACE_MEM_POOL_1, class ACE_LOCK> ACE_INLINE void
+ACE_Slab_Malloc<ACE_MEM_POOL_2, ACE_LOCK>::push_small (FREE_BLOCK *block)
+{
+  size_t const size_class = block->header_.size_class_;
+  CONTROL_BLOCK::Size_Class &sc = this->cb_ptr_->size_classes_[size_class];
+
+  // The block is lost if the lock cannot be taken.
+  if (this->cb_ptr_->acquire_class (size_class) == -1)
+    return;
+  block->next_ = sc.head_;
+  sc.publish (this->offset (block));
+  ++sc.free_count_;
+  this->cb_ptr_->release_class (size_class);
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
@@ -96,6 +96,23 @@ ACE_String_Base<ACE_CHAR_T>::ACE_String_Base (const ACE_String_Base<ACE_CHAR_T>
   this->set (s.rep_, s.len_, true);
 }
 
+#if defined (ACE_HAS_CPP11)
+// Move constructor.
+
+template <class ACE_CHAR_T>
+ACE_String_Base<ACE_CHAR_T>::ACE_String_Base (ACE_String_Base<ACE_CHAR_T> &&s) noexcept
+  : allocator_ (s.allocator_ ? s.allocator_ : ACE_Allocator::instance ()),
+    len_ (0),
+    buf_len_ (0),
+    rep_ (&ACE_String_Base<ACE_CHAR_T>::NULL_String_),
+    release_ (false)
+{
+  ACE_TRACE ("ACE_String_Base<ACE_CHAR_T>::ACE_String_Base");
+
+  this->take_i (s);
+}
+#endif /* ACE_HAS_CPP11 */
+
 template <class ACE_CHAR_T>
 ACE_String_Base<ACE_CHAR_T>::ACE_String_Base (
   typename ACE_String_Base<ACE_CHAR_T>::size_type len,
@@ -117,8 +134,73 @@ ACE_String_Base<ACE_CHAR_T>::~ACE_String_Base (void)
 {
   ACE_TRACE ("ACE_String_Base<ACE_CHAR_T>::~ACE_String_Base");
 
-  if (this->buf_len_ != 0 && this->release_)
-      this->allocator_->free (this->rep_);
+  this->free_i ();
+}
+
+template <class ACE_CHAR_T> void
+ACE_String_Base<ACE_CHAR_T>::free_i (void)
+{
+  if (this->buf_len_ != 0 && this->release_ && this->rep_ != this->inline_buf_)
+    this->allocator_->free (this->rep_);
+}
+
+template <class ACE_CHAR_T> int
+ACE_String_Base<ACE_CHAR_T>::grow_i (
+  typename ACE_String_Base<ACE_CHAR_T>::size_type buf_len,
+  typename ACE_String_Base<ACE_CHAR_T>::size_type keep,
+  const ACE_CHAR_T *tail,
+  typename ACE_String_Base<ACE_CHAR_T>::size_type tail_len)
+{
+  size_type const inline_size = INLINE_SIZE;
+  ACE_CHAR_T *temp = this->inline_buf_;
+
+  if (buf_len > inline_size)
+    {
+      ACE_ALLOCATOR_RETURN (temp,
+                            (ACE_CHAR_T *) this->allocator_->malloc (buf_len * sizeof (ACE_CHAR_T)),
+                            -1);
+    }
+  else
+    buf_len = inline_size;
+
+  // Copy before releasing the old buffer, @a tail may live in it.
+  if (temp != this->rep_)
+    ACE_OS::memmove (temp, this->rep_, keep * sizeof (ACE_CHAR_T));
+  if (tail_len != 0)
+    ACE_OS::memmove (temp + keep, tail, tail_len * sizeof (ACE_CHAR_T));
+
+  if (temp != this->rep_)
+    this->free_i ();
+
+  this->rep_ = temp;
+  this->buf_len_ = buf_len;
+  this->release_ = true;
+  this->len_ = keep + tail_len;
+  this->rep_[this->len_] = 0;
+  return 0;
+}
+
+template <class ACE_CHAR_T> void
+ACE_String_Base<ACE_CHAR_T>::take_i (ACE_String_Base<ACE_CHAR_T> &s)
+{
+  if (s.rep_ == s.inline_buf_)
+    {
+      ACE_OS::memcpy (this->inline_buf_,
+                      s.inline_buf_,
+                      (s.len_ + 1) * sizeof (ACE_CHAR_T));
+      this->rep_ = this->inline_buf_;
+    }
+  else
+    this->rep_ = s.rep_;
+
+  this->len_ = s.len_;
+  this->buf_len_ = s.buf_len_;
+  this->release_ = s.release_;
+
+  s.rep_ = &ACE_String_Base<ACE_CHAR_T>::NULL_String_;
+  s.len_ = 0;
+  s.buf_len_ = 0;
+  s.release_ = false;
 }
 
 // this method might benefit from a little restructuring.
@@ -131,19 +213,7 @@ ACE_String_Base<ACE_CHAR_T>::set (const ACE_CHAR_T *s,
   size_type new_buf_len = len + 1;
   if (s != 0 && len != 0 && release && this->buf_len_ < new_buf_len)
     {
-      ACE_CHAR_T *temp = 0;
-      ACE_ALLOCATOR (temp,
-                     (ACE_CHAR_T *) this->allocator_->malloc (new_buf_len * sizeof (ACE_CHAR_T)));
-
-      if (this->buf_len_ != 0 && this->release_)
-        this->allocator_->free (this->rep_);
-
-      this->rep_ = temp;
-      this->buf_len_ = new_buf_len;
-      this->release_ = true;
-      this->len_ = len;
-      ACE_OS::memcpy (this->rep_, s, len * sizeof (ACE_CHAR_T));
-      this->rep_[len] = 0;
+      this->grow_i (new_buf_len, 0, s, len);
     }
   else // Case 2. No memory allocation is necessary.
     {
@@ -152,7 +222,7 @@ ACE_String_Base<ACE_CHAR_T>::set (const ACE_CHAR_T *s,
         {
           if (this->buf_len_ != 0 && this->release_)
             {
-              this->allocator_->free (this->rep_);
+              this->free_i ();
               this->release_ = false;
             }
         }
@@ -173,7 +243,7 @@ ACE_String_Base<ACE_CHAR_T>::set (const ACE_CHAR_T *s,
         }
       else
         {
-          ACE_OS::memcpy (this->rep_, s, len * sizeof (ACE_CHAR_T));
+          ACE_OS::memmove (this->rep_, s, len * sizeof (ACE_CHAR_T));
           this->rep_[len] = 0;
           this->len_ = len;
         }
@@ -217,33 +287,17 @@ ACE_String_Base<ACE_CHAR_T>::append (const ACE_CHAR_T* s,
     if (this->buf_len_ >= this->len_ + slen + 1)
     {
       // Copy in data from new string.
-      ACE_OS::memcpy (this->rep_ + this->len_, s, slen * sizeof (ACE_CHAR_T));
+      ACE_OS::memmove (this->rep_ + this->len_, s, slen * sizeof (ACE_CHAR_T));
+      this->len_ += slen;
+      this->rep_[this->len_] = 0;
     }
     else // case 2. Memory reallocation is needed
     {
       const size_type new_buf_len =
         ace_max(this->len_ + slen + 1, this->buf_len_ + this->buf_len_ / 2);
 
-      ACE_CHAR_T *t = 0;
-
-      ACE_ALLOCATOR_RETURN (t,
-        (ACE_CHAR_T *) this->allocator_->malloc (new_buf_len * sizeof (ACE_CHAR_T)), *this);
-
-      // Copy memory from old string into new string.
-      ACE_OS::memcpy (t, this->rep_, this->len_ * sizeof (ACE_CHAR_T));
-
-      ACE_OS::memcpy (t + this->len_, s, slen * sizeof (ACE_CHAR_T));
-
-      if (this->buf_len_ != 0 && this->release_)
-        this->allocator_->free (this->rep_);
-
-      this->release_ = true;
-      this->rep_ = t;
-      this->buf_len_ = new_buf_len;
+      this->grow_i (new_buf_len, this->len_, s, slen);
     }
-
-    this->len_ += slen;
-    this->rep_[this->len_] = 0;
   }
 
   return *this;
@@ -275,28 +329,29 @@ ACE_String_Base<ACE_CHAR_T>::fast_resize (size_t len)
 
   // Only reallocate if we don't have enough space...
   if (this->buf_len_ <= len)
-    {
-      if (this->buf_len_ != 0 && this->release_)
-        this->allocator_->free (this->rep_);
+    this->grow_i (len + 1, 0);
 
-      this->rep_ = static_cast<ACE_CHAR_T*>
-                     (this->allocator_->malloc ((len + 1) * sizeof (ACE_CHAR_T)));
-      this->buf_len_ = len + 1;
-      this->release_ = true;
-    }
   this->len_ = 0;
   if (len > 0)
     this->rep_[0] = 0;
 }
 
+template <class ACE_CHAR_T> void
+ACE_String_Base<ACE_CHAR_T>::reserve (typename ACE_String_Base<ACE_CHAR_T>::size_type len)
+{
+  ACE_TRACE ("ACE_String_Base<ACE_CHAR_T>::reserve");
+
+  if (this->buf_len_ <= len)
+    this->grow_i (len + 1, this->len_);
+}
+
 template <class ACE_CHAR_T> void
 ACE_String_Base<ACE_CHAR_T>::clear (bool release)
 {
   // This can't use set(), because that would free memory if release=false
   if (release)
   {
-    if (this->buf_len_ != 0 && this->release_)
-      this->allocator_->free (this->rep_);
+    this->free_i ();
 
     this->rep_ = &ACE_String_Base<ACE_CHAR_T>::NULL_String_;
     this->len_ = 0;
@@ -334,6 +389,35 @@ ACE_String_Base<ACE_CHAR_T>::operator= (const ACE_String_Base<ACE_CHAR_T> &s)
   return *this;
 }
 
+#if defined (ACE_HAS_CPP11)
+// Move assignment operator.
+template <class ACE_CHAR_T> ACE_String_Base<ACE_CHAR_T> &
+ACE_String_Base<ACE_CHAR_T>::operator= (ACE_String_Base<ACE_CHAR_T> &&s) noexcept
+{
+  ACE_TRACE ("ACE_String_Base<ACE_CHAR_T>::operator=");
+
+  if (this != &s)
+    {
+      // A heap buffer can only change hands if both strings free it
+      // through the same allocator.
+      if (s.allocator_ == this->allocator_
+          || !s.release_
+          || s.rep_ == s.inline_buf_)
+        {
+          this->free_i ();
+          this->take_i (s);
+        }
+      else
+        {
+          this->set (s.rep_, s.len_, true);
+          s.clear (true);
+        }
+    }
+
+  return *this;
+}
+#endif /* ACE_HAS_CPP11 */
+
 template <class ACE_CHAR_T> void
 ACE_String_Base<ACE_CHAR_T>::set (const ACE_CHAR_T *s, bool release)
 {
@@ -473,6 +557,19 @@ ACE_String_Base<ACE_CHAR_T>::swap (ACE_String_Base<ACE_CHAR_T> & str)
   std::swap (this->buf_len_   , str.buf_len_);
   std::swap (this->rep_       , str.rep_);
   std::swap (this->release_   , str.release_);
+
+  // Inline buffers cannot change hands, swap their contents and
+  // point each string back at its own.
+  if (this->rep_ == str.inline_buf_ || str.rep_ == this->inline_buf_)
+    {
+      std::swap_ranges (this->inline_buf_,
+                        this->inline_buf_ + INLINE_SIZE,
+                        str.inline_buf_);
+      if (this->rep_ == str.inline_buf_)
+        this->rep_ = this->inline_buf_;
+      if (str.rep_ == this->inline_buf_)
+        str.rep_ = str.inline_buf_;
+    }
 }
 
 // ----------------------------------------------
@@ -580,7 +677,8 @@ operator = (const ACE_String_Base_Const_Iterator <ACE_CHAR_T> & rhs)
 template <class ACE_CHAR_T> ACE_String_Base<ACE_CHAR_T>
 operator+ (const ACE_String_Base<ACE_CHAR_T> &s, const ACE_String_Base<ACE_CHAR_T> &t)
 {
-  ACE_String_Base<ACE_CHAR_T> temp (s.length () + t.length ());
+  ACE_String_Base<ACE_CHAR_T> temp;
+  temp.reserve (s.length () + t.length ());
   temp += s;
   temp += t;
   return temp;
@@ -592,7 +690,8 @@ operator+ (const ACE_CHAR_T *s, const ACE_String_Base<ACE_CHAR_T> &t)
   size_t slen = 0;
   if (s != 0)
     slen = ACE_OS::strlen (s);
-  ACE_String_Base<ACE_CHAR_T> temp (slen + t.length ());
+  ACE_String_Base<ACE_CHAR_T> temp;
+  temp.reserve (slen + t.length ());
   if (slen > 0)
     temp.append (s, slen);
   temp += t;
@@ -605,7 +704,8 @@ operator+ (const ACE_String_Base<ACE_CHAR_T> &s, const ACE_CHAR_T *t)
   size_t tlen = 0;
   if (t != 0)
     tlen = ACE_OS::strlen (t);
-  ACE_String_Base<ACE_CHAR_T> temp (s.length () + tlen);
+  ACE_String_Base<ACE_CHAR_T> temp;
+  temp.reserve (s.length () + tlen);
   temp += s;
   if (tlen > 0)
     temp.append (t, tlen);
@@ -616,7 +716,8 @@ template <class ACE_CHAR_T> ACE_String_Base<ACE_CHAR_T>
 operator + (const ACE_String_Base<ACE_CHAR_T> &t,
             const ACE_CHAR_T c)
 {
-  ACE_String_Base<ACE_CHAR_T> temp (t.length () + 1);
+  ACE_String_Base<ACE_CHAR_T> temp;
+  temp.reserve (t.length () + 1);
   temp += t;
   temp += c;
   return temp;
@@ -626,12 +727,37 @@ template <class ACE_CHAR_T> ACE_String_Base<ACE_CHAR_T>
 operator + (const ACE_CHAR_T c,
             const ACE_String_Base<ACE_CHAR_T> &t)
 {
-  ACE_String_Base<ACE_CHAR_T> temp (t.length () + 1);
+  ACE_String_Base<ACE_CHAR_T> temp;
+  temp.reserve (t.length () + 1);
   temp += c;
   temp += t;
   return temp;
 }
 
+#if defined (ACE_HAS_CPP11)
+template <class ACE_CHAR_T> ACE_String_Base<ACE_CHAR_T>
+operator+ (ACE_String_Base<ACE_CHAR_T> &&s, const ACE_String_Base<ACE_CHAR_T> &t)
+{
+  s += t;
+  return std::move (s);
+}
+
+template <class ACE_CHAR_T> ACE_String_Base<ACE_CHAR_T>
+operator+ (ACE_String_Base<ACE_CHAR_T> &&s, const ACE_CHAR_T *t)
+{
+  s += t;
+  return std::move (s);
+}
+
+template <class ACE_CHAR_T> ACE_String_Base<ACE_CHAR_T>
+operator + (ACE_String_Base<ACE_CHAR_T> &&t,
+            const ACE_CHAR_T c)
+{
+  t += c;
+  return std::move (t);
+}
+#endif /* ACE_HAS_CPP11 */
+
 template <class ACE_CHAR_T>
 ACE_String_Base<ACE_CHAR_T> &
 ACE_String_Base<ACE_CHAR_T>::operator+= (const ACE_CHAR_T* s)
@@ -23,6 +23,17 @@
 #include "ace/String_Base_Const.h"
 #include <iterator>
 
+#if defined (ACE_HAS_CPP11)
+# include <utility>
+#endif /* ACE_HAS_CPP11 */
+
+#if !defined (ACE_STRING_BASE_INLINE_BYTES)
+/// Size, in bytes, of the buffer embedded in every ACE_String_Base.
+/// Strings that fit (including the terminating nul) are stored there
+/// instead of being allocated through the ACE_Allocator.
+# define ACE_STRING_BASE_INLINE_BYTES 24
+#endif /* ACE_STRING_BASE_INLINE_BYTES */
+
 ACE_BEGIN_VERSIONED_NAMESPACE_DECL
 
 // Forward decl.
@@ -47,6 +58,10 @@ class ACE_String_Base_Const_Iterator;
  * assigned an empty string (with first element of '\0'), then it
  * is not allocated new space.  Instead, its internal
  * representation is set equal to a global empty string.
+ * @note Short strings (up to ACE_STRING_BASE_INLINE_BYTES bytes,
+ * including the terminating '\0') are kept in a buffer embedded in
+ * the object and do not touch the ACE_Allocator at all; only longer
+ * strings are allocated from it.
  * CAUTION: in cases when ACE_String_Base is constructed from a
  * provided buffer with the release parameter set to false,
  * ACE_String_Base is not guaranteed to be '\0' terminated.
@@ -135,6 +150,16 @@ public:
    */
   ACE_String_Base (const ACE_String_Base < ACE_CHAR_T > &s);
 
+#if defined (ACE_HAS_CPP11)
+  /**
+   *  Move constructor.  Takes over the buffer (and allocator) of @a s,
+   *  which is left empty.
+   *
+   *  @param s Input ACE_String_Base string to move from
+   */
+  ACE_String_Base (ACE_String_Base < ACE_CHAR_T > &&s) noexcept;
+#endif /* ACE_HAS_CPP11 */
+
   /**
    *  Constructor that copies @a c into dynamically allocated memory.
    *
@@ -200,6 +225,18 @@ public:
    */
   ACE_String_Base < ACE_CHAR_T > &operator = (const ACE_String_Base < ACE_CHAR_T > &s);
 
+#if defined (ACE_HAS_CPP11)
+  /**
+   *  Move assignment operator.  The buffer of @a s is taken over when
+   *  both strings use the same allocator, otherwise it is copied.
+   *  @a s is left empty.
+   *
+   *  @param s Input ACE_String_Base string to move from.
+   *  @return Return this string.
+   */
+  ACE_String_Base < ACE_CHAR_T > &operator = (ACE_String_Base < ACE_CHAR_T > &&s) noexcept;
+#endif /* ACE_HAS_CPP11 */
+
   /**
    *  Assignment alternative method (does not copy memory).
    *
@@ -540,6 +577,15 @@ public:
   void resize (size_type len, ACE_CHAR_T c = 0);
   void fast_resize (size_t len);
 
+  /**
+   * Make sure the string can hold at least @a len CHARs (not counting
+   * the trailing '\0') without further allocation.  Unlike resize(),
+   * the current contents are kept.
+   *
+   * @param len The number of CHARs to reserve
+   */
+  void reserve (size_type len);
+
   /// Swap the contents of this @c ACE_String_Base with @a str.
   /**
    * @note This is non-throwing operation.
@@ -588,6 +634,44 @@ protected:
    *  Represents the "NULL" string to simplify the internal logic.
    */
   static ACE_CHAR_T NULL_String_;
+
+  /// Number of CHARs, including the trailing '\0', that fit in
+  /// @c inline_buf_.
+  enum
+  {
+    INLINE_SIZE = ACE_STRING_BASE_INLINE_BYTES / sizeof (ACE_CHAR_T) > 0
+                  ? ACE_STRING_BASE_INLINE_BYTES / sizeof (ACE_CHAR_T)
+                  : 1
+  };
+
+  /**
+   *  Embedded buffer used instead of the allocator for short strings.
+   *  When in use @c rep_ points here, @c release_ is true and
+   *  @c buf_len_ is INLINE_SIZE.
+   */
+  ACE_CHAR_T inline_buf_[INLINE_SIZE];
+
+private:
+  /**
+   * Replace the buffer with one of at least @a buf_len CHARs, keeping
+   * the first @a keep CHARs of the current contents followed by
+   * @a tail_len CHARs of @a tail.  The new buffer is the inline one
+   * when it is large enough.  @a tail may point into the current
+   * buffer.  Returns -1 (leaving the string untouched) if the
+   * allocation fails.
+   */
+  int grow_i (size_type buf_len,
+              size_type keep,
+              const ACE_CHAR_T *tail = 0,
+              size_type tail_len = 0);
+
+  /// Free the buffer if it came from @c allocator_.  Does not reset
+  /// any of the data members.
+  void free_i (void);
+
+  /// Take over the contents of @a s, leaving it empty.  Any buffer
+  /// this string owned must already have been freed.
+  void take_i (ACE_String_Base<ACE_CHAR_T> &s);
 };
 
 /**
@@ -862,6 +946,21 @@ template < class ACE_CHAR_T >
   ACE_String_Base < ACE_CHAR_T > operator + (const ACE_CHAR_T c,
                                        const ACE_String_Base < ACE_CHAR_T > &t);
 
+#if defined (ACE_HAS_CPP11)
+// Appending to a temporary reuses its buffer, so chains such as
+// "a + b + c" allocate (at most) once per growth instead of once per
+// operator.
+template < class ACE_CHAR_T >
+  ACE_String_Base < ACE_CHAR_T > operator + (ACE_String_Base < ACE_CHAR_T > &&,
+                                       const ACE_String_Base < ACE_CHAR_T > &);
+template < class ACE_CHAR_T >
+  ACE_String_Base < ACE_CHAR_T > operator + (ACE_String_Base < ACE_CHAR_T > &&,
+                                       const ACE_CHAR_T *);
+template < class ACE_CHAR_T >
+  ACE_String_Base < ACE_CHAR_T > operator + (ACE_String_Base < ACE_CHAR_T > &&t,
+                                       const ACE_CHAR_T c);
+#endif /* ACE_HAS_CPP11 */
+
 template <class ACE_CHAR_T>
   bool operator == (const ACE_CHAR_T *s,
                     const ACE_String_Base<ACE_CHAR_T> &t);
@@ -0,0 +1,335 @@
+/**
+ * @file TSC_Clock.cpp
+ */
+
+#include "ace/TSC_Clock.h"
+#include "ace/OS_NS_time.h"
+#include "ace/OS_NS_sys_time.h"
+#include "ace/OS_NS_unistd.h"
+#include "ace/OS_NS_Thread.h"
+#include "ace/Time_Value.h"
+
+#if !defined (__ACE_INLINE__)
+#include "ace/TSC_Clock.inl"
+#endif /* __ACE_INLINE__ */
+
+#if defined (ACE_HAS_TSC_CLOCK)
+# include <cpuid.h>
+#endif /* ACE_HAS_TSC_CLOCK */
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+ACE_UINT64
+ACE_TSC_Clock::system_now (void)
+{
+#if defined (ACE_HAS_CLOCK_GETTIME) && defined (CLOCK_MONOTONIC)
+  struct timespec ts;
+  ACE_OS::clock_gettime (CLOCK_MONOTONIC, &ts);
+  return static_cast<ACE_UINT64> (ts.tv_sec) * ACE_U_ONE_SECOND_IN_NSECS
+    + static_cast<ACE_UINT64> (ts.tv_nsec);
+#else
+  ACE_Time_Value const now = ACE_OS::gettimeofday ();
+  return (static_cast<ACE_UINT64> (now.sec ()) * ACE_ONE_SECOND_IN_USECS
+          + static_cast<ACE_UINT64> (now.usec ())) * 1000u;
+#endif /* ACE_HAS_CLOCK_GETTIME && CLOCK_MONOTONIC */
+}
+
+#if defined (ACE_HAS_TSC_CLOCK)
+
+std::atomic<int> ACE_TSC_Clock::state_ (ACE_TSC_Clock::UNCALIBRATED);
+std::atomic<unsigned int> ACE_TSC_Clock::sequence_ (0);
+std::atomic<ACE_UINT64> ACE_TSC_Clock::base_ticks_ (0);
+std::atomic<ACE_UINT64> ACE_TSC_Clock::base_nsecs_ (0);
+std::atomic<ACE_UINT64> ACE_TSC_Clock::mult_ (0);
+std::atomic<ACE_UINT64> ACE_TSC_Clock::recalibrate_at_ (0);
+std::atomic<bool> ACE_TSC_Clock::recalibrating_ (false);
+
+namespace
+{
+  /// A counter value and the CLOCK_MONOTONIC time read at that value.
+  struct Sample
+  {
+    ACE_UINT64 ticks;
+    ACE_UINT64 nsecs;
+  };
+
+  /// The sample the current frequency was measured from, only used by
+  /// the thread holding ACE_TSC_Clock::recalibrating_.
+  Sample last_sync = { 0, 0 };
+
+  bool
+  invariant_tsc (void)
+  {
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid (0x80000000, &eax, &ebx, &ecx, &edx) == 0
+        || eax < 0x80000007)
+      return false;
+    __get_cpuid (0x80000007, &eax, &ebx, &ecx, &edx);
+    return (edx & (1u << 8)) != 0;
+  }
+
+  /// Nanoseconds per tick, in 32.32 fixed point.
+  ACE_UINT64
+  mult_of (const Sample &from, const Sample &to)
+  {
+    if (to.ticks <= from.ticks || to.nsecs <= from.nsecs)
+      return 0;
+    return static_cast<ACE_UINT64> (
+      (static_cast<unsigned __int128> (to.nsecs - from.nsecs) << 32)
+      / (to.ticks - from.ticks));
+  }
+
+  /// Counter ticks in a recalibration period.
+  ACE_UINT64
+  recalibration_ticks (ACE_UINT64 mult)
+  {
+    return static_cast<ACE_UINT64> (
+      (static_cast<unsigned __int128> (ACE_TSC_CLOCK_RECALIBRATION_MSECS)
+       * 1000000u << 32) / mult);
+  }
+
+  /// Read the system clock between two reads of the counter, several
+  /// times, and keep the tightest pair.
+  Sample
+  take_sample (ACE_UINT64 (*system_now) (void))
+  {
+    Sample best = { 0, 0 };
+    ACE_UINT64 best_width = ~ACE_UINT64 (0);
+    for (int i = 0; i != 5; ++i)
+      {
+        ACE_UINT64 const before = ACE_TSC_Clock::ticks ();
+        ACE_UINT64 const nsecs = system_now ();
+        ACE_UINT64 const after = ACE_TSC_Clock::ticks ();
+        if (after - before < best_width)
+          {
+            best_width = after - before;
+            best.ticks = before + best_width / 2;
+            best.nsecs = nsecs;
+          }
+      }
+    return best;
+  }
+}
+
+void
+ACE_TSC_Clock::publish (ACE_UINT64 base_ticks,
+                        ACE_UINT64 base_nsecs,
+                        ACE_UINT64 mult,
+                        ACE_UINT64 recalibrate_at)
+{
+  unsigned int const seq = sequence_.load (std::memory_order_relaxed);
+  sequence_.store (seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence (std::memory_order_release);
+
+  base_ticks_.store (base_ticks, std::memory_order_relaxed);
+  base_nsecs_.store (base_nsecs, std::memory_order_relaxed);
+  mult_.store (mult, std::memory_order_relaxed);
+  recalibrate_at_.store (recalibrate_at, std::memory_order_relaxed);
+
+  sequence_.store (seq + 2, std::memory_order_release);
+}
+
+int
+ACE_TSC_Clock::calibrate (void)
+{
+  while (recalibrating_.exchange (true, std::memory_order_acquire))
+    ACE_OS::thr_yield ();
+
+  state_.store (CALIBRATING);
+
+  bool ok = invariant_tsc ();
+  Sample first = { 0, 0 };
+  Sample last = { 0, 0 };
+  ACE_UINT64 mult = 0;
+
+  if (ok)
+    {
+      ACE_Time_Value const pause (0, ACE_TSC_CLOCK_CALIBRATION_USECS);
+
+      first = take_sample (ACE_TSC_Clock::system_now);
+      ACE_OS::sleep (pause);
+      Sample const middle = take_sample (ACE_TSC_Clock::system_now);
+      ACE_OS::sleep (pause);
+      last = take_sample (ACE_TSC_Clock::system_now);
+
+      ACE_UINT64 const mult1 = mult_of (first, middle);
+      ACE_UINT64 const mult2 = mult_of (middle, last);
+      mult = mult_of (first, last);
+
+      // The two halves must agree within 0.1%, and the frequency be
+      // somewhere between 100 MHz and 20 GHz.
+      ACE_UINT64 const diff = mult1 > mult2 ? mult1 - mult2 : mult2 - mult1;
+      ok = mult1 != 0 && mult2 != 0
+        && diff <= mult / 1000
+        && mult <= (ACE_UINT64 (10) << 32)
+        && mult >= (ACE_UINT64 (1) << 32) / 20;
+    }
+
+  if (ok)
+    {
+      // Calibrating again must not move the clock backwards either.
+      ACE_UINT64 base_nsecs = last.nsecs;
+      ACE_UINT64 const old_mult = mult_.load (std::memory_order_relaxed);
+      ACE_UINT64 const old_base_ticks = base_ticks_.load (std::memory_order_relaxed);
+      if (old_mult != 0 && last.ticks > old_base_ticks)
+        {
+          ACE_UINT64 const shown =
+            base_nsecs_.load (std::memory_order_relaxed)
+            + static_cast<ACE_UINT64> (
+                (static_cast<unsigned __int128> (last.ticks - old_base_ticks)
+                 * old_mult) >> 32);
+          if (shown > base_nsecs)
+            base_nsecs = shown;
+        }
+
+      last_sync = last;
+      publish (last.ticks,
+               base_nsecs,
+               mult,
+               last.ticks + recalibration_ticks (mult));
+      state_.store (CALIBRATED);
+    }
+  else
+    {
+      state_.store (FALLBACK);
+      publish (0, 0, 0, 0);
+    }
+
+  recalibrating_.store (false, std::memory_order_release);
+  return ok ? 0 : -1;
+}
+
+void
+ACE_TSC_Clock::recalibrate (ACE_UINT64)
+{
+  if (recalibrating_.exchange (true, std::memory_order_acquire))
+    return;
+
+  if (state_.load () == CALIBRATED)
+    {
+      Sample const now = take_sample (ACE_TSC_Clock::system_now);
+      ACE_UINT64 const old_mult = mult_.load (std::memory_order_relaxed);
+      ACE_UINT64 const mult = mult_of (last_sync, now);
+      ACE_UINT64 const diff = mult > old_mult ? mult - old_mult : old_mult - mult;
+
+      if (mult == 0 || diff > old_mult / 100)
+        {
+          // The counter is not what it was: the machine was suspended,
+          // or the process moved to another host.
+          state_.store (FALLBACK);
+          publish (0, 0, 0, 0);
+        }
+      else
+        {
+          // Where the clock is now, which we must not go back from.
+          ACE_UINT64 const base_ticks = base_ticks_.load (std::memory_order_relaxed);
+          ACE_UINT64 const shown =
+            base_nsecs_.load (std::memory_order_relaxed)
+            + static_cast<ACE_UINT64> (
+                (static_cast<unsigned __int128> (now.ticks - base_ticks)
+                 * old_mult) >> 32);
+
+          last_sync = now;
+          publish (now.ticks,
+                   now.nsecs > shown ? now.nsecs : shown,
+                   mult,
+                   now.ticks + recalibration_ticks (mult));
+        }
+    }
+
+  recalibrating_.store (false, std::memory_order_release);
+}
+
+ACE_UINT64
+ACE_TSC_Clock::now_slow (ACE_UINT64 t)
+{
+  int state = state_.load ();
+  if (state == UNCALIBRATED)
+    {
+      if (state_.compare_exchange_strong (state, CALIBRATING))
+        ACE_TSC_Clock::calibrate ();
+      state = state_.load ();
+    }
+  else if (state == CALIBRATED)
+    {
+      ACE_TSC_Clock::recalibrate (t);
+      state = state_.load ();
+    }
+
+  if (state != CALIBRATED)
+    return ACE_TSC_Clock::system_now ();
+
+  // Another thread may still be recalibrating: use the parameters as
+  // they are, past the limit.
+  t = ACE_TSC_Clock::ticks ();
+  for (;;)
+    {
+      unsigned int const seq = sequence_.load (std::memory_order_acquire);
+      ACE_UINT64 const base_ticks = base_ticks_.load (std::memory_order_relaxed);
+      ACE_UINT64 const base_nsecs = base_nsecs_.load (std::memory_order_relaxed);
+      ACE_UINT64 const mult = mult_.load (std::memory_order_relaxed);
+      std::atomic_thread_fence (std::memory_order_acquire);
+
+      if (seq != sequence_.load (std::memory_order_relaxed) || (seq & 1) != 0)
+        continue;
+      if (mult == 0)
+        return ACE_TSC_Clock::system_now ();
+
+      ACE_UINT64 const delta = t > base_ticks ? t - base_ticks : 0;
+      return base_nsecs
+        + static_cast<ACE_UINT64> (
+            (static_cast<unsigned __int128> (delta) * mult) >> 32);
+    }
+}
+
+bool
+ACE_TSC_Clock::available (void)
+{
+  ACE_TSC_Clock::now ();
+  return state_.load () == CALIBRATED;
+}
+
+double
+ACE_TSC_Clock::ticks_per_usec (void)
+{
+  if (!ACE_TSC_Clock::available ())
+    return 0.0;
+  return 1000.0 * 4294967296.0
+    / static_cast<double> (mult_.load (std::memory_order_relaxed));
+}
+
+#else /* ACE_HAS_TSC_CLOCK */
+
+ACE_UINT64
+ACE_TSC_Clock::now (void)
+{
+  return ACE_TSC_Clock::system_now ();
+}
+
+ACE_UINT64
+ACE_TSC_Clock::ticks (void)
+{
+  return ACE_TSC_Clock::system_now ();
+}
+
+bool
+ACE_TSC_Clock::available (void)
+{
+  return false;
+}
+
+double
+ACE_TSC_Clock::ticks_per_usec (void)
+{
+  return 0.0;
+}
+
+int
+ACE_TSC_Clock::calibrate (void)
+{
+  return -1;
+}
+
+#endif /* ACE_HAS_TSC_CLOCK */
+
+ACE_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,142 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    TSC_Clock.h
+ *
+ *  A monotonic nanosecond clock read from the CPU time stamp counter.
+ */
+//=============================================================================
+
+#ifndef ACE_TSC_CLOCK_H
+#define ACE_TSC_CLOCK_H
+#include /**/ "ace/pre.h"
+
+#include /**/ "ace/ACE_export.h"
+#include "ace/Basic_Types.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#if (defined (__x86_64__) || defined (__amd64__)) \
+    && (defined (__GNUG__) || defined (__INTEL_COMPILER)) \
+    && defined (ACE_HAS_CPP11) && defined (ACE_HAS_CLOCK_GETTIME) \
+    && !defined (ACE_LACKS_TSC_CLOCK)
+/// The time stamp counter can be used, if the CPU says it is invariant.
+# define ACE_HAS_TSC_CLOCK
+#endif
+
+#if !defined (ACE_TSC_CLOCK_CALIBRATION_USECS)
+/// Length of each of the two measurements of the counter frequency
+/// done at startup.
+# define ACE_TSC_CLOCK_CALIBRATION_USECS 5000
+#endif /* ACE_TSC_CLOCK_CALIBRATION_USECS */
+
+#if !defined (ACE_TSC_CLOCK_RECALIBRATION_MSECS)
+/// How often the frequency is measured again and the clock brought
+/// back in line with CLOCK_MONOTONIC.
+# define ACE_TSC_CLOCK_RECALIBRATION_MSECS 1000
+#endif /* ACE_TSC_CLOCK_RECALIBRATION_MSECS */
+
+#if defined (ACE_HAS_TSC_CLOCK)
+# include <atomic>
+#endif /* ACE_HAS_TSC_CLOCK */
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class ACE_TSC_Clock
+ *
+ * @brief Nanoseconds on the CLOCK_MONOTONIC time line, computed from
+ * the CPU time stamp counter.
+ *
+ * On x86-64 CPUs whose counter is invariant (it ticks at a constant
+ * rate in every power state, and all the cores share it) reading it
+ * and scaling the result is several times cheaper than clock_gettime.
+ * The first call checks CPUID for the invariant counter and measures
+ * its frequency twice against CLOCK_MONOTONIC.  If the counter is not
+ * invariant or the two measurements disagree, for instance under a
+ * hypervisor that does not virtualize the counter well, the clock
+ * falls back to CLOCK_MONOTONIC for good.
+ *
+ * Every ACE_TSC_CLOCK_RECALIBRATION_MSECS the thread that notices
+ * measures the frequency again over the whole period and resets the
+ * clock to CLOCK_MONOTONIC, without ever moving it backwards, so the
+ * two do not drift apart.  Readers never lock.
+ *
+ * Define ACE_USES_TSC_GETHRTIME in config.h to make ACE_OS::gethrtime(),
+ * and so ACE_High_Res_Timer, use this clock; ACE_TSC_Time_Policy uses
+ * it for timer queues and ACE_Time_Value_T.
+ */
+class ACE_Export ACE_TSC_Clock
+{
+public:
+  /// Current time, in nanoseconds.
+  static ACE_UINT64 now (void);
+
+  /// Raw counter value, or now() where there is no counter.
+  static ACE_UINT64 ticks (void);
+
+  /// True if now() reads the time stamp counter, false if it falls
+  /// back to the system clock.  Calibrates the clock if needed.
+  static bool available (void);
+
+  /// Counter ticks per microsecond, 0 if the counter is not used.
+  static double ticks_per_usec (void);
+
+  /// Check and measure the counter again, from scratch.  Returns 0 if
+  /// the counter is used, -1 if the clock falls back.
+  static int calibrate (void);
+
+private:
+#if defined (ACE_HAS_TSC_CLOCK)
+  /// Calibrate on first use, or recalibrate, then return now().
+  static ACE_UINT64 now_slow (ACE_UINT64 ticks);
+
+  /// Measure the frequency again and publish new parameters.
+  static void recalibrate (ACE_UINT64 ticks);
+
+  /// Publish new scaling parameters.
+  static void publish (ACE_UINT64 base_ticks,
+                       ACE_UINT64 base_nsecs,
+                       ACE_UINT64 mult,
+                       ACE_UINT64 recalibrate_at);
+
+  enum
+  {
+    UNCALIBRATED,
+    CALIBRATING,
+    CALIBRATED,
+    FALLBACK
+  };
+
+  static std::atomic<int> state_;
+
+  /// Odd while the parameters below are being changed.
+  static std::atomic<unsigned int> sequence_;
+
+  /// now() = base_nsecs_ + ((ticks - base_ticks_) * mult_) >> 32
+  static std::atomic<ACE_UINT64> base_ticks_;
+  static std::atomic<ACE_UINT64> base_nsecs_;
+  static std::atomic<ACE_UINT64> mult_;
+
+  /// Counter value past which the next reader recalibrates.
+  static std::atomic<ACE_UINT64> recalibrate_at_;
+
+  /// Set by the thread recalibrating.
+  static std::atomic<bool> recalibrating_;
+#endif /* ACE_HAS_TSC_CLOCK */
+
+  /// The system clock used when the counter is not.
+  static ACE_UINT64 system_now (void);
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#if defined (__ACE_INLINE__)
+#include "ace/TSC_Clock.inl"
+#endif /* __ACE_INLINE__ */
+
+#include /**/ "ace/post.h"
+#endif /* ACE_TSC_CLOCK_H */
@@ -0,0 +1,45 @@
+// -*- C++ -*-
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+#if defined (ACE_HAS_TSC_CLOCK)
+
+ACE_INLINE ACE_UINT64
+ACE_TSC_Clock::ticks (void)
+{
+  ACE_UINT32 eax, edx;
+  asm volatile ("rdtsc" : "=a" (eax), "=d" (edx) : : "memory");
+  return (static_cast<ACE_UINT64> (edx) << 32) | eax;
+}
+
+ACE_INLINE ACE_UINT64
+ACE_TSC_Clock::now (void)
+{
+  ACE_UINT64 const t = ACE_TSC_Clock::ticks ();
+
+  for (;;)
+    {
+      unsigned int const seq = sequence_.load (std::memory_order_acquire);
+      ACE_UINT64 const base_ticks = base_ticks_.load (std::memory_order_relaxed);
+      ACE_UINT64 const base_nsecs = base_nsecs_.load (std::memory_order_relaxed);
+      ACE_UINT64 const mult = mult_.load (std::memory_order_relaxed);
+      ACE_UINT64 const limit = recalibrate_at_.load (std::memory_order_relaxed);
+      std::atomic_thread_fence (std::memory_order_acquire);
+
+      if (seq != sequence_.load (std::memory_order_relaxed) || (seq & 1) != 0)
+        continue;
+
+      // Before the first calibration limit is 0, and it stays 0 when
+      // falling back to the system clock.
+      if (t >= limit)
+        return ACE_TSC_Clock::now_slow (t);
+
+      ACE_UINT64 const delta = t > base_ticks ? t - base_ticks : 0;
+      return base_nsecs
+        + static_cast<ACE_UINT64> (
+            (static_cast<unsigned __int128> (delta) * mult) >> 32);
+    }
+}
+
+#endif /* ACE_HAS_TSC_CLOCK */
+
+ACE_END_VERSIONED_NAMESPACE_DECL
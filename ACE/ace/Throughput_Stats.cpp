@@ -12,6 +12,7 @@ ACE_BEGIN_VERSIONED_NAMESPACE_DECL
 ACE_Throughput_Stats::ACE_Throughput_Stats (void)
   : ACE_Basic_Stats ()
   , throughput_last_ (0)
+  , histogram_ ()
 {
 }
 
@@ -20,6 +21,7 @@ ACE_Throughput_Stats::sample (ACE_UINT64 throughput,
                               ACE_UINT64 latency)
 {
   this->ACE_Basic_Stats::sample (latency);
+  this->histogram_.sample (latency);
 
   if (this->samples_count () == 1u)
     {
@@ -34,6 +36,7 @@ ACE_Throughput_Stats::accumulate (const ACE_Throughput_Stats &rhs)
     return;
 
   this->ACE_Basic_Stats::accumulate (rhs);
+  this->histogram_.accumulate (rhs.histogram_);
 
   if (this->samples_count () == 0u)
     {
@@ -57,12 +60,26 @@ ACE_Throughput_Stats::dump_results (const ACE_TCHAR* msg,
     }
 
   this->ACE_Basic_Stats::dump_results (msg, sf);
+  this->histogram_.dump_percentiles (msg, sf);
 
   ACE_Throughput_Stats::dump_throughput (msg, sf,
                                          this->throughput_last_,
                                          this->samples_count ());
 }
 
+void
+ACE_Throughput_Stats::dump_cdf (const ACE_TCHAR* msg,
+                                ACE_Basic_Stats::scale_factor_type sf) const
+{
+  this->histogram_.dump_cdf (msg, sf);
+}
+
+const ACE_Latency_Histogram &
+ACE_Throughput_Stats::histogram (void) const
+{
+  return this->histogram_;
+}
+
 void
 ACE_Throughput_Stats::dump_throughput (const ACE_TCHAR *msg,
                                        ACE_Basic_Stats::scale_factor_type sf,
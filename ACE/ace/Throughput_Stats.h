@@ -21,6 +21,7 @@
 #endif /* ACE_LACKS_PRAGMA_ONCE */
 
 #include "ace/Basic_Stats.h"
+#include "ace/Latency_Histogram.h"
 
 ACE_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -31,6 +32,7 @@ ACE_BEGIN_VERSIONED_NAMESPACE_DECL
  * analysis, including:
  * -# Minimum, Average and Maximum latency
  * -# Jitter for the latency
+ * -# Latency percentiles and distribution, see ACE_Latency_Histogram
  * -# Linear regression for throughput
  * -# Accumulate results from several samples to obtain aggregated
  *    results, across several threads or experiments.
@@ -55,6 +57,12 @@ public:
   /// Print down the stats
   void dump_results (const ACE_TCHAR* msg, scale_factor_type scale_factor);
 
+  /// Print the cumulative distribution of the latency.
+  void dump_cdf (const ACE_TCHAR* msg, scale_factor_type scale_factor) const;
+
+  /// The distribution of the latency samples.
+  const ACE_Latency_Histogram &histogram (void) const;
+
   /// Dump the average throughput stats.
   static void dump_throughput (const ACE_TCHAR *msg,
                                scale_factor_type scale_factor,
@@ -63,6 +71,9 @@ public:
 private:
   /// The last throughput measurement.
   ACE_UINT64 throughput_last_;
+
+  /// The latency samples, for the percentiles.
+  ACE_Latency_Histogram histogram_;
 };
 
 ACE_END_VERSIONED_NAMESPACE_DECL
@@ -53,6 +53,24 @@ public:
   void set_gettimeofday (ACE_Time_Value (*gettimeofday)(void));
 };
 
+/**
+ * @class ACE_TSC_Time_Policy
+ *
+ * @brief Implement a monotonic time policy based on ACE_TSC_Clock.
+ *
+ * Cheaper than ACE_Monotonic_Time_Policy where the time stamp counter
+ * can be used, and the same where it cannot.
+ */
+class ACE_Export ACE_TSC_Time_Policy
+{
+public:
+  /// Return the current time according to this policy
+  ACE_Time_Value_T<ACE_TSC_Time_Policy> operator() () const;
+
+  /// Noop. Just here to satisfy backwards compatibility demands.
+  void set_gettimeofday (ACE_Time_Value (*gettimeofday)(void));
+};
+
 /**
  * @class ACE_FPointer_Timer_Policy
  *
@@ -154,6 +172,7 @@ typedef ACE_FPointer_Time_Policy ACE_Default_Time_Policy;
 #if defined ACE_HAS_EXPLICIT_TEMPLATE_INSTANTIATION_EXPORT
 template class ACE_Export ACE_Time_Value_T<ACE_System_Time_Policy>;
 template class ACE_Export ACE_Time_Value_T<ACE_HR_Time_Policy>;
+template class ACE_Export ACE_Time_Value_T<ACE_TSC_Time_Policy>;
 template class ACE_Export ACE_Time_Value_T<ACE_FPointer_Time_Policy>;
 template class ACE_Export ACE_Time_Value_T<ACE_Delegating_Time_Policy>;
 #endif /* ACE_HAS_EXPLICIT_TEMPLATE_INSTANTIATION_EXPORT */
@@ -1,6 +1,7 @@
 // -*- C++ -*-
 #include "ace/OS_NS_sys_time.h"
 #include "ace/High_Res_Timer.h"
+#include "ace/TSC_Clock.h"
 
 ACE_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -26,6 +27,20 @@ ACE_HR_Time_Policy::set_gettimeofday (ACE_Time_Value (*)(void))
 {
 }
 
+ACE_INLINE ACE_Time_Value_T<ACE_TSC_Time_Policy>
+ACE_TSC_Time_Policy::operator()() const
+{
+  ACE_UINT64 const nsecs = ACE_TSC_Clock::now ();
+  return ACE_Time_Value_T<ACE_TSC_Time_Policy> (
+    static_cast<time_t> (nsecs / ACE_U_ONE_SECOND_IN_NSECS),
+    static_cast<suseconds_t> ((nsecs % ACE_U_ONE_SECOND_IN_NSECS) / 1000));
+}
+
+ACE_INLINE void
+ACE_TSC_Time_Policy::set_gettimeofday (ACE_Time_Value (*)(void))
+{
+}
+
 ACE_INLINE
 ACE_FPointer_Time_Policy::ACE_FPointer_Time_Policy()
   : function_(ACE_OS::gettimeofday)
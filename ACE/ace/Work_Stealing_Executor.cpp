@@ -0,0 +1,312 @@
+#include "ace/Work_Stealing_Executor.h"
+
+#if defined (ACE_HAS_THREADS)
+
+#if defined (ACE_HAS_ALLOC_HOOKS)
+# include "ace/Malloc_Base.h"
+#endif /* ACE_HAS_ALLOC_HOOKS */
+
+#include "ace/Guard_T.h"
+#include "ace/Log_Category.h"
+#include "ace/OS_NS_Thread.h"
+#include "ace/OS_NS_errno.h"
+#include "ace/OS_NS_unistd.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class ACE_Work_Stealing_Executor::Worker
+ *
+ * @brief The queue of one worker thread.
+ *
+ * The owner pushes and pops at the back, thieves pop at the front.
+ * Only the owner and the occasional thief take the lock, so unlike the
+ * lock of a shared queue it rarely has to move between CPUs.
+ */
+class ACE_Work_Stealing_Executor::Worker
+{
+public:
+  Worker (void)
+    : requests_ (0),
+      capacity_ (0),
+      head_ (0),
+      count_ (0)
+  {
+  }
+
+  ~Worker (void)
+  {
+    for (size_t i = 0; i != this->count_; ++i)
+      delete this->requests_[(this->head_ + i) % this->capacity_];
+    delete [] this->requests_;
+  }
+
+  int push_back (ACE_Method_Request *request)
+  {
+    ACE_GUARD_RETURN (ACE_Thread_Mutex, ace_mon, this->lock_, -1);
+
+    if (this->count_ == this->capacity_)
+      {
+        size_t const capacity = this->capacity_ == 0 ? 64 : 2 * this->capacity_;
+        ACE_Method_Request **requests = 0;
+        ACE_NEW_RETURN (requests, ACE_Method_Request *[capacity], -1);
+
+        for (size_t i = 0; i != this->count_; ++i)
+          requests[i] = this->requests_[(this->head_ + i) % this->capacity_];
+
+        delete [] this->requests_;
+        this->requests_ = requests;
+        this->capacity_ = capacity;
+        this->head_ = 0;
+      }
+
+    this->requests_[(this->head_ + this->count_) % this->capacity_] = request;
+    ++this->count_;
+    return 0;
+  }
+
+  ACE_Method_Request *pop_back (void)
+  {
+    ACE_GUARD_RETURN (ACE_Thread_Mutex, ace_mon, this->lock_, 0);
+
+    if (this->count_ == 0)
+      return 0;
+    --this->count_;
+    return this->requests_[(this->head_ + this->count_) % this->capacity_];
+  }
+
+  ACE_Method_Request *pop_front (void)
+  {
+    ACE_GUARD_RETURN (ACE_Thread_Mutex, ace_mon, this->lock_, 0);
+
+    if (this->count_ == 0)
+      return 0;
+    ACE_Method_Request *request = this->requests_[this->head_];
+    this->head_ = (this->head_ + 1) % this->capacity_;
+    --this->count_;
+    return request;
+  }
+
+private:
+  ACE_Thread_Mutex lock_;
+
+  /// Circular buffer of @c capacity_ requests, @c count_ of which are
+  /// used starting at @c head_.
+  ACE_Method_Request **requests_;
+  size_t capacity_;
+  size_t head_;
+  size_t count_;
+};
+
+ACE_ALLOC_HOOK_DEFINE(ACE_Work_Stealing_Executor)
+
+ACE_Work_Stealing_Executor::ACE_Work_Stealing_Executor (ACE_Thread_Manager *thr_mgr)
+  : ACE_Task_Base (thr_mgr),
+    workers_ (0),
+    size_ (0),
+    pending_ (0),
+    idle_ (0),
+    next_ (0),
+    started_ (0),
+    steals_ (0),
+    closed_ (0),
+    wakeup_ (lock_)
+{
+}
+
+ACE_Work_Stealing_Executor::~ACE_Work_Stealing_Executor (void)
+{
+  this->shutdown ();
+}
+
+int
+ACE_Work_Stealing_Executor::start (size_t threads)
+{
+  if (this->workers_ != 0)
+    {
+      errno = EBUSY;
+      return -1;
+    }
+
+  if (threads == 0)
+    {
+      long const cpus = ACE_OS::num_processors_online ();
+      threads = cpus > 0 ? static_cast<size_t> (cpus) : 1;
+    }
+
+  if (ACE_OS::thr_keycreate (&this->key_, 0) == -1)
+    return -1;
+
+  ACE_NEW_NORETURN (this->workers_, Worker *[threads]);
+  if (this->workers_ == 0)
+    {
+      ACE_OS::thr_keyfree (this->key_);
+      return -1;
+    }
+
+  for (size_t i = 0; i != threads; ++i)
+    {
+      ACE_NEW_NORETURN (this->workers_[i], Worker);
+      if (this->workers_[i] == 0)
+        {
+          while (i-- != 0)
+            delete this->workers_[i];
+          delete [] this->workers_;
+          this->workers_ = 0;
+          ACE_OS::thr_keyfree (this->key_);
+          return -1;
+        }
+    }
+
+  this->size_ = threads;
+  this->next_ = 0;
+  this->started_ = 0;
+  this->closed_ = 0;
+
+  if (this->activate (THR_NEW_LWP | THR_JOINABLE | THR_INHERIT_SCHED,
+                      static_cast<int> (threads)) == -1)
+    {
+      this->shutdown ();
+      return -1;
+    }
+  return 0;
+}
+
+int
+ACE_Work_Stealing_Executor::shutdown (void)
+{
+  if (this->workers_ == 0)
+    return 0;
+
+  {
+    ACE_GUARD_RETURN (ACE_Thread_Mutex, ace_mon, this->lock_, -1);
+    this->closed_ = 1;
+    this->wakeup_.broadcast ();
+  }
+
+  int const result = this->wait ();
+
+  // Requests that other threads managed to queue while the workers
+  // were exiting are deleted without being called.
+  for (size_t i = 0; i != this->size_; ++i)
+    delete this->workers_[i];
+  delete [] this->workers_;
+  this->workers_ = 0;
+  this->size_ = 0;
+
+  ACE_OS::thr_keyfree (this->key_);
+  return result;
+}
+
+size_t
+ACE_Work_Stealing_Executor::size (void) const
+{
+  return this->size_;
+}
+
+unsigned long
+ACE_Work_Stealing_Executor::steals (void) const
+{
+  return this->steals_.value ();
+}
+
+int
+ACE_Work_Stealing_Executor::execute (ACE_Method_Request *request)
+{
+  if (this->workers_ == 0)
+    return -1;
+
+  void *self = 0;
+  ACE_OS::thr_getspecific (this->key_, &self);
+
+  // Once closed, only the requests being called may add more: their
+  // worker does not exit before its queue is empty.
+  Worker *worker = static_cast<Worker *> (self);
+  if (worker == 0)
+    {
+      if (this->closed_.value () != 0)
+        return -1;
+      worker = this->workers_[this->next_++ % this->size_];
+    }
+
+  if (worker->push_back (request) == -1)
+    return -1;
+
+  ++this->pending_;
+  this->notify_i ();
+  return 0;
+}
+
+void
+ACE_Work_Stealing_Executor::notify_i (void)
+{
+  // A worker increments idle_ before it checks pending_ one last
+  // time, and we incremented pending_ before checking idle_, so at
+  // least one of us sees the other.
+  if (this->idle_.value () != 0)
+    {
+      ACE_GUARD (ACE_Thread_Mutex, ace_mon, this->lock_);
+      this->wakeup_.signal ();
+    }
+}
+
+ACE_Method_Request *
+ACE_Work_Stealing_Executor::steal_i (size_t self)
+{
+  for (size_t i = 1; i < this->size_; ++i)
+    {
+      ACE_Method_Request *request =
+        this->workers_[(self + i) % this->size_]->pop_front ();
+      if (request != 0)
+        {
+          ++this->steals_;
+          return request;
+        }
+    }
+  return 0;
+}
+
+int
+ACE_Work_Stealing_Executor::svc (void)
+{
+  size_t const index = (this->started_++) % this->size_;
+  Worker *self = this->workers_[index];
+
+  if (ACE_OS::thr_setspecific (this->key_, self) == -1)
+    ACELIB_ERROR_RETURN ((LM_ERROR,
+                          ACE_TEXT ("%p\n"),
+                          ACE_TEXT ("ACE_Work_Stealing_Executor::svc")),
+                         -1);
+
+  for (;;)
+    {
+      ACE_Method_Request *request = self->pop_back ();
+      if (request == 0)
+        request = this->steal_i (index);
+
+      if (request != 0)
+        {
+          --this->pending_;
+          request->call ();
+          delete request;
+          continue;
+        }
+
+      ACE_GUARD_RETURN (ACE_Thread_Mutex, ace_mon, this->lock_, -1);
+
+      ++this->idle_;
+      while (this->pending_.value () == 0 && this->closed_.value () == 0)
+        this->wakeup_.wait ();
+      --this->idle_;
+
+      if (this->pending_.value () == 0)
+        break;
+    }
+
+  ACE_OS::thr_setspecific (this->key_, 0);
+  return 0;
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* ACE_HAS_THREADS */
@@ -0,0 +1,145 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Work_Stealing_Executor.h
+ *
+ *  A thread pool executor whose threads have a queue each.
+ */
+//=============================================================================
+
+#ifndef ACE_WORK_STEALING_EXECUTOR_H
+#define ACE_WORK_STEALING_EXECUTOR_H
+
+#include /**/ "ace/pre.h"
+
+#include /**/ "ace/ACE_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#if defined (ACE_HAS_THREADS)
+
+#include "ace/Executor.h"
+#include "ace/Task.h"
+#include "ace/Atomic_Op.h"
+#include "ace/Thread_Mutex.h"
+#include "ace/Condition_Thread_Mutex.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class ACE_Work_Stealing_Executor
+ *
+ * @brief Thread pool executor in which each thread has its own queue
+ * of requests and steals from the others when it runs dry.
+ *
+ * A pool fed from a single ACE_Activation_Queue makes every thread
+ * take the same lock for every request, and hands a request created
+ * by a worker (a continuation, a sub task) to whichever thread wakes
+ * up first.  Here requests submitted by a worker go to the back of
+ * that worker's own queue, which it serves last in first out, so the
+ * data they use is still in its cache.  Requests from other threads
+ * are spread round robin over the queues.  A worker whose queue is
+ * empty takes the oldest request of another worker's queue, and only
+ * sleeps when all the queues are empty.
+ *
+ * Requests run in no particular order; use ACE_Future::then() or an
+ * ACE_Activation_Queue when the order matters.
+ */
+class ACE_Export ACE_Work_Stealing_Executor
+  : public ACE_Executor,
+    public ACE_Task_Base
+{
+public:
+  /// Constructor.  No thread is started until start() is called.
+  ACE_Work_Stealing_Executor (ACE_Thread_Manager *thr_mgr = 0);
+
+  /// Destructor, calls shutdown().
+  virtual ~ACE_Work_Stealing_Executor (void);
+
+  /**
+   * Start @a threads worker threads, or one per online processor if
+   * @a threads is 0.  Returns -1 if the threads could not be spawned,
+   * or with @c errno set to @c EBUSY if the executor was already
+   * started.
+   */
+  int start (size_t threads = 0);
+
+  /**
+   * Refuse new requests from outside the pool, wait until the pending
+   * ones, and those they queue, have been called and join the worker
+   * threads.  Must not be called from a worker thread.
+   */
+  int shutdown (void);
+
+  /// Queue @a request, see ACE_Executor::execute().  Returns -1 if the
+  /// executor is not running or, unless called by a worker, is being
+  /// shut down.
+  virtual int execute (ACE_Method_Request *request);
+
+  /// Number of worker threads.
+  size_t size (void) const;
+
+  /// Number of requests taken from the queue of another worker since
+  /// the executor was started.
+  unsigned long steals (void) const;
+
+  /// Run the requests; this is the body of the worker threads.
+  virtual int svc (void);
+
+  /// Declare the dynamic allocation hooks.
+  ACE_ALLOC_HOOK_DECLARE;
+
+private:
+  class Worker;
+
+  /// Take a request from the front of the queue of a worker other
+  /// than @a self, or return 0 if they are all empty.
+  ACE_Method_Request *steal_i (size_t self);
+
+  /// Wake up one sleeping worker, if any.
+  void notify_i (void);
+
+  /// The workers, one queue each.
+  Worker **workers_;
+  size_t size_;
+
+  /// Key of the thread specific slot in which each worker thread finds
+  /// its Worker.
+  ACE_thread_key_t key_;
+
+  /// Number of requests queued and not yet taken by a worker.
+  ACE_Atomic_Op<ACE_Thread_Mutex, long> pending_;
+
+  /// Number of workers sleeping, or about to sleep, on @c wakeup_.
+  ACE_Atomic_Op<ACE_Thread_Mutex, long> idle_;
+
+  /// Round robin counter used to pick a queue for outside requests.
+  ACE_Atomic_Op<ACE_Thread_Mutex, unsigned long> next_;
+
+  /// Gives the workers their index at startup.
+  ACE_Atomic_Op<ACE_Thread_Mutex, unsigned long> started_;
+
+  ACE_Atomic_Op<ACE_Thread_Mutex, unsigned long> steals_;
+
+  /// Non zero once shutdown() has been called.
+  ACE_Atomic_Op<ACE_Thread_Mutex, long> closed_;
+
+  /// Lock and condition idle workers sleep on.
+  ACE_Thread_Mutex lock_;
+  ACE_Condition_Thread_Mutex wakeup_;
+
+  // = Prevent assignment and initialization.
+  void operator= (const ACE_Work_Stealing_Executor &);
+  ACE_Work_Stealing_Executor (const ACE_Work_Stealing_Executor &);
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* ACE_HAS_THREADS */
+
+#include /**/ "ace/post.h"
+
+#endif /* ACE_WORK_STEALING_EXECUTOR_H */
@@ -137,6 +137,25 @@
 # define ACE_HAS_CPU_SET_T
 #endif /* __GLIBC__ > 2 || __GLIBC__ === 2 && __GLIBC_MINOR__ >= 3) */
 
+// sendmmsg() and recvmmsg() are GNU extensions, available since glibc 2.14
+#if defined (_GNU_SOURCE) && \
+    ((__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 14))
+# define ACE_HAS_SENDMMSG
+# define ACE_HAS_RECVMMSG
+#endif /* _GNU_SOURCE && __GLIBC__ >= 2.14 */
+
+// Robust mutexes, pthread_mutexattr_setrobust() and
+// pthread_mutex_consistent(), are available since glibc 2.12
+#if (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 12)
+# define ACE_HAS_PTHREAD_MUTEX_ROBUST
+#endif /* __GLIBC__ >= 2.12 */
+
+// eventfd() with the EFD_NONBLOCK and EFD_CLOEXEC flags is available
+// since glibc 2.9
+#if (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 9)
+# define ACE_HAS_EVENTFD
+#endif /* __GLIBC__ >= 2.9 */
+
 // Then the compiler specific parts
 
 #if defined (__INTEL_COMPILER)
@@ -425,6 +425,12 @@
 #  define ACE_ALLOC_HOOK_DEFINE_Tcs(CLASS) \
   ACE_GENERIC_ALLOCS (ACE_ALLOC_HOOK_HELPER_Tcs, CLASS)
 
+#  define ACE_ALLOC_HOOK_HELPER_Tmc(RET, CLASS) \
+  template <ACE_MEM_POOL_1, class ACE_LOCK> RET \
+  CLASS<ACE_MEM_POOL_2, ACE_LOCK>
+#  define ACE_ALLOC_HOOK_DEFINE_Tmc(CLASS) \
+  ACE_GENERIC_ALLOCS (ACE_ALLOC_HOOK_HELPER_Tmc, CLASS)
+
 #  define ACE_ALLOC_HOOK_HELPER_Tmcc(RET, CLASS) \
   template <ACE_MEM_POOL_1, class ACE_LOCK, class ACE_CB> RET \
   CLASS<ACE_MEM_POOL_2, ACE_LOCK, ACE_CB>
@@ -452,6 +458,7 @@
 #  define ACE_ALLOC_HOOK_DEFINE_Tco(CLASS)
 #  define ACE_ALLOC_HOOK_DEFINE_Tcoccc(CLASS)
 #  define ACE_ALLOC_HOOK_DEFINE_Tcs(CLASS)
+#  define ACE_ALLOC_HOOK_DEFINE_Tmc(CLASS)
 #  define ACE_ALLOC_HOOK_DEFINE_Tmcc(CLASS)
 # endif /* ACE_HAS_ALLOC_HOOKS */
 
@@ -10,6 +10,7 @@
 #include "ace/RW_Mutex.h"
 #include "ace/RW_Process_Mutex.h"
 #include "ace/RW_Thread_Mutex.h"
+#include "ace/Scalable_RW_Mutex.h"
 #include "ace/Lock_Adapter_T.h"
 #include "ace/Recursive_Thread_Mutex.h"
 #include "ace/Semaphore.h"
@@ -148,6 +149,11 @@ typedef Baseline_Lock_Test<ACE_RW_Thread_Mutex> Baseline_RW_Thread_Mutex_Test;
 ACE_SVC_FACTORY_DECLARE (Baseline_RW_Thread_Mutex_Test)
 ACE_SVC_FACTORY_DEFINE (Baseline_RW_Thread_Mutex_Test)
 
+typedef Baseline_Lock_Test<ACE_Scalable_RW_Mutex> Baseline_Scalable_RW_Mutex_Test;
+
+ACE_SVC_FACTORY_DECLARE (Baseline_Scalable_RW_Mutex_Test)
+ACE_SVC_FACTORY_DEFINE (Baseline_Scalable_RW_Mutex_Test)
+
 typedef Baseline_Lock_Test<ACE_RW_Mutex> Baseline_RW_Mutex_Test;
 
 ACE_SVC_FACTORY_DECLARE (Baseline_RW_Mutex_Test)
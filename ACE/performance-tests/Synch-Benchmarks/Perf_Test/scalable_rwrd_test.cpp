@@ -0,0 +1,42 @@
+#define  ACE_BUILD_SVC_DLL
+#include "ace/Scalable_RW_Mutex.h"
+#include "Performance_Test_Options.h"
+#include "Benchmark_Performance.h"
+
+#if defined (ACE_HAS_THREADS)
+
+// Same as RWRD_Test, for the readers/writer lock whose readers do not
+// share a cache line.  Compare the two with -t set to the number of
+// CPUs.
+
+class ACE_Svc_Export Scalable_RWRD_Test : public Benchmark_Performance
+{
+public:
+  virtual int svc (void);
+
+private:
+  static ACE_Scalable_RW_Mutex rw_lock;
+};
+
+ACE_Scalable_RW_Mutex Scalable_RWRD_Test::rw_lock;
+
+int
+Scalable_RWRD_Test::svc (void)
+{
+  int ni = this->thr_id ();
+  synch_count = 2;
+
+  while (!this->done ())
+    {
+      rw_lock.acquire_read ();
+      performance_test_options.thr_work_count[ni]++;
+      rw_lock.release ();
+    }
+
+  /* NOTREACHED */
+  return 0;
+}
+
+ACE_SVC_FACTORY_DECLARE (Scalable_RWRD_Test)
+ACE_SVC_FACTORY_DEFINE  (Scalable_RWRD_Test)
+#endif /* ACE_HAS_THREADS */
@@ -0,0 +1,432 @@
+//=============================================================================
+/**
+ *  @file    BTree_Map_Test.cpp
+ *
+ *  This test checks that ACE_BTree_Map behaves like ACE_RB_Tree while
+ *  nodes get split, merged and rebalanced, that its iterators and
+ *  range lookups visit the keys in order, and that a key prefix
+ *  policy gives the same results as plain comparisons.  It then times
+ *  both maps on the same operations.
+ */
+//=============================================================================
+
+#include "test_config.h"
+#include "ace/BTree_Map_T.h"
+#include "ace/RB_Tree.h"
+#include "ace/Functor_T.h"
+#include "ace/Null_Mutex.h"
+#include "ace/Synch_Traits.h"
+#include "ace/RW_Thread_Mutex.h"
+#include "ace/SString.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/OS_NS_stdio.h"
+#include "ace/OS_NS_string.h"
+
+typedef ACE_BTree_Map<u_long,
+                      u_long,
+                      ACE_Less_Than<u_long>,
+                      ACE_Null_Mutex> BTREE_MAP;
+
+typedef ACE_BTree_Map<u_long,
+                      u_long,
+                      ACE_Less_Than<u_long>,
+                      ACE_Null_Mutex,
+                      ACE_BTree_Map_Integer_Prefix<u_long> > INTEGER_BTREE_MAP;
+
+typedef ACE_RB_Tree<u_long,
+                    u_long,
+                    ACE_Less_Than<u_long>,
+                    ACE_Null_Mutex> RB_TREE;
+
+// Byte-wise ordering of strings, a shorter string sorts before the
+// longer ones it is a prefix of.
+class String_Less_Than
+{
+public:
+  bool operator () (const ACE_CString &lhs, const ACE_CString &rhs) const
+  {
+    size_t const len = lhs.length () < rhs.length () ? lhs.length () : rhs.length ();
+    int const result = ACE_OS::memcmp (lhs.fast_rep (), rhs.fast_rep (), len);
+    return result < 0 || (result == 0 && lhs.length () < rhs.length ());
+  }
+};
+
+// Key prefix policy matching String_Less_Than, the head holds the
+// eight bytes following the skipped ones.
+class String_Prefix
+{
+public:
+  size_t common (const ACE_CString &a, const ACE_CString &b) const
+  {
+    size_t const len = a.length () < b.length () ? a.length () : b.length ();
+    size_t i = 0;
+    while (i < len && a[i] == b[i])
+      ++i;
+    return i;
+  }
+
+  ACE_UINT64 head (const ACE_CString &k, size_t skip) const
+  {
+    ACE_UINT64 result = 0;
+    for (size_t i = skip; i < skip + 8; ++i)
+      result = (result << 8) | (i < k.length () ? static_cast<u_char> (k[i]) : 0u);
+    return result;
+  }
+
+  bool exact (void) const { return false; }
+};
+
+typedef ACE_BTree_Map<ACE_CString,
+                      int,
+                      String_Less_Than,
+                      ACE_SYNCH_RW_MUTEX,
+                      String_Prefix> STRING_MAP;
+
+typedef ACE_BTree_Map<ACE_CString,
+                      int,
+                      String_Less_Than,
+                      ACE_Null_Mutex> PLAIN_STRING_MAP;
+
+typedef ACE_RB_Tree<ACE_CString,
+                    int,
+                    String_Less_Than,
+                    ACE_Null_Mutex> STRING_RB_TREE;
+
+static const u_long N = 20000;
+
+// Scatters 0 .. N - 1 over 0 .. N - 1, N is not a multiple of 7919.
+static u_long
+scatter (u_long i)
+{
+  return (i * 7919) % N;
+}
+
+template <class MAP>
+static int
+test_bind_find_unbind (void)
+{
+  MAP map;
+  int status = 0;
+
+  for (u_long i = 0; i < N; ++i)
+    if (map.bind (scatter (i), scatter (i) * 3) != 0)
+      {
+        ACE_ERROR ((LM_ERROR, ACE_TEXT ("bind %u failed\n"), scatter (i)));
+        return 1;
+      }
+
+  if (map.current_size () != N || map.test_invariant () != 0)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("tree broken after %u binds\n"), N));
+      status = 1;
+    }
+
+  u_long value = 0;
+  if (map.bind (7, 0) != 1 || map.find (7, value) != 0 || value != 21)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("bind of an existing key changed it\n")));
+      status = 1;
+    }
+
+  value = 99;
+  if (map.trybind (8, value) != 1 || value != 24)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("trybind did not return the old value\n")));
+      status = 1;
+    }
+
+  u_long old_value = 0;
+  if (map.rebind (8, 80, old_value) != 1 || old_value != 24
+      || map.find (8, value) != 0 || value != 80)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("rebind failed\n")));
+      status = 1;
+    }
+  map.rebind (8, 24);
+
+  // Unbind the odd keys in scattered order, every merge and rotation
+  // has to keep the tree sound.
+  for (u_long i = 0; i < N; ++i)
+    {
+      u_long const key = scatter (i);
+      if (key % 2 == 0)
+        continue;
+      if (map.unbind (key, value) != 0 || value != key * 3)
+        {
+          ACE_ERROR ((LM_ERROR, ACE_TEXT ("unbind %u failed\n"), key));
+          return 1;
+        }
+      if (i % 1000 == 0 && map.test_invariant () != 0)
+        {
+          ACE_ERROR ((LM_ERROR, ACE_TEXT ("tree broken after unbind %u\n"), key));
+          return 1;
+        }
+    }
+
+  if (map.unbind (1) != -1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("unbind of a missing key succeeded\n")));
+      status = 1;
+    }
+
+  typename MAP::ENTRY *entry = 0;
+  for (u_long i = 0; i < N; ++i)
+    {
+      int const expected = (i % 2 == 0) ? 0 : -1;
+      if (map.find (i, entry) != expected
+          || (expected == 0 && entry->item () != i * 3))
+        {
+          ACE_ERROR ((LM_ERROR, ACE_TEXT ("find %u failed\n"), i));
+          return 1;
+        }
+    }
+
+  // Unbinding through the entries, as TAO's ObjectKey_Table does.
+  while (map.begin () != map.end ())
+    if (map.unbind (&*map.begin ()) != 0)
+      {
+        ACE_ERROR ((LM_ERROR, ACE_TEXT ("unbind of an entry failed\n")));
+        return 1;
+      }
+
+  if (map.current_size () != 0 || map.find (0) != -1 || map.test_invariant () != 0)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("entries left after unbinding all\n")));
+      status = 1;
+    }
+
+  return status;
+}
+
+static int
+test_iteration (void)
+{
+  BTREE_MAP map;
+  int status = 0;
+
+  // Keys 0, 10, 20 .. 9990.
+  for (u_long i = 0; i < 1000; ++i)
+    map.bind (scatter (i) % 1000 * 10, i);
+
+  u_long expected = 0;
+  for (BTREE_MAP::iterator iter = map.begin (); iter != map.end (); ++iter)
+    {
+      if (iter->key () != expected)
+        {
+          ACE_ERROR ((LM_ERROR, ACE_TEXT ("forward: %u instead of %u\n"),
+                      iter->key (), expected));
+          return 1;
+        }
+      expected += 10;
+    }
+
+  BTREE_MAP::ENTRY *entry = 0;
+  for (BTREE_MAP::REVERSE_ITERATOR iter (map); iter.next (entry) != 0; iter.advance ())
+    {
+      expected -= 10;
+      if (entry->key () != expected)
+        {
+          ACE_ERROR ((LM_ERROR, ACE_TEXT ("reverse: %u instead of %u\n"),
+                      entry->key (), expected));
+          return 1;
+        }
+    }
+
+  if (expected != 0)
+    status = 1;
+
+  // Range scans, [lower_bound (a), upper_bound (b)) holds the keys
+  // between a and b.
+  for (u_long low = 0; low < 10000; low += 97)
+    {
+      u_long const high = low + 333;
+      size_t count = 0;
+      BTREE_MAP::iterator const last = map.upper_bound (high);
+      for (BTREE_MAP::iterator iter = map.lower_bound (low); iter != last; iter++)
+        {
+          if (iter->key () < low || iter->key () > high)
+            status = 1;
+          ++count;
+        }
+
+      size_t const wanted = (high >= 9990 ? 999 : high / 10) - (low + 9) / 10 + 1;
+      if (count != wanted)
+        {
+          ACE_ERROR ((LM_ERROR, ACE_TEXT ("range [%u, %u] has %u keys, not %u\n"),
+                      low, high, count, wanted));
+          status = 1;
+        }
+    }
+
+  if (map.lower_bound (9991) != map.end () || map.upper_bound (9990) != map.end ()
+      || map.lower_bound (5)->key () != 10 || map.upper_bound (10)->key () != 20)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("bounds at the edges are wrong\n")));
+      status = 1;
+    }
+
+  return status;
+}
+
+template <class MAP>
+static int
+test_strings (const ACE_TCHAR *name)
+{
+  MAP map;
+  STRING_RB_TREE tree;
+  int status = 0;
+  const u_long n = 5000;
+
+  // Long shared prefixes of varying lengths, the way object keys of a
+  // few POAs look.
+  char key[128];
+  for (u_long i = 0; i < n; ++i)
+    {
+      u_long const id = scatter (i) % n;
+      ACE_OS::sprintf (key, "RootPOA/child-%lu/grandchild/%08lu", id % 3, id);
+      map.bind (ACE_CString (key), static_cast<int> (id));
+      tree.bind (ACE_CString (key), static_cast<int> (id));
+      if (id % 7 == 0)
+        {
+          ACE_OS::sprintf (key, "RootPOA/child-%lu/grandchild/%08lu", id % 3, id);
+          map.unbind (ACE_CString (key));
+          tree.unbind (ACE_CString (key));
+        }
+    }
+
+  if (map.current_size () != tree.current_size () || map.test_invariant () != 0)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("%s: %u entries instead of %u\n"),
+                  name, map.current_size (), tree.current_size ()));
+      status = 1;
+    }
+
+  typename MAP::iterator iter = map.begin ();
+  for (STRING_RB_TREE::ITERATOR rb = tree.begin (); rb != tree.end (); ++rb, ++iter)
+    if (iter == map.end () || iter->key () != (*rb).key ())
+      {
+        ACE_ERROR ((LM_ERROR, ACE_TEXT ("%s: iteration differs from ACE_RB_Tree\n"),
+                    name));
+        return 1;
+      }
+
+  for (u_long id = 0; id < n; ++id)
+    {
+      ACE_OS::sprintf (key, "RootPOA/child-%lu/grandchild/%08lu", id % 3, id);
+      int value = -1;
+      int const result = map.find (ACE_CString (key), value);
+      if ((id % 7 == 0 && result != -1) || (id % 7 != 0 && (result != 0 || value != static_cast<int> (id))))
+        {
+          ACE_ERROR ((LM_ERROR, ACE_TEXT ("%s: lookup of %C failed\n"), name, key));
+          return 1;
+        }
+    }
+
+  // Keys outside the shared prefixes of the nodes.
+  if (map.find (ACE_CString ("A")) != -1 || map.find (ACE_CString ("Z")) != -1
+      || map.find (ACE_CString ("RootPOA/child-1/grandchild/")) != -1
+      || map.lower_bound (ACE_CString ("A")) != map.begin ()
+      || map.lower_bound (ACE_CString ("Z")) != map.end ())
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("%s: lookup of a foreign key failed\n"), name));
+      status = 1;
+    }
+
+  return status;
+}
+
+template <class MAP>
+static void
+time_map (const ACE_TCHAR *name)
+{
+  MAP map;
+  ACE_High_Res_Timer timer;
+  ACE_hrtime_t bind_ns, find_ns, unbind_ns;
+  u_long value = 0;
+  u_long found = 0;
+
+  timer.start ();
+  for (u_long i = 0; i < N; ++i)
+    map.bind (scatter (i), i);
+  timer.stop ();
+  timer.elapsed_time (bind_ns);
+
+  timer.start ();
+  for (int round = 0; round < 10; ++round)
+    for (u_long i = 0; i < N; ++i)
+      found += (map.find (scatter (i), value) == 0);
+  timer.stop ();
+  timer.elapsed_time (find_ns);
+
+  timer.start ();
+  for (u_long i = 0; i < N; ++i)
+    map.unbind (scatter (i));
+  timer.stop ();
+  timer.elapsed_time (unbind_ns);
+
+  ACE_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("%s: ns per bind %Q, find %Q, unbind %Q (%u found)\n"),
+              name,
+              bind_ns / N,
+              find_ns / (10 * N),
+              unbind_ns / N,
+              found));
+}
+
+template <class MAP>
+static void
+time_string_map (const ACE_TCHAR *name)
+{
+  MAP map;
+  ACE_High_Res_Timer timer;
+  ACE_hrtime_t find_ns;
+  int value = 0;
+  u_long found = 0;
+
+  ACE_CString *keys = 0;
+  ACE_NEW (keys, ACE_CString[N]);
+  char key[128];
+  for (u_long i = 0; i < N; ++i)
+    {
+      ACE_OS::sprintf (key, "TAO/1.2/NUP/RootPOA/server-poa/%08lu", scatter (i));
+      keys[i] = ACE_CString (key);
+      map.bind (keys[i], static_cast<int> (i));
+    }
+
+  timer.start ();
+  for (int round = 0; round < 10; ++round)
+    for (u_long i = 0; i < N; ++i)
+      found += (map.find (keys[i], value) == 0);
+  timer.stop ();
+  timer.elapsed_time (find_ns);
+
+  delete [] keys;
+
+  ACE_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("%s: ns per find of a prefixed key %Q (%u found)\n"),
+              name,
+              find_ns / (10 * N),
+              found));
+}
+
+int
+run_main (int, ACE_TCHAR *[])
+{
+  ACE_START_TEST (ACE_TEXT ("BTree_Map_Test"));
+
+  int status = test_bind_find_unbind<BTREE_MAP> ();
+  status += test_bind_find_unbind<INTEGER_BTREE_MAP> ();
+  status += test_iteration ();
+  status += test_strings<STRING_MAP> (ACE_TEXT ("prefix policy"));
+  status += test_strings<PLAIN_STRING_MAP> (ACE_TEXT ("no prefix policy"));
+
+  time_map<RB_TREE> (ACE_TEXT ("ACE_RB_Tree"));
+  time_map<BTREE_MAP> (ACE_TEXT ("ACE_BTree_Map"));
+  time_map<INTEGER_BTREE_MAP> (ACE_TEXT ("ACE_BTree_Map with integer heads"));
+  time_string_map<STRING_RB_TREE> (ACE_TEXT ("ACE_RB_Tree"));
+  time_string_map<PLAIN_STRING_MAP> (ACE_TEXT ("ACE_BTree_Map"));
+  time_string_map<STRING_MAP> (ACE_TEXT ("ACE_BTree_Map with prefixes"));
+
+  ACE_END_TEST;
+  return status;
+}
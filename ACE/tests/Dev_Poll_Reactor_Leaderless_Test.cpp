@@ -0,0 +1,255 @@
+//=============================================================================
+/**
+ *  @file    Dev_Poll_Reactor_Leaderless_Test.cpp
+ *
+ *  This test runs the event loop of an ACE_Dev_Poll_Reactor in
+ *  leaderless mode from several threads at once.  It checks that each
+ *  handler is dispatched by one thread at a time, that every event and
+ *  notification is dispatched exactly once, that a timer scheduled
+ *  while all threads are waiting fires on time, and that ending the
+ *  event loop releases all the threads.
+ */
+//=============================================================================
+
+#include "test_config.h"
+
+#if defined (ACE_HAS_EVENT_POLL) && defined (ACE_HAS_THREADS)
+
+#include "ace/Reactor.h"
+#include "ace/Dev_Poll_Reactor.h"
+#include "ace/Event_Handler.h"
+#include "ace/Atomic_Op.h"
+#include "ace/Pipe.h"
+#include "ace/Thread_Manager.h"
+#include "ace/ACE.h"
+#include "ace/OS_NS_unistd.h"
+#include "ace/OS_NS_sys_time.h"
+
+static const int n_threads = 8;
+static const int n_handlers = 16;
+static const int n_bytes = 200;
+static const int n_notifies = 500;
+
+static ACE_Atomic_Op<ACE_SYNCH_MUTEX, long> total_reads (0);
+static ACE_Atomic_Op<ACE_SYNCH_MUTEX, long> total_notifies (0);
+static ACE_Atomic_Op<ACE_SYNCH_MUTEX, long> concurrent_upcalls (0);
+
+class Reader : public ACE_Event_Handler
+{
+public:
+  Reader (void) : in_upcall_ (0) {}
+
+  int open (ACE_Reactor *r)
+  {
+    if (this->pipe_.open () == -1)
+      return -1;
+    this->reactor (r);
+    return r->register_handler (this->pipe_.read_handle (),
+                                this,
+                                ACE_Event_Handler::READ_MASK);
+  }
+
+  void close (void)
+  {
+    this->reactor ()->remove_handler (this->pipe_.read_handle (),
+                                      ACE_Event_Handler::ALL_EVENTS_MASK
+                                      | ACE_Event_Handler::DONT_CALL);
+    this->pipe_.close ();
+  }
+
+  int send (void)
+  {
+    return ACE::send (this->pipe_.write_handle (), "x", 1) == 1 ? 0 : -1;
+  }
+
+  virtual int handle_input (ACE_HANDLE h)
+  {
+    if (++this->in_upcall_ != 1)
+      ++concurrent_upcalls;
+
+    // Read one byte per upcall so that the handle has to be re-armed
+    // many times.
+    char c;
+    if (ACE::recv (h, &c, 1) == 1)
+      ++total_reads;
+
+    // Give another thread a chance to pick the same handle up.
+    ACE_OS::thr_yield ();
+
+    --this->in_upcall_;
+    return 0;
+  }
+
+  virtual int handle_exception (ACE_HANDLE)
+  {
+    ++total_notifies;
+    return 0;
+  }
+
+private:
+  ACE_Pipe pipe_;
+  ACE_Atomic_Op<ACE_SYNCH_MUTEX, long> in_upcall_;
+};
+
+class Timer : public ACE_Event_Handler
+{
+public:
+  Timer (void) : fired_ (0) {}
+
+  virtual int handle_timeout (const ACE_Time_Value &, const void *)
+  {
+    this->fired_at_ = ACE_OS::gettimeofday ();
+    ++this->fired_;
+    return 0;
+  }
+
+  ACE_Atomic_Op<ACE_SYNCH_MUTEX, long> fired_;
+  ACE_Time_Value fired_at_;
+};
+
+static ACE_THR_FUNC_RETURN
+event_loop (void *arg)
+{
+  ACE_Reactor *reactor = static_cast<ACE_Reactor *> (arg);
+  reactor->owner (ACE_OS::thr_self ());
+  reactor->run_reactor_event_loop ();
+  return 0;
+}
+
+static bool
+wait_for (ACE_Atomic_Op<ACE_SYNCH_MUTEX, long> &counter, long expected)
+{
+  for (int i = 0; i < 300 && counter.value () < expected; ++i)
+    ACE_OS::sleep (ACE_Time_Value (0, 100000));
+  return counter.value () == expected;
+}
+
+int
+run_main (int, ACE_TCHAR *[])
+{
+  ACE_START_TEST (ACE_TEXT ("Dev_Poll_Reactor_Leaderless_Test"));
+
+  int status = 0;
+
+  ACE_Dev_Poll_Reactor *impl = 0;
+  ACE_NEW_RETURN (impl, ACE_Dev_Poll_Reactor, -1);
+  ACE_Reactor reactor (impl, true);
+
+  if (impl->leaderless (true) != 0)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("%p\n"),
+                  ACE_TEXT ("leaderless")));
+      ACE_END_TEST;
+      return 1;
+    }
+
+  Reader readers[n_handlers];
+  for (int i = 0; i < n_handlers; ++i)
+    if (readers[i].open (&reactor) == -1)
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("%p\n"),
+                         ACE_TEXT ("Reader::open")),
+                        1);
+
+  if (ACE_Thread_Manager::instance ()->spawn_n (n_threads,
+                                                event_loop,
+                                                &reactor) == -1)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("%p\n"),
+                       ACE_TEXT ("spawn_n")),
+                      1);
+
+  // Let all the threads block in the reactor before scheduling a
+  // timer; none of them has a timeout to wake up with.
+  ACE_OS::sleep (ACE_Time_Value (0, 500000));
+  Timer timer;
+  ACE_Time_Value const delay (0, 200000);
+  ACE_Time_Value const scheduled = ACE_OS::gettimeofday ();
+  if (reactor.schedule_timer (&timer, 0, delay) == -1)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("%p\n"),
+                       ACE_TEXT ("schedule_timer")),
+                      1);
+
+  for (int b = 0; b < n_bytes; ++b)
+    for (int i = 0; i < n_handlers; ++i)
+      readers[i].send ();
+
+  for (int n = 0; n < n_notifies; ++n)
+    reactor.notify (&readers[n % n_handlers]);
+
+  if (!wait_for (total_reads, n_handlers * n_bytes))
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("Expected %d reads, got %d\n"),
+                  n_handlers * n_bytes,
+                  total_reads.value ()));
+      status = 1;
+    }
+
+  if (!wait_for (total_notifies, n_notifies))
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("Expected %d notifications, got %d\n"),
+                  n_notifies,
+                  total_notifies.value ()));
+      status = 1;
+    }
+
+  if (concurrent_upcalls.value () != 0)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("%d upcalls overlapped another upcall on ")
+                  ACE_TEXT ("the same handler\n"),
+                  concurrent_upcalls.value ()));
+      status = 1;
+    }
+
+  if (!wait_for (timer.fired_, 1))
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("The timer did not fire\n")));
+      status = 1;
+    }
+  else if (timer.fired_at_ - scheduled > delay + ACE_Time_Value (1))
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("The timer fired %d msec late\n"),
+                  (timer.fired_at_ - scheduled - delay).msec ()));
+      status = 1;
+    }
+
+  // All the threads are blocked in the reactor again, ending the event
+  // loop has to release every one of them.
+  reactor.end_reactor_event_loop ();
+  ACE_Thread_Manager::instance ()->wait ();
+
+  for (int i = 0; i < n_handlers; ++i)
+    readers[i].close ();
+
+  ACE_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("%d threads dispatched %d reads and %d ")
+              ACE_TEXT ("notifications\n"),
+              n_threads,
+              total_reads.value (),
+              total_notifies.value ()));
+
+  ACE_END_TEST;
+
+  return status;
+}
+
+#else
+
+int
+run_main (int, ACE_TCHAR *[])
+{
+  ACE_START_TEST (ACE_TEXT ("Dev_Poll_Reactor_Leaderless_Test"));
+  ACE_ERROR ((LM_INFO,
+              ACE_TEXT ("The leaderless Dev_Poll_Reactor needs epoll ")
+              ACE_TEXT ("and threads\n")));
+  ACE_END_TEST;
+  return 0;
+}
+
+#endif  /* ACE_HAS_EVENT_POLL && ACE_HAS_THREADS */
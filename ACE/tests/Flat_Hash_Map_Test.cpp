@@ -0,0 +1,348 @@
+//=============================================================================
+/**
+ *  @file    Flat_Hash_Map_Test.cpp
+ *
+ *  This test checks that ACE_Flat_Hash_Map_Ex behaves like
+ *  ACE_Hash_Map_Manager_Ex: binding, rebinding, finding and unbinding
+ *  keys while the table grows and fills up with deleted slots, and
+ *  iterating over it, also while unbinding entries.  It then times
+ *  both maps on the same operations.
+ */
+//=============================================================================
+
+#include "test_config.h"
+#include "ace/Flat_Hash_Map_T.h"
+#include "ace/Hash_Map_Manager_T.h"
+#include "ace/Functor_T.h"
+#include "ace/Null_Mutex.h"
+#include "ace/Synch_Traits.h"
+#include "ace/RW_Thread_Mutex.h"
+#include "ace/SString.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/OS_NS_stdio.h"
+
+typedef ACE_Flat_Hash_Map_Ex<u_long,
+                             u_long,
+                             ACE_Hash<u_long>,
+                             ACE_Equal_To<u_long>,
+                             ACE_Null_Mutex> FLAT_MAP;
+
+typedef ACE_Hash_Map_Manager_Ex<u_long,
+                                u_long,
+                                ACE_Hash<u_long>,
+                                ACE_Equal_To<u_long>,
+                                ACE_Null_Mutex> HASH_MAP;
+
+// All the keys have the same hash, every lookup has to go through
+// all the groups holding a key.
+class Colliding_Hash
+{
+public:
+  u_long operator () (const ACE_CString &) const { return 42; }
+};
+
+typedef ACE_Flat_Hash_Map_Ex<ACE_CString,
+                             int,
+                             Colliding_Hash,
+                             ACE_Equal_To<ACE_CString>,
+                             ACE_SYNCH_RW_MUTEX> COLLIDING_MAP;
+
+static const u_long N = 20000;
+
+static int
+test_bind_find_unbind (void)
+{
+  // Start small so that the table has to grow several times.
+  FLAT_MAP map (16);
+  int status = 0;
+
+  for (u_long i = 0; i < N; ++i)
+    if (map.bind (i, i * 3) != 0)
+      {
+        ACE_ERROR ((LM_ERROR, ACE_TEXT ("bind %u failed\n"), i));
+        return 1;
+      }
+
+  if (map.current_size () != N || map.total_size () < N)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("size %u, total size %u after %u binds\n"),
+                  map.current_size (), map.total_size (), N));
+      status = 1;
+    }
+
+  u_long value = 0;
+  if (map.bind (7, 0) != 1 || map.find (7, value) != 0 || value != 21)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("bind of an existing key changed it\n")));
+      status = 1;
+    }
+
+  value = 99;
+  if (map.trybind (8, value) != 1 || value != 24)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("trybind did not return the old value\n")));
+      status = 1;
+    }
+
+  u_long old_value = 0;
+  if (map.rebind (8, 80, old_value) != 1 || old_value != 24
+      || map.find (8, value) != 0 || value != 80)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("rebind failed\n")));
+      status = 1;
+    }
+
+  FLAT_MAP::ENTRY *entry = 0;
+  if (map.rebind (N, N * 3, entry) != 0 || entry == 0 || entry->item () != N * 3)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("rebind of a new key failed\n")));
+      status = 1;
+    }
+  map.unbind (N);
+  map.rebind (8, 24);
+
+  // Unbind the odd keys, they must not be found anymore while the
+  // even ones are.
+  for (u_long i = 1; i < N; i += 2)
+    if (map.unbind (i, value) != 0 || value != i * 3)
+      {
+        ACE_ERROR ((LM_ERROR, ACE_TEXT ("unbind %u failed\n"), i));
+        return 1;
+      }
+
+  if (map.unbind (1) != -1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("unbind of a missing key succeeded\n")));
+      status = 1;
+    }
+
+  for (u_long i = 0; i < N; ++i)
+    {
+      int const expected = (i % 2 == 0) ? 0 : -1;
+      if (map.find (i) != expected)
+        {
+          ACE_ERROR ((LM_ERROR, ACE_TEXT ("find %u returned %d\n"),
+                      i, map.find (i)));
+          return 1;
+        }
+    }
+
+  // Bind and unbind other keys many times, the deleted slots have to
+  // be reclaimed without the table growing.
+  size_t const total = map.total_size ();
+  for (int round = 0; round < 20; ++round)
+    {
+      for (u_long i = N; i < N + N / 4; ++i)
+        map.bind (i + round * N, i);
+      for (u_long i = N; i < N + N / 4; ++i)
+        map.unbind (i + round * N);
+    }
+
+  if (map.total_size () != total || map.current_size () != N / 2)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("total size %u instead of %u, size %u instead of %u\n"),
+                  map.total_size (), total, map.current_size (), N / 2));
+      status = 1;
+    }
+
+  for (u_long i = 0; i < N; i += 2)
+    if (map.find (i, value) != 0 || value != i * 3)
+      {
+        ACE_ERROR ((LM_ERROR, ACE_TEXT ("key %u lost\n"), i));
+        return 1;
+      }
+
+  map.unbind_all ();
+  if (map.current_size () != 0 || map.find (0) != -1 || map.begin () != map.end ())
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("unbind_all left entries\n")));
+      status = 1;
+    }
+
+  return status;
+}
+
+static int
+test_iteration (void)
+{
+  FLAT_MAP map;
+  int status = 0;
+
+  u_long sum = 0;
+  for (u_long i = 0; i < 1000; ++i)
+    {
+      map.bind (i, i);
+      sum += i;
+    }
+
+  u_long forward = 0;
+  size_t count = 0;
+  for (FLAT_MAP::iterator iter = map.begin (); iter != map.end (); ++iter, ++count)
+    forward += (*iter).int_id_;
+
+  const FLAT_MAP &const_map = map;
+  u_long const_forward = 0;
+  for (FLAT_MAP::const_iterator iter = const_map.begin ();
+       iter != const_map.end ();
+       iter++)
+    const_forward += iter->item ();
+
+  u_long reverse = 0;
+  FLAT_MAP::ENTRY *entry = 0;
+  for (FLAT_MAP::REVERSE_ITERATOR iter (map); iter.next (entry) != 0; iter.advance ())
+    reverse += entry->int_id_;
+
+  if (count != 1000 || forward != sum || const_forward != sum || reverse != sum)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("iterated over %u entries, sums %u %u %u instead of %u\n"),
+                  count, forward, const_forward, reverse, sum));
+      status = 1;
+    }
+
+  // Walking backward from the end visits the same entries.
+  u_long backward = 0;
+  FLAT_MAP::iterator iter = map.end ();
+  while (iter != map.begin ())
+    {
+      --iter;
+      backward += iter->int_id_;
+    }
+  if (backward != sum)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("backward sum %u instead of %u\n"),
+                  backward, sum));
+      status = 1;
+    }
+
+  // Unbinding doesn't move entries, the iteration carries on.
+  for (FLAT_MAP::iterator i = map.begin (); i != map.end (); )
+    {
+      FLAT_MAP::ENTRY &e = *i;
+      ++i;
+      if (e.int_id_ % 3 != 0)
+        map.unbind (&e);
+    }
+
+  count = 0;
+  for (FLAT_MAP::iterator i = map.begin (); !i.done (); i.advance ())
+    {
+      if (i->int_id_ % 3 != 0)
+        status = 1;
+      ++count;
+    }
+
+  if (count != 334 || map.current_size () != 334)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("%u entries left instead of 334\n"),
+                  count));
+      status = 1;
+    }
+
+  return status;
+}
+
+static int
+test_collisions (void)
+{
+  COLLIDING_MAP map (8);
+  int status = 0;
+  const int n = 500;
+
+  ACE_TCHAR name[32];
+  for (int i = 0; i < n; ++i)
+    {
+      ACE_OS::sprintf (name, ACE_TEXT ("key-%d"), i);
+      if (map.bind (ACE_CString (ACE_TEXT_ALWAYS_CHAR (name)), i) != 0)
+        status = 1;
+    }
+
+  for (int i = 0; i < n; i += 2)
+    {
+      ACE_OS::sprintf (name, ACE_TEXT ("key-%d"), i);
+      if (map.unbind (ACE_CString (ACE_TEXT_ALWAYS_CHAR (name))) != 0)
+        status = 1;
+    }
+
+  for (int i = 0; i < n; ++i)
+    {
+      ACE_OS::sprintf (name, ACE_TEXT ("key-%d"), i);
+      int value = -1;
+      int const result = map.find (ACE_CString (ACE_TEXT_ALWAYS_CHAR (name)), value);
+      if ((i % 2 == 0 && result != -1) || (i % 2 == 1 && (result != 0 || value != i)))
+        status = 1;
+    }
+
+  if (status != 0 || map.current_size () != n / 2)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("colliding keys were mixed up\n")));
+      status = 1;
+    }
+
+  return status;
+}
+
+template <class MAP>
+static void
+time_map (const ACE_TCHAR *name)
+{
+  MAP map;
+  ACE_High_Res_Timer timer;
+  ACE_hrtime_t bind_ns, find_ns, miss_ns, unbind_ns;
+  u_long value = 0;
+  u_long found = 0;
+
+  timer.start ();
+  for (u_long i = 0; i < N; ++i)
+    map.bind (i * 7919, i);
+  timer.stop ();
+  timer.elapsed_time (bind_ns);
+
+  timer.start ();
+  for (int round = 0; round < 10; ++round)
+    for (u_long i = 0; i < N; ++i)
+      found += (map.find (i * 7919, value) == 0);
+  timer.stop ();
+  timer.elapsed_time (find_ns);
+
+  timer.start ();
+  for (u_long i = 0; i < N; ++i)
+    found += (map.find (i * 7919 + 1, value) == 0);
+  timer.stop ();
+  timer.elapsed_time (miss_ns);
+
+  timer.start ();
+  for (u_long i = 0; i < N; ++i)
+    map.unbind (i * 7919);
+  timer.stop ();
+  timer.elapsed_time (unbind_ns);
+
+  ACE_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("%s: ns per bind %Q, find %Q, failed find %Q, ")
+              ACE_TEXT ("unbind %Q (%u found)\n"),
+              name,
+              bind_ns / N,
+              find_ns / (10 * N),
+              miss_ns / N,
+              unbind_ns / N,
+              found));
+}
+
+int
+run_main (int, ACE_TCHAR *[])
+{
+  ACE_START_TEST (ACE_TEXT ("Flat_Hash_Map_Test"));
+
+  int status = test_bind_find_unbind ();
+  status += test_iteration ();
+  status += test_collisions ();
+
+  time_map<HASH_MAP> (ACE_TEXT ("ACE_Hash_Map_Manager_Ex"));
+  time_map<FLAT_MAP> (ACE_TEXT ("ACE_Flat_Hash_Map_Ex"));
+
+  ACE_END_TEST;
+  return status;
+}
@@ -0,0 +1,351 @@
+
+//=============================================================================
+/**
+ *  @file    Future_Continuation_Test.cpp
+ *
+ *    This test checks the continuations of ACE_Future (then(),
+ *    when_all() and when_any()) and the ACE_Work_Stealing_Executor
+ *    that runs them, including requests that queue more requests
+ *    from a worker thread.
+ */
+//=============================================================================
+
+
+#include "test_config.h"
+#include "ace/Future.h"
+#include "ace/Work_Stealing_Executor.h"
+#include "ace/Atomic_Op.h"
+#include "ace/OS_NS_unistd.h"
+
+#if defined (ACE_HAS_THREADS)
+
+typedef ACE_Atomic_Op<ACE_Thread_Mutex, long> Counter;
+
+/**
+ * Sets a future, after a short sleep so that it is set from a worker
+ * while the main thread is waiting.
+ */
+class Setter : public ACE_Method_Request
+{
+public:
+  Setter (const ACE_Future<int> &future, int value, int delay_ms)
+    : future_ (future), value_ (value), delay_ms_ (delay_ms)
+  {
+  }
+
+  virtual int call (void)
+  {
+    if (this->delay_ms_ != 0)
+      ACE_OS::sleep (ACE_Time_Value (0, this->delay_ms_ * 1000));
+    return this->future_.set (this->value_);
+  }
+
+private:
+  ACE_Future<int> future_;
+  int value_;
+  int delay_ms_;
+};
+
+/**
+ * Splits itself in two until @a depth reaches 0, so most requests are
+ * queued by the workers themselves.
+ */
+class Splitter : public ACE_Method_Request
+{
+public:
+  Splitter (ACE_Executor &executor, Counter &leaves, int depth)
+    : executor_ (executor), leaves_ (leaves), depth_ (depth)
+  {
+  }
+
+  virtual int call (void)
+  {
+    if (this->depth_ == 0)
+      {
+        ++this->leaves_;
+        return 0;
+      }
+
+    for (int i = 0; i != 2; ++i)
+      {
+        Splitter *child = 0;
+        ACE_NEW_RETURN (child,
+                        Splitter (this->executor_,
+                                  this->leaves_,
+                                  this->depth_ - 1),
+                        -1);
+        if (this->executor_.execute (child) == -1)
+          {
+            delete child;
+            return -1;
+          }
+      }
+    return 0;
+  }
+
+private:
+  ACE_Executor &executor_;
+  Counter &leaves_;
+  int depth_;
+};
+
+static int
+test_executor (void)
+{
+  int errors = 0;
+  Counter leaves (0);
+  int const depth = 12;
+
+  {
+    ACE_Work_Stealing_Executor executor;
+    if (executor.start (4) == -1)
+      ACE_ERROR_RETURN ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("start")), 1);
+
+    if (executor.start (4) != -1)
+      {
+        ACE_ERROR ((LM_ERROR, ACE_TEXT ("executor started twice\n")));
+        ++errors;
+      }
+
+    Splitter *root = 0;
+    ACE_NEW_RETURN (root, Splitter (executor, leaves, depth), 1);
+    executor.execute (root);
+
+    size_t const workers = executor.size ();
+
+    // Every request queued before shutdown() must have run.
+    executor.shutdown ();
+
+    ACE_DEBUG ((LM_DEBUG,
+                ACE_TEXT ("%d workers, %d requests stolen\n"),
+                workers,
+                executor.steals ()));
+
+    Setter late (ACE_Future<int> (), 0, 0);
+    if (executor.execute (&late) != -1)
+      {
+        ACE_ERROR ((LM_ERROR, ACE_TEXT ("shut down executor accepted a request\n")));
+        ++errors;
+      }
+  }
+
+  if (leaves.value () != (1L << depth))
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("%d leaves ran instead of %d\n"),
+                  leaves.value (),
+                  1L << depth));
+      ++errors;
+    }
+  return errors;
+}
+
+static int
+test_when (ACE_Executor &executor)
+{
+  int errors = 0;
+  size_t const n = 4;
+  ACE_Future<int> futures[n];
+
+  ACE_Future<size_t> all = ACE_Future<int>::when_all (futures, n);
+  ACE_Future<size_t> any = ACE_Future<int>::when_any (futures, n);
+
+  if (all.ready () || any.ready ())
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("when_all/when_any ready too early\n")));
+      ++errors;
+    }
+
+  // Future 2 is set first, the others much later.
+  for (size_t i = 0; i != n; ++i)
+    {
+      Setter *setter = 0;
+      ACE_NEW_RETURN (setter,
+                      Setter (futures[i],
+                              static_cast<int> (i),
+                              i == 2 ? 0 : 50),
+                      1);
+      executor.execute (setter);
+    }
+
+  size_t first = n;
+  size_t count = 0;
+  if (any.get (first) == -1 || first != 2)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("when_any gave %d, expected 2\n"), first));
+      ++errors;
+    }
+  if (all.get (count) == -1 || count != n)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("when_all gave %d\n"), count));
+      ++errors;
+    }
+  for (size_t i = 0; i != n; ++i)
+    if (!futures[i].ready ())
+      {
+        ACE_ERROR ((LM_ERROR, ACE_TEXT ("when_all ready before future %d\n"), i));
+        ++errors;
+      }
+
+  ACE_Future<size_t> none = ACE_Future<int>::when_all (futures, 0);
+  if (none.get (count) == -1 || count != 0)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("when_all of nothing not ready\n")));
+      ++errors;
+    }
+
+  // A future destroyed without a value counts as set for when_all(),
+  // but not for when_any().
+  ACE_Future<int> *abandoned = 0;
+  ACE_NEW_RETURN (abandoned, ACE_Future<int>[2], 1);
+  all = ACE_Future<int>::when_all (abandoned, 2);
+  any = ACE_Future<int>::when_any (abandoned, 2);
+  abandoned[0].cancel ();
+  if (all.ready () || any.ready ())
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("abandoned future counted too early\n")));
+      ++errors;
+    }
+  delete [] abandoned;
+  if (!all.ready () || all.get (count) == -1 || count != 2)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("when_all of abandoned futures not ready\n")));
+      ++errors;
+    }
+  if (any.ready ())
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("when_any of abandoned futures ready\n")));
+      ++errors;
+    }
+  return errors;
+}
+
+#if defined (ACE_HAS_CPP11)
+/// Counts its live copies, to check that continuations are deleted.
+class Probe
+{
+public:
+  explicit Probe (Counter &live) : live_ (live) { ++this->live_; }
+  Probe (const Probe &rhs) : live_ (rhs.live_) { ++this->live_; }
+  ~Probe (void) { --this->live_; }
+
+  int operator() (int v) const { return v; }
+
+private:
+  Counter &live_;
+};
+
+static int
+test_then (ACE_Executor &executor)
+{
+  int errors = 0;
+
+  // Inline continuation, run by set().
+  ACE_Future<int> source;
+  ACE_Future<int> doubled = source.then ([] (int v) { return 2 * v; });
+  if (doubled.ready ())
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("continuation ran before set\n")));
+      ++errors;
+    }
+  source.set (21);
+  int value = 0;
+  if (!doubled.ready () || doubled.get (value) == -1 || value != 42)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("inline continuation gave %d\n"), value));
+      ++errors;
+    }
+
+  // Chained to a future that is already set: runs right away.
+  ACE_Future<double> half = doubled.then ([] (int v) { return v / 4.0; });
+  double d = 0;
+  if (!half.ready () || half.get (d) == -1 || d != 10.5)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("continuation of a set future failed\n")));
+      ++errors;
+    }
+
+  // A pipeline run by the executor, started by a worker.
+  ACE_Future<int> start;
+  ACE_Future<long> end =
+    start.then ([] (int v) { return v + 1; }, &executor)
+         .then ([] (int v) { return long (v) * 1000; }, &executor)
+         .then ([] (long v) { return v - 1; }, &executor);
+
+  Setter *setter = 0;
+  ACE_NEW_RETURN (setter, Setter (start, 6, 10), 1);
+  executor.execute (setter);
+
+  long l = 0;
+  ACE_Time_Value timeout (ACE_OS::gettimeofday () + ACE_Time_Value (10));
+  if (end.get (l, &timeout) == -1 || l != 6999)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("pipeline gave %d\n"), l));
+      ++errors;
+    }
+
+  // Many continuations of the same future.
+  Counter calls (0);
+  ACE_Future<int> shared;
+  ACE_Future<int> results[64];
+  for (size_t i = 0; i != 64; ++i)
+    results[i] = shared.then ([&calls] (int v) { ++calls; return v; },
+                              &executor);
+  shared.set (7);
+  size_t count = 0;
+  ACE_Future<int>::when_all (results, 64).get (count);
+  if (count != 64 || calls.value () != 64)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("%d of 64 continuations ran\n"),
+                  calls.value ()));
+      ++errors;
+    }
+
+  // The continuation of a future destroyed without a value is deleted.
+  Counter live (0);
+  {
+    ACE_Future<int> never;
+    ACE_Future<int> unused = never.then (Probe (live));
+  }
+  if (live.value () != 0)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("%d continuations of an abandoned future left\n"),
+                  live.value ()));
+      ++errors;
+    }
+  return errors;
+}
+#endif /* ACE_HAS_CPP11 */
+
+#endif /* ACE_HAS_THREADS */
+
+int
+run_main (int, ACE_TCHAR *[])
+{
+  ACE_START_TEST (ACE_TEXT ("Future_Continuation_Test"));
+
+  int status = 0;
+
+#if defined (ACE_HAS_THREADS)
+  status += test_executor ();
+
+  ACE_Work_Stealing_Executor executor;
+  if (executor.start (3) == -1)
+    ACE_ERROR_RETURN ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("start")), 1);
+
+  status += test_when (executor);
+#if defined (ACE_HAS_CPP11)
+  status += test_then (executor);
+#endif /* ACE_HAS_CPP11 */
+
+  executor.shutdown ();
+#else
+  ACE_ERROR ((LM_INFO,
+              ACE_TEXT ("threads not supported on this platform\n")));
+#endif /* ACE_HAS_THREADS */
+
+  ACE_END_TEST;
+  return status;
+}
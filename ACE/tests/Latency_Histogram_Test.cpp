@@ -0,0 +1,176 @@
+
+//=============================================================================
+/**
+ *  @file    Latency_Histogram_Test.cpp
+ *
+ *    This test checks that ACE_Latency_Histogram reports percentiles
+ *    within its precision, and that histograms merged directly, with
+ *    different precisions or through CDR give the same results.
+ */
+//=============================================================================
+
+
+#include "test_config.h"
+#include "ace/Latency_Histogram.h"
+#include "ace/CDR_Stream.h"
+
+static int
+check_percentile (const ACE_Latency_Histogram &histogram,
+                  double percent,
+                  ACE_UINT64 exact)
+{
+  ACE_UINT64 const value = histogram.percentile (percent);
+
+  // Never below the exact value, and within the bucket width above.
+  ACE_UINT64 const tolerance =
+    exact >> (histogram.precision_bits () - 1);
+  if (value < exact || value > exact + tolerance)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("%d bits: p%f is %Q, expected %Q (+%Q)\n"),
+                  histogram.precision_bits (),
+                  percent,
+                  value,
+                  exact,
+                  tolerance));
+      return 1;
+    }
+  return 0;
+}
+
+static int
+check_same (const ACE_Latency_Histogram &lhs,
+            const ACE_Latency_Histogram &rhs,
+            const ACE_TCHAR *what)
+{
+  static double const percents[] = { 0.0, 1.0, 50.0, 90.0, 99.0, 99.9, 100.0 };
+
+  int errors = 0;
+  if (lhs.samples_count () != rhs.samples_count ()
+      || lhs.min_value () != rhs.min_value ()
+      || lhs.max_value () != rhs.max_value ()
+      || lhs.mean () != rhs.mean ())
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("%s: summaries differ\n"), what));
+      ++errors;
+    }
+
+  for (size_t i = 0; i != sizeof percents / sizeof percents[0]; ++i)
+    if (lhs.percentile (percents[i]) != rhs.percentile (percents[i]))
+      {
+        ACE_ERROR ((LM_ERROR,
+                    ACE_TEXT ("%s: p%f differ, %Q and %Q\n"),
+                    what,
+                    percents[i],
+                    lhs.percentile (percents[i]),
+                    rhs.percentile (percents[i])));
+        ++errors;
+      }
+  return errors;
+}
+
+int
+run_main (int, ACE_TCHAR *[])
+{
+  ACE_START_TEST (ACE_TEXT ("Latency_Histogram_Test"));
+
+  int errors = 0;
+  ACE_UINT64 const n = 1000000;
+
+  // Small values have a bucket each.
+  ACE_Latency_Histogram small;
+  for (ACE_UINT64 i = 0; i != 200; ++i)
+    small.sample (i);
+  errors += check_percentile (small, 50.0, 99);
+  if (small.percentile (50.0) != 99 || small.percentile (100.0) != 199)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("small values are not exact\n")));
+      ++errors;
+    }
+
+  // 1..n, recorded by two "threads" and merged.
+  ACE_Latency_Histogram all;
+  ACE_Latency_Histogram even;
+  ACE_Latency_Histogram odd;
+  ACE_Latency_Histogram fine (12);
+  for (ACE_UINT64 i = 1; i <= n; ++i)
+    {
+      all.sample (i);
+      fine.sample (i);
+      if (i % 2 == 0)
+        even.sample (i);
+      else
+        odd.sample (i);
+    }
+
+  errors += check_percentile (all, 50.0, n / 2);
+  errors += check_percentile (all, 90.0, n / 10 * 9);
+  errors += check_percentile (all, 99.0, n / 100 * 99);
+  errors += check_percentile (all, 99.999, n - 10);
+  errors += check_percentile (fine, 99.9, n - 1000);
+  if (all.min_value () != 1 || all.max_value () != n
+      || all.mean () != (n + 1) / 2 || all.percentile (100.0) != n)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("wrong min/mean/max\n")));
+      ++errors;
+    }
+
+  ACE_Latency_Histogram merged;
+  merged.accumulate (even);
+  merged.accumulate (odd);
+  errors += check_same (all, merged, ACE_TEXT ("merged"));
+
+  // A finer histogram folds into the same buckets.
+  ACE_Latency_Histogram folded;
+  folded.accumulate (fine);
+  errors += check_same (all, folded, ACE_TEXT ("folded"));
+
+  ACE_Latency_Histogram copy (all);
+  errors += check_same (all, copy, ACE_TEXT ("copy"));
+
+  // Through CDR, as when merging the results of several processes.
+  ACE_OutputCDR out;
+  if (even.encode (out) == -1 || odd.encode (out) == -1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("encode failed\n")));
+      ++errors;
+    }
+  ACE_InputCDR in (out);
+  ACE_Latency_Histogram decoded;
+  if (decoded.accumulate (in) == -1 || decoded.accumulate (in) == -1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("decode failed\n")));
+      ++errors;
+    }
+  errors += check_same (all, decoded, ACE_TEXT ("decoded"));
+
+  ACE_InputCDR empty (out);
+  empty.skip_bytes (out.total_length ());
+  if (decoded.accumulate (empty) != -1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("decoded a truncated histogram\n")));
+      ++errors;
+    }
+
+  // The whole 64 bit range fits.
+  ACE_Latency_Histogram wide;
+  wide.sample (ACE_UINT64_MAX);
+  wide.sample (0);
+  if (wide.percentile (100.0) != ACE_UINT64_MAX || wide.percentile (50.0) != 0)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("extreme values not kept\n")));
+      ++errors;
+    }
+
+  all.reset ();
+  if (all.samples_count () != 0 || all.percentile (50.0) != 0)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("reset did not empty the histogram\n")));
+      ++errors;
+    }
+
+  merged.dump_results (ACE_TEXT ("1..1000000"), 1);
+
+  ACE_END_TEST;
+  return errors;
+}
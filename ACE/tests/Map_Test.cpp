@@ -36,6 +36,9 @@ typedef ACE_Map_Manager_Adapter<KEY, VALUE, Key_Generator> MAP_MANAGER_ADAPTER;
 // Hash Manager Manager adapter.
 typedef ACE_Hash_Map_Manager_Ex_Adapter<KEY, VALUE, Hash_Key, ACE_Equal_To<KEY>, Key_Generator> HASH_MAP_MANAGER_ADAPTER;
 
+// Flat Hash Map adapter.
+typedef ACE_Flat_Hash_Map_Ex_Adapter<KEY, VALUE, Hash_Key, ACE_Equal_To<KEY>, Key_Generator> FLAT_HASH_MAP_ADAPTER;
+
 // Active Manager Manager adapter.
 typedef ACE_Active_Map_Manager_Adapter<KEY, VALUE, Key_Adapter> ACTIVE_MAP_MANAGER_ADAPTER;
 
@@ -276,6 +279,7 @@ run_main (int argc, ACE_TCHAR *argv[])
   MAP_MANAGER_ADAPTER map1 (table_size);
   HASH_MAP_MANAGER_ADAPTER map2 (table_size);
   ACTIVE_MAP_MANAGER_ADAPTER map3 (table_size);
+  FLAT_HASH_MAP_ADAPTER map4 (table_size);
 
   if (functionality_tests)
     {
@@ -289,6 +293,9 @@ run_main (int argc, ACE_TCHAR *argv[])
       ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("\nActive Map Manager functionality test\n")));
       functionality_test (map3, iterations);
 
+      ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("\nFlat Hash Map functionality test\n")));
+      functionality_test (map4, iterations);
+
       ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("\n")));
     }
 
@@ -359,6 +366,28 @@ run_main (int argc, ACE_TCHAR *argv[])
                     table_size,
                     ACE_TEXT ("Active Map Manager (unbind test)"));
 
+  ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("\n")));
+
+  // Flat Hash Map
+  performance_test (&insert_test,
+                    map4,
+                    iterations,
+                    keys,
+                    table_size,
+                    ACE_TEXT ("Flat Hash Map (insert test)"));
+  performance_test (&find_test,
+                    map4,
+                    iterations,
+                    keys,
+                    table_size,
+                    ACE_TEXT ("Flat Hash Map (find test)"));
+  performance_test (&unbind_test,
+                    map4,
+                    iterations,
+                    keys,
+                    table_size,
+                    ACE_TEXT ("Flat Hash Map (unbind test)"));
+
   delete[] keys;
 
   ACE_LOG_MSG->set_flags (ACE_Log_Msg::VERBOSE_LITE);
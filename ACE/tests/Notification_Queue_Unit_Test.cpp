@@ -1,13 +1,18 @@
 /**
  * @file Notification_Queue_Unit_Test.cpp
  *
- * A unit test for the ACE_Notification_Queue class.
+ * A unit test for the ACE_Notification_Queue and
+ * ACE_MPSC_Notification_Queue classes.
  *
  * @author Carlos O'Ryan <coryan@atdesk.com>
  */
 
 #include "test_config.h"
 #include "ace/Notification_Queue.h"
+#include "ace/Atomic_Op.h"
+#include "ace/OS_NS_sys_time.h"
+#include "ace/OS_NS_Thread.h"
+#include "ace/Thread_Manager.h"
 
 #define TEST_LIST \
   ACTION(null_test) \
@@ -18,9 +23,11 @@
   ACTION(purge_with_multiple_matches) \
   ACTION(reset_empty_queue) \
   ACTION(reset_non_empty_queue) \
+  ACTION(concurrent_producers) \
 
 // Declare all the tests
-#define ACTION(TEST_NAME) void TEST_NAME (char const * test_name);
+#define ACTION(TEST_NAME) \
+  template<typename QUEUE> void TEST_NAME (char const * test_name);
 TEST_LIST
 #undef ACTION
 
@@ -29,11 +36,19 @@ run_main (int, ACE_TCHAR *[])
 {
   ACE_START_TEST (ACE_TEXT ("Notification_Queue_Unit_Test"));
 
-  // Call all the tests
-#define ACTION(TEST_NAME) TEST_NAME (#TEST_NAME);
+  // Call all the tests, for each queue implementation
+#define ACTION(TEST_NAME) \
+  TEST_NAME<ACE_Notification_Queue> (#TEST_NAME);
 TEST_LIST
 #undef ACTION
 
+#if defined (ACE_HAS_MPSC_NOTIFICATION_QUEUE)
+#define ACTION(TEST_NAME) \
+  TEST_NAME<ACE_MPSC_Notification_Queue> ("mpsc " #TEST_NAME);
+TEST_LIST
+#undef ACTION
+#endif /* ACE_HAS_MPSC_NOTIFICATION_QUEUE */
+
   ACE_END_TEST;
 
   return 0;
@@ -62,9 +77,10 @@ void test_assert(bool predicate, char const * predicate_msg,
 #define TEST_ASSERT(PREDICATE, MESSAGE) \
   test_assert((PREDICATE), #PREDICATE, MESSAGE, test_name, __FILE__, __LINE__)
 
+template<typename QUEUE>
 void null_test(char const * test_name)
 {
-  ACE_Notification_Queue queue;
+  QUEUE queue;
 
   TEST_EQUAL(0, 0, "Test framework failure");
   TEST_NOT_EQUAL(1, 0, "Test framework failure");
@@ -83,9 +99,10 @@ public:
   int id;
 };
 
+template<typename QUEUE>
 void pop_returns_element_pushed(char const * test_name)
 {
-  ACE_Notification_Queue queue;
+  QUEUE queue;
 
   Event_Handler eh1(1);
   Event_Handler eh2(2);
@@ -142,9 +159,10 @@ void pop_returns_element_pushed(char const * test_name)
   TEST_ASSERT(!more_messages_queued, "pop[3] should not have more messages");
 }
 
+template<typename QUEUE>
 void purge_empty_queue(char const * test_name)
 {
-  ACE_Notification_Queue queue;
+  QUEUE queue;
 
   Event_Handler eh1(1);
 
@@ -153,9 +171,10 @@ void purge_empty_queue(char const * test_name)
   TEST_ASSERT(result == 0, "purge of empty queue should return 0");
 }
 
+template<typename QUEUE>
 void purge_with_no_matches(char const * test_name)
 {
-  ACE_Notification_Queue queue;
+  QUEUE queue;
 
   Event_Handler eh1(1);
   Event_Handler eh2(2);
@@ -173,9 +192,10 @@ void purge_with_no_matches(char const * test_name)
   TEST_ASSERT(result == 0, "purge of eh1/WRITE should return 0");
 }
 
+template<typename QUEUE>
 void purge_with_single_match(char const * test_name)
 {
-  ACE_Notification_Queue queue;
+  QUEUE queue;
 
   Event_Handler eh1(1);
   Event_Handler eh2(2);
@@ -209,9 +229,10 @@ void purge_with_single_match(char const * test_name)
   TEST_EQUAL(result, 0, "purge of eh1/READ should return 0");
 }
 
+template<typename QUEUE>
 void purge_with_multiple_matches(char const * test_name)
 {
-  ACE_Notification_Queue queue;
+  QUEUE queue;
 
   Event_Handler eh1(1);
   Event_Handler eh2(2);
@@ -245,16 +266,18 @@ void purge_with_multiple_matches(char const * test_name)
   TEST_EQUAL(result, 1, "purge of eh1/WRITE should return 1");
 }
 
+template<typename QUEUE>
 void reset_empty_queue(char const * /* test_name */)
 {
-  ACE_Notification_Queue queue;
+  QUEUE queue;
 
   queue.reset();
 }
 
+template<typename QUEUE>
 void reset_non_empty_queue(char const * /* test_name */)
 {
-  ACE_Notification_Queue queue;
+  QUEUE queue;
 
   Event_Handler eh1(1);
   Event_Handler eh2(2);
@@ -275,6 +298,125 @@ void reset_non_empty_queue(char const * /* test_name */)
   queue.reset();
 }
 
+#if defined (ACE_HAS_THREADS)
+namespace
+{
+  int const producer_count = 4;
+  int const notifications_per_producer = 20000;
+
+  template<typename QUEUE>
+  struct Producer
+  {
+    QUEUE * queue;
+    ACE_Event_Handler * handler;
+    ACE_Atomic_Op<ACE_SYNCH_MUTEX, long> * wakeups;
+  };
+
+  template<typename QUEUE>
+  ACE_THR_FUNC_RETURN produce(void * arg)
+  {
+    Producer<QUEUE> * producer = static_cast<Producer<QUEUE> *>(arg);
+
+    for (int i = 0; i != notifications_per_producer; ++i)
+      {
+        // The mask carries a sequence number, to check the order
+        if (producer->queue->push_new_notification(
+              ACE_Notification_Buffer(producer->handler, i)) == 1)
+          {
+            ++*producer->wakeups;
+          }
+      }
+
+    return 0;
+  }
+}
+#endif /* ACE_HAS_THREADS */
+
+template<typename QUEUE>
+void concurrent_producers(char const * test_name)
+{
+#if defined (ACE_HAS_THREADS)
+  QUEUE queue;
+
+  Event_Handler eh0(0);
+  Event_Handler eh1(1);
+  Event_Handler eh2(2);
+  Event_Handler eh3(3);
+  ACE_Event_Handler * handlers[producer_count] = { &eh0, &eh1, &eh2, &eh3 };
+
+  ACE_Atomic_Op<ACE_SYNCH_MUTEX, long> wakeups (0);
+  Producer<QUEUE> producers[producer_count];
+  int expected[producer_count];
+
+  ACE_Thread_Manager thr_mgr;
+  for (int i = 0; i != producer_count; ++i)
+    {
+      producers[i].queue = &queue;
+      producers[i].handler = handlers[i];
+      producers[i].wakeups = &wakeups;
+      expected[i] = 0;
+
+      TEST_NOT_EQUAL(thr_mgr.spawn(produce<QUEUE>, &producers[i]), -1,
+                     "Cannot spawn producer");
+    }
+
+  // Consume like a reactor does: only look at the queue after a
+  // wakeup, then pop until the queue is empty.  A lost wakeup leaves
+  // notifications behind that are never popped.
+  int const total = producer_count * notifications_per_producer;
+  int popped = 0;
+  long wakeups_seen = 0;
+  ACE_Time_Value const deadline =
+    ACE_OS::gettimeofday () + ACE_Time_Value (60);
+
+  while (popped != total)
+    {
+      if (wakeups.value () == wakeups_seen)
+        {
+          if (ACE_OS::gettimeofday () > deadline)
+            {
+              break;
+            }
+          ACE_OS::thr_yield ();
+          continue;
+        }
+      wakeups_seen = wakeups.value ();
+
+      ACE_Notification_Buffer current;
+      bool more_messages_queued;
+      ACE_Notification_Buffer next;
+      while (queue.pop_next_notification(current,
+                                         more_messages_queued,
+                                         next) == 1)
+        {
+          ++popped;
+
+          int n = 0;
+          while (n != producer_count && handlers[n] != current.eh_)
+            {
+              ++n;
+            }
+          TEST_ASSERT(n != producer_count, "Unknown handler popped");
+          if (n == producer_count)
+            {
+              continue;
+            }
+
+          TEST_EQUAL(static_cast<int> (current.mask_), expected[n],
+                     "Notifications of a producer out of order");
+          expected[n] = static_cast<int> (current.mask_) + 1;
+        }
+    }
+
+  thr_mgr.wait ();
+
+  TEST_EQUAL(popped, total, "Notifications lost");
+  TEST_ASSERT(wakeups_seen <= popped, "More wakeups than notifications");
+#else
+  ACE_UNUSED_ARG (test_name);
+#endif /* ACE_HAS_THREADS */
+}
+
 void test_equal(int x, int y, char const * x_msg, char const * y_msg,
                 char const * error_message,
                 char const * test_name, char const * filename, int lineno)
@@ -16,6 +16,7 @@
 #include "ace/OS_NS_string.h"
 #include "ace/Auto_Ptr.h"
 #include "ace/SString.h"
+#include "ace/Malloc_Allocator.h"
 
 
 
@@ -154,6 +155,206 @@ int testConstIterator()
   return 0;
 }
 
+/**
+ * Allocator that counts the calls made through it, so the tests can
+ * tell whether a string used its inline buffer or the heap.
+ */
+class Counting_Allocator : public ACE_New_Allocator
+{
+public:
+  Counting_Allocator (void) : mallocs_ (0), frees_ (0) {}
+
+  virtual void *malloc (size_t nbytes)
+  {
+    ++this->mallocs_;
+    return this->ACE_New_Allocator::malloc (nbytes);
+  }
+
+  virtual void free (void *ptr)
+  {
+    ++this->frees_;
+    this->ACE_New_Allocator::free (ptr);
+  }
+
+  size_t mallocs_;
+  size_t frees_;
+};
+
+int testInlineBuffer()
+{
+  Counting_Allocator alloc;
+  const char *lorem = "Lorem ipsum dolor sit amet, consectetur adipiscing";
+
+  {
+    ACE_CString small ("hello", &alloc);
+    ACE_CString copy (small);
+    copy += " world";
+    if (small != "hello" || copy != "hello world")
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("short string contents wrong\n")),
+                         1);
+    if (alloc.mallocs_ != 0)
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("short strings used the allocator\n")),
+                         1);
+
+    // Growing out of the inline buffer moves the string to the heap.
+    copy += lorem;
+    if (alloc.mallocs_ != 1
+        || copy.length () != 11 + ACE_OS::strlen (lorem)
+        || ACE_OS::strncmp (copy.c_str (), "hello world", 11) != 0
+        || ACE_OS::strcmp (copy.c_str () + 11, lorem) != 0)
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("growing past the inline buffer failed\n")),
+                         1);
+
+    // Swapping an inline string with a heap one.
+    small.swap (copy);
+    if (copy != "hello"
+        || small.length () != 11 + ACE_OS::strlen (lorem)
+        || small[0] != 'h')
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("swap of inline and heap strings failed\n")),
+                         1);
+    ACE_CString other ("abc", &alloc);
+    other.swap (copy);
+    if (other != "hello" || copy != "abc")
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("swap of two inline strings failed\n")),
+                         1);
+
+    // Appending a string to itself must not read a freed buffer.
+    ACE_CString self ("0123456789", &alloc);
+    self += self;
+    self += self;
+    if (self != "0123456789012345678901234567890123456789")
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("self append failed\n")),
+                         1);
+
+    self.clear (true);
+    self = "x";
+    if (self != "x" || self.capacity () == 0)
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("reuse after clear failed\n")),
+                         1);
+  }
+
+  if (alloc.mallocs_ != alloc.frees_)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("%B allocations but %B frees\n"),
+                       alloc.mallocs_,
+                       alloc.frees_),
+                       1);
+
+  return 0;
+}
+
+int testReserve()
+{
+  Counting_Allocator alloc;
+
+  {
+    ACE_CString s ("prefix:", &alloc);
+    s.reserve (1000);
+    if (s != "prefix:" || s.capacity () <= 1000 || alloc.mallocs_ != 1)
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("reserve lost contents or capacity\n")),
+                         1);
+
+    for (int i = 0; i < 99; ++i)
+      s += "0123456789";
+    if (alloc.mallocs_ != 1 || s.length () != 7 + 990)
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("append after reserve reallocated\n")),
+                         1);
+
+    // Reserving less than the capacity is a no-op.
+    const char *before = s.c_str ();
+    s.reserve (10);
+    if (s.c_str () != before)
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("shrinking reserve reallocated\n")),
+                         1);
+  }
+
+  if (alloc.mallocs_ != alloc.frees_)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("reserve leaked\n")),
+                       1);
+
+  return 0;
+}
+
+int testMove()
+{
+#if defined (ACE_HAS_CPP11)
+  Counting_Allocator alloc;
+  Counting_Allocator other_alloc;
+  const char *lorem = "Lorem ipsum dolor sit amet, consectetur adipiscing";
+
+  {
+    // Heap buffers are handed over without copying.
+    ACE_CString heap (lorem, &alloc);
+    const char *buffer = heap.c_str ();
+    ACE_CString moved (std::move (heap));
+    if (moved.c_str () != buffer || moved != lorem
+        || heap.length () != 0 || alloc.mallocs_ != 1)
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("move construction copied the buffer\n")),
+                         1);
+
+    // Inline buffers are copied, the source is still left empty.
+    ACE_CString small ("short", &alloc);
+    ACE_CString moved_small (std::move (small));
+    if (moved_small != "short" || small.length () != 0)
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("move of an inline string failed\n")),
+                         1);
+
+    ACE_CString target ("old contents", &alloc);
+    target = std::move (moved);
+    if (target.c_str () != buffer || moved.length () != 0)
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("move assignment copied the buffer\n")),
+                         1);
+
+    // Strings using different allocators must not exchange buffers.
+    ACE_CString foreign (&other_alloc);
+    foreign = std::move (target);
+    if (foreign != lorem || target.length () != 0
+        || other_alloc.mallocs_ != 1 || alloc.mallocs_ != alloc.frees_)
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("move across allocators failed\n")),
+                         1);
+
+    // Self move assignment leaves the string alone.
+    ACE_CString &alias = foreign;
+    foreign = std::move (alias);
+    if (foreign != lorem)
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("self move assignment failed\n")),
+                         1);
+
+    // Chained concatenation appends to the temporary.
+    ACE_CString a ("The quick brown fox ");
+    ACE_CString b ("over the lazy dog");
+    ACE_CString chained = a + "jumps " + b + '.';
+    if (chained != "The quick brown fox jumps over the lazy dog.")
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("chained concatenation failed\n")),
+                         1);
+  }
+
+  if (alloc.mallocs_ != alloc.frees_
+      || other_alloc.mallocs_ != other_alloc.frees_)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("moves leaked\n")),
+                       1);
+#endif /* ACE_HAS_CPP11 */
+  return 0;
+}
+
 
 int
 run_main (int, ACE_TCHAR *[])
@@ -430,6 +631,9 @@ run_main (int, ACE_TCHAR *[])
   int err = testConcatenation ();
   err += testIterator ();
   err += testConstIterator ();
+  err += testInlineBuffer ();
+  err += testReserve ();
+  err += testMove ();
 
   ACE_END_TEST;
   return err;
@@ -0,0 +1,228 @@
+
+//=============================================================================
+/**
+ *  @file    Scalable_RW_Mutex_Test.cpp
+ *
+ *    This test checks that ACE_Scalable_RW_Mutex excludes writers from
+ *    readers and from each other, whether the readers come through a
+ *    reader slot or through the underlying lock, and that the try and
+ *    upgrade operations keep the lock consistent.
+ */
+//=============================================================================
+
+
+#include "test_config.h"
+#include "ace/Thread_Manager.h"
+#include "ace/Atomic_Op.h"
+#include "ace/Guard_T.h"
+#include "ace/Lock_Adapter_T.h"
+#include "ace/Scalable_RW_Mutex.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/OS_NS_errno.h"
+
+#if defined (ACE_HAS_THREADS)
+
+static size_t const n_readers = 6;
+static size_t const n_writers = 2;
+static size_t const n_iterations = 20000;
+
+static ACE_Scalable_RW_Mutex rw_mutex;
+
+// Writers keep both values equal while holding the write lock.
+static volatile long first_value = 0;
+static volatile long second_value = 0;
+
+static ACE_Atomic_Op<ACE_Thread_Mutex, long> inconsistent_reads;
+static ACE_Atomic_Op<ACE_Thread_Mutex, long> current_writers;
+static ACE_Atomic_Op<ACE_Thread_Mutex, long> overlapping_writers;
+
+static ACE_THR_FUNC_RETURN
+reader (void *)
+{
+  for (size_t i = 0; i != n_iterations; ++i)
+    {
+      ACE_READ_GUARD_RETURN (ACE_Scalable_RW_Mutex, g, rw_mutex, 0);
+
+      long const first = first_value;
+      if (i % 64 == 0)
+        ACE_Thread::yield ();
+      if (first != second_value || current_writers.value () != 0)
+        ++inconsistent_reads;
+    }
+  return 0;
+}
+
+static ACE_THR_FUNC_RETURN
+writer (void *)
+{
+  for (size_t i = 0; i != n_iterations / 20; ++i)
+    {
+      ACE_WRITE_GUARD_RETURN (ACE_Scalable_RW_Mutex, g, rw_mutex, 0);
+
+      if (++current_writers != 1)
+        ++overlapping_writers;
+      first_value = first_value + 1;
+      ACE_Thread::yield ();
+      second_value = second_value + 1;
+      --current_writers;
+    }
+  return 0;
+}
+
+static int
+test_try_operations (void)
+{
+  int errors = 0;
+  ACE_Scalable_RW_Mutex lock;
+
+  // Readers do not exclude each other, writers exclude everybody.
+  if (lock.acquire_read () != 0 || lock.tryacquire_read () != 0)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("nested read acquisition failed\n")));
+      ++errors;
+    }
+  if (lock.tryacquire_write () != -1 || errno != EBUSY)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("tryacquire_write succeeded with readers\n")));
+      ++errors;
+    }
+  lock.release ();
+  lock.release ();
+
+  if (lock.tryacquire_write () != 0)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("tryacquire_write failed on a free lock\n")));
+      ++errors;
+    }
+  if (lock.tryacquire_read () != -1)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("tryacquire_read succeeded with a writer\n")));
+      ++errors;
+    }
+  lock.release ();
+
+  // A sole reader can become the writer.
+  lock.acquire_read ();
+  if (lock.tryacquire_write_upgrade () == 0)
+    {
+      if (lock.tryacquire_read () != -1)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      ACE_TEXT ("upgraded lock admitted a reader\n")));
+          ++errors;
+        }
+      lock.release ();
+    }
+  else
+    {
+      // The underlying lock may not support upgrades.
+      ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("%p\n"),
+                  ACE_TEXT ("tryacquire_write_upgrade")));
+      lock.release ();
+    }
+
+  if (lock.tryacquire_write () != 0)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("lock not free after the upgrade test\n")));
+      ++errors;
+    }
+  else
+    lock.release ();
+
+  // Usable through the polymorphic lock interface.
+  ACE_Lock_Adapter<ACE_Scalable_RW_Mutex> adapter;
+  if (adapter.acquire_read () != 0
+      || adapter.release () != 0
+      || adapter.acquire_write () != 0
+      || adapter.release () != 0)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("ACE_Lock_Adapter use failed\n")));
+      ++errors;
+    }
+
+  return errors;
+}
+
+template <class LOCK> static void
+time_reads (const ACE_TCHAR *name, LOCK &lock)
+{
+  size_t const iterations = 1000000;
+  ACE_High_Res_Timer timer;
+
+  timer.start ();
+  for (size_t i = 0; i != iterations; ++i)
+    {
+      lock.acquire_read ();
+      lock.release ();
+    }
+  timer.stop ();
+
+  ACE_hrtime_t nsecs;
+  timer.elapsed_time (nsecs);
+  ACE_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("%s: %Q nsecs per uncontended read\n"),
+              name,
+              nsecs / iterations));
+}
+
+#endif /* ACE_HAS_THREADS */
+
+int
+run_main (int, ACE_TCHAR *[])
+{
+  ACE_START_TEST (ACE_TEXT ("Scalable_RW_Mutex_Test"));
+
+  int status = 0;
+
+#if defined (ACE_HAS_THREADS)
+  status += test_try_operations ();
+
+  ACE_Thread_Manager *mgr = ACE_Thread_Manager::instance ();
+  if (mgr->spawn_n (n_readers,
+                    ACE_THR_FUNC (reader),
+                    0,
+                    THR_NEW_LWP | THR_DETACHED) == -1
+      || mgr->spawn_n (n_writers,
+                       ACE_THR_FUNC (writer),
+                       0,
+                       THR_NEW_LWP | THR_DETACHED) == -1)
+    ACE_ERROR_RETURN ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("spawn_n")), 1);
+
+  mgr->wait ();
+
+  if (inconsistent_reads.value () != 0 || overlapping_writers.value () != 0)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("%d inconsistent reads, %d overlapping writers\n"),
+                  inconsistent_reads.value (),
+                  overlapping_writers.value ()));
+      ++status;
+    }
+
+  long const expected = static_cast<long> (n_writers * (n_iterations / 20));
+  if (first_value != expected || second_value != expected)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("lost updates: %d/%d, expected %d\n"),
+                  first_value,
+                  second_value,
+                  expected));
+      ++status;
+    }
+
+  ACE_RW_Thread_Mutex plain;
+  ACE_Scalable_RW_Mutex scalable;
+  time_reads (ACE_TEXT ("ACE_RW_Thread_Mutex"), plain);
+  time_reads (ACE_TEXT ("ACE_Scalable_RW_Mutex"), scalable);
+#else
+  ACE_ERROR ((LM_INFO,
+              ACE_TEXT ("threads not supported on this platform\n")));
+#endif /* ACE_HAS_THREADS */
+
+  ACE_END_TEST;
+  return status;
+}
@@ -0,0 +1,406 @@
+
+//=============================================================================
+/**
+ *  @file    Slab_Malloc_Test.cpp
+ *
+ *    This test checks that ACE_Slab_Malloc hands out distinct blocks
+ *    of any size, from one thread and from several, that the buddy
+ *    allocator merges freed large blocks, and that a pool in a mapped
+ *    file keeps its named regions when mapped again, possibly at
+ *    another address, and that a process dying while it holds the
+ *    lock of a size class does not stop the others.  It also compares the time taken by ACE_Malloc
+ *    and ACE_Slab_Malloc on a fragmented heap.
+ */
+//=============================================================================
+
+
+#include "test_config.h"
+#include "ace/Slab_Malloc_T.h"
+#include "ace/Malloc_T.h"
+#include "ace/Local_Memory_Pool.h"
+#include "ace/MMAP_Memory_Pool.h"
+#include "ace/Process_Mutex.h"
+#include "ace/Null_Mutex.h"
+#include "ace/Thread_Mutex.h"
+#include "ace/Thread_Manager.h"
+#include "ace/Atomic_Op.h"
+#include "ace/Hash_Map_With_Allocator_T.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/OS_NS_string.h"
+#include "ace/OS_NS_stdlib.h"
+#include "ace/OS_NS_unistd.h"
+#include "ace/OS_NS_sys_wait.h"
+#include "ace/Lib_Find.h"
+
+typedef ACE_Slab_Malloc<ACE_LOCAL_MEMORY_POOL, ACE_Thread_Mutex> LOCAL_SLAB;
+typedef ACE_Slab_Malloc<ACE_MMAP_MEMORY_POOL, ACE_Process_Mutex> MMAP_SLAB;
+
+static size_t const n_blocks = 2000;
+
+/// Sizes from a few bytes to well over the largest size class.
+static size_t
+block_size (unsigned int &seed)
+{
+  unsigned int const r = static_cast<unsigned int> (ACE_OS::rand_r (&seed));
+  switch (r % 8)
+    {
+    case 0:
+      return 1 + r % 16;
+    case 7:
+      return 4096 + r % 40000;
+    default:
+      return 1 + r % 1000;
+    }
+}
+
+/// Allocate, fill and free blocks in random order, checking that no
+/// block overwrote another.
+template <class MALLOC> static int
+exercise (MALLOC &allocator, unsigned int seed, size_t rounds)
+{
+  int errors = 0;
+  char *blocks[n_blocks];
+  size_t sizes[n_blocks];
+  ACE_OS::memset (blocks, 0, sizeof blocks);
+
+  for (size_t i = 0; i != rounds * n_blocks; ++i)
+    {
+      size_t const slot = ACE_OS::rand_r (&seed) % n_blocks;
+      char const fill = static_cast<char> (slot);
+
+      if (blocks[slot] != 0)
+        {
+          for (size_t j = 0; j != sizes[slot]; ++j)
+            if (blocks[slot][j] != fill)
+              {
+                ++errors;
+                break;
+              }
+          allocator.free (blocks[slot]);
+          blocks[slot] = 0;
+          continue;
+        }
+
+      sizes[slot] = block_size (seed);
+      blocks[slot] = static_cast<char *> (allocator.malloc (sizes[slot]));
+      if (blocks[slot] == 0)
+        {
+          ++errors;
+          continue;
+        }
+      if (reinterpret_cast<uintptr_t> (blocks[slot]) % 16 != 0)
+        ++errors;
+      ACE_OS::memset (blocks[slot], fill, sizes[slot]);
+    }
+
+  for (size_t slot = 0; slot != n_blocks; ++slot)
+    allocator.free (blocks[slot]);
+
+  return errors;
+}
+
+static int
+test_local_pool (void)
+{
+  LOCAL_SLAB allocator;
+  int errors = exercise (allocator, 42, 10);
+
+  if (errors != 0)
+    ACE_ERROR ((LM_ERROR,
+                ACE_TEXT ("%d corrupt or misaligned blocks\n"),
+                errors));
+
+  // Freeing large blocks merges them back, so the same space serves a
+  // single block of twice the size afterwards.
+  size_t const large = 64 * 1024;
+  ssize_t const before = allocator.avail_chunks (2 * large);
+  void *first = allocator.malloc (large - 64);
+  void *second = allocator.malloc (large - 64);
+  allocator.free (first);
+  allocator.free (second);
+  if (allocator.avail_chunks (2 * large) != before)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("large blocks not merged: %d chunks, expected %d\n"),
+                  allocator.avail_chunks (2 * large),
+                  before));
+      ++errors;
+    }
+
+  void *zeroes = allocator.calloc (10, 100, '\0');
+  for (size_t i = 0; zeroes != 0 && i != 1000; ++i)
+    if (static_cast<char *> (zeroes)[i] != '\0')
+      {
+        ACE_ERROR ((LM_ERROR, ACE_TEXT ("calloc did not clear\n")));
+        ++errors;
+        break;
+      }
+  allocator.free (zeroes);
+
+  if (allocator.bind ("name", allocator.malloc (8)) != 0
+      || allocator.find ("name") != 0
+      || allocator.find ("other") != -1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("bind/find failed\n")));
+      ++errors;
+    }
+
+  allocator.remove ();
+  return errors;
+}
+
+#if defined (ACE_HAS_THREADS)
+
+static LOCAL_SLAB *shared_allocator = 0;
+static ACE_Atomic_Op<ACE_Thread_Mutex, long> thread_errors;
+static ACE_Atomic_Op<ACE_Thread_Mutex, long> thread_seed;
+
+static ACE_THR_FUNC_RETURN
+worker (void *)
+{
+  thread_errors += exercise (*shared_allocator,
+                             static_cast<unsigned int> (++thread_seed),
+                             5);
+  return 0;
+}
+
+static int
+test_threads (void)
+{
+  LOCAL_SLAB allocator;
+  shared_allocator = &allocator;
+
+  if (ACE_Thread_Manager::instance ()->spawn_n (4,
+                                                ACE_THR_FUNC (worker)) == -1)
+    ACE_ERROR_RETURN ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("spawn_n")), 1);
+  ACE_Thread_Manager::instance ()->wait ();
+
+  allocator.remove ();
+  if (thread_errors.value () != 0)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("%d corrupt blocks with threads\n"),
+                  thread_errors.value ()));
+      return 1;
+    }
+  return 0;
+}
+
+#endif /* ACE_HAS_THREADS */
+
+#if !defined (ACE_LACKS_MMAP)
+
+typedef ACE_Allocator_Adapter<MMAP_SLAB> MMAP_ALLOCATOR;
+typedef ACE_Hash_Map_With_Allocator<int, int> MAP;
+
+static int
+test_mapped_file (void)
+{
+  int errors = 0;
+  ACE_TCHAR backing_store[MAXPATHLEN + 1];
+  if (ACE::get_temp_dir (backing_store, MAXPATHLEN - 32) == -1)
+    ACE_OS::strcpy (backing_store, ACE_TEXT ("."));
+  ACE_OS::strcat (backing_store, ACE_TEXT ("Slab_Malloc_Test_store"));
+  ACE_OS::unlink (backing_store);
+
+  // Let the system choose the address, so the second mapping may
+  // differ from the first.
+  ACE_MMAP_Memory_Pool_Options options (0);
+  options.use_fixed_addr_ = ACE_MMAP_Memory_Pool_Options::NEVER_FIXED;
+
+  static char const text[] = "position independent";
+
+  {
+    MMAP_ALLOCATOR allocator (backing_store, backing_store, &options);
+
+    // The hash map itself holds plain pointers, so it is only used
+    // within this mapping.
+    void *memory = allocator.malloc (sizeof (MAP));
+    MAP *map = new (memory) MAP (64, &allocator);
+    for (int i = 0; i != 1000; ++i)
+      map->bind (i, i * i, &allocator);
+    for (int i = 0; i != 1000; ++i)
+      {
+        int value = 0;
+        if (map->find (i, value, &allocator) != 0 || value != i * i)
+          {
+            ACE_ERROR ((LM_ERROR, ACE_TEXT ("hash map entry %d lost\n"), i));
+            ++errors;
+            break;
+          }
+      }
+    map->close (&allocator);
+    allocator.free (map);
+
+    void *copy = allocator.malloc (sizeof text);
+    ACE_OS::memcpy (copy, text, sizeof text);
+    if (allocator.bind ("text", copy) != 0)
+      {
+        ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("bind")));
+        ++errors;
+      }
+    allocator.sync ();
+  }
+
+  MMAP_ALLOCATOR allocator (backing_store, backing_store, &options);
+  void *memory = 0;
+  if (allocator.find ("text", memory) != 0
+      || ACE_OS::strcmp (static_cast<char *> (memory), text) != 0)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("region lost after mapping the pool again\n")));
+      ++errors;
+    }
+
+  void *unbound = 0;
+  if (allocator.unbind ("text", unbound) != 0 || unbound != memory
+      || allocator.find ("text") != -1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("unbind failed\n")));
+      ++errors;
+    }
+
+  allocator.remove ();
+  return errors;
+}
+
+#if defined (ACE_SLAB_MALLOC_HAS_CLASS_LOCKS) && !defined (ACE_LACKS_FORK)
+
+/// A child takes the locks of every size class and exits without
+/// releasing them; the parent must still allocate small blocks, and
+/// find the free blocks it left.
+static int
+test_dead_owner (void)
+{
+  int errors = 0;
+  ACE_TCHAR backing_store[MAXPATHLEN + 1];
+  if (ACE::get_temp_dir (backing_store, MAXPATHLEN - 32) == -1)
+    ACE_OS::strcpy (backing_store, ACE_TEXT ("."));
+  ACE_OS::strcat (backing_store, ACE_TEXT ("Slab_Malloc_Test_owner"));
+  ACE_OS::unlink (backing_store);
+
+  ACE_MMAP_Memory_Pool_Options options (0);
+  options.use_fixed_addr_ = ACE_MMAP_Memory_Pool_Options::NEVER_FIXED;
+  MMAP_SLAB allocator (backing_store, backing_store, &options);
+
+  // Leave a few blocks on a free list for the repair to count.  The
+  // pool may move when it grows, so no pointer is kept across a
+  // malloc() of another class.
+  size_t const n_left = 8;
+  void *left[n_left];
+  for (size_t i = 0; i != n_left; ++i)
+    left[i] = allocator.malloc (40);
+  for (size_t i = 0; i != n_left; ++i)
+    allocator.free (left[i]);
+
+  ACE_Slab_Control_Block *cb =
+    static_cast<ACE_Slab_Control_Block *> (allocator.base_addr ());
+  pid_t const child = ACE_OS::fork (ACE_TEXT ("Slab_Malloc_Test"));
+  if (child == 0)
+    {
+      for (size_t c = 0; c != ACE_Slab_Control_Block::NUM_CLASSES; ++c)
+        cb->acquire_class (c);
+      ACE_OS::_exit (0);
+    }
+  if (child == -1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("fork")));
+      allocator.remove ();
+      return 1;
+    }
+  ACE_OS::waitpid (child, 0, 0);
+
+  // The list is used last in first out.
+  for (size_t i = n_left; i != 0; --i)
+    if (allocator.malloc (40) != left[i - 1])
+      {
+        ACE_ERROR ((LM_ERROR,
+                    ACE_TEXT ("free block %B lost after the owner died\n"),
+                    i - 1));
+        ++errors;
+        break;
+      }
+
+  for (size_t bytes = 8; bytes <= 4000; bytes += 60)
+    {
+      void *block = allocator.malloc (bytes);
+      if (block == 0)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      ACE_TEXT ("no block of %B bytes after the owner died\n"),
+                      bytes));
+          ++errors;
+        }
+      allocator.free (block);
+    }
+
+  allocator.remove ();
+  return errors;
+}
+
+#endif /* ACE_SLAB_MALLOC_HAS_CLASS_LOCKS && !ACE_LACKS_FORK */
+
+#endif /* !ACE_LACKS_MMAP */
+
+template <class MALLOC> static void
+time_fragmented (const ACE_TCHAR *name, MALLOC &allocator)
+{
+  size_t const live = 4096;
+  void *blocks[live];
+  unsigned int seed = 7;
+
+  for (size_t i = 0; i != live; ++i)
+    blocks[i] = allocator.malloc (16 + ACE_OS::rand_r (&seed) % 500);
+
+  size_t const iterations = 200000;
+  ACE_High_Res_Timer timer;
+  timer.start ();
+  for (size_t i = 0; i != iterations; ++i)
+    {
+      size_t const slot = ACE_OS::rand_r (&seed) % live;
+      allocator.free (blocks[slot]);
+      blocks[slot] = allocator.malloc (16 + ACE_OS::rand_r (&seed) % 500);
+    }
+  timer.stop ();
+
+  for (size_t i = 0; i != live; ++i)
+    allocator.free (blocks[i]);
+
+  ACE_hrtime_t nsecs;
+  timer.elapsed_time (nsecs);
+  ACE_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("%s: %Q nsecs per free and malloc\n"),
+              name,
+              nsecs / iterations));
+}
+
+int
+run_main (int, ACE_TCHAR *[])
+{
+  ACE_START_TEST (ACE_TEXT ("Slab_Malloc_Test"));
+
+  int status = test_local_pool ();
+
+#if defined (ACE_HAS_THREADS)
+  status += test_threads ();
+#endif /* ACE_HAS_THREADS */
+
+#if !defined (ACE_LACKS_MMAP)
+  status += test_mapped_file ();
+#  if defined (ACE_SLAB_MALLOC_HAS_CLASS_LOCKS) && !defined (ACE_LACKS_FORK)
+  status += test_dead_owner ();
+#  endif /* ACE_SLAB_MALLOC_HAS_CLASS_LOCKS && !ACE_LACKS_FORK */
+#endif /* !ACE_LACKS_MMAP */
+
+  {
+    ACE_Malloc<ACE_LOCAL_MEMORY_POOL, ACE_Null_Mutex> plain;
+    ACE_Slab_Malloc<ACE_LOCAL_MEMORY_POOL, ACE_Null_Mutex> slab;
+    time_fragmented (ACE_TEXT ("ACE_Malloc"), plain);
+    time_fragmented (ACE_TEXT ("ACE_Slab_Malloc"), slab);
+    plain.remove ();
+    slab.remove ();
+  }
+
+  ACE_END_TEST;
+  return status;
+}
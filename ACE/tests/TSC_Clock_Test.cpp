@@ -0,0 +1,215 @@
+
+//=============================================================================
+/**
+ *  @file    TSC_Clock_Test.cpp
+ *
+ *    This test checks that ACE_TSC_Clock never goes backwards, within a
+ *    thread or across threads, keeps in step with CLOCK_MONOTONIC and
+ *    can be used through ACE_TSC_Time_Policy.  It also reports what a
+ *    reading costs compared with ACE_OS::gethrtime().
+ */
+//=============================================================================
+
+
+#include "test_config.h"
+#include "ace/TSC_Clock.h"
+#include "ace/Time_Policy.h"
+#include "ace/Thread_Manager.h"
+#include "ace/Atomic_Op.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/OS_NS_time.h"
+#include "ace/OS_NS_unistd.h"
+
+static size_t const n_iterations = 200000;
+
+// Readings that were behind a value another thread had already seen.
+static ACE_Atomic_Op<ACE_Thread_Mutex, unsigned long> readings_behind;
+
+static int
+test_monotonic (void)
+{
+  ACE_UINT64 previous = ACE_TSC_Clock::now ();
+  for (size_t i = 0; i != n_iterations; ++i)
+    {
+      ACE_UINT64 const now = ACE_TSC_Clock::now ();
+      if (now < previous)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           ACE_TEXT ("clock went back from %Q to %Q\n"),
+                           previous,
+                           now),
+                          1);
+      previous = now;
+    }
+  return 0;
+}
+
+#if defined (ACE_HAS_THREADS)
+
+static ACE_Thread_Mutex last_lock;
+static ACE_UINT64 last_seen = 0;
+
+static ACE_THR_FUNC_RETURN
+reader (void *)
+{
+  for (size_t i = 0; i != n_iterations / 10; ++i)
+    {
+      // A reading taken after another thread published its own reading
+      // cannot be older than it.
+      ACE_GUARD_RETURN (ACE_Thread_Mutex, g, last_lock, 0);
+      ACE_UINT64 const now = ACE_TSC_Clock::now ();
+      if (now < last_seen)
+        ++readings_behind;
+      last_seen = now;
+    }
+  return 0;
+}
+
+#endif /* ACE_HAS_THREADS */
+
+static int
+test_against_monotonic (void)
+{
+  // Across a recalibration the difference must stay small.
+  int errors = 0;
+  for (int i = 0; i != 3; ++i)
+    {
+      ACE_OS::sleep (ACE_Time_Value (0, ACE_TSC_CLOCK_RECALIBRATION_MSECS * 500));
+
+      ACE_UINT64 const tsc = ACE_TSC_Clock::now ();
+#if defined (ACE_HAS_CLOCK_GETTIME) && defined (CLOCK_MONOTONIC)
+      struct timespec ts;
+      ACE_OS::clock_gettime (CLOCK_MONOTONIC, &ts);
+      ACE_UINT64 const mono =
+        static_cast<ACE_UINT64> (ts.tv_sec) * ACE_U_ONE_SECOND_IN_NSECS
+        + static_cast<ACE_UINT64> (ts.tv_nsec);
+#else
+      ACE_UINT64 const mono = tsc;
+#endif /* ACE_HAS_CLOCK_GETTIME && CLOCK_MONOTONIC */
+
+      ACE_UINT64 const diff = tsc > mono ? tsc - mono : mono - tsc;
+      ACE_DEBUG ((LM_DEBUG,
+                  ACE_TEXT ("TSC clock %Q, CLOCK_MONOTONIC %Q\n"),
+                  tsc,
+                  mono));
+      if (diff > ACE_UINT64 (10000000))
+        {
+          ACE_ERROR ((LM_ERROR,
+                      ACE_TEXT ("TSC clock %Q nsecs away from CLOCK_MONOTONIC\n"),
+                      diff));
+          ++errors;
+        }
+    }
+  return errors;
+}
+
+static int
+test_time_policy (void)
+{
+  ACE_TSC_Time_Policy policy;
+  ACE_Time_Value_T<ACE_TSC_Time_Policy> const before = policy ();
+  ACE_OS::sleep (ACE_Time_Value (0, 20000));
+  ACE_Time_Value_T<ACE_TSC_Time_Policy> const after = policy ();
+
+  ACE_Time_Value const elapsed = after - before;
+  if (elapsed < ACE_Time_Value (0, 19000) || elapsed > ACE_Time_Value (1))
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("time policy measured %#T for a 20 msec sleep\n"),
+                       &elapsed),
+                      1);
+
+  if (after.to_relative_time () != ACE_Time_Value::zero
+      && after.to_absolute_time () == ACE_Time_Value::zero)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("time policy conversions failed\n")),
+                      1);
+  return 0;
+}
+
+template <class CLOCK> static void
+time_readings (const ACE_TCHAR *name, CLOCK clock)
+{
+  size_t const iterations = 1000000;
+  ACE_UINT64 sum = 0;
+  ACE_High_Res_Timer timer;
+
+  timer.start ();
+  for (size_t i = 0; i != iterations; ++i)
+    sum += clock ();
+  timer.stop ();
+
+  ACE_hrtime_t nsecs;
+  timer.elapsed_time (nsecs);
+  ACE_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("%s: %Q nsecs per reading (%Q)\n"),
+              name,
+              nsecs / iterations,
+              sum & 1));
+}
+
+static ACE_UINT64
+gethrtime_reading (void)
+{
+  return ACE_OS::gethrtime ();
+}
+
+int
+run_main (int, ACE_TCHAR *[])
+{
+  ACE_START_TEST (ACE_TEXT ("TSC_Clock_Test"));
+
+  int status = 0;
+
+  bool const available = ACE_TSC_Clock::available ();
+  ACE_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("time stamp counter %C, %f ticks per usec\n"),
+              available ? "used" : "not used",
+              ACE_TSC_Clock::ticks_per_usec ()));
+
+  status += test_monotonic ();
+
+#if defined (ACE_HAS_THREADS)
+  if (ACE_Thread_Manager::instance ()->spawn_n (4,
+                                                ACE_THR_FUNC (reader),
+                                                0,
+                                                THR_NEW_LWP | THR_DETACHED) == -1)
+    ACE_ERROR_RETURN ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("spawn_n")), 1);
+  ACE_Thread_Manager::instance ()->wait ();
+
+  if (readings_behind.value () != 0)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("%u readings behind those of another thread\n"),
+                  readings_behind.value ()));
+      ++status;
+    }
+#endif /* ACE_HAS_THREADS */
+
+  status += test_against_monotonic ();
+  status += test_time_policy ();
+
+  // Calibrating again must give the same answer and keep the clock going
+  // forward.
+  ACE_UINT64 const before = ACE_TSC_Clock::now ();
+  int const result = ACE_TSC_Clock::calibrate ();
+  ACE_UINT64 const after = ACE_TSC_Clock::now ();
+  if ((result == 0) != available)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("calibrate() returned %d, counter was %C\n"),
+                  result,
+                  available ? "used" : "not used"));
+      ++status;
+    }
+  if (after < before)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("clock went back across calibrate()\n")));
+      ++status;
+    }
+
+  time_readings (ACE_TEXT ("ACE_TSC_Clock::now"), ACE_TSC_Clock::now);
+  time_readings (ACE_TEXT ("ACE_OS::gethrtime"), gethrtime_reading);
+
+  ACE_END_TEST;
+  return status;
+}
@@ -2449,6 +2449,14 @@ TAO_CodeGen::gen_stub_hdr_includes (void)
   this->gen_standard_include (this->client_header_,
                               "tao/Basic_Types.h");
 
+  // For the CDR_Layout_Traits of fixed-size structs, used by
+  // sequences that are not copied when they are demarshaled.
+  this->gen_cond_file_include (
+      idl_global->aggregate_seen_ && be_global->gen_arg_traits (),
+      "tao/CDR_Layout_Traits_T.h",
+      this->client_header_
+    );
+
   // May need ORB_Constants if users check SystemException minor
   // codes.
   this->gen_cond_file_include (
@@ -2748,6 +2756,10 @@ TAO_CodeGen::gen_stub_src_includes (void)
       // Needed for _narrow(), which is now template-based.
       this->gen_standard_include (this->client_stubs_,
                                   "tao/Object_T.h");
+
+      // Needed for the registration of the base interfaces.
+      this->gen_standard_include (this->client_stubs_,
+                                  "tao/Base_Interface_Table.h");
     }
 
   if (idl_global->octet_seq_seen_)
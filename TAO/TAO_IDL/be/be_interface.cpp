@@ -2317,6 +2317,20 @@ be_interface::is_a_helper (be_interface * /*derived*/,
   return 0;
 }
 
+int
+be_interface::repository_id_helper (be_interface *derived,
+                                    be_interface *bi,
+                                    TAO_OutStream *os)
+{
+  // The id of the interface itself comes first.
+  if (bi != derived)
+    {
+      *os << "\"" << bi->repoID () << "\"," << be_nl;
+    }
+
+  return 0;
+}
+
 int
 be_interface::copy_ctor_helper (be_interface *derived,
                                 be_interface *base,
@@ -2789,6 +2803,35 @@ be_interface::gen_is_a_ancestors (TAO_OutStream *os)
   return 0;
 }
 
+int
+be_interface::gen_base_interface_ids (TAO_OutStream *os)
+{
+  *os << "\"" << this->repoID () << "\"," << be_nl;
+
+  int const status =
+    this->traverse_inheritance_graph (be_interface::repository_id_helper,
+                                      os);
+
+  if (status == -1)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("be_interface::")
+                         ACE_TEXT ("gen_base_interface_ids - ")
+                         ACE_TEXT ("traverse_inheritance_graph failed\n")),
+                        -1);
+    }
+
+  if (this->has_mixed_parentage ())
+    {
+      *os << "\"IDL:omg.org/CORBA/AbstractBase:1.0\"," << be_nl;
+    }
+
+  *os << "\"IDL:omg.org/CORBA/Object:1.0\"," << be_nl
+      << "0";
+
+  return 0;
+}
+
 // =================================================================
 
 class Facet_Op_Attr_Helper
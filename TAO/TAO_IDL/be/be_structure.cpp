@@ -18,6 +18,8 @@
 #include "be_visitor.h"
 #include "be_extern.h"
 
+#include "ast_predefined_type.h"
+
 #include "utl_identifier.h"
 #include "idl_defines.h"
 #include "global_extern.h"
@@ -144,6 +146,98 @@ be_structure::gen_ostream_operator (TAO_OutStream *os,
       << "}" << be_nl;
 }
 
+bool
+be_structure::cdr_layout (ACE_CDR::ULong &size,
+                          ACE_CDR::ULong &encoded_size,
+                          ACE_CDR::ULong &read_alignment,
+                          ACE_CDR::ULong &alignment)
+{
+  if (this->node_type () != AST_Decl::NT_struct
+      || this->nfields () == 0)
+    {
+      return false;
+    }
+
+  size = 0;
+  read_alignment = 0;
+  alignment = 1;
+
+  for (long i = 0; i < this->pd_decls_used; ++i)
+    {
+      be_field *f = be_field::narrow_from_decl (this->pd_decls[i]);
+
+      if (f == 0)
+        {
+          continue;
+        }
+
+      AST_Type *ft = f->field_type ()->unaliased_type ();
+
+      if (ft->node_type () != AST_Decl::NT_pre_defined)
+        {
+          return false;
+        }
+
+      ACE_CDR::ULong member_size = 0;
+
+      // Characters and booleans are left out, their values may be
+      // translated or checked when they are demarshaled.
+      switch (AST_PredefinedType::narrow_from_decl (ft)->pt ())
+        {
+          case AST_PredefinedType::PT_octet:
+            member_size = 1;
+            break;
+          case AST_PredefinedType::PT_short:
+          case AST_PredefinedType::PT_ushort:
+            member_size = 2;
+            break;
+          case AST_PredefinedType::PT_long:
+          case AST_PredefinedType::PT_ulong:
+          case AST_PredefinedType::PT_float:
+            member_size = 4;
+            break;
+          case AST_PredefinedType::PT_longlong:
+          case AST_PredefinedType::PT_ulonglong:
+          case AST_PredefinedType::PT_double:
+            member_size = 8;
+            break;
+          default:
+            return false;
+        }
+
+      if (read_alignment == 0)
+        {
+          read_alignment = member_size;
+        }
+
+      if (member_size > alignment)
+        {
+          alignment = member_size;
+        }
+
+      // Both CDR and the C++ compilers align the members on their size,
+      // relative to the start of a struct that is aligned on its
+      // largest member.
+      size = (size + member_size - 1) & ~(member_size - 1);
+      size += member_size;
+    }
+
+  // In memory the next element of a sequence starts after the struct
+  // is padded to its alignment, in CDR on the alignment of the first
+  // member.
+  ACE_CDR::ULong const padded_size =
+    (size + alignment - 1) & ~(alignment - 1);
+
+  if (((size + read_alignment - 1) & ~(read_alignment - 1)) != padded_size)
+    {
+      return false;
+    }
+
+  encoded_size = size;
+  size = padded_size;
+  return true;
+}
+
 void
 be_structure::destroy (void)
 {
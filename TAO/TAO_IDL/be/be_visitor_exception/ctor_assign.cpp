@@ -13,9 +13,11 @@
 #include "exception.h"
 
 be_visitor_exception_ctor_assign::be_visitor_exception_ctor_assign (
-    be_visitor_context *ctx
+    be_visitor_context *ctx,
+    bool move
   )
-  : be_visitor_scope (ctx)
+  : be_visitor_scope (ctx),
+    move_ (move)
 {
 }
 
@@ -134,6 +136,11 @@ be_visitor_exception_ctor_assign::visit_enum (be_enum *)
 int
 be_visitor_exception_ctor_assign::visit_interface (be_interface *node)
 {
+  if (this->move_)
+    {
+      return this->emit_move ();
+    }
+
   TAO_OutStream *os = this->ctx_->stream ();
   be_decl *bd = this->ctx_->node ();
 
@@ -159,6 +166,11 @@ int
 be_visitor_exception_ctor_assign::visit_interface_fwd (
   be_interface_fwd *node)
 {
+  if (this->move_)
+    {
+      return this->emit_move ();
+    }
+
   TAO_OutStream *os = this->ctx_->stream ();
   be_decl *bd = this->ctx_->node ();
 
@@ -204,6 +216,14 @@ be_visitor_exception_ctor_assign::visit_predefined_type (
   be_decl *bd = this->ctx_->node ();
   AST_PredefinedType::PredefinedType pt = node->pt ();
 
+  if (this->move_
+      && (pt == AST_PredefinedType::PT_any
+          || pt == AST_PredefinedType::PT_pseudo
+          || pt == AST_PredefinedType::PT_object))
+    {
+      return this->emit_move ();
+    }
+
   *os << be_nl;
 
   // Check if the type is an any.
@@ -256,6 +276,11 @@ be_visitor_exception_ctor_assign::visit_predefined_type (
 int
 be_visitor_exception_ctor_assign::visit_sequence (be_sequence *)
 {
+  if (this->move_)
+    {
+      return this->emit_move ();
+    }
+
   TAO_OutStream *os = this->ctx_->stream ();
   be_decl *bd = this->ctx_->node ();
 
@@ -278,6 +303,11 @@ be_visitor_exception_ctor_assign::visit_sequence (be_sequence *)
 int
 be_visitor_exception_ctor_assign::visit_string (be_string *node)
 {
+  if (this->move_)
+    {
+      return this->emit_move ();
+    }
+
   TAO_OutStream *os = this->ctx_->stream ();
   be_decl *bd = this->ctx_->node ();
 
@@ -320,6 +350,11 @@ be_visitor_exception_ctor_assign::visit_string (be_string *node)
 int
 be_visitor_exception_ctor_assign::visit_structure (be_structure *)
 {
+  if (this->move_)
+    {
+      return this->emit_move ();
+    }
+
   TAO_OutStream *os = this->ctx_->stream ();
   be_decl *bd = this->ctx_->node ();
 
@@ -352,6 +387,11 @@ be_visitor_exception_ctor_assign::visit_structure_fwd (
 int
 be_visitor_exception_ctor_assign::visit_union (be_union *)
 {
+  if (this->move_)
+    {
+      return this->emit_move ();
+    }
+
   TAO_OutStream *os = this->ctx_->stream ();
   be_decl *bd = this->ctx_->node ();
 
@@ -431,3 +471,16 @@ be_visitor_exception_ctor_assign::emit_valuetype_common (be_type *node)
 
   return 0;
 }
+
+int
+be_visitor_exception_ctor_assign::emit_move (void)
+{
+  TAO_OutStream *os = this->ctx_->stream ();
+  be_decl *bd = this->ctx_->node ();
+
+  *os << be_nl
+      << "this->" << bd->local_name () << " = std::move (_tao_excp."
+      << bd->local_name () << ");";
+
+  return 0;
+}
@@ -65,7 +65,15 @@ int be_visitor_exception_ch::visit_exception (be_exception *node)
 
   // Assignment operator.
   *os << node->local_name () << " &operator= (const "
-      << node->local_name () << " &);" << be_nl_2;
+      << node->local_name () << " &);";
+
+  // Move constructor and assignment operator.
+  *os << "\n\n#if defined (ACE_HAS_CPP11)" << be_nl
+      << node->local_name () << " (" << node->local_name ()
+      << " &&) noexcept;" << be_nl
+      << node->local_name () << " &operator= ("
+      << node->local_name () << " &&) noexcept;"
+      << "\n#endif /* ACE_HAS_CPP11 */" << be_nl_2;
 
   if (be_global->any_support ())
     {
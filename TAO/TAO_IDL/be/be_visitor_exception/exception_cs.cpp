@@ -169,6 +169,62 @@ int be_visitor_exception_cs::visit_exception (be_exception *node)
       << "return *this;" << be_uidt_nl
       << "}" << be_nl_2;
 
+  // Move constructor.
+  *os << "#if defined (ACE_HAS_CPP11)" << be_nl
+      << node->name () << "::" << node->local_name () << " (::"
+      << node->name () << " &&_tao_excp) noexcept" << be_idt_nl;
+  *os << ": ::CORBA::UserException (" << be_idt << be_idt << be_idt_nl
+      << "_tao_excp._rep_id ()," << be_nl
+      << "_tao_excp._name ())" << be_uidt
+      << be_uidt << be_uidt << be_uidt_nl;
+  *os << "{";
+
+  if (node->nmembers () > 0)
+    {
+      *os << be_idt;
+
+      // Move each individual member.
+      ctx = *this->ctx_;
+      be_visitor_exception_ctor_assign mc_visitor (&ctx, true);
+
+      if (node->accept (&mc_visitor) == -1)
+        {
+          ACE_ERROR_RETURN ((LM_ERROR,
+                             ACE_TEXT ("be_visitor_exception_cs::")
+                             ACE_TEXT ("visit_exception - ")
+                             ACE_TEXT ("codegen for scope failed\n")),
+                            -1);
+        }
+    }
+
+  *os << be_uidt_nl
+      << "}" << be_nl_2;
+
+  // Move assignment operator.
+  *os << node->name () << "&" << be_nl;
+  *os << node->name () << "::operator= (::"
+      << node->name () << " &&_tao_excp) noexcept" << be_nl
+      << "{" << be_idt_nl
+      << "this->::CORBA::UserException::operator= "
+      << "(_tao_excp);";
+
+  ctx = *this->ctx_;
+  be_visitor_exception_ctor_assign ma_visitor (&ctx, true);
+
+  if (node->accept (&ma_visitor) == -1)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("be_visitor_exception_cs::")
+                         ACE_TEXT ("visit_exception - ")
+                         ACE_TEXT ("codegen for scope failed\n")),
+                        -1);
+    }
+
+  *os << be_nl
+      << "return *this;" << be_uidt_nl
+      << "}" << be_nl
+      << "#endif /* ACE_HAS_CPP11 */" << be_nl_2;
+
   if (be_global->any_support ())
     {
       *os << "void "
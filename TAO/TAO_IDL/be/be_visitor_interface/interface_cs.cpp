@@ -327,6 +327,35 @@ be_visitor_interface_cs::visit_interface (be_interface *node)
   *os << "}" << be_uidt << be_uidt_nl
       << "}" << be_nl_2;
 
+  // Register the repository ids known to _is_a(), so that the ORB
+  // can answer it for object references of this type held as one of
+  // its base interfaces.
+  if (! node->is_abstract () && ! node->is_local () && c == 0)
+    {
+      *os << "#if (TAO_HAS_BASE_INTERFACE_TABLE == 1)" << be_nl
+          << "static const char * const _tao_" << node->flat_name ()
+          << "_repository_ids[] =" << be_idt_nl
+          << "{" << be_idt_nl;
+
+      if (node->gen_base_interface_ids (os) == -1)
+        {
+          ACE_ERROR_RETURN ((LM_ERROR,
+                             ACE_TEXT ("be_visitor_interface_cs::")
+                             ACE_TEXT ("visit_interface - ")
+                             ACE_TEXT ("gen_base_interface_ids() failed\n")),
+                            -1);
+        }
+
+      *os << be_uidt_nl
+          << "};" << be_uidt_nl << be_nl
+          << "static TAO::Base_Interface_Table::Registration" << be_idt_nl
+          << "_tao_" << node->flat_name () << "_base_interfaces ("
+          << be_idt_nl
+          << "_tao_" << node->flat_name () << "_repository_ids);"
+          << be_uidt << be_uidt_nl
+          << "#endif /* TAO_HAS_BASE_INTERFACE_TABLE == 1 */" << be_nl_2;
+    }
+
   *os << "const char* " << node->full_name ()
       << "::_interface_repository_id (void) const"
       << be_nl
@@ -239,7 +239,18 @@ int be_visitor_sequence_ch::visit_sequence (be_sequence *node)
 
       *os << be_nl
           << node->local_name () << " (const " << node->local_name ()
-          << " &);" << be_nl;
+          << " &);";
+
+      // The base sequence moves its buffer, declaring the move
+      // operations needs the copy assignment declared as well.
+      *os << "\n#if defined (ACE_HAS_CPP11)" << be_nl
+          << node->local_name () << " (" << node->local_name ()
+          << " &&) = default;" << be_nl
+          << node->local_name () << " &operator= (const "
+          << node->local_name () << " &) = default;" << be_nl
+          << node->local_name () << " &operator= ("
+          << node->local_name () << " &&) = default;"
+          << "\n#endif /* ACE_HAS_CPP11 */" << be_nl;
       *os << "virtual ~" << node->local_name () << " (void);";
 
       if (be_global->alt_mapping () && node->unbounded ())
@@ -66,6 +66,10 @@ int be_visitor_structure_ch::visit_structure (be_structure *node)
                         -1);
     }
 
+  // No constructors or assignment operators are declared, the struct
+  // has to remain an aggregate.  With C++11 the implicitly declared
+  // move constructor and move assignment operator move each member,
+  // the strings, sequences and _vars used for them are movable.
   *os << be_uidt_nl;
   *os << "};";
 
@@ -381,6 +381,43 @@ be_visitor_traits::visit_structure (be_structure *node)
                         -1);
     }
 
+  if (node->imported () || node->is_local () || node->cli_traits_gen ())
+    {
+      return 0;
+    }
+
+  node->cli_traits_gen (true);
+
+  ACE_CDR::ULong size = 0;
+  ACE_CDR::ULong encoded_size = 0;
+  ACE_CDR::ULong read_alignment = 0;
+  ACE_CDR::ULong alignment = 0;
+
+  // Lets sequences of the struct refer to the elements in the CDR
+  // stream, see TAO_NO_COPY_VALUE_SEQUENCES.
+  if (node->cdr_layout (size, encoded_size, read_alignment, alignment))
+    {
+      TAO_OutStream *os = this->ctx_->stream ();
+
+      os->gen_ifdef_macro (node->flat_name (), "cdr_layout_traits", false);
+
+      *os << be_nl_2
+          << "template<>" << be_nl
+          << "struct CDR_Layout_Traits< ::" << node->full_name () << ">"
+          << be_nl
+          << "{" << be_idt_nl
+          << "enum" << be_nl
+          << "{" << be_idt_nl
+          << "size = " << size << "," << be_nl
+          << "encoded_size = " << encoded_size << "," << be_nl
+          << "read_alignment = " << read_alignment << "," << be_nl
+          << "alignment = " << alignment << be_uidt_nl
+          << "};" << be_uidt_nl
+          << "};";
+
+      os->gen_endif ();
+    }
+
   return 0;
 }
 
@@ -60,6 +60,14 @@ int be_visitor_union_ch::visit_union (be_union *node)
       << node->local_name () << " &operator= (const "
       << node->local_name () << " &);";
 
+  // Generate the move constructor and assignment operator.
+  *os << "\n\n#if defined (ACE_HAS_CPP11)" << be_nl
+      << node->local_name () << " (" << node->local_name ()
+      << " &&) noexcept;" << be_nl
+      << node->local_name () << " &operator= ("
+      << node->local_name () << " &&) noexcept;"
+      << "\n#endif /* ACE_HAS_CPP11 */";
+
   // Retrieve the disriminant type.
   be_type *bt = be_type::narrow_from_decl (node->disc_type ());
 
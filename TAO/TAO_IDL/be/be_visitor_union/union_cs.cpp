@@ -263,6 +263,33 @@ int be_visitor_union_cs::visit_union (be_union *node)
   *os << be_nl << "return *this;" << be_uidt_nl;
   *os << "}" << be_nl_2;
 
+  // The move constructor takes the branch storage of the other union
+  // and leaves it the way the default constructor does, with the
+  // discriminant of the default branch.  The move assignment operator
+  // moves into a temporary that then destroys the old value.
+  *os << "#if defined (ACE_HAS_CPP11)" << be_nl
+      << node->name () << "::" << node->local_name ()
+      << " (::" << node->name () << " &&u) noexcept" << be_idt_nl
+      << ": " << node->local_name () << " ()" << be_uidt_nl
+      << "{" << be_idt_nl
+      << "std::swap (this->disc_, u.disc_);" << be_nl
+      << "std::swap (this->u_, u.u_);" << be_uidt_nl
+      << "}" << be_nl_2;
+
+  *os << node->name () << " &" << be_nl
+      << node->name () << "::operator= (::"
+      << node->name () << " &&u) noexcept" << be_nl
+      << "{" << be_idt_nl
+      << "if (&u != this)" << be_idt_nl
+      << "{" << be_idt_nl
+      << "::" << node->name () << " tmp (std::move (u));" << be_nl
+      << "std::swap (this->disc_, tmp.disc_);" << be_nl
+      << "std::swap (this->u_, tmp.u_);" << be_uidt_nl
+      << "}" << be_uidt << be_nl_2
+      << "return *this;" << be_uidt_nl
+      << "}" << be_nl
+      << "#endif /* ACE_HAS_CPP11 */" << be_nl_2;
+
   // The reset method.
   this->ctx_->state (TAO_CodeGen::TAO_UNION_PUBLIC_RESET_CS);
 
@@ -176,6 +176,12 @@ public:
                           be_interface *,
                           TAO_OutStream *os);
 
+  /// Helper method passed to the template method that generates the
+  /// repository ids registered in the base interface table.
+  static int repository_id_helper (be_interface *,
+                                   be_interface *,
+                                   TAO_OutStream *os);
+
   /// Helper method passed to the template method to generate code for the
   /// operation table.
   static int ami_handler_gen_optable_helper (be_interface *,
@@ -276,6 +282,10 @@ public:
   /// Generate the string compares for ancestors in _is_a().
   virtual int gen_is_a_ancestors (TAO_OutStream *os);
 
+  /// Generate the repository ids known to _is_a(), that of this
+  /// interface first, as the null terminated initializer of an array.
+  int gen_base_interface_ids (TAO_OutStream *os);
+
 protected:
   /**
    * CDreate a new string made by the concatenation
@@ -43,6 +43,16 @@ public:
   virtual void gen_ostream_operator (TAO_OutStream *os,
                                      bool use_underscore);
 
+  /// True if the CDR encoding of the struct has the same layout as
+  /// the struct in memory, when all the members are numeric types and
+  /// there is no padding that differs between the two.  Returns the
+  /// size in memory and in CDR, the alignment of the first member and
+  /// the alignment of the struct (see TAO::CDR_Layout_Traits).
+  bool cdr_layout (ACE_CDR::ULong &size,
+                   ACE_CDR::ULong &encoded_size,
+                   ACE_CDR::ULong &read_alignment,
+                   ACE_CDR::ULong &alignment);
+
   /// Cleanup method.
   virtual void destroy (void);
 
@@ -23,7 +23,11 @@
 class be_visitor_exception_ctor_assign : public be_visitor_scope
 {
 public:
-  be_visitor_exception_ctor_assign (be_visitor_context *ctx);
+  /// With @a move the members are moved from the other exception
+  /// where their types allow it, for the move constructor and
+  /// assignment operator.
+  be_visitor_exception_ctor_assign (be_visitor_context *ctx,
+                                    bool move = false);
   ~be_visitor_exception_ctor_assign (void);
 
   virtual int visit_exception (be_exception *node);
@@ -46,6 +50,11 @@ public:
 
 private:
   int emit_valuetype_common (be_type *node);
+
+  /// Move the current member from the other exception.
+  int emit_move (void);
+
+  bool move_;
 };
 
 #endif /* _BE_VISITOR_EXCEPTION_CTOR_ASSIGN_H_ */
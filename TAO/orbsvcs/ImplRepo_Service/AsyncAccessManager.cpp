@@ -356,11 +356,20 @@ AsyncAccessManager::status (void) const
 void
 AsyncAccessManager::status (ImplementationRepository::AAM_Status s)
 {
-  ACE_GUARD (TAO_SYNCH_MUTEX, mon, this->lock_);
-  this->status_ = s;
-  if (s == ImplementationRepository::AAM_SERVER_DEAD)
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, mon, this->lock_);
+    this->status_ = s;
+    if (s == ImplementationRepository::AAM_SERVER_DEAD)
+      {
+        this->info_.edit()->pid = 0;
+      }
+  }
+
+  // Until the server is known to be ready again, locate requests must
+  // not be forwarded from the cache.
+  if (s != ImplementationRepository::AAM_SERVER_READY)
     {
-      this->info_.edit()->pid = 0;
+      this->locator_.forward_cache ().unbind (this->info_->ping_id ());
     }
 }
 
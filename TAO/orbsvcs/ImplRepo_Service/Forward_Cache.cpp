@@ -0,0 +1,200 @@
+// -*- C++ -*-
+#include "Forward_Cache.h"
+#include "ImR_Locator_i.h"
+
+#include "orbsvcs/Log_Macros.h"
+
+#include "ace/Guard_T.h"
+#include "ace/OS_NS_sys_time.h"
+#include "ace/Vector_T.h"
+
+//---------------------------------------------------------------------------
+//---------------------------------------------------------------------------
+
+Forward_Cache::Forward_Cache (void)
+  : ttl_ (ACE_Time_Value::zero)
+{
+}
+
+void
+Forward_Cache::ttl (const ACE_Time_Value &ttl)
+{
+  this->ttl_ = ttl;
+}
+
+bool
+Forward_Cache::enabled (void) const
+{
+  return this->ttl_ != ACE_Time_Value::zero;
+}
+
+bool
+Forward_Cache::find_i (const ACE_CString &name,
+                       const ACE_Time_Value &now,
+                       ACE_CString &partial_ior)
+{
+  ACE_CString server;
+  if (this->aliases_.find (name, server) != 0)
+    {
+      return false;
+    }
+
+  Entry entry;
+  if (this->entries_.find (server, entry) != 0 ||
+      entry.expiration_ <= now)
+    {
+      return false;
+    }
+
+  partial_ior = entry.partial_ior_;
+  return true;
+}
+
+bool
+Forward_Cache::find (const ACE_CString &name, ACE_CString &partial_ior)
+{
+  if (!this->enabled ())
+    {
+      return false;
+    }
+
+  ACE_Time_Value const now (ACE_OS::gettimeofday ());
+  ACE_READ_GUARD_RETURN (TAO_SYNCH_RW_MUTEX, mon, this->lock_, false);
+  return this->find_i (name, now, partial_ior);
+}
+
+bool
+Forward_Cache::find_key (const ACE_CString &key, ACE_CString &partial_ior)
+{
+  if (!this->enabled ())
+    {
+      return false;
+    }
+
+  ACE_Time_Value const now (ACE_OS::gettimeofday ());
+  ACE_READ_GUARD_RETURN (TAO_SYNCH_RW_MUTEX, mon, this->lock_, false);
+  if (this->find_i (key, now, partial_ior))
+    {
+      return true;
+    }
+
+  ACE_CString::size_type pos = key.rfind ('/');
+  while (pos != ACE_CString::npos)
+    {
+      ACE_CString const server = key.substring (0, pos);
+      if (this->find_i (server, now, partial_ior))
+        {
+          return true;
+        }
+      pos = server.rfind ('/');
+    }
+  return false;
+}
+
+void
+Forward_Cache::bind (const ACE_CString &name,
+                     const ACE_CString &server,
+                     const char *partial_ior)
+{
+  if (!this->enabled ())
+    {
+      return;
+    }
+
+  Entry entry;
+  entry.partial_ior_ = partial_ior;
+  entry.expiration_ = ACE_OS::gettimeofday () + this->ttl_;
+
+  ACE_WRITE_GUARD (TAO_SYNCH_RW_MUTEX, mon, this->lock_);
+  this->aliases_.rebind (name, server);
+  this->entries_.rebind (server, entry);
+
+  if (ImR_Locator_i::debug () > 4)
+    {
+      ORBSVCS_DEBUG ((LM_DEBUG,
+                      ACE_TEXT ("(%P|%t) Forward_Cache::bind <%C> as <%C>, ")
+                      ACE_TEXT ("partial ior <%C>\n"),
+                      server.c_str (), name.c_str (), partial_ior));
+    }
+}
+
+void
+Forward_Cache::unbind (const char *server)
+{
+  if (!this->enabled ())
+    {
+      return;
+    }
+
+  ACE_WRITE_GUARD (TAO_SYNCH_RW_MUTEX, mon, this->lock_);
+  if (this->entries_.unbind (server) == 0 && ImR_Locator_i::debug () > 4)
+    {
+      ORBSVCS_DEBUG ((LM_DEBUG,
+                      ACE_TEXT ("(%P|%t) Forward_Cache::unbind <%C>\n"),
+                      server));
+    }
+}
+
+void
+Forward_Cache::purge (const char *server)
+{
+  if (!this->enabled ())
+    {
+      return;
+    }
+
+  ACE_WRITE_GUARD (TAO_SYNCH_RW_MUTEX, mon, this->lock_);
+  this->entries_.unbind (server);
+
+  ACE_Vector<ACE_CString> names;
+  for (AliasMap::iterator i (this->aliases_); !i.done (); i++)
+    {
+      if (i->int_id_ == server)
+        {
+          names.push_back (i->ext_id_);
+        }
+    }
+  for (size_t n = 0; n < names.size (); ++n)
+    {
+      this->aliases_.unbind (names[n]);
+    }
+}
+
+void
+Forward_Cache::clear (void)
+{
+  ACE_WRITE_GUARD (TAO_SYNCH_RW_MUTEX, mon, this->lock_);
+  this->entries_.unbind_all ();
+  this->aliases_.unbind_all ();
+}
+
+//---------------------------------------------------------------------------
+//---------------------------------------------------------------------------
+
+Forward_Cache_ResponseHandler::Forward_Cache_ResponseHandler
+(Forward_Cache &cache,
+ const char *name,
+ const char *server,
+ ImR_ResponseHandler *rh)
+  : cache_ (cache),
+    name_ (name),
+    server_ (server),
+    rh_ (rh)
+{
+}
+
+void
+Forward_Cache_ResponseHandler::send_ior (const char *pior)
+{
+  this->cache_.bind (this->name_, this->server_, pior);
+  this->rh_->send_ior (pior);
+  delete this;
+}
+
+void
+Forward_Cache_ResponseHandler::send_exception (CORBA::Exception *ex)
+{
+  this->cache_.unbind (this->server_.c_str ());
+  this->rh_->send_exception (ex);
+  delete this;
+}
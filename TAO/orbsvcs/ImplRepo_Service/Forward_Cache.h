@@ -0,0 +1,132 @@
+// -*- C++ -*-
+/*
+ * @file Forward_Cache.h
+ *
+ * @brief Cache of the partial IORs of running servers, used to answer
+ * locate and forward requests without involving the activation state.
+ */
+
+#ifndef IMR_FORWARD_CACHE_H_
+#define IMR_FORWARD_CACHE_H_
+
+#include "locator_export.h"
+
+#include "ace/Hash_Map_Manager_T.h"
+#include "ace/Null_Mutex.h"
+#include "ace/SString.h"
+#include "ace/Time_Value.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+#pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/orbconf.h"
+#include "ImR_ResponseHandler.h"
+
+//----------------------------------------------------------------------------
+/*
+ * @class Forward_Cache
+ *
+ * @brief Remembers the partial IOR a server was last activated with.
+ *
+ * During a startup storm every client of a server asks the locator for
+ * the same forward.  Once the server has been found running, its partial
+ * IOR is kept here for a limited time so that further requests can be
+ * forwarded without looking up the server in the repository and without
+ * queuing on its AsyncAccessManager.
+ *
+ * Entries are stored per server, the names the clients used to reach a
+ * server are kept as aliases of it.  An entry is dropped as soon as the
+ * locator learns that the server is no longer running, otherwise it
+ * expires after the configured time to live.  Lookups only take a read
+ * lock, so concurrent locates do not serialize on the cache.
+ */
+class Locator_Export Forward_Cache
+{
+ public:
+  Forward_Cache (void);
+
+  /// Set the time an entry remains valid, zero disables the cache.
+  void ttl (const ACE_Time_Value &ttl);
+  bool enabled (void) const;
+
+  /// Find the partial IOR for the server known as @a name.
+  bool find (const ACE_CString &name, ACE_CString &partial_ior);
+
+  /// Find the partial IOR for an object key. Like
+  /// ImR_Locator_i::split_key, the key itself and each of its
+  /// '/' delimited prefixes are tried as a server name.
+  bool find_key (const ACE_CString &key, ACE_CString &partial_ior);
+
+  /// Remember that @a server, known as @a name, runs at @a partial_ior.
+  void bind (const ACE_CString &name,
+             const ACE_CString &server,
+             const char *partial_ior);
+
+  /// The server is not running, or not running at the cached address
+  /// anymore.
+  void unbind (const char *server);
+
+  /// The server is removed from the repository, forget its aliases too.
+  void purge (const char *server);
+
+  void clear (void);
+
+ private:
+  struct Entry
+  {
+    ACE_CString partial_ior_;
+    ACE_Time_Value expiration_;
+  };
+
+  typedef ACE_Hash_Map_Manager_Ex<ACE_CString,
+                                  Entry,
+                                  ACE_Hash<ACE_CString>,
+                                  ACE_Equal_To<ACE_CString>,
+                                  ACE_Null_Mutex> EntryMap;
+  typedef ACE_Hash_Map_Manager_Ex<ACE_CString,
+                                  ACE_CString,
+                                  ACE_Hash<ACE_CString>,
+                                  ACE_Equal_To<ACE_CString>,
+                                  ACE_Null_Mutex> AliasMap;
+
+  bool find_i (const ACE_CString &name,
+               const ACE_Time_Value &now,
+               ACE_CString &partial_ior);
+
+  TAO_SYNCH_RW_MUTEX lock_;
+  ACE_Time_Value ttl_;
+
+  /// Server name to entry
+  EntryMap entries_;
+
+  /// Name used by clients to server name
+  AliasMap aliases_;
+};
+
+//----------------------------------------------------------------------------
+/*
+ * @class Forward_Cache_ResponseHandler
+ *
+ * @brief Fills the forward cache with the result of an activation
+ * before passing it on.
+ */
+class Forward_Cache_ResponseHandler : public ImR_ResponseHandler
+{
+ public:
+  Forward_Cache_ResponseHandler (Forward_Cache &cache,
+                                 const char *name,
+                                 const char *server,
+                                 ImR_ResponseHandler *rh);
+
+  virtual void send_ior (const char *pior);
+  virtual void send_exception (CORBA::Exception *ex);
+
+ private:
+  Forward_Cache &cache_;
+  ACE_CString name_;
+  ACE_CString server_;
+  ImR_ResponseHandler *rh_;
+};
+
+#endif /* IMR_FORWARD_CACHE_H_ */
@@ -142,6 +142,13 @@ ImR_DSI_Forwarder::invoke (CORBA::ServerRequest_ptr request,
                                     this->locator_.debug() > 0 ?
                                     server_name.in() : "",
                                     this->orb_, resp));
+
+  ACE_CString ior;
+  if (this->locator_.forward_cache ().find (server_name.in (), ior))
+    {
+      rh->send_ior (ior.c_str ());
+      return;
+    }
   this->locator_.activate_server_by_name (server_name.in(), false, rh);
 }
 
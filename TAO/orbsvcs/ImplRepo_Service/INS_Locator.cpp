@@ -22,6 +22,15 @@ char *
 INS_Locator::locate (const char* object_key)
 {
   ACE_ASSERT (object_key != 0);
+
+  ACE_CString full (object_key);
+  ACE_CString ior;
+  if (this->imr_locator_.forward_cache ().find_key (full, ior))
+    {
+      ior += full;
+      return CORBA::string_dup (ior.c_str ());
+    }
+
   try
     {
       CORBA::String_var located =
@@ -42,13 +51,23 @@ INS_Locator::async_locate (::IORTable::Locate_ResponseHandler handler,
 {
   ACE_ASSERT (object_key != 0);
 
+  ACE_CString full (object_key);
+  ACE_CString ior;
+  if (this->imr_locator_.forward_cache ().find_key (full, ior))
+    {
+      ior += full;
+      handler->forward_ior (ior.c_str(), false);
+      return;
+    }
+
   Server_Info_Ptr si;
   ACE_CString key;
-  ACE_CString full (object_key);
-  if (this->imr_locator_.split_key (full, key, si))
+  ACE_CString name;
+  if (this->imr_locator_.split_key (full, key, si, name))
     {
       ImR_ResponseHandler *rh = 0;
       ACE_NEW (rh, INS_Loc_ResponseHandler (key.c_str(), handler));
+      rh = this->imr_locator_.cache_forward (name.c_str (), *si, rh);
       this->imr_locator_.activate_server_by_info (si, rh);
     }
   else
@@ -103,6 +103,7 @@ ImR_Locator_i::init_with_orb (CORBA::ORB_ptr orb)
   this->dsi_forwarder_.init (orb);
   this->adapter_.init (& this->dsi_forwarder_);
   this->pinger_.init (orb, this->opts_->ping_interval ());
+  this->forward_cache_.ttl (this->opts_->forward_ttl ());
 
   this->opts_->pinger (&this->pinger_);
 
@@ -514,6 +515,7 @@ ImR_Locator_i::child_death_i (const char* name, int pid)
                     pid, name));
 
   this->pinger_.remove_server (name, pid);
+  this->forward_cache_.unbind (name);
   AsyncAccessManager_ptr aam (this->find_aam (name, false));
   bool terminated = !aam.is_nil () && aam->notify_child_death (pid);
   aam = this->find_aam (name, true);
@@ -609,11 +611,12 @@ ImR_Locator_i::activate_server_by_object (const char* object_name)
 {
   Server_Info_Ptr si;
   ACE_CString key;
+  ACE_CString name;
   ACE_CString full (object_name);
-  if (this->split_key (full, key, si))
+  if (this->split_key (full, key, si, name))
     {
       ImR_SyncResponseHandler rh (key.c_str(), this->orb_.in());
-      this->activate_server_by_info (si, &rh);
+      this->activate_server_by_info (si, this->cache_forward (name.c_str (), *si, &rh));
       return rh.wait_for_result ();
     }
   throw ImplementationRepository::NotFound();
@@ -648,11 +651,13 @@ ImR_Locator_i::get_info_for_name (const char* name, Server_Info_Ptr &si)
 }
 
 bool
-ImR_Locator_i::split_key (ACE_CString &full, ACE_CString &key, Server_Info_Ptr &si)
+ImR_Locator_i::split_key (ACE_CString &full, ACE_CString &key, Server_Info_Ptr &si,
+                          ACE_CString &name)
 {
   key = full;
   if (this->get_info_for_name (full.c_str(), si))
     {
+      name = full;
       return true;
     }
 
@@ -662,6 +667,7 @@ ImR_Locator_i::split_key (ACE_CString &full, ACE_CString &key, Server_Info_Ptr &
       ACE_CString server = full.substring (0, pos);
       if (this->get_info_for_name (server.c_str (), si))
         {
+          name = server;
           return true;
         }
       pos = server.rfind ('/');
@@ -670,6 +676,35 @@ ImR_Locator_i::split_key (ACE_CString &full, ACE_CString &key, Server_Info_Ptr &
   return false;
 }
 
+Forward_Cache &
+ImR_Locator_i::forward_cache (void)
+{
+  return this->forward_cache_;
+}
+
+ImR_ResponseHandler *
+ImR_Locator_i::cache_forward (const char *name,
+                              const Server_Info &si,
+                              ImR_ResponseHandler *rh)
+{
+  // A per client server is started anew for each request, its
+  // address must not be handed to anyone else.
+  if (!this->forward_cache_.enabled () ||
+      si.is_mode (ImplementationRepository::PER_CLIENT))
+    {
+      return rh;
+    }
+
+  ImR_ResponseHandler *crh = 0;
+  ACE_NEW_RETURN (crh,
+                  Forward_Cache_ResponseHandler (this->forward_cache_,
+                                                 name,
+                                                 si.ping_id (),
+                                                 rh),
+                  rh);
+  return crh;
+}
+
 void
 ImR_Locator_i::activate_server_by_name (const char* name, bool manual_start,
                                         ImR_ResponseHandler *rh)
@@ -683,6 +718,10 @@ ImR_Locator_i::activate_server_by_name (const char* name, bool manual_start,
     }
   else
     {
+      if (!manual_start)
+        {
+          rh = this->cache_forward (name, *info, rh);
+        }
       this->activate_server_i (info, manual_start, rh);
     }
 }
@@ -951,6 +990,8 @@ ImR_Locator_i::remove_server_i (const Server_Info_Ptr &info)
                     ACE_TEXT ("(%P|%t) ImR: Removing Server <%C>...\n"),
                     info->key_name_.c_str()));
 
+  this->forward_cache_.purge (info->ping_id ());
+
   ACE_CString poa_name = info->poa_name;
   if (this->repository_->remove_server (info->key_name_, this) == 0)
     {
@@ -1335,6 +1376,7 @@ ImR_Locator_i::server_is_running
       AsyncAccessManager_ptr aam;
       if (!info->is_mode(ImplementationRepository::PER_CLIENT))
         {
+          this->forward_cache_.unbind (info->ping_id ());
           info.edit ()->set_contact (partial_ior, sior.in(), srvobj.in());
 
           info.update_repo();
@@ -1403,6 +1445,7 @@ ImR_Locator_i::server_is_shutting_down
 
   if (!info->is_mode(ImplementationRepository::PER_CLIENT))
     {
+      this->forward_cache_.unbind (info->ping_id ());
       this->pinger_.remove_server (info->ping_id());
       {
         AsyncAccessManager_ptr aam = this->find_aam (info->ping_id (), false);
@@ -1704,6 +1747,7 @@ ImR_Locator_i::make_terminating (AsyncAccessManager_ptr &aam,
 {
   this->aam_active_.remove (aam);
   this->aam_terminating_.insert_tail (aam);
+  this->forward_cache_.unbind (name);
   this->pinger_.remove_server (name, pid);
 }
 
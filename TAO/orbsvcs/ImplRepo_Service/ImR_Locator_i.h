@@ -8,6 +8,7 @@
 #include "Adapter_Activator.h"
 #include "Activator_Info.h"
 #include "Forwarder.h"
+#include "Forward_Cache.h"
 #include "LiveCheck.h"
 #include "ImR_ResponseHandler.h"
 #include "Locator_Options.h"
@@ -160,7 +161,21 @@ public:
                                 bool manual_start,
                                 ImR_ResponseHandler *rh);
 
-  bool split_key (ACE_CString &full, ACE_CString &key, Server_Info_Ptr &si);
+  /// Find the server an object key belongs to, @a name is set to the
+  /// part of the key that matched the server.
+  bool split_key (ACE_CString &full, ACE_CString &key, Server_Info_Ptr &si,
+                  ACE_CString &name);
+
+  /// Partial IORs of running servers, consulted by the INS_Locator and
+  /// Forwarder before activating a server.
+  Forward_Cache &forward_cache (void);
+
+  /// Returns a response handler that adds the result of activating @a si
+  /// to the forward cache under @a name and then passes it on to @a rh.
+  /// Returns @a rh itself when the result cannot be cached.
+  ImR_ResponseHandler *cache_forward (const char *name,
+                                      const Server_Info &si,
+                                      ImR_ResponseHandler *rh);
 
   // interfaces to aid with collaboration
 
@@ -230,6 +245,8 @@ private:
   /// The asynch server ping adapter
   LiveCheck pinger_;
 
+  Forward_Cache forward_cache_;
+
   /// A collection of asynch activator instances
   typedef ACE_Unbounded_Set<AsyncAccessManager_ptr> AAM_Set;
   AAM_Set aam_active_;
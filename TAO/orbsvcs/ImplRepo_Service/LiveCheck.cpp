@@ -7,8 +7,6 @@
 #include "tao/ORB_Core.h"
 #include "ace/Reactor.h"
 #include "ace/OS_NS_sys_time.h"
-#include "ace/Timer_Queue.h"
-#include "ace/Timer_Queue_Iterator.h"
 
 LiveListener::LiveListener (const char *server)
   : server_ (server),
@@ -628,25 +626,15 @@ LC_TimeoutGuard::~LC_TimeoutGuard (void)
 
   if (owner_->want_timeout_)
     {
-      ACE_Time_Value delay = ACE_Time_Value::zero;
-      if (owner_->deferred_timeout_ != ACE_Time_Value::zero)
-        {
-          ACE_Time_Value const now (ACE_OS::gettimeofday());
-          if (owner_->deferred_timeout_ > now)
-            delay = owner_->deferred_timeout_ - now;
-        }
-      ++owner_->token_;
       if (ImR_Locator_i::debug () > 2)
         {
           ORBSVCS_DEBUG ((LM_DEBUG,
                           ACE_TEXT ("(%P|%t) LC_TimeoutGuard(%d)::dtor,")
-                          ACE_TEXT ("scheduling new timeout(%d), delay = %d,%d\n"),
-                          this->token_, owner_->token_, delay.sec(), delay.usec()));
+                          ACE_TEXT ("scheduling deferred timeout\n"),
+                          this->token_));
         }
-      owner_->reactor()->schedule_timer (owner_,
-                                         reinterpret_cast<void *>(owner_->token_),
-                                         delay);
       owner_->want_timeout_ = false;
+      owner_->schedule_timeout (owner_->deferred_timeout_);
     }
   else
     {
@@ -674,7 +662,8 @@ LiveCheck::LiveCheck ()
    token_ (100),
    handle_timeout_busy_ (1),
    want_timeout_ (false),
-   deferred_timeout_ (0,0)
+   deferred_timeout_ (0,0),
+   next_timeout_ (ACE_Time_Value::max_time)
 {
 }
 
@@ -729,6 +718,7 @@ LiveCheck::shutdown (void)
 {
   this->running_ = false;
   this->reactor()->cancel_timer (this);
+  this->next_timeout_ = ACE_Time_Value::max_time;
 }
 
 const ACE_Time_Value &
@@ -752,6 +742,10 @@ LiveCheck::handle_timeout (const ACE_Time_Value &,
   if (!this->running_)
     return -1;
 
+  // Assume the earliest pending timeout is the one that fired, a later
+  // one that is forgotten at worst results in a redundant timeout.
+  this->next_timeout_ = ACE_Time_Value::max_time;
+
   LC_TimeoutGuard tg (this, token);
   if (tg.blocked ())
     return 0;
@@ -950,10 +944,7 @@ LiveCheck::add_per_client_listener (LiveListener *l,
 
       if (!this->in_handle_timeout ())
         {
-          ++this->token_;
-          this->reactor()->schedule_timer (this,
-                                           reinterpret_cast<void *>(this->token_),
-                                           ACE_Time_Value::zero);
+          this->schedule_timeout (ACE_Time_Value::zero);
         }
       else
         {
@@ -1030,50 +1021,11 @@ LiveCheck::schedule_ping (LiveEntry *entry)
       return status != LS_DEAD;
     }
 
-  ACE_Time_Value now (ACE_OS::gettimeofday());
   ACE_Time_Value next = entry->next_check ();
 
   if (!this->in_handle_timeout () )
     {
-      ACE_Time_Value delay = ACE_Time_Value::zero;
-      if (next > now)
-        {
-          delay = next - now;
-        }
-
-      ACE_Timer_Queue *tq = this->reactor ()->timer_queue ();
-      if (!tq->is_empty ())
-        {
-          for (ACE_Timer_Queue_Iterator_T<ACE_Event_Handler*> &i = tq->iter ();
-               !i.isdone (); i.next())
-            {
-              if (i.item ()->get_type () == this)
-                {
-                  if (next >= tq->earliest_time ())
-                    {
-                      if (ImR_Locator_i::debug () > 2)
-                        {
-                          ORBSVCS_DEBUG ((LM_DEBUG,
-                                          ACE_TEXT ("(%P|%t) LiveCheck::schedule_ping ")
-                                          ACE_TEXT ("already scheduled\n")));
-                        }
-                      return true;
-                    }
-                  break;
-                }
-            }
-        }
-      ++this->token_;
-      if (ImR_Locator_i::debug () > 2)
-        {
-          ORBSVCS_DEBUG ((LM_DEBUG,
-                          ACE_TEXT ("(%P|%t) LiveCheck::schedule_ping (%d),")
-                          ACE_TEXT (" delay = %d,%d\n"),
-                          this->token_, delay.sec(), delay.usec()));
-        }
-      this->reactor()->schedule_timer (this,
-                                       reinterpret_cast<void *>(this->token_),
-                                       delay);
+      this->schedule_timeout (next);
     }
   else
     {
@@ -1091,6 +1043,43 @@ LiveCheck::schedule_ping (LiveEntry *entry)
   return true;
 }
 
+void
+LiveCheck::schedule_timeout (const ACE_Time_Value &when)
+{
+  ACE_Time_Value const now (ACE_OS::gettimeofday());
+  ACE_Time_Value delay = ACE_Time_Value::zero;
+  if (when > now)
+    {
+      delay = when - now;
+    }
+
+  if (now + delay >= this->next_timeout_)
+    {
+      if (ImR_Locator_i::debug () > 2)
+        {
+          ORBSVCS_DEBUG ((LM_DEBUG,
+                          ACE_TEXT ("(%P|%t) LiveCheck::schedule_timeout ")
+                          ACE_TEXT ("already scheduled\n")));
+        }
+      return;
+    }
+
+  ++this->token_;
+  if (ImR_Locator_i::debug () > 2)
+    {
+      ORBSVCS_DEBUG ((LM_DEBUG,
+                      ACE_TEXT ("(%P|%t) LiveCheck::schedule_timeout (%d),")
+                      ACE_TEXT (" delay = %d,%d\n"),
+                      this->token_, delay.sec(), delay.usec()));
+    }
+  if (this->reactor()->schedule_timer (this,
+                                       reinterpret_cast<void *>(this->token_),
+                                       delay) != -1)
+    {
+      this->next_timeout_ = now + delay;
+    }
+}
+
 LiveStatus
 LiveCheck::is_alive (const char *server)
 {
@@ -277,6 +277,12 @@ class Locator_Export LiveCheck : public ACE_Event_Handler
   bool in_handle_timeout (void);
   void remove_deferred_servers (void);
 
+  /// Schedule a timeout at the absolute time @a when, unless one that
+  /// expires no later is already pending.  Every listener of every
+  /// entry is served by the same timeout, so a storm of listeners
+  /// results in a single timer rather than one per request.
+  void schedule_timeout (const ACE_Time_Value &when);
+
   typedef ACE_Hash_Map_Manager_Ex<ACE_CString,
                                   LiveEntry *,
                                   ACE_Hash<ACE_CString>,
@@ -295,6 +301,10 @@ class Locator_Export LiveCheck : public ACE_Event_Handler
   bool want_timeout_;
   ACE_Time_Value deferred_timeout_;
   NameStack removed_entries_;
+
+  /// The expiration time of the earliest timeout known to be pending,
+  /// ACE_Time_Value::max_time if there is none.
+  ACE_Time_Value next_timeout_;
 };
 
 #endif /* IMR_LIVECHECK_H_  */
@@ -31,6 +31,7 @@ Options::Options ()
 , ping_external_ (false)
 , ping_interval_ (DEFAULT_PING_INTERVAL)
 , ping_timeout_ (DEFAULT_PING_TIMEOUT)
+, forward_ttl_ (ACE_Time_Value::zero)
 , startup_timeout_ (DEFAULT_START_TIMEOUT)
 , readonly_ (false)
 , service_command_ (SC_NONE)
@@ -279,6 +280,20 @@ Options::parse_args (int &argc, ACE_TCHAR *argv[])
           this->ping_timeout_ =
             ACE_Time_Value (0, 1000 * ACE_OS::atoi (shifter.get_current ()));
         }
+      else if (ACE_OS::strcasecmp (shifter.get_current (),
+                                   ACE_TEXT ("--forwardttl")) == 0)
+        {
+          shifter.consume_arg ();
+
+          if (!shifter.is_anything_left () || shifter.get_current ()[0] == '-')
+            {
+              ORBSVCS_ERROR ((LM_ERROR,
+                          ACE_TEXT ("Error: --forwardttl option needs a value\n")));
+              this->print_usage ();
+              return -1;
+            }
+          this->forward_ttl_.msec (static_cast<long> (ACE_OS::atoi (shifter.get_current ())));
+        }
 #if 0
       else if (ACE_OS::strcasecmp (shifter.get_current (),
                                    ACE_TEXT ("--threads")) == 0)
@@ -390,7 +405,7 @@ Options::print_usage (void) const
     ACE_TEXT ("\n")
     ACE_TEXT ("ImplRepo_Service [-c cmd] [-d 0..5] [-e] [-m] [-o file]\n")
     ACE_TEXT (" [-r|-p file|-x file|--directory dir [--primary|--backup] ]\n")
-    ACE_TEXT (" [-s] [-t secs] [-v msecs]\n")
+    ACE_TEXT (" [-s] [-t secs] [-v msecs] [--forwardttl msecs]\n")
     ACE_TEXT ("  -c command      Runs nt service commands ('install' or 'remove')\n")
     ACE_TEXT ("  -d level        Sets the debug level (default 0)\n")
     ACE_TEXT ("  -e              Erase the persisted repository at startup\n")
@@ -409,6 +424,8 @@ Options::print_usage (void) const
     ACE_TEXT ("  -v msecs        Server verification interval.(Default = 10000ms)\n")
     ACE_TEXT ("  -n msecs        Ping request timeout.(Default = 10ms)\n")
     ACE_TEXT ("  -i              Ping servers started without activators too.\n")
+    ACE_TEXT ("  --forwardttl msecs Forward clients of a running server from a cache\n")
+    ACE_TEXT ("                  for this long.(Default = 0, disabled)\n")
     ACE_TEXT ("  --lockout       Prevent excessive restart attempts until manual reset.\n")
     ACE_TEXT ("  --UnregisterIfAddressReused,\n")
     ACE_TEXT ("  -u              Unregister server if its endpoint is used by another\n")
@@ -755,6 +772,12 @@ Options::ping_timeout (void) const
   return this->ping_timeout_;
 }
 
+ACE_Time_Value
+Options::forward_ttl (void) const
+{
+  return this->forward_ttl_;
+}
+
 LiveCheck *
 Options::pinger (void) const
 {
@@ -109,6 +109,11 @@ public:
   /// When pinging, this is the timeout
   ACE_Time_Value ping_timeout (void) const;
 
+  /// How long the partial IOR of a running server may be used to
+  /// forward clients without checking on the server again. Zero
+  /// disables the forward cache.
+  ACE_Time_Value forward_ttl (void) const;
+
   LiveCheck *pinger (void) const;
   void pinger (LiveCheck *);
 
@@ -167,6 +172,9 @@ private:
   /// The amount of time to wait for a "are you started yet?" ping reply.
   ACE_Time_Value ping_timeout_;
 
+  /// The amount of time a cached forward remains valid.
+  ACE_Time_Value forward_ttl_;
+
   /// The amount of time to wait for a server to response after starting it.
   ACE_Time_Value startup_timeout_;
 
@@ -7,11 +7,20 @@
 #include "ace/SOCK_Dgram.h"
 #include "ace/ACE.h"
 #include "ace/OS_NS_string.h"
+#include "ace/os_include/sys/os_socket.h"
+
+#if defined (ACE_LINUX)
+# include <netinet/udp.h>
+#endif /* ACE_LINUX */
 
 #if !defined(__ACE_INLINE__)
 #include "orbsvcs/Event/ECG_CDR_Message_Receiver.inl"
 #endif /* __ACE_INLINE__ */
 
+#if defined (ACE_HAS_RECVMMSG) && defined (UDP_GRO)
+# define TAO_ECG_HAS_UDP_GRO
+#endif /* ACE_HAS_RECVMMSG && UDP_GRO */
+
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 TAO_ECG_CDR_Processor::~TAO_ECG_CDR_Processor (void)
@@ -19,6 +28,82 @@ TAO_ECG_CDR_Processor::~TAO_ECG_CDR_Processor (void)
 }
 // ****************************************************************
 
+TAO_ECG_Fragment_Buffer_Pool::TAO_ECG_Fragment_Buffer_Pool (void)
+  : count_ (0)
+{
+}
+
+TAO_ECG_Fragment_Buffer_Pool::~TAO_ECG_Fragment_Buffer_Pool (void)
+{
+  for (size_t i = 0; i != this->count_; ++i)
+    {
+      this->free_[i]->release ();
+    }
+}
+
+ACE_Data_Block *
+TAO_ECG_Fragment_Buffer_Pool::acquire (size_t size)
+{
+  size_t const needed = size + ACE_CDR::MAX_ALIGNMENT;
+
+  for (size_t i = 0; i != this->count_; ++i)
+    {
+      ACE_Data_Block *db = this->free_[i];
+      if (db->size () >= needed)
+        {
+          this->free_[i] = this->free_[--this->count_];
+          return db;
+        }
+    }
+
+  ACE_Data_Block *db = 0;
+  ACE_NEW_RETURN (db,
+                  ACE_Data_Block (ACE_CDR::first_size (needed),
+                                  ACE_Message_Block::MB_DATA,
+                                  0,
+                                  0,
+                                  0,
+                                  0,
+                                  0),
+                  0);
+  return db;
+}
+
+void
+TAO_ECG_Fragment_Buffer_Pool::release (ACE_Data_Block *db)
+{
+  if (db == 0)
+    return;
+
+  if (this->count_ < ECG_DEFAULT_MAX_FREE_BUFFERS
+      && db->reference_count () == 1)
+    {
+      this->free_[this->count_++] = db;
+      return;
+    }
+
+  // Replace the smallest buffer, the larger ones are more useful.
+  if (this->count_ != 0 && db->reference_count () == 1)
+    {
+      size_t smallest = 0;
+      for (size_t i = 1; i != this->count_; ++i)
+        {
+          if (this->free_[i]->size () < this->free_[smallest]->size ())
+            smallest = i;
+        }
+      if (this->free_[smallest]->size () < db->size ())
+        {
+          ACE_Data_Block *tmp = this->free_[smallest];
+          this->free_[smallest] = db;
+          db = tmp;
+        }
+    }
+
+  db->release ();
+}
+
+// ****************************************************************
+
 TAO_ECG_UDP_Request_Entry::~TAO_ECG_UDP_Request_Entry (void)
 {
   if (this->own_received_fragments_)
@@ -26,19 +111,39 @@ TAO_ECG_UDP_Request_Entry::~TAO_ECG_UDP_Request_Entry (void)
       this->own_received_fragments_ = 0;
       delete[] this->received_fragments_;
     }
+
+  if (this->pool_ != 0)
+    {
+      this->pool_->release (this->payload_.replace_data_block (0));
+    }
 }
 
 TAO_ECG_UDP_Request_Entry::
 TAO_ECG_UDP_Request_Entry (CORBA::Boolean byte_order,
                            CORBA::ULong request_id,
                            CORBA::ULong request_size,
-                           CORBA::ULong fragment_count)
+                           CORBA::ULong fragment_count,
+                           TAO_ECG_Fragment_Buffer_Pool *pool)
   : byte_order_ (byte_order)
   , request_id_ (request_id)
   , request_size_ (request_size)
   , fragment_count_ (fragment_count)
+  , pool_ (0)
 {
-  ACE_CDR::grow (&this->payload_, this->request_size_);
+  ACE_Data_Block *db = 0;
+  if (pool != 0)
+    db = pool->acquire (this->request_size_);
+
+  if (db != 0)
+    {
+      this->pool_ = pool;
+      this->payload_.data_block (db);
+      ACE_CDR::mb_align (&this->payload_);
+    }
+  else
+    {
+      ACE_CDR::grow (&this->payload_, this->request_size_);
+    }
   this->payload_.wr_ptr (request_size_);
 
   this->received_fragments_ = this->default_received_fragments_;
@@ -232,11 +337,116 @@ TAO_ECG_CDR_Message_Receiver::Requests::purge_requests (
 TAO_ECG_UDP_Request_Entry
 TAO_ECG_CDR_Message_Receiver::Request_Completed_ (0, 0, 0, 0);
 
+/// The buffers and system call arguments used to read a batch of
+/// datagrams.
+struct TAO_ECG_CDR_Message_Receiver::Batch
+{
+  Batch (size_t size);
+  ~Batch (void);
+
+  /// Return the buffer for datagram @a i
+  char *slot (size_t i);
+
+  /// The number of datagrams
+  size_t size;
+
+  /// The size of each datagram buffer
+  size_t slot_size;
+
+  /// The memory for all the datagram buffers, plus a scratch buffer
+  /// used to realign datagrams split from GRO buffers.
+  char *buffer;
+  char *slots;
+
+#if defined (ACE_HAS_RECVMMSG)
+  mmsghdr *msgs;
+  iovec *iov;
+  sockaddr_storage *addrs;
+# if defined (TAO_ECG_HAS_UDP_GRO)
+  union Control
+  {
+    char buf[CMSG_SPACE (sizeof (int))];
+    cmsghdr align;
+  };
+  Control *control;
+# endif /* TAO_ECG_HAS_UDP_GRO */
+#endif /* ACE_HAS_RECVMMSG */
+};
+
+TAO_ECG_CDR_Message_Receiver::Batch::Batch (size_t n)
+  : size (n)
+#if defined (TAO_ECG_HAS_UDP_GRO)
+    // A GRO buffer can hold up to 64K worth of datagrams.
+  , slot_size (65536)
+#else
+  , slot_size (ACE_align_binary (TAO_ECG_CDR_Message_Sender::ECG_HEADER_SIZE
+                                 + ACE_MAX_DGRAM_SIZE,
+                                 ACE_CDR::MAX_ALIGNMENT))
+#endif /* TAO_ECG_HAS_UDP_GRO */
+  , buffer (0)
+  , slots (0)
+#if defined (ACE_HAS_RECVMMSG)
+  , msgs (0)
+  , iov (0)
+  , addrs (0)
+# if defined (TAO_ECG_HAS_UDP_GRO)
+  , control (0)
+# endif /* TAO_ECG_HAS_UDP_GRO */
+#endif /* ACE_HAS_RECVMMSG */
+{
+  ACE_NEW (this->buffer,
+           char[(this->size + 1) * this->slot_size + ACE_CDR::MAX_ALIGNMENT]);
+  this->slots = ACE_ptr_align_binary (this->buffer, ACE_CDR::MAX_ALIGNMENT);
+
+#if defined (ACE_HAS_RECVMMSG)
+  ACE_NEW (this->msgs, mmsghdr[this->size]);
+  ACE_NEW (this->iov, iovec[this->size]);
+  ACE_NEW (this->addrs, sockaddr_storage[this->size]);
+# if defined (TAO_ECG_HAS_UDP_GRO)
+  ACE_NEW (this->control, Control[this->size]);
+# endif /* TAO_ECG_HAS_UDP_GRO */
+#endif /* ACE_HAS_RECVMMSG */
+}
+
+TAO_ECG_CDR_Message_Receiver::Batch::~Batch (void)
+{
+#if defined (ACE_HAS_RECVMMSG)
+# if defined (TAO_ECG_HAS_UDP_GRO)
+  delete [] this->control;
+# endif /* TAO_ECG_HAS_UDP_GRO */
+  delete [] this->addrs;
+  delete [] this->iov;
+  delete [] this->msgs;
+#endif /* ACE_HAS_RECVMMSG */
+  delete [] this->buffer;
+}
+
+char *
+TAO_ECG_CDR_Message_Receiver::Batch::slot (size_t i)
+{
+  return this->slots + i * this->slot_size;
+}
+
+int
+TAO_ECG_CDR_Message_Receiver::batch_size (CORBA::ULong new_batch_size)
+{
+  if (new_batch_size > TAO_ECG_CDR_Message_Receiver::ECG_MAX_BATCH_SIZE)
+    return -1;
+
+  delete this->batch_;
+  this->batch_ = 0;
+  this->batch_size_ = new_batch_size;
+  return 0;
+}
+
 int
 TAO_ECG_CDR_Message_Receiver::handle_input (
                                  ACE_SOCK_Dgram& dgram,
                                  TAO_ECG_CDR_Processor *cdr_processor)
 {
+  if (this->batch_size_ > 1)
+    return this->handle_input_batch (dgram, cdr_processor);
+
   char nonaligned_header[TAO_ECG_CDR_Message_Sender::ECG_HEADER_SIZE
                         + ACE_CDR::MAX_ALIGNMENT];
   char *header_buf = ACE_ptr_align_binary (nonaligned_header,
@@ -273,6 +483,141 @@ TAO_ECG_CDR_Message_Receiver::handle_input (
                         0);
     }
 
+  return this->process_datagram (from, header_buf, data_buf, n, cdr_processor);
+}
+
+int
+TAO_ECG_CDR_Message_Receiver::handle_input_batch (
+                                 ACE_SOCK_Dgram& dgram,
+                                 TAO_ECG_CDR_Processor *cdr_processor)
+{
+#if defined (ACE_HAS_RECVMMSG)
+  if (this->batch_ == 0)
+    {
+      ACE_NEW_RETURN (this->batch_,
+                      Batch (this->batch_size_),
+                      -1);
+    }
+  Batch &batch = *this->batch_;
+
+  ACE_HANDLE const handle = dgram.get_handle ();
+
+# if defined (TAO_ECG_HAS_UDP_GRO)
+  if (this->gro_handles_.find (handle) != 0)
+    {
+      // Failing is fine, the kernel simply does not support GRO.
+      int enable = 1;
+      dgram.set_option (SOL_UDP, UDP_GRO, &enable, sizeof (enable));
+      this->gro_handles_.insert (handle);
+    }
+# endif /* TAO_ECG_HAS_UDP_GRO */
+
+  for (size_t i = 0; i != batch.size; ++i)
+    {
+      batch.iov[i].iov_base = batch.slot (i);
+      batch.iov[i].iov_len = batch.slot_size;
+
+      msghdr &hdr = batch.msgs[i].msg_hdr;
+      ACE_OS::memset (&batch.msgs[i], 0, sizeof (batch.msgs[i]));
+      hdr.msg_name = &batch.addrs[i];
+      hdr.msg_namelen = sizeof (batch.addrs[i]);
+      hdr.msg_iov = &batch.iov[i];
+      hdr.msg_iovlen = 1;
+# if defined (TAO_ECG_HAS_UDP_GRO)
+      hdr.msg_control = batch.control[i].buf;
+      hdr.msg_controllen = sizeof (batch.control[i].buf);
+# endif /* TAO_ECG_HAS_UDP_GRO */
+    }
+
+  // We are called because the first datagram is available, do not
+  // wait for the others.
+  int const count = ::recvmmsg (handle,
+                                batch.msgs,
+                                static_cast<unsigned int> (batch.size),
+                                MSG_DONTWAIT,
+                                0);
+  if (count == -1)
+    {
+      if (errno == EWOULDBLOCK)
+        return 0;
+
+      ORBSVCS_ERROR_RETURN ((LM_ERROR, "Error reading mcast fragments (%m).\n"),
+                        -1);
+    }
+
+  // Report success if any message was processed, the events decoded
+  // so far must not be lost because of a bad datagram.
+  int result = 0;
+  char * const scratch = batch.slot (batch.size);
+  for (int i = 0; i != count; ++i)
+    {
+      const msghdr &hdr = batch.msgs[i].msg_hdr;
+      ACE_INET_Addr from;
+      from.set_addr (&batch.addrs[i], static_cast<int> (hdr.msg_namelen));
+
+      size_t const length = batch.msgs[i].msg_len;
+      size_t segment_size = length;
+# if defined (TAO_ECG_HAS_UDP_GRO)
+      for (cmsghdr *cm = CMSG_FIRSTHDR (&hdr);
+           cm != 0;
+           cm = CMSG_NXTHDR (const_cast<msghdr *> (&hdr), cm))
+        {
+          if (cm->cmsg_level == SOL_UDP && cm->cmsg_type == UDP_GRO)
+            {
+              int gso_size = 0;
+              ACE_OS::memcpy (&gso_size, CMSG_DATA (cm), sizeof (gso_size));
+              if (gso_size > 0)
+                segment_size = static_cast<size_t> (gso_size);
+            }
+        }
+# endif /* TAO_ECG_HAS_UDP_GRO */
+
+      for (size_t offset = 0; offset < length; offset += segment_size)
+        {
+          size_t const n = ACE_MIN (segment_size, length - offset);
+          char *buf = batch.slot (i) + offset;
+          if (ACE_ptr_align_binary (buf, ACE_CDR::MAX_ALIGNMENT) != buf)
+            {
+              ACE_OS::memcpy (scratch, buf, n);
+              buf = scratch;
+            }
+
+          if (n < TAO_ECG_CDR_Message_Sender::ECG_HEADER_SIZE)
+            {
+              ORBSVCS_ERROR ((LM_ERROR, "Trying to read mcast fragment: "
+                                    "# of bytes read < mcast header size.\n"));
+              if (result == 0)
+                result = -1;
+              continue;
+            }
+
+          int const r =
+            this->process_datagram (from,
+                                    buf,
+                                    buf + TAO_ECG_CDR_Message_Sender::ECG_HEADER_SIZE,
+                                    n,
+                                    cdr_processor);
+          if (r == 1 || (r == -1 && result == 0))
+            result = r;
+        }
+    }
+
+  return result;
+#else
+  // Read one datagram at a time.
+  this->batch_size_ = 0;
+  return this->handle_input (dgram, cdr_processor);
+#endif /* ACE_HAS_RECVMMSG */
+}
+
+int
+TAO_ECG_CDR_Message_Receiver::process_datagram (
+                                 const ACE_INET_Addr &from,
+                                 char *header_buf,
+                                 char *data_buf,
+                                 size_t n,
+                                 TAO_ECG_CDR_Processor *cdr_processor)
+{
   if (n < TAO_ECG_CDR_Message_Sender::ECG_HEADER_SIZE)
     {
       ORBSVCS_ERROR_RETURN ((LM_ERROR, "Trying to read mcast fragment: "
@@ -284,11 +629,15 @@ TAO_ECG_CDR_Message_Receiver::handle_input (
 
   if (this->check_crc_)
     {
-      iov[1].iov_len = n - iov[0].iov_len;
-      iov[0].iov_len -= 4;  // don't include crc
+      iovec iov[2];
+      iov[0].iov_base = header_buf;
+      iov[0].iov_len  = TAO_ECG_CDR_Message_Sender::ECG_HEADER_SIZE - 4;
+      iov[1].iov_base = data_buf;
+      iov[1].iov_len  = n - TAO_ECG_CDR_Message_Sender::ECG_HEADER_SIZE;
 
       crc = ACE::crc32 (iov, 2);
     }
+
   // Check whether the message is a loopback message.
   if (this->ignore_from_.get () != 0
       && this->ignore_from_->is_loopback (from))
@@ -337,6 +686,15 @@ TAO_ECG_CDR_Message_Receiver::handle_input (
     }
 
   // Process received data.
+  if (header.coalesced)
+    {
+      int const result = this->mark_received (from, header.request_id);
+      if (result != 1)
+        return result;
+
+      return this->process_coalesced (header, data_buf, cdr_processor);
+    }
+
   if (header.fragment_count == 1)
     {
       // Update <request_map_> to mark this request as completed. (Not
@@ -355,6 +713,43 @@ TAO_ECG_CDR_Message_Receiver::handle_input (
   return this->process_fragment (from, header, data_buf, cdr_processor);
 }
 
+int
+TAO_ECG_CDR_Message_Receiver::process_coalesced (
+                                 const Mcast_Header &header,
+                                 char *data_buf,
+                                 TAO_ECG_CDR_Processor *cdr_processor)
+{
+  TAO_InputCDR cdr (data_buf, header.request_size, header.byte_order);
+
+  int result = 0;
+  while (cdr.length () != 0)
+    {
+      CORBA::ULong message_size = 0;
+      if (!cdr.read_ulong (message_size)
+          || cdr.align_read_ptr (ACE_CDR::MAX_ALIGNMENT) != 0
+          || message_size > cdr.length ())
+        {
+          ORBSVCS_ERROR_RETURN ((LM_ERROR,
+                             "Invalid coalesced mcast message.\n"),
+                            result == 0 ? -1 : result);
+        }
+
+      TAO_InputCDR message (cdr.rd_ptr (), message_size, header.byte_order);
+      if (cdr_processor->decode (message) == -1)
+        return result == 0 ? -1 : result;
+      result = 1;
+
+      // Skip the message and the padding after it.
+      size_t const padded =
+        ACE_align_binary (message_size, ACE_CDR::MAX_ALIGNMENT);
+      if (padded > cdr.length ())
+        break;
+      cdr.skip_bytes (padded);
+    }
+
+  return result;
+}
+
 int
 TAO_ECG_CDR_Message_Receiver::mark_received (const ACE_INET_Addr &from,
                                              CORBA::ULong request_id)
@@ -426,7 +821,8 @@ TAO_ECG_CDR_Message_Receiver::process_fragment (
                       TAO_ECG_UDP_Request_Entry (header.byte_order,
                                                  header.request_id,
                                                  header.request_size,
-                                                 header.fragment_count),
+                                                 header.fragment_count,
+                                                 &this->buffer_pool_),
                       -1);
     }
 
@@ -517,6 +913,9 @@ TAO_ECG_CDR_Message_Receiver::shutdown (void)
       (*i).int_id_ = 0;
     }
 
+  delete this->batch_;
+  this->batch_ = 0;
+
   this->ignore_from_.reset ();
 }
 
@@ -527,12 +926,15 @@ TAO_ECG_CDR_Message_Receiver::Mcast_Header::read (char *header,
                                                   CORBA::Boolean checkcrc)
 {
   // Decode.
-  this->byte_order = header[0];
-  if(this->byte_order != 0 && this->byte_order != 1)
+  int const flags = header[0];
+  this->byte_order = flags & 0x01;
+  this->coalesced =
+    (flags & TAO_ECG_CDR_Message_Sender::ECG_COALESCED_FLAG) != 0;
+  if ((flags & ~(0x01 | TAO_ECG_CDR_Message_Sender::ECG_COALESCED_FLAG)) != 0)
     {
-      ORBSVCS_ERROR_RETURN ((LM_ERROR, "Reading mcast packet header: byte "
-                                   "order is neither 0 nor 1, it is %d.\n",
-                         this->byte_order),
+      ORBSVCS_ERROR_RETURN ((LM_ERROR, "Reading mcast packet header: invalid "
+                                   "flags %d.\n",
+                         flags),
                         -1);
     }
 
@@ -586,6 +988,7 @@ TAO_ECG_CDR_Message_Receiver::Mcast_Header::read (char *header,
   if (this->request_size < this->fragment_size
       || this->fragment_offset >= this->request_size
       || this->fragment_id >= this->fragment_count
+      || (this->coalesced && this->fragment_count != 1)
       || (this->fragment_count == 1
           && (this->fragment_size != this->request_size
               || this->request_size != data_bytes_received)))
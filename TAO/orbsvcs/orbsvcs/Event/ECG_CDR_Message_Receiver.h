@@ -22,6 +22,7 @@
 #include "ace/Hash_Map_Manager.h"
 #include "ace/INET_Addr.h"
 #include "ace/Null_Mutex.h"
+#include "ace/Unbounded_Set.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -41,6 +42,46 @@ public:
   virtual int decode (TAO_InputCDR &cdr) = 0;
 };
 
+// ****************************************************************
+/**
+ * @class TAO_ECG_Fragment_Buffer_Pool
+ *
+ * @brief Recycle the buffers used to reassemble fragmented requests.
+ *
+ * A gateway receiving a steady stream of large events allocates and
+ * releases a reassembly buffer for each one of them, this pool keeps
+ * a few of those buffers around for reuse.
+ * NOT THREAD-SAFE.
+ */
+class TAO_RTEvent_Serv_Export TAO_ECG_Fragment_Buffer_Pool
+{
+public:
+  enum {
+    ECG_DEFAULT_MAX_FREE_BUFFERS = 16
+  };
+
+  TAO_ECG_Fragment_Buffer_Pool (void);
+  ~TAO_ECG_Fragment_Buffer_Pool (void);
+
+  /// Return a data block big enough for @a size bytes, properly
+  /// aligned for CDR.  Returns 0 if the memory cannot be allocated.
+  ACE_Data_Block *acquire (size_t size);
+
+  /// Return a data block obtained with acquire() to the pool.
+  void release (ACE_Data_Block *data_block);
+
+private:
+  TAO_ECG_Fragment_Buffer_Pool (const TAO_ECG_Fragment_Buffer_Pool &);
+  TAO_ECG_Fragment_Buffer_Pool & operator= (const TAO_ECG_Fragment_Buffer_Pool &);
+
+private:
+  /// The free buffers.
+  ACE_Data_Block *free_[ECG_DEFAULT_MAX_FREE_BUFFERS];
+
+  /// The number of entries used in <free_>.
+  size_t count_;
+};
+
 // ****************************************************************
 /**
  * @class TAO_ECG_UDP_Request_Entry
@@ -58,10 +99,15 @@ public:
   };
 
   /// Initialize the fragment, allocating memory, etc.
+  /**
+   * If @a pool is not zero the reassembly buffer is obtained from
+   * it, and returned to it when the entry is destroyed.
+   */
   TAO_ECG_UDP_Request_Entry (CORBA::Boolean byte_order,
                              CORBA::ULong request_id,
                              CORBA::ULong request_size,
-                             CORBA::ULong fragment_count);
+                             CORBA::ULong fragment_count,
+                             TAO_ECG_Fragment_Buffer_Pool *pool = 0);
 
   ~TAO_ECG_UDP_Request_Entry (void);
 
@@ -100,6 +146,9 @@ private:
 
   ACE_Message_Block payload_;
 
+  /// Where the payload buffer came from, if not zero.
+  TAO_ECG_Fragment_Buffer_Pool *pool_;
+
   /// This is a bit vector, used to keep track of the received buffers.
   CORBA::ULong* received_fragments_;
   int own_received_fragments_;
@@ -137,6 +186,20 @@ private:
  * dropped.
  * Once all the fragments have been received the message is sent
  * up to the calling classes, and the memory reclaimed.
+ * The reassembly buffers are recycled through a
+ * TAO_ECG_Fragment_Buffer_Pool.
+ *
+ * = BATCHING
+ * If the batch size is set to a value larger than one, each call to
+ * handle_input() reads all the datagrams available, up to the batch
+ * size, using recvmmsg() where available.  On Linux the socket is
+ * also configured to receive UDP GRO (generic receive offload)
+ * buffers, which are split back into datagrams before processing.
+ * The processor is called once for each complete message.
+ *
+ * Coalesced datagrams (see ECG_CDR_Message_Sender.h) are always
+ * accepted, the processor is called once for each message they
+ * contain.
  */
 class TAO_RTEvent_Serv_Export TAO_ECG_CDR_Message_Receiver
 {
@@ -171,6 +234,11 @@ public:
   int handle_input (ACE_SOCK_Dgram& dgram,
                     TAO_ECG_CDR_Processor *cdr_processor);
 
+  /// Read up to @a batch_size datagrams on each call to handle_input(),
+  /// a value of 0 or 1 reads a single datagram.
+  int batch_size (CORBA::ULong batch_size);
+  CORBA::ULong batch_size (void) const;
+
   /// Represents any request that has been fully received and
   /// serviced, to simplify the internal logic.
   static TAO_ECG_UDP_Request_Entry Request_Completed_;
@@ -179,11 +247,13 @@ private:
 
   enum {
     ECG_DEFAULT_MAX_FRAGMENTED_REQUESTS = 1024,
-    ECG_DEFAULT_FRAGMENTED_REQUESTS_MIN_PURGE_COUNT = 32
+    ECG_DEFAULT_FRAGMENTED_REQUESTS_MIN_PURGE_COUNT = 32,
+    ECG_MAX_BATCH_SIZE = 1024
   };
 
   struct Mcast_Header;
   class Requests;
+  struct Batch;
 
   typedef ACE_Hash_Map_Manager<ACE_INET_Addr,
                                Requests*,
@@ -191,6 +261,24 @@ private:
 
 private:
 
+  /// Read and process several datagrams at once.
+  int handle_input_batch (ACE_SOCK_Dgram& dgram,
+                          TAO_ECG_CDR_Processor *cdr_processor);
+
+  /// Validate and process a single datagram of @a n bytes, including
+  /// the header.
+  int process_datagram (const ACE_INET_Addr &from,
+                        char *header_buf,
+                        char *data_buf,
+                        size_t n,
+                        TAO_ECG_CDR_Processor *cdr_processor);
+
+  /// Pass each one of the messages in a coalesced datagram to
+  /// @a cdr_processor.
+  int process_coalesced (const Mcast_Header &header,
+                         char *data_buf,
+                         TAO_ECG_CDR_Processor *cdr_processor);
+
   /// Returns 1 on success, 0 if <request_id> has already been
   /// received or is below current request range, and -1 on error.
   int mark_received (const ACE_INET_Addr &from,
@@ -230,6 +318,19 @@ private:
 
   /// Flag to indicate whether CRC should be computed and checked.
   CORBA::Boolean check_crc_;
+
+  /// The maximum number of datagrams read by handle_input().
+  CORBA::ULong batch_size_;
+
+  /// Buffers for handle_input_batch(), allocated on first use.
+  Batch *batch_;
+
+  /// The sockets already configured to receive GRO buffers.
+  ACE_Unbounded_Set<ACE_HANDLE> gro_handles_;
+
+  /// Recycle the reassembly buffers, the entries that use it are
+  /// destroyed by shutdown().
+  TAO_ECG_Fragment_Buffer_Pool buffer_pool_;
 };
 
 // ****************************************************************
@@ -238,6 +339,7 @@ private:
 struct TAO_ECG_CDR_Message_Receiver::Mcast_Header
 {
   int byte_order;
+  int coalesced;
   CORBA::ULong request_id;
   CORBA::ULong request_size;
   CORBA::ULong fragment_size;
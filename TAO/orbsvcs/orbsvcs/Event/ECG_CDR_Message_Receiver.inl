@@ -21,6 +21,8 @@ TAO_ECG_CDR_Message_Receiver::TAO_ECG_CDR_Message_Receiver (CORBA::Boolean crc)
   , max_requests_ (ECG_DEFAULT_MAX_FRAGMENTED_REQUESTS)
   , min_purge_count_ (ECG_DEFAULT_FRAGMENTED_REQUESTS_MIN_PURGE_COUNT)
   , check_crc_ (crc)
+  , batch_size_ (0)
+  , batch_ (0)
 {
 //    ACE_NEW (this->lock_,
 //             ACE_Lock_Adapter<ACE_Null_Mutex>);
@@ -45,4 +47,10 @@ TAO_ECG_CDR_Message_Receiver::init (TAO_ECG_Refcounted_Endpoint ignore_from
 //      }
 }
 
+ACE_INLINE CORBA::ULong
+TAO_ECG_CDR_Message_Receiver::batch_size (void) const
+{
+  return this->batch_size_;
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
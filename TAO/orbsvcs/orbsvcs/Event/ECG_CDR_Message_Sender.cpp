@@ -4,15 +4,38 @@
 #include "ace/SOCK_Dgram.h"
 #include "ace/INET_Addr.h"
 #include "ace/ACE.h"
+#include "ace/OS_NS_string.h"
+#include "ace/os_include/sys/os_socket.h"
+
+#if defined (ACE_LINUX)
+# include <netinet/udp.h>
+#endif /* ACE_LINUX */
 
 #if !defined(__ACE_INLINE__)
 #include "orbsvcs/Event/ECG_CDR_Message_Sender.inl"
 #endif /* __ACE_INLINE__ */
 
-
+#if defined (ACE_HAS_SENDMMSG) && defined (UDP_SEGMENT)
+# define TAO_ECG_HAS_UDP_GSO
+#endif /* ACE_HAS_SENDMMSG && UDP_SEGMENT */
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
+namespace
+{
+  /// The largest buffer handed to the kernel for segmentation.
+  size_t const ECG_MAX_GSO_BUFFER = 65000;
+
+  /// The number of datagrams prepared on the stack for each call to
+  /// sendmmsg().
+  size_t const ECG_SENDMMSG_CHUNK = 64;
+}
+
+TAO_ECG_CDR_Message_Sender::~TAO_ECG_CDR_Message_Sender (void)
+{
+  delete [] this->staged_;
+}
+
 void
 TAO_ECG_CDR_Message_Sender::init (
       TAO_ECG_Refcounted_Endpoint endpoint_rptr)
@@ -26,6 +49,49 @@ TAO_ECG_CDR_Message_Sender::init (
     }
 
   this->endpoint_rptr_ = endpoint_rptr;
+
+#if defined (TAO_ECG_HAS_UDP_GSO)
+  // Only use segmentation offload if the kernel knows about it.
+  int gso_size = 0;
+  int len = sizeof (gso_size);
+  this->gso_ = (this->dgram ().get_option (SOL_UDP,
+                                           UDP_SEGMENT,
+                                           &gso_size,
+                                           &len) == 0);
+#endif /* TAO_ECG_HAS_UDP_GSO */
+}
+
+int
+TAO_ECG_CDR_Message_Sender::batch_size (CORBA::ULong new_batch_size)
+{
+  if (new_batch_size > TAO_ECG_CDR_Message_Sender::ECG_MAX_BATCH_SIZE)
+    return -1;
+
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->lock_, -1);
+
+  if (this->staged_count_ != 0)
+    this->flush_staged ();
+
+  Staged_Datagram *staged = 0;
+  if (new_batch_size > 1)
+    {
+      ACE_NEW_RETURN (staged,
+                      Staged_Datagram[new_batch_size],
+                      -1);
+    }
+  delete [] this->staged_;
+  this->staged_ = staged;
+  this->batch_size_ = new_batch_size;
+  return 0;
+}
+
+void
+TAO_ECG_CDR_Message_Sender::flush (void)
+{
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+  this->send_coalesced ();
+  this->flush_staged ();
 }
 
 void
@@ -39,6 +105,26 @@ TAO_ECG_CDR_Message_Sender::send_message  (const TAO_OutputCDR &cdr,
       throw CORBA::INTERNAL ();
     }
 
+  // A message is sent, or staged, as a whole.
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+  if (this->coalesce_)
+    {
+      if (this->coalesce_message (cdr, addr))
+        return;
+
+      // Too big, but it must not overtake the messages already
+      // waiting.
+      this->send_coalesced ();
+    }
+
+  this->send_message_i (cdr, addr);
+}
+
+void
+TAO_ECG_CDR_Message_Sender::send_message_i (const TAO_OutputCDR &cdr,
+                                            const ACE_INET_Addr &addr)
+{
   CORBA::ULong max_fragment_payload = this->mtu () -
     TAO_ECG_CDR_Message_Sender::ECG_HEADER_SIZE;
   // ACE_ASSERT (max_fragment_payload != 0);
@@ -184,14 +270,15 @@ TAO_ECG_CDR_Message_Sender::send_fragment (const ACE_INET_Addr &addr,
                                            CORBA::ULong fragment_id,
                                            CORBA::ULong fragment_count,
                                            iovec iov[],
-                                           int iovcnt)
+                                           int iovcnt,
+                                           CORBA::Octet flags)
 {
   CORBA::ULong header[TAO_ECG_CDR_Message_Sender::ECG_HEADER_SIZE
                      / sizeof(CORBA::ULong)
                      + ACE_CDR::MAX_ALIGNMENT];
   char* buf = reinterpret_cast<char*> (header);
   TAO_OutputCDR cdr (buf, sizeof(header));
-  cdr.write_boolean (TAO_ENCAP_BYTE_ORDER);
+  cdr.write_octet (static_cast<CORBA::Octet> (TAO_ENCAP_BYTE_ORDER) | flags);
   // Insert some known values in the padding bytes, so we can smoke
   // test the message on the receiving end.
   cdr.write_octet ('A'); cdr.write_octet ('B'); cdr.write_octet ('C');
@@ -235,12 +322,33 @@ TAO_ECG_CDR_Message_Sender::send_fragment (const ACE_INET_Addr &addr,
   iov[0].iov_base = cdr.begin ()->rd_ptr ();
   iov[0].iov_len  = cdr.begin ()->length ();
 
-  ssize_t n = this->dgram ().send (iov,
-                                   iovcnt,
-                                   addr);
+  this->send_datagram (addr, iov, iovcnt);
+}
+
+void
+TAO_ECG_CDR_Message_Sender::send_datagram (const ACE_INET_Addr &addr,
+                                           iovec iov[],
+                                           int iovcnt)
+{
   size_t expected_n = 0;
   for (int i = 0; i < iovcnt; ++i)
     expected_n += iov[i].iov_len;
+
+  if (this->batch_size_ > 1)
+    {
+      this->stage_datagram (addr, iov, iovcnt, expected_n);
+      return;
+    }
+
+  ssize_t n = this->dgram ().send (iov,
+                                   iovcnt,
+                                   addr);
+  this->check_send (n, expected_n);
+}
+
+void
+TAO_ECG_CDR_Message_Sender::check_send (ssize_t n, size_t expected_n)
+{
   if (n > 0 && size_t(n) != expected_n)
     {
       ORBSVCS_ERROR ((LM_ERROR, ("Sent only %d out of %d bytes "
@@ -268,6 +376,252 @@ TAO_ECG_CDR_Message_Sender::send_fragment (const ACE_INET_Addr &addr,
     }
 }
 
+bool
+TAO_ECG_CDR_Message_Sender::coalesce_message (const TAO_OutputCDR &cdr,
+                                              const ACE_INET_Addr &addr)
+{
+  size_t const max_payload =
+    this->mtu () - TAO_ECG_CDR_Message_Sender::ECG_HEADER_SIZE;
+  size_t const length = cdr.total_length ();
+
+  // The message size and padding go first, then the message, padded
+  // so the next one starts at an 8-byte boundary.
+  size_t const needed =
+    2 * sizeof (CORBA::ULong) + ACE_align_binary (length, 8);
+  if (needed > max_payload)
+    return false;
+
+  if (this->coalesced_count_ != 0
+      && (addr != this->coalesced_addr_
+          || this->coalesced_.length () + needed > max_payload))
+    this->send_coalesced ();
+
+  if (this->coalesced_count_ == 0)
+    {
+      if (ACE_CDR::grow (&this->coalesced_, max_payload) == -1)
+        return false;
+      ACE_CDR::mb_align (&this->coalesced_);
+      this->coalesced_addr_ = addr;
+    }
+
+  char *buf = this->coalesced_.wr_ptr ();
+  ACE_OS::memset (buf, 0, needed);
+
+  // Written in the native byte order, as announced in the header.
+  CORBA::ULong const message_size = static_cast<CORBA::ULong> (length);
+  ACE_OS::memcpy (buf, &message_size, sizeof (message_size));
+
+  char *dst = buf + 2 * sizeof (CORBA::ULong);
+  for (const ACE_Message_Block *b = cdr.begin ();
+       b != cdr.end ();
+       b = b->cont ())
+    {
+      ACE_OS::memcpy (dst, b->rd_ptr (), b->length ());
+      dst += b->length ();
+    }
+
+  this->coalesced_.wr_ptr (needed);
+  ++this->coalesced_count_;
+  return true;
+}
+
+void
+TAO_ECG_CDR_Message_Sender::send_coalesced (void)
+{
+  if (this->coalesced_count_ == 0)
+    return;
+
+  this->coalesced_count_ = 0;
+
+  CORBA::ULong const size =
+    static_cast<CORBA::ULong> (this->coalesced_.length ());
+
+  iovec iov[2];
+  iov[1].iov_base = this->coalesced_.rd_ptr ();
+  iov[1].iov_len  = size;
+
+  this->send_fragment (this->coalesced_addr_,
+                       this->endpoint_rptr_->next_request_id (),
+                       size,
+                       size,
+                       0,
+                       0,
+                       1,
+                       iov,
+                       2,
+                       TAO_ECG_CDR_Message_Sender::ECG_COALESCED_FLAG);
+}
+
+void
+TAO_ECG_CDR_Message_Sender::stage_datagram (const ACE_INET_Addr &addr,
+                                            iovec iov[],
+                                            int iovcnt,
+                                            size_t total)
+{
+  if (this->staged_count_ == this->batch_size_
+      || this->staging_.space () < total)
+    this->flush_staged ();
+
+  if (this->staging_.space () < total)
+    {
+      // Room for a complete batch of full datagrams.
+      size_t capacity = this->batch_size_ * this->mtu ();
+      if (capacity < total)
+        capacity = total;
+      if (ACE_CDR::grow (&this->staging_, capacity) == -1)
+        throw CORBA::NO_MEMORY ();
+      ACE_CDR::mb_align (&this->staging_);
+    }
+
+  char *dst = this->staging_.wr_ptr ();
+  size_t const offset = dst - this->staging_.rd_ptr ();
+  for (int i = 0; i < iovcnt; ++i)
+    {
+      ACE_OS::memcpy (dst, iov[i].iov_base, iov[i].iov_len);
+      dst += iov[i].iov_len;
+    }
+  this->staging_.wr_ptr (total);
+  ++this->staged_datagrams_;
+
+  if (this->gso_ && this->staged_count_ != 0)
+    {
+      // All the segments of a GSO buffer have the same size, except
+      // the last one, which can be shorter.
+      Staged_Datagram &last = this->staged_[this->staged_count_ - 1];
+      if (last.addr == addr
+          && last.length == last.segment_size * last.segment_count
+          && total <= last.segment_size
+          && last.segment_count
+               < TAO_ECG_CDR_Message_Sender::ECG_MAX_GSO_SEGMENTS
+          && last.length + total <= ECG_MAX_GSO_BUFFER)
+        {
+          last.length += total;
+          ++last.segment_count;
+          return;
+        }
+    }
+
+  Staged_Datagram &staged = this->staged_[this->staged_count_++];
+  staged.addr = addr;
+  staged.offset = offset;
+  staged.length = total;
+  staged.segment_size = total;
+  staged.segment_count = 1;
+}
+
+void
+TAO_ECG_CDR_Message_Sender::flush_staged (void)
+{
+  if (this->staged_count_ == 0)
+    return;
+
+  // Reset the staging area first, sending may throw.  The data
+  // remains valid until the next datagram is staged.
+  size_t const count = this->staged_count_;
+  char * const base = this->staging_.rd_ptr ();
+  this->staged_count_ = 0;
+  this->staged_datagrams_ = 0;
+  ACE_CDR::mb_align (&this->staging_);
+
+#if defined (ACE_HAS_SENDMMSG)
+  mmsghdr msgs[ECG_SENDMMSG_CHUNK];
+  iovec iov[ECG_SENDMMSG_CHUNK];
+# if defined (TAO_ECG_HAS_UDP_GSO)
+  union Control
+  {
+    char buf[CMSG_SPACE (sizeof (uint16_t))];
+    cmsghdr align;
+  };
+  Control control[ECG_SENDMMSG_CHUNK];
+# endif /* TAO_ECG_HAS_UDP_GSO */
+
+  for (size_t first = 0; first < count; first += ECG_SENDMMSG_CHUNK)
+    {
+      size_t n = count - first;
+      if (n > ECG_SENDMMSG_CHUNK)
+        n = ECG_SENDMMSG_CHUNK;
+
+      for (size_t i = 0; i != n; ++i)
+        {
+          Staged_Datagram &staged = this->staged_[first + i];
+          iov[i].iov_base = base + staged.offset;
+          iov[i].iov_len = staged.length;
+
+          msghdr &hdr = msgs[i].msg_hdr;
+          ACE_OS::memset (&msgs[i], 0, sizeof (msgs[i]));
+          hdr.msg_name = staged.addr.get_addr ();
+          hdr.msg_namelen = staged.addr.get_size ();
+          hdr.msg_iov = &iov[i];
+          hdr.msg_iovlen = 1;
+# if defined (TAO_ECG_HAS_UDP_GSO)
+          if (staged.segment_count > 1)
+            {
+              hdr.msg_control = control[i].buf;
+              hdr.msg_controllen = sizeof (control[i].buf);
+              cmsghdr *cm = CMSG_FIRSTHDR (&hdr);
+              cm->cmsg_level = SOL_UDP;
+              cm->cmsg_type = UDP_SEGMENT;
+              cm->cmsg_len = CMSG_LEN (sizeof (uint16_t));
+              uint16_t const segment_size =
+                static_cast<uint16_t> (staged.segment_size);
+              ACE_OS::memcpy (CMSG_DATA (cm),
+                              &segment_size,
+                              sizeof (segment_size));
+            }
+# endif /* TAO_ECG_HAS_UDP_GSO */
+        }
+
+      size_t sent = 0;
+      while (sent < n)
+        {
+          int const r = ::sendmmsg (this->dgram ().get_handle (),
+                                    msgs + sent,
+                                    static_cast<unsigned int> (n - sent),
+                                    0);
+          if (r > 0)
+            {
+              for (int i = 0; i != r; ++i, ++sent)
+                this->check_send (msgs[sent].msg_len,
+                                  this->staged_[first + sent].length);
+              continue;
+            }
+
+          Staged_Datagram &failed = this->staged_[first + sent];
+          ++sent;
+          if (failed.segment_count > 1
+              && (errno == EINVAL || errno == EIO))
+            {
+              // The route or the device cannot segment the buffer,
+              // send it one datagram at a time from now on.
+              this->gso_ = false;
+              for (size_t offset = 0;
+                   offset < failed.length;
+                   offset += failed.segment_size)
+                {
+                  size_t const len =
+                    ACE_MIN (failed.segment_size, failed.length - offset);
+                  ssize_t const n_sent =
+                    this->dgram ().send (base + failed.offset + offset,
+                                         len,
+                                         failed.addr);
+                  this->check_send (n_sent, len);
+                }
+              continue;
+            }
+          this->check_send (-1, failed.length);
+        }
+    }
+#else
+  for (size_t i = 0; i != count; ++i)
+    {
+      Staged_Datagram &staged = this->staged_[i];
+      ssize_t const n = this->dgram ().send (base + staged.offset,
+                                             staged.length,
+                                             staged.addr);
+      this->check_send (n, staged.length);
+    }
+#endif /* ACE_HAS_SENDMMSG */
+}
 
 CORBA::ULong
 TAO_ECG_CDR_Message_Sender::compute_fragment_count (const ACE_Message_Block* begin,
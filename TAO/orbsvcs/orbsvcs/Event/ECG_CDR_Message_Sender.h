@@ -23,6 +23,7 @@
 #include "tao/SystemException.h"
 
 #include "ace/INET_Addr.h"
+#include "ace/Thread_Mutex.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -30,7 +31,9 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
  * @class TAO_ECG_CDR_Message_Sender
  *
  * @brief Sends CDR messages using UDP.
- *        NOT THREAD-SAFE.
+ *
+ * send_message() and flush() can be called from several threads, the
+ * other methods configure the sender before it is used.
  *
  * This class breaks up a CDR message into fragments and sends each
  * fragment with a header (described below) using UDP.
@@ -69,6 +72,30 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
  *
  * // Ensures the header ends at an 8-byte boundary.
  * }; // size (in CDR stream) = 32
+ *
+ * <H2>COALESCED MESSAGES</H2>
+ * When coalescing is enabled several small messages for the same
+ * address are sent in a single datagram.  Such datagrams have bit 2
+ * of byte_order_flags set, a fragment_count of 1, and their payload
+ * is a sequence of:
+ * struct Coalesced_Message {
+ * unsigned long message_size;
+ * octet padding[4];
+ * octet message[message_size];
+ * // followed by padding up to the next 8-byte boundary
+ * };
+ * Each message is thus a complete CDR stream that starts at an
+ * 8-byte boundary.  Receivers older than this format reject those
+ * datagrams, coalescing must only be enabled when all the receivers
+ * understand it.
+ *
+ * <H2>BATCHING</H2>
+ * When batching is enabled the datagrams are copied to a staging
+ * buffer, and sent with a single system call by flush() (or once the
+ * batch is full), using sendmmsg() where available.  On Linux
+ * consecutive datagrams for the same address that have the same size
+ * are also handed to the kernel as a single UDP GSO (generic
+ * segmentation offload) buffer, if the kernel supports it.
  */
 class TAO_RTEvent_Serv_Export TAO_ECG_CDR_Message_Sender
 {
@@ -78,13 +105,19 @@ public:
     ECG_HEADER_SIZE = 32,
     ECG_MIN_MTU = 32 + 8,
     ECG_MAX_MTU = 65536, // Really optimistic...
-    ECG_DEFAULT_MTU = 1024
+    ECG_DEFAULT_MTU = 1024,
+    ECG_COALESCED_FLAG = 0x04,
+    ECG_MAX_BATCH_SIZE = 1024,
+    ECG_MAX_GSO_SEGMENTS = 64
   };
 
   /// Initialization and termination methods.
   //@{
   TAO_ECG_CDR_Message_Sender (CORBA::Boolean crc = 0);
 
+  /// Destructor
+  ~TAO_ECG_CDR_Message_Sender (void);
+
   /// Set the endpoint for sending messages.
   /**
    * If init () is successful, shutdown () must be called when the
@@ -110,6 +143,21 @@ public:
    */
   int mtu (CORBA::ULong mtu);
   CORBA::ULong mtu (void) const;
+
+  /**
+   * Stage up to @a batch_size datagrams and send them with a single
+   * system call.  A value of 0 or 1 disables batching, and every
+   * datagram is sent as soon as it is ready.
+   * Setting the batch size fails if the value is larger than
+   * ECG_MAX_BATCH_SIZE.
+   */
+  int batch_size (CORBA::ULong batch_size);
+  CORBA::ULong batch_size (void) const;
+
+  /// Enable or disable the coalescing of small messages, see the
+  /// message format description above.
+  void coalesce (int enable);
+  int coalesce (void) const;
   //@}
 
   /// The main method - send a CDR message.
@@ -129,7 +177,45 @@ public:
   void send_message (const TAO_OutputCDR &cdr,
                      const ACE_INET_Addr &addr);
 
+  /**
+   * Send any datagrams that are waiting in the staging buffer or in
+   * the coalescing buffer.  When batching or coalescing are enabled
+   * this must be called after the last send_message() of a burst,
+   * otherwise the messages may be delayed indefinitely.
+   */
+  void flush (void);
+
 private:
+  /// Send the message, fragmenting it if needed.
+  void send_message_i (const TAO_OutputCDR &cdr,
+                       const ACE_INET_Addr &addr);
+
+  /// Try to add a complete message to the coalescing buffer, return
+  /// false if the message is too big to be coalesced.
+  bool coalesce_message (const TAO_OutputCDR &cdr,
+                         const ACE_INET_Addr &addr);
+
+  /// Send the coalescing buffer, if not empty.
+  void send_coalesced (void);
+
+  /// Send a datagram, or copy it to the staging buffer if batching
+  /// is enabled.
+  void send_datagram (const ACE_INET_Addr &addr,
+                      iovec iov[],
+                      int iovcnt);
+
+  /// Copy a datagram to the staging buffer.
+  void stage_datagram (const ACE_INET_Addr &addr,
+                       iovec iov[],
+                       int iovcnt,
+                       size_t total);
+
+  /// Send the datagrams in the staging buffer.
+  void flush_staged (void);
+
+  /// Log the result of sending @a expected_n bytes.
+  void check_send (ssize_t n, size_t expected_n);
+
   /// Return the datagram...
   ACE_SOCK_Dgram& dgram (void);
 
@@ -146,7 +232,8 @@ private:
                       CORBA::ULong fragment_id,
                       CORBA::ULong fragment_count,
                       iovec iov[],
-                      int iovcnt);
+                      int iovcnt,
+                      CORBA::Octet flags = 0);
 
   /**
    * Count the number of fragments that will be required to send the
@@ -169,6 +256,50 @@ private:
 
   /// Should crc checksum be calculated and sent?
   CORBA::Boolean checksum_;
+
+  /// The maximum number of datagrams sent with a single system call.
+  CORBA::ULong batch_size_;
+
+  /// Are small messages coalesced?
+  int coalesce_;
+
+  /// Small messages waiting to be sent in a single datagram.
+  ACE_Message_Block coalesced_;
+
+  /// The destination of the messages in <coalesced_>
+  ACE_INET_Addr coalesced_addr_;
+
+  /// The number of messages in <coalesced_>
+  CORBA::ULong coalesced_count_;
+
+  /// A datagram, or a series of equally sized datagrams sent as a
+  /// single GSO buffer, waiting in the staging buffer.
+  struct Staged_Datagram
+  {
+    ACE_INET_Addr addr;
+    size_t offset;
+    size_t length;
+    size_t segment_size;
+    size_t segment_count;
+  };
+
+  /// The datagrams in the staging buffer.
+  Staged_Datagram *staged_;
+
+  /// The number of entries used in <staged_>, and the total number
+  /// of datagrams they represent.
+  size_t staged_count_;
+  size_t staged_datagrams_;
+
+  /// The staging buffer.
+  ACE_Message_Block staging_;
+
+  /// Can the datagrams be sent as UDP GSO buffers?
+  bool gso_;
+
+  /// Serializes the threads that send messages, they share the
+  /// coalescing and staging buffers.
+  TAO_SYNCH_MUTEX lock_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
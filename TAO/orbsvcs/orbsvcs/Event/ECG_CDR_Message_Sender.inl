@@ -1,5 +1,6 @@
 // -*- C++ -*-
 #include "ace/Null_Mutex.h"
+#include "ace/Guard_T.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -8,12 +9,29 @@ TAO_ECG_CDR_Message_Sender::TAO_ECG_CDR_Message_Sender (CORBA::Boolean crc)
   :  endpoint_rptr_ ()
      , mtu_ (TAO_ECG_CDR_Message_Sender::ECG_DEFAULT_MTU)
      , checksum_ (crc)
+     , batch_size_ (0)
+     , coalesce_ (0)
+     , coalesced_addr_ ()
+     , coalesced_count_ (0)
+     , staged_ (0)
+     , staged_count_ (0)
+     , staged_datagrams_ (0)
+     , gso_ (false)
 {
 }
 
 ACE_INLINE void
 TAO_ECG_CDR_Message_Sender::shutdown (void)
 {
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+  // Discard anything that was not flushed.
+  this->coalesced_.reset ();
+  this->coalesced_count_ = 0;
+  this->staging_.reset ();
+  this->staged_count_ = 0;
+  this->staged_datagrams_ = 0;
+
   // Release the endpoint.
   TAO_ECG_Refcounted_Endpoint empty_endpoint_rptr;
   this->endpoint_rptr_ = empty_endpoint_rptr;
@@ -50,4 +68,22 @@ TAO_ECG_CDR_Message_Sender::mtu (CORBA::ULong new_mtu)
   return 0;
 }
 
+ACE_INLINE CORBA::ULong
+TAO_ECG_CDR_Message_Sender::batch_size (void) const
+{
+  return this->batch_size_;
+}
+
+ACE_INLINE int
+TAO_ECG_CDR_Message_Sender::coalesce (void) const
+{
+  return this->coalesce_;
+}
+
+ACE_INLINE void
+TAO_ECG_CDR_Message_Sender::coalesce (int enable)
+{
+  this->coalesce_ = enable;
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
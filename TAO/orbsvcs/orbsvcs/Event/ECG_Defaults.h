@@ -49,6 +49,14 @@
 # define TAO_ECG_DEFAULT_NON_BLOCKING 1 /* write sockets are non-blocking */
 #endif /* TAO_ECG_DEFAULT_NON_BLOCKING */
 
+#ifndef TAO_ECG_DEFAULT_BATCH_SIZE
+# define TAO_ECG_DEFAULT_BATCH_SIZE 0 /* one datagram per system call */
+#endif /* TAO_ECG_DEFAULT_BATCH_SIZE */
+
+#ifndef TAO_ECG_DEFAULT_COALESCE
+# define TAO_ECG_DEFAULT_COALESCE 0 /* one datagram per event */
+#endif /* TAO_ECG_DEFAULT_COALESCE */
+
 #ifndef TAO_ECG_DEFAULT_IIOP_CONSUMEREC_CONTROL
 # define TAO_ECG_DEFAULT_IIOP_CONSUMEREC_CONTROL 0 /* null */
 #endif /* TAO_ECG_DEFAULT_IIOP_CONSUMEREC_CONTROL */
@@ -190,6 +190,30 @@ TAO_ECG_Mcast_Gateway::init (int argc, ACE_TCHAR* argv[])
             }
         }
 
+      else if (ACE_OS::strcasecmp (arg, ACE_TEXT ("-ECGBATCHSIZE")) == 0)
+        {
+          arg_shifter.consume_arg ();
+
+          if (arg_shifter.is_parameter_next ())
+            {
+              this->batch_size_ =
+                ACE_OS::strtoul (arg_shifter.get_current (), 0, 10);
+              arg_shifter.consume_arg ();
+            }
+        }
+
+      else if (ACE_OS::strcasecmp (arg, ACE_TEXT ("-ECGCOALESCE")) == 0)
+        {
+          arg_shifter.consume_arg ();
+
+          if (arg_shifter.is_parameter_next ())
+            {
+              this->coalesce_ =
+                (ACE_OS::atoi(arg_shifter.get_current()) != 0);
+              arg_shifter.consume_arg ();
+            }
+        }
+
       else
         {
           arg_shifter.ignore_arg ();
@@ -220,6 +244,8 @@ TAO_ECG_Mcast_Gateway::init (const char * address_server_arg,
   this->nic_.set (ACE_TEXT_CHAR_TO_TCHAR(attr.nic.c_str ()));
   this->ip_multicast_loop_ = attr.ip_multicast_loop;
   this->non_blocking_ = attr.non_blocking;
+  this->batch_size_ = attr.batch_size;
+  this->coalesce_ = attr.coalesce;
 
   return this->validate_configuration ();
 }
@@ -276,6 +302,22 @@ TAO_ECG_Mcast_Gateway::validate_configuration (void)
       return -1;
     }
 
+  if (this->batch_size_ > TAO_ECG_CDR_Message_Sender::ECG_MAX_BATCH_SIZE)
+    {
+      ORBSVCS_DEBUG ((LM_ERROR,
+                  "BATCH SIZE must not be greater than %d.\n",
+                  TAO_ECG_CDR_Message_Sender::ECG_MAX_BATCH_SIZE));
+      return -1;
+    }
+
+  if (this->coalesce_ != 0
+      && this->coalesce_ != 1)
+    {
+      ORBSVCS_DEBUG ((LM_ERROR,
+                  "COALESCE flag must have a boolean value.\n"));
+      return -1;
+    }
+
   return 0;
 }
 
@@ -494,6 +536,9 @@ TAO_ECG_Mcast_Gateway::init_sender (
                 address_server,
                 endpoint_rptr);
 
+  sender->batch_size (this->batch_size_);
+  sender->coalesce (this->coalesce_);
+
   TAO_EC_Auto_Command<UDP_Sender_Shutdown> sender_shutdown;
   sender_shutdown.set_command (UDP_Sender_Shutdown (sender));
 
@@ -537,6 +582,8 @@ TAO_ECG_Mcast_Gateway::init_receiver (
                   endpoint_rptr,
                   address_server);
 
+  receiver->batch_size (this->batch_size_);
+
   TAO_EC_Auto_Command<UDP_Receiver_Shutdown> receiver_shutdown;
   receiver_shutdown.set_command (UDP_Receiver_Shutdown (receiver));
 
@@ -112,6 +112,20 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
  *  NOTE: Certain device drivers block the process if the physical
  *        link fails.
  *
+ * -ECGBatchSize <n>
+ *  Valid values: 0 to 1024
+ *  Number of datagrams sent or received with a single system call,
+ *  where the platform supports sendmmsg() and recvmmsg().  On Linux
+ *  the sender also uses UDP segmentation offload and the receiver
+ *  UDP GRO when the kernel supports them.  The default (0) sends and
+ *  receives one datagram at a time.
+ *
+ * -ECGCoalesce <0|1>
+ *  Boolean flag to configure if the events pushed together for the
+ *  same multicast group are packed in as few datagrams as possible.
+ *  All the receivers must run a version of the gateway that
+ *  understands coalesced datagrams.  The default is not to coalesce.
+ *
  * 2) Create an instance of TAO_ECG_Mcast_Gateway in your code, on the stack or
  *    dynamically, and use init () method to configure it.  No
  *    configuration files involved.  See service config options above for the
@@ -191,6 +205,8 @@ public:
     ACE_CString nic;
     int ip_multicast_loop;
     int non_blocking;
+    CORBA::ULong batch_size;
+    int coalesce;
   };
 
   /// Configure TAO_ECG_Mcast_Gateway programatically.  This method should
@@ -263,6 +279,8 @@ private:
   ACE_TString nic_;
   int ip_multicast_loop_;
   int non_blocking_;
+  CORBA::ULong batch_size_;
+  int coalesce_;
 
   RtecEventChannelAdmin::ConsumerQOS consumer_qos_;
   //@}
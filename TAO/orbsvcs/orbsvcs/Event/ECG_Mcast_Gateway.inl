@@ -11,6 +11,8 @@ TAO_ECG_Mcast_Gateway::TAO_ECG_Mcast_Gateway (void)
   , nic_ (static_cast<const ACE_TCHAR *> (TAO_ECG_DEFAULT_NIC))
   , ip_multicast_loop_ (TAO_ECG_DEFAULT_IP_MULTICAST_LOOP)
   , non_blocking_ (TAO_ECG_DEFAULT_NON_BLOCKING)
+  , batch_size_ (TAO_ECG_DEFAULT_BATCH_SIZE)
+  , coalesce_ (TAO_ECG_DEFAULT_COALESCE)
   , consumer_qos_ ()
 {
   this->consumer_qos_.dependencies.length (0);
@@ -25,6 +27,8 @@ TAO_ECG_Mcast_Gateway::Attributes::Attributes (void)
   , nic (static_cast<const char *> (TAO_ECG_DEFAULT_NIC))
   , ip_multicast_loop (TAO_ECG_DEFAULT_IP_MULTICAST_LOOP)
   , non_blocking (TAO_ECG_DEFAULT_NON_BLOCKING)
+  , batch_size (TAO_ECG_DEFAULT_BATCH_SIZE)
+  , coalesce (TAO_ECG_DEFAULT_COALESCE)
 {
 }
 
@@ -165,12 +165,32 @@ public:
 int
 TAO_ECG_Event_CDR_Decoder::decode (TAO_InputCDR &cdr)
 {
-  if (!(cdr >> this->events))
+  // Batched reads and coalesced datagrams deliver several messages,
+  // append their events to the ones already decoded.
+  if (this->events.length () == 0)
+    {
+      if (!(cdr >> this->events))
+        {
+          ORBSVCS_ERROR_RETURN ((LM_ERROR,
+                             "Error decoding events cdr.\n"),
+                            -1);
+        }
+      return 0;
+    }
+
+  RtecEventComm::EventSet more;
+  if (!(cdr >> more))
     {
       ORBSVCS_ERROR_RETURN ((LM_ERROR,
                          "Error decoding events cdr.\n"),
                         -1);
     }
+
+  CORBA::ULong const length = this->events.length ();
+  this->events.length (length + more.length ());
+  for (CORBA::ULong i = 0; i != more.length (); ++i)
+    this->events[length + i] = more[i];
+
   return 0;
 }
 
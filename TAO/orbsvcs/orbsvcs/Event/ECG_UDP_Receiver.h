@@ -171,6 +171,11 @@ public:
   void get_address (const RtecEventComm::EventHeader& header,
                     RtecUDPAdmin::UDP_Address_out addr);
 
+  /// Read up to @a batch_size datagrams each time the socket becomes
+  /// readable, all the events received are pushed to the local Event
+  /// Channel in a single EventSet.
+  int batch_size (CORBA::ULong batch_size);
+
   /// The PushSupplier idl method.
   /// Invokes shutdown (), which may result in the object being deleted, if
   /// refcounting is used to manage its lifetime.
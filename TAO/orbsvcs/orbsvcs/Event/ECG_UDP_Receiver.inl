@@ -66,6 +66,12 @@ TAO_ECG_UDP_Receiver::TAO_ECG_UDP_Receiver (CORBA::Boolean perform_crc)
 {
 }
 
+ACE_INLINE int
+TAO_ECG_UDP_Receiver::batch_size (CORBA::ULong new_batch_size)
+{
+  return this->cdr_receiver_.batch_size (new_batch_size);
+}
+
 ACE_INLINE PortableServer::Servant_var<TAO_ECG_UDP_Receiver>
 TAO_ECG_UDP_Receiver::create (CORBA::Boolean perform_crc)
 {
@@ -165,9 +165,9 @@ TAO_ECG_UDP_Sender::push (const RtecEventComm::EventSet &events)
       return;
     }
 
-  // Send each event in a separate message.
-  // @@ TODO It is interesting to group events destined to the
-  // same mcast group in a single message.
+  // Send each event in a separate message, the CDR sender coalesces
+  // and batches the messages when configured to do so, and flushes
+  // them before we return.
   for (u_int i = 0; i < events.length (); ++i)
     {
       // To avoid loops we keep a TTL field on the events and skip the
@@ -227,6 +227,8 @@ TAO_ECG_UDP_Sender::push (const RtecEventComm::EventSet &events)
 
       this->cdr_sender_.send_message (cdr, inet_addr);
     }
+
+  this->cdr_sender_.flush ();
 }
 
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -164,6 +164,15 @@ public:
 
   /// Get the local endpoint used to send the events.
   int get_local_addr (ACE_INET_Addr& addr);
+
+  /// Send up to @a batch_size datagrams with a single system call,
+  /// see TAO_ECG_CDR_Message_Sender.
+  int batch_size (CORBA::ULong batch_size);
+
+  /// Pack the events pushed together for the same multicast group in
+  /// as few datagrams as possible.  The receivers must understand
+  /// coalesced datagrams.
+  void coalesce (int enable);
   //@}
 
   /// The PushConsumer methods.
@@ -40,6 +40,18 @@ TAO_ECG_UDP_Sender::get_local_addr (ACE_INET_Addr& addr)
 {
   return this->cdr_sender_.get_local_addr (addr);
 }
+
+ACE_INLINE int
+TAO_ECG_UDP_Sender::batch_size (CORBA::ULong new_batch_size)
+{
+  return this->cdr_sender_.batch_size (new_batch_size);
+}
+
+ACE_INLINE void
+TAO_ECG_UDP_Sender::coalesce (int enable)
+{
+  this->cdr_sender_.coalesce (enable);
+}
 //***************************************************************************
 
 ACE_INLINE
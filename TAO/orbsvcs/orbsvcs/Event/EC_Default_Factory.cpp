@@ -2,6 +2,7 @@
 #include "orbsvcs/Event/EC_Default_Factory.h"
 #include "orbsvcs/Event/EC_Reactive_Dispatching.h"
 #include "orbsvcs/Event/EC_MT_Dispatching.h"
+#include "orbsvcs/Event/EC_Sharded_Dispatching.h"
 #include "orbsvcs/Event/EC_Basic_Filter_Builder.h"
 #include "orbsvcs/Event/EC_Prefix_Filter_Builder.h"
 #include "orbsvcs/Event/EC_ConsumerAdmin.h"
@@ -9,6 +10,7 @@
 #include "orbsvcs/Event/EC_Default_ProxyConsumer.h"
 #include "orbsvcs/Event/EC_Default_ProxySupplier.h"
 #include "orbsvcs/Event/EC_Trivial_Supplier_Filter.h"
+#include "orbsvcs/Event/EC_Type_Index_Supplier_Filter.h"
 #include "orbsvcs/Event/EC_Per_Supplier_Filter.h"
 #include "orbsvcs/Event/EC_ObserverStrategy.h"
 #include "orbsvcs/Event/EC_Null_Scheduling.h"
@@ -90,6 +92,8 @@ TAO_EC_Default_Factory::init (int argc, ACE_TCHAR* argv[])
                 this->dispatching_ = 0;
               else if (ACE_OS::strcasecmp (opt, ACE_TEXT("mt")) == 0)
                 this->dispatching_ = 1;
+              else if (ACE_OS::strcasecmp (opt, ACE_TEXT("sharded")) == 0)
+                this->dispatching_ = 2;
               else
                   this->unsupported_option_value (ACE_TEXT("-ECDispatching"), opt);
               arg_shifter.consume_arg ();
@@ -173,6 +177,8 @@ TAO_EC_Default_Factory::init (int argc, ACE_TCHAR* argv[])
                 this->supplier_filtering_ = 0;
               else if (ACE_OS::strcasecmp (opt, ACE_TEXT("per-supplier")) == 0)
                 this->supplier_filtering_ = 1;
+              else if (ACE_OS::strcasecmp (opt, ACE_TEXT("type-index")) == 0)
+                this->supplier_filtering_ = 2;
               else
                   this->unsupported_option_value (ACE_TEXT("-ECSupplierFilter"), opt);
               arg_shifter.consume_arg ();
@@ -550,6 +556,17 @@ TAO_EC_Default_Factory::create_dispatching (TAO_EC_Event_Channel_Base *)
                                         this->dispatching_threads_force_active_,
                                         so);
     }
+  else if (this->dispatching_ == 2)
+    {
+      TAO_EC_Queue_Full_Service_Object* so =
+        this->find_service_object (this->queue_full_service_object_name_.fast_rep(),
+                                   TAO_EC_DEFAULT_QUEUE_FULL_SERVICE_OBJECT_NAME);
+      return new TAO_EC_Sharded_Dispatching (this->dispatching_threads_,
+                                             this->dispatching_threads_flags_,
+                                             this->dispatching_threads_priority_,
+                                             this->dispatching_threads_force_active_,
+                                             so);
+    }
   return 0;
 }
 
@@ -584,6 +601,8 @@ TAO_EC_Default_Factory::create_supplier_filter_builder (TAO_EC_Event_Channel_Bas
     return new TAO_EC_Trivial_Supplier_Filter_Builder (ec);
   else if (this->supplier_filtering_ == 1)
     return new TAO_EC_Per_Supplier_Filter_Builder (ec);
+  else if (this->supplier_filtering_ == 2)
+    return new TAO_EC_Type_Index_Supplier_Filter_Builder (ec);
   return 0;
 }
 
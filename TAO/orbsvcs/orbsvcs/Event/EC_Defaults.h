@@ -101,6 +101,10 @@
 # define TAO_EC_DEFAULT_DISPATCHING_THREADS_FORCE_ACTIVE 1
 #endif /* TAO_EC_DEFAULT_DISPATCHING_THREADS_FORCE_ACTIVE */
 
+#ifndef TAO_EC_DEFAULT_SHARDED_IDLE_WAIT
+# define TAO_EC_DEFAULT_SHARDED_IDLE_WAIT 10000 /* usecs */
+#endif /* TAO_EC_DEFAULT_SHARDED_IDLE_WAIT */
+
 #ifndef TAO_EC_DEFAULT_ORB_ID
 # define TAO_EC_DEFAULT_ORB_ID "" /* */
 #endif /* TAO_EC_DEFAULT_ORB_ID */
@@ -0,0 +1,453 @@
+#include "orbsvcs/Log_Macros.h"
+#include "orbsvcs/Event/EC_Sharded_Dispatching.h"
+#include "orbsvcs/Event/EC_Defaults.h"
+
+#include "tao/ORB_Constants.h"
+#include "ace/OS_NS_sys_time.h"
+
+#ifndef TAO_EC_QUEUE_HWM
+#define TAO_EC_QUEUE_HWM 16384
+#endif
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+TAO_EC_Sharded_Batch::TAO_EC_Sharded_Batch (TAO_EC_ProxyPushSupplier *proxy)
+  :  proxy_ (proxy),
+     head_ (0),
+     tail_ (0),
+     count_ (0),
+     next_ready_ (0),
+     ready_ (false),
+     running_ (false)
+{
+}
+
+// ****************************************************************
+
+TAO_EC_Sharded_Queue::TAO_EC_Sharded_Queue (void)
+  :  cond_ (lock_),
+     ready_head_ (0),
+     ready_tail_ (0),
+     count_ (0),
+     idle_ (0),
+     shutdown_ (false)
+{
+}
+
+TAO_EC_Sharded_Queue::~TAO_EC_Sharded_Queue (void)
+{
+  this->clear_i ();
+}
+
+void
+TAO_EC_Sharded_Queue::put_i (TAO_EC_ProxyPushSupplier *proxy,
+                             ACE_Message_Block *command)
+{
+  TAO_EC_Sharded_Batch *batch = 0;
+  if (this->batches_.find (proxy, batch) != 0)
+    {
+      ACE_NEW_THROW_EX (batch,
+                        TAO_EC_Sharded_Batch (proxy),
+                        CORBA::NO_MEMORY (TAO::VMCID, CORBA::COMPLETED_NO));
+      if (this->batches_.bind (proxy, batch) != 0)
+        {
+          delete batch;
+          ACE_Message_Block::release (command);
+          throw CORBA::NO_MEMORY (TAO::VMCID, CORBA::COMPLETED_NO);
+        }
+    }
+
+  if (batch->tail_ == 0)
+    batch->head_ = command;
+  else
+    batch->tail_->next (command);
+  batch->tail_ = command;
+  ++batch->count_;
+  ++this->count_;
+
+  // A running batch is put back in the ready list by the thread
+  // running it, if needed.
+  if (!batch->ready_ && !batch->running_)
+    {
+      batch->ready_ = true;
+      batch->next_ready_ = 0;
+      if (this->ready_tail_ == 0)
+        this->ready_head_ = batch;
+      else
+        this->ready_tail_->next_ready_ = batch;
+      this->ready_tail_ = batch;
+    }
+}
+
+TAO_EC_Sharded_Batch *
+TAO_EC_Sharded_Queue::take_i (void)
+{
+  TAO_EC_Sharded_Batch *batch = this->ready_head_;
+  if (batch == 0)
+    return 0;
+
+  this->ready_head_ = batch->next_ready_;
+  if (this->ready_head_ == 0)
+    this->ready_tail_ = 0;
+
+  batch->next_ready_ = 0;
+  batch->ready_ = false;
+  batch->running_ = true;
+  return batch;
+}
+
+void
+TAO_EC_Sharded_Queue::release_i (TAO_EC_Sharded_Batch *batch)
+{
+  batch->running_ = false;
+
+  if (batch->head_ == 0)
+    {
+      this->batches_.unbind (batch->proxy_);
+      delete batch;
+      return;
+    }
+
+  // More events arrived while the batch was running, go to the end
+  // of the line so other consumers get their turn.
+  batch->ready_ = true;
+  batch->next_ready_ = 0;
+  if (this->ready_tail_ == 0)
+    this->ready_head_ = batch;
+  else
+    this->ready_tail_->next_ready_ = batch;
+  this->ready_tail_ = batch;
+}
+
+void
+TAO_EC_Sharded_Queue::clear_i (void)
+{
+  Batch_Map::iterator end = this->batches_.end ();
+  for (Batch_Map::iterator i = this->batches_.begin (); i != end; ++i)
+    {
+      TAO_EC_Sharded_Batch *batch = (*i).int_id_;
+      while (batch->head_ != 0)
+        {
+          ACE_Message_Block *mb = batch->head_;
+          batch->head_ = mb->next ();
+          mb->next (0);
+          ACE_Message_Block::release (mb);
+        }
+      delete batch;
+    }
+  this->batches_.unbind_all ();
+  this->ready_head_ = 0;
+  this->ready_tail_ = 0;
+  this->count_ = 0;
+}
+
+// ****************************************************************
+
+TAO_EC_Sharded_Dispatching_Task::TAO_EC_Sharded_Dispatching_Task (
+      TAO_EC_Sharded_Dispatching *dispatching)
+  :  dispatching_ (dispatching),
+     next_queue_ (0)
+{
+}
+
+int
+TAO_EC_Sharded_Dispatching_Task::svc (void)
+{
+  long const index = this->next_queue_++;
+  this->dispatching_->svc (static_cast<size_t> (index));
+  return 0;
+}
+
+// ****************************************************************
+
+TAO_EC_Sharded_Dispatching::TAO_EC_Sharded_Dispatching (
+      int nthreads,
+      int thread_creation_flags,
+      int thread_priority,
+      int force_activate,
+      TAO_EC_Queue_Full_Service_Object* service_object)
+  :  nthreads_ (nthreads > 0 ? nthreads : 1),
+     thread_creation_flags_ (thread_creation_flags),
+     thread_priority_ (thread_priority),
+     force_activate_ (force_activate),
+     queues_ (0),
+     task_ (this),
+     queue_full_service_object_ (service_object),
+     active_ (0)
+{
+  ACE_NEW (this->queues_, TAO_EC_Sharded_Queue[this->nthreads_]);
+  this->task_.thr_mgr (&this->thread_manager_);
+}
+
+TAO_EC_Sharded_Dispatching::~TAO_EC_Sharded_Dispatching (void)
+{
+  delete [] this->queues_;
+}
+
+void
+TAO_EC_Sharded_Dispatching::activate (void)
+{
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+  // Once shut down the events are dispatched by the pushing thread,
+  // see push_nocopy().
+  if (this->active_ != 0 || this->queues_[0].shutdown_)
+    return;
+
+  this->active_ = 1;
+
+  if (this->task_.activate (this->thread_creation_flags_,
+                            this->nthreads_,
+                            1,
+                            this->thread_priority_) == -1)
+    {
+      if (this->force_activate_ != 0)
+        {
+          ORBSVCS_DEBUG ((LM_DEBUG,
+                      "EC (%P|%t) activating sharded dispatching queues at"
+                      " default priority\n"));
+          if (this->task_.activate (THR_BOUND, this->nthreads_) == -1)
+            ORBSVCS_ERROR ((LM_ERROR,
+                        "EC (%P|%t) cannot activate sharded dispatching queues.\n"));
+        }
+    }
+}
+
+void
+TAO_EC_Sharded_Dispatching::shutdown (void)
+{
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+    if (this->active_ == 0)
+      return;
+
+    this->active_ = 0;
+
+    // The threads drain the pending events before exiting.
+    for (int i = 0; i < this->nthreads_; ++i)
+      {
+        TAO_EC_Sharded_Queue &queue = this->queues_[i];
+        ACE_GUARD (TAO_SYNCH_MUTEX, queue_mon, queue.lock_);
+        queue.shutdown_ = true;
+        queue.cond_.broadcast ();
+      }
+  }
+
+  // Not holding the lock, a thread draining its queue may need it.
+  this->thread_manager_.wait ();
+
+  for (int i = 0; i < this->nthreads_; ++i)
+    {
+      TAO_EC_Sharded_Queue &queue = this->queues_[i];
+      ACE_GUARD (TAO_SYNCH_MUTEX, queue_mon, queue.lock_);
+      queue.clear_i ();
+    }
+}
+
+void
+TAO_EC_Sharded_Dispatching::push (TAO_EC_ProxyPushSupplier* proxy,
+                                  RtecEventComm::PushConsumer_ptr consumer,
+                                  const RtecEventComm::EventSet& event,
+                                  TAO_EC_QOS_Info& qos_info)
+{
+  RtecEventComm::EventSet event_copy = event;
+  this->push_nocopy (proxy, consumer, event_copy, qos_info);
+}
+
+void
+TAO_EC_Sharded_Dispatching::push_nocopy (TAO_EC_ProxyPushSupplier* proxy,
+                                         RtecEventComm::PushConsumer_ptr consumer,
+                                         RtecEventComm::EventSet& event,
+                                         TAO_EC_QOS_Info&)
+{
+  // Double checked locking....
+  if (this->active_ == 0)
+    this->activate ();
+
+  ACE_Pointer_Hash<TAO_EC_ProxyPushSupplier*> hash;
+  size_t const index = hash (proxy) % this->nthreads_;
+  TAO_EC_Sharded_Queue &queue = this->queues_[index];
+
+  if (this->queue_full_service_object_ != 0)
+    {
+      bool full = false;
+      {
+        ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, queue.lock_);
+        full = queue.count_ > TAO_EC_QUEUE_HWM;
+      }
+      // There is no single task to report, the action cannot depend
+      // on it.
+      if (full
+          && this->queue_full_service_object_->queue_full_action (
+               0, proxy, consumer, event)
+                 == TAO_EC_Queue_Full_Service_Object::SILENTLY_DISCARD)
+        return;
+    }
+
+  ACE_Allocator *allocator = ACE_Allocator::instance ();
+  void* buf = allocator->malloc (sizeof (TAO_EC_Push_Command));
+
+  if (buf == 0)
+    throw CORBA::NO_MEMORY (TAO::VMCID, CORBA::COMPLETED_NO);
+
+  ACE_Message_Block *mb =
+    new (buf) TAO_EC_Push_Command (proxy,
+                                   consumer,
+                                   event,
+                                   queue.data_block_.duplicate (),
+                                   allocator);
+
+  bool owner_idle = true;
+  bool shut_down = false;
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, queue.lock_);
+
+    shut_down = queue.shutdown_;
+    if (!shut_down)
+      {
+        queue.put_i (proxy, mb);
+        owner_idle = queue.idle_.value () != 0;
+        if (owner_idle)
+          queue.cond_.signal ();
+      }
+  }
+
+  if (shut_down)
+    {
+      // The threads are gone or about to exit, nobody would run the
+      // command, dispatch it in this thread instead.
+      try
+        {
+          static_cast<TAO_EC_Dispatch_Command*> (mb)->execute ();
+        }
+      catch (...)
+        {
+          ACE_Message_Block::release (mb);
+          throw;
+        }
+      ACE_Message_Block::release (mb);
+      return;
+    }
+
+  if (!owner_idle)
+    this->wakeup_thief (index);
+}
+
+void
+TAO_EC_Sharded_Dispatching::wakeup_thief (size_t index)
+{
+  for (int i = 1; i < this->nthreads_; ++i)
+    {
+      TAO_EC_Sharded_Queue &queue =
+        this->queues_[(index + i) % this->nthreads_];
+      // This is only a hint, a thread that misses it will find the
+      // work once its idle wait times out.
+      if (queue.idle_.value () != 0)
+        {
+          queue.cond_.signal ();
+          return;
+        }
+    }
+}
+
+void
+TAO_EC_Sharded_Dispatching::svc (size_t index)
+{
+  if (index >= static_cast<size_t> (this->nthreads_))
+    return;
+
+  TAO_EC_Sharded_Queue &own = this->queues_[index];
+  ACE_Time_Value const idle_wait (0, TAO_EC_DEFAULT_SHARDED_IDLE_WAIT);
+
+  for (;;)
+    {
+      TAO_EC_Sharded_Queue *owner = 0;
+      TAO_EC_Sharded_Batch *batch = this->next_batch (index, owner);
+
+      if (batch != 0)
+        {
+          this->run_batch (*owner, batch);
+          continue;
+        }
+
+      ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, own.lock_);
+
+      if (own.ready_head_ != 0)
+        continue;
+
+      // Nothing to run here and nothing to steal, the other threads
+      // will drain any batch they are running.
+      if (own.shutdown_)
+        return;
+
+      own.idle_ = 1;
+      ACE_Time_Value const deadline = ACE_OS::gettimeofday () + idle_wait;
+      own.cond_.wait (&deadline);
+      own.idle_ = 0;
+    }
+}
+
+TAO_EC_Sharded_Batch *
+TAO_EC_Sharded_Dispatching::next_batch (size_t index,
+                                        TAO_EC_Sharded_Queue *&owner)
+{
+  for (int i = 0; i < this->nthreads_; ++i)
+    {
+      TAO_EC_Sharded_Queue &queue =
+        this->queues_[(index + i) % this->nthreads_];
+
+      ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, queue.lock_, 0);
+      TAO_EC_Sharded_Batch *batch = queue.take_i ();
+      if (batch != 0)
+        {
+          owner = &queue;
+          return batch;
+        }
+    }
+  return 0;
+}
+
+void
+TAO_EC_Sharded_Dispatching::run_batch (TAO_EC_Sharded_Queue &owner,
+                                       TAO_EC_Sharded_Batch *batch)
+{
+  size_t pending = 0;
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, owner.lock_);
+    pending = batch->count_;
+  }
+
+  for (; pending != 0; --pending)
+    {
+      ACE_Message_Block *mb = 0;
+      {
+        ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, owner.lock_);
+        mb = batch->head_;
+        batch->head_ = mb->next ();
+        if (batch->head_ == 0)
+          batch->tail_ = 0;
+        --batch->count_;
+        --owner.count_;
+      }
+      mb->next (0);
+
+      try
+        {
+          TAO_EC_Dispatch_Command *command =
+            static_cast<TAO_EC_Dispatch_Command*> (mb);
+          command->execute ();
+        }
+      catch (const CORBA::Exception& ex)
+        {
+          ex._tao_print_exception ("EC (%P|%t) exception in sharded dispatching queue");
+        }
+
+      ACE_Message_Block::release (mb);
+    }
+
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, owner.lock_);
+  owner.release_i (batch);
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,259 @@
+// -*- C++ -*-
+
+/**
+ *  @file   EC_Sharded_Dispatching.h
+ *
+ * A multi-queue, work-stealing variant of the MT dispatching strategy.
+ */
+
+#ifndef TAO_EC_SHARDED_DISPATCHING_H
+#define TAO_EC_SHARDED_DISPATCHING_H
+#include /**/ "ace/pre.h"
+
+#include "orbsvcs/Event/EC_Dispatching.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "orbsvcs/Event/EC_Dispatching_Task.h"
+
+#include "ace/Hash_Map_Manager_T.h"
+#include "ace/Null_Mutex.h"
+#include "ace/Atomic_Op.h"
+#include "ace/Condition_Thread_Mutex.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class TAO_EC_Sharded_Dispatching;
+
+/**
+ * @class TAO_EC_Sharded_Batch
+ *
+ * @brief The FIFO of pending events for a single consumer.
+ *
+ * A batch is executed by at most one thread at a time, that
+ * preserves the order in which the events for each consumer were
+ * pushed.  All the fields are protected by the lock of the shard
+ * that owns the batch.
+ */
+class TAO_EC_Sharded_Batch
+{
+public:
+  /// Constructor
+  TAO_EC_Sharded_Batch (TAO_EC_ProxyPushSupplier *proxy);
+
+  /// The consumer this batch belongs to.
+  TAO_EC_ProxyPushSupplier *proxy_;
+
+  /// The pending commands, linked through ACE_Message_Block::next()
+  ACE_Message_Block *head_;
+  ACE_Message_Block *tail_;
+
+  /// The number of pending commands
+  size_t count_;
+
+  /// Link in the shard ready list
+  TAO_EC_Sharded_Batch *next_ready_;
+
+  /// Is the batch in the ready list?
+  bool ready_;
+
+  /// Is some thread executing this batch?
+  bool running_;
+};
+
+/**
+ * @class TAO_EC_Sharded_Queue
+ *
+ * @brief One of the queues used by TAO_EC_Sharded_Dispatching
+ *
+ * Each dispatching thread owns one queue, consumers are assigned to
+ * a queue by hashing their proxy.  The queue keeps one batch per
+ * consumer with pending events and a FIFO of the batches ready to
+ * run.
+ */
+class TAO_EC_Sharded_Queue
+{
+public:
+  /// Constructor
+  TAO_EC_Sharded_Queue (void);
+
+  /// Destructor, releases any pending commands.
+  ~TAO_EC_Sharded_Queue (void);
+
+  /// Append @a command to the batch for @a proxy, the caller holds
+  /// the lock.
+  void put_i (TAO_EC_ProxyPushSupplier *proxy, ACE_Message_Block *command);
+
+  /// Take the first ready batch, marking it as running, the caller
+  /// holds the lock.
+  TAO_EC_Sharded_Batch *take_i (void);
+
+  /// Put a running batch back in the ready list, or destroy it if it
+  /// has no more commands, the caller holds the lock.
+  void release_i (TAO_EC_Sharded_Batch *batch);
+
+  /// Discard all the pending commands, the caller holds the lock.
+  void clear_i (void);
+
+  typedef ACE_Hash_Map_Manager_Ex<TAO_EC_ProxyPushSupplier*,
+                                  TAO_EC_Sharded_Batch*,
+                                  ACE_Pointer_Hash<TAO_EC_ProxyPushSupplier*>,
+                                  ACE_Equal_To<TAO_EC_ProxyPushSupplier*>,
+                                  ACE_Null_Mutex> Batch_Map;
+
+  /// Synchronize access to the queue
+  TAO_SYNCH_MUTEX lock_;
+
+  /// The owner thread waits here when there is no work.
+  TAO_SYNCH_CONDITION cond_;
+
+  /// The batches with pending commands, indexed by proxy.
+  Batch_Map batches_;
+
+  /// The batches ready to run.
+  TAO_EC_Sharded_Batch *ready_head_;
+  TAO_EC_Sharded_Batch *ready_tail_;
+
+  /// The number of pending commands in all the batches.
+  size_t count_;
+
+  /// Set when the owner thread is waiting for work, read without
+  /// the lock as a hint to wake up thieves.
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, long> idle_;
+
+  /// Set when the dispatching strategy is shutting down, with the
+  /// strategy lock held as well.  Events pushed afterwards are
+  /// dispatched by the pushing thread.
+  bool shutdown_;
+
+  /// Helper data structure to minimize memory allocations...
+  ACE_Locked_Data_Block<ACE_Lock_Adapter<TAO_SYNCH_MUTEX> > data_block_;
+
+private:
+  TAO_EC_Sharded_Queue (const TAO_EC_Sharded_Queue&);
+  TAO_EC_Sharded_Queue& operator= (const TAO_EC_Sharded_Queue&);
+};
+
+/**
+ * @class TAO_EC_Sharded_Dispatching_Task
+ *
+ * @brief Run the dispatching threads of TAO_EC_Sharded_Dispatching
+ */
+class TAO_RTEvent_Serv_Export TAO_EC_Sharded_Dispatching_Task
+  : public ACE_Task_Base
+{
+public:
+  /// Constructor
+  TAO_EC_Sharded_Dispatching_Task (TAO_EC_Sharded_Dispatching *dispatching);
+
+  /// Each thread picks the next queue and services it.
+  virtual int svc (void);
+
+private:
+  /// The strategy
+  TAO_EC_Sharded_Dispatching *dispatching_;
+
+  /// Assign a queue to each thread
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, long> next_queue_;
+};
+
+/**
+ * @class TAO_EC_Sharded_Dispatching
+ *
+ * @brief Dispatching strategy with one queue per thread and work
+ * stealing.
+ *
+ * The TAO_EC_MT_Dispatching strategy feeds all its threads from a
+ * single queue, so the threads contend on the queue lock and two
+ * events for the same consumer can be delivered out of order.
+ * This strategy gives each thread its own queue, and consumers are
+ * assigned to a queue by hashing their proxy, so each consumer
+ * receives its events in FIFO order.
+ * Within a queue the events are grouped in per-consumer batches.
+ * A thread that finds its own queue empty steals a whole batch from
+ * another queue, only one thread runs a given batch at a time.
+ */
+class TAO_RTEvent_Serv_Export TAO_EC_Sharded_Dispatching
+  : public TAO_EC_Dispatching
+{
+public:
+  /// Constructor
+  /// It will create @a nthreads servicing threads, each one with its
+  /// own queue.
+  TAO_EC_Sharded_Dispatching (int nthreads,
+                              int thread_creation_flags,
+                              int thread_priority,
+                              int force_activate,
+                              TAO_EC_Queue_Full_Service_Object* queue_full_service_object);
+
+  /// Destructor
+  virtual ~TAO_EC_Sharded_Dispatching (void);
+
+  // = The EC_Dispatching methods.
+  virtual void activate (void);
+  virtual void shutdown (void);
+  virtual void push (TAO_EC_ProxyPushSupplier* proxy,
+                     RtecEventComm::PushConsumer_ptr consumer,
+                     const RtecEventComm::EventSet& event,
+                     TAO_EC_QOS_Info& qos_info);
+  virtual void push_nocopy (TAO_EC_ProxyPushSupplier* proxy,
+                            RtecEventComm::PushConsumer_ptr consumer,
+                            RtecEventComm::EventSet& event,
+                            TAO_EC_QOS_Info& qos_info);
+
+  /// Service the queue @a index, called by the dispatching threads.
+  void svc (size_t index);
+
+private:
+  /// Find a ready batch, first in the queue @a index and then in the
+  /// other queues.  Returns the queue that owns the batch in
+  /// @a owner.
+  TAO_EC_Sharded_Batch *next_batch (size_t index,
+                                    TAO_EC_Sharded_Queue *&owner);
+
+  /// Execute the commands that were in @a batch when it was taken.
+  void run_batch (TAO_EC_Sharded_Queue &owner, TAO_EC_Sharded_Batch *batch);
+
+  /// Wake up a thread that can steal work from the busy queue
+  /// @a index.
+  void wakeup_thief (size_t index);
+
+  /// Use our own thread manager.
+  ACE_Thread_Manager thread_manager_;
+
+  /// The number of threads, and queues
+  int nthreads_;
+
+  /// The flags (THR_BOUND, THR_NEW_LWP, etc.) used to create the
+  /// dispatching threads.
+  int thread_creation_flags_;
+
+  /// The priority of the dispatching threads.
+  int thread_priority_;
+
+  /// If activation at the requested priority fails then we fallback on
+  /// the defaults for thread activation.
+  int force_activate_;
+
+  /// The queues
+  TAO_EC_Sharded_Queue *queues_;
+
+  /// The dispatching threads
+  TAO_EC_Sharded_Dispatching_Task task_;
+
+  /// Used when a queue grows beyond its high water mark.
+  TAO_EC_Queue_Full_Service_Object *queue_full_service_object_;
+
+  /// Synchronize access to internal data
+  TAO_SYNCH_MUTEX lock_;
+
+  /// Are the threads running?
+  int active_;
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+#endif /* TAO_EC_SHARDED_DISPATCHING_H */
@@ -0,0 +1,346 @@
+#include "orbsvcs/Event/EC_Type_Index_Supplier_Filter.h"
+#include "orbsvcs/Event/EC_Event_Channel_Base.h"
+#include "orbsvcs/Event/EC_ProxySupplier.h"
+#include "orbsvcs/Event/EC_QOS_Info.h"
+#include "orbsvcs/Event/EC_Scheduling_Strategy.h"
+#include "orbsvcs/Event/EC_ProxyConsumer.h" // @@ MSVC 6 bug
+
+#include "orbsvcs/ESF/ESF_Proxy_Collection.h"
+
+#include "orbsvcs/Event_Service_Constants.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+TAO_EC_Type_Index_Key::TAO_EC_Type_Index_Key (void)
+  :  source (0),
+     type (0)
+{
+}
+
+TAO_EC_Type_Index_Key::TAO_EC_Type_Index_Key (
+      RtecEventComm::EventSourceID s,
+      RtecEventComm::EventType t)
+  :  source (s),
+     type (t)
+{
+}
+
+bool
+TAO_EC_Type_Index_Key::operator== (const TAO_EC_Type_Index_Key &rhs) const
+{
+  return this->source == rhs.source && this->type == rhs.type;
+}
+
+u_long
+TAO_EC_Type_Index_Key::hash (void) const
+{
+  return static_cast<u_long> (this->source) * 31
+    + static_cast<u_long> (this->type);
+}
+
+// ****************************************************************
+
+TAO_EC_Type_Index_Supplier_Filter::
+    TAO_EC_Type_Index_Supplier_Filter (TAO_EC_Event_Channel_Base* ec)
+  :  event_channel_ (ec),
+     unindexed_ (0),
+     bound_ (0)
+{
+}
+
+TAO_EC_Type_Index_Supplier_Filter::~TAO_EC_Type_Index_Supplier_Filter (void)
+{
+  Index::iterator end = this->index_.end ();
+  for (Index::iterator i = this->index_.begin (); i != end; ++i)
+    {
+      this->event_channel_->destroy_proxy_collection ((*i).int_id_);
+    }
+  this->index_.unbind_all ();
+
+  if (this->unindexed_ != 0)
+    {
+      this->event_channel_->destroy_proxy_collection (this->unindexed_);
+      this->unindexed_ = 0;
+    }
+}
+
+bool
+TAO_EC_Type_Index_Supplier_Filter::is_indexable (
+      const RtecEventChannelAdmin::ConsumerQOS &qos)
+{
+  CORBA::ULong const l = qos.dependencies.length ();
+  CORBA::ULong pos = 0;
+
+  if (l == 0)
+    return false;
+
+  if (qos.dependencies[0].event.header.type == ACE_ES_DISJUNCTION_DESIGNATOR)
+    {
+      ++pos; // Skip the designator
+      if (pos == l)
+        return false;
+    }
+  else if (l != 1)
+    {
+      return false;
+    }
+
+  for (; pos != l; ++pos)
+    {
+      const RtecEventComm::EventHeader &header =
+        qos.dependencies[pos].event.header;
+      if (header.source == ACE_ES_EVENT_SOURCE_ANY
+          || header.type < ACE_ES_EVENT_UNDEFINED)
+        return false;
+    }
+  return true;
+}
+
+void
+TAO_EC_Type_Index_Supplier_Filter::bind (TAO_EC_ProxyPushConsumer*)
+{
+  ACE_WRITE_GUARD (TAO_SYNCH_RW_MUTEX, ace_mon, this->lock_);
+
+  ++this->bound_;
+}
+
+void
+TAO_EC_Type_Index_Supplier_Filter::unbind (TAO_EC_ProxyPushConsumer*)
+{
+  ACE_WRITE_GUARD (TAO_SYNCH_RW_MUTEX, ace_mon, this->lock_);
+
+  if (this->bound_ == 0)
+    return;
+
+  --this->bound_;
+  if (this->bound_ != 0)
+    return;
+
+  try
+    {
+      this->shutdown_i ();
+    }
+  catch (const CORBA::Exception&)
+    {
+      // @@ Ignore exceptions
+    }
+}
+
+void
+TAO_EC_Type_Index_Supplier_Filter::connected (TAO_EC_ProxyPushSupplier* supplier)
+{
+  ACE_WRITE_GUARD (TAO_SYNCH_RW_MUTEX, ace_mon, this->lock_);
+
+  this->insert_i (supplier);
+}
+
+void
+TAO_EC_Type_Index_Supplier_Filter::reconnected (TAO_EC_ProxyPushSupplier* supplier)
+{
+  ACE_WRITE_GUARD (TAO_SYNCH_RW_MUTEX, ace_mon, this->lock_);
+
+  // The subscriptions have changed already, we cannot tell where the
+  // consumer was filed before.
+  this->remove_all_i (supplier);
+  this->insert_i (supplier);
+}
+
+void
+TAO_EC_Type_Index_Supplier_Filter::disconnected (TAO_EC_ProxyPushSupplier* supplier)
+{
+  ACE_WRITE_GUARD (TAO_SYNCH_RW_MUTEX, ace_mon, this->lock_);
+
+  this->remove_i (supplier, supplier->subscriptions ());
+}
+
+void
+TAO_EC_Type_Index_Supplier_Filter::shutdown (void)
+{
+  ACE_WRITE_GUARD (TAO_SYNCH_RW_MUTEX, ace_mon, this->lock_);
+
+  this->shutdown_i ();
+}
+
+void
+TAO_EC_Type_Index_Supplier_Filter::push (const RtecEventComm::EventSet& event,
+                                         TAO_EC_ProxyPushConsumer *consumer)
+{
+  TAO_EC_Scheduling_Strategy* scheduling_strategy =
+    this->event_channel_->scheduling_strategy ();
+  scheduling_strategy->schedule_event (event,
+                                       consumer,
+                                       this);
+}
+
+void
+TAO_EC_Type_Index_Supplier_Filter::push_scheduled_event (
+      RtecEventComm::EventSet &event,
+      const TAO_EC_QOS_Info &event_info)
+{
+  TAO_EC_Filter_Worker worker (event, event_info);
+
+  if (event.length () == 1)
+    {
+      const RtecEventComm::EventHeader &header = event[0].header;
+      if (header.source != ACE_ES_EVENT_SOURCE_ANY
+          && header.type != ACE_ES_EVENT_ANY)
+        {
+          Collection *matching = 0;
+          Collection *unindexed = 0;
+          {
+            ACE_READ_GUARD (TAO_SYNCH_RW_MUTEX, ace_mon, this->lock_);
+
+            this->index_.find (TAO_EC_Type_Index_Key (header.source,
+                                                      header.type),
+                               matching);
+            unindexed = this->unindexed_;
+          }
+
+          // The collections are never destroyed while the filter is
+          // alive, and they synchronize their own iteration.
+          if (matching != 0)
+            matching->for_each (&worker);
+          if (unindexed != 0)
+            unindexed->for_each (&worker);
+          return;
+        }
+    }
+
+  // Wildcard events, or sets of events, can match any consumer.
+  this->event_channel_->for_each_consumer (&worker);
+}
+
+CORBA::ULong
+TAO_EC_Type_Index_Supplier_Filter::_incr_refcnt (void)
+{
+  return 1;
+}
+
+CORBA::ULong
+TAO_EC_Type_Index_Supplier_Filter::_decr_refcnt (void)
+{
+  return 1;
+}
+
+void
+TAO_EC_Type_Index_Supplier_Filter::insert_i (TAO_EC_ProxyPushSupplier *supplier)
+{
+  const RtecEventChannelAdmin::ConsumerQOS &sub = supplier->subscriptions ();
+
+  if (!TAO_EC_Type_Index_Supplier_Filter::is_indexable (sub))
+    {
+      if (this->unindexed_ == 0)
+        this->event_channel_->create_proxy_collection (this->unindexed_);
+      this->unindexed_->connected (supplier);
+      return;
+    }
+
+  for (CORBA::ULong i = 0; i != sub.dependencies.length (); ++i)
+    {
+      const RtecEventComm::EventHeader &header =
+        sub.dependencies[i].event.header;
+      if (header.type == ACE_ES_DISJUNCTION_DESIGNATOR)
+        continue;
+
+      Collection *collection =
+        this->collection_i (TAO_EC_Type_Index_Key (header.source,
+                                                   header.type));
+      if (collection != 0)
+        collection->connected (supplier);
+    }
+}
+
+void
+TAO_EC_Type_Index_Supplier_Filter::remove_i (
+      TAO_EC_ProxyPushSupplier *supplier,
+      const RtecEventChannelAdmin::ConsumerQOS &sub)
+{
+  if (!TAO_EC_Type_Index_Supplier_Filter::is_indexable (sub))
+    {
+      if (this->unindexed_ != 0)
+        this->unindexed_->disconnected (supplier);
+      return;
+    }
+
+  for (CORBA::ULong i = 0; i != sub.dependencies.length (); ++i)
+    {
+      const RtecEventComm::EventHeader &header =
+        sub.dependencies[i].event.header;
+
+      Collection *collection = 0;
+      if (this->index_.find (TAO_EC_Type_Index_Key (header.source,
+                                                    header.type),
+                             collection) == 0)
+        collection->disconnected (supplier);
+    }
+}
+
+void
+TAO_EC_Type_Index_Supplier_Filter::remove_all_i (
+      TAO_EC_ProxyPushSupplier *supplier)
+{
+  if (this->unindexed_ != 0)
+    this->unindexed_->disconnected (supplier);
+
+  Index::iterator end = this->index_.end ();
+  for (Index::iterator i = this->index_.begin (); i != end; ++i)
+    {
+      (*i).int_id_->disconnected (supplier);
+    }
+}
+
+void
+TAO_EC_Type_Index_Supplier_Filter::shutdown_i (void)
+{
+  if (this->unindexed_ != 0)
+    this->unindexed_->shutdown ();
+
+  Index::iterator end = this->index_.end ();
+  for (Index::iterator i = this->index_.begin (); i != end; ++i)
+    {
+      (*i).int_id_->shutdown ();
+    }
+}
+
+TAO_EC_Type_Index_Supplier_Filter::Collection *
+TAO_EC_Type_Index_Supplier_Filter::collection_i (
+      const TAO_EC_Type_Index_Key &key)
+{
+  Collection *collection = 0;
+  if (this->index_.find (key, collection) == 0)
+    return collection;
+
+  this->event_channel_->create_proxy_collection (collection);
+  if (collection == 0)
+    return 0;
+
+  if (this->index_.bind (key, collection) != 0)
+    {
+      this->event_channel_->destroy_proxy_collection (collection);
+      return 0;
+    }
+  return collection;
+}
+
+// ****************************************************************
+
+TAO_EC_Type_Index_Supplier_Filter_Builder::
+  TAO_EC_Type_Index_Supplier_Filter_Builder (TAO_EC_Event_Channel_Base *ec)
+  :  filter_ (ec)
+{
+}
+
+TAO_EC_Supplier_Filter*
+TAO_EC_Type_Index_Supplier_Filter_Builder::create (
+    RtecEventChannelAdmin::SupplierQOS&)
+{
+  return &this->filter_;
+}
+
+void
+TAO_EC_Type_Index_Supplier_Filter_Builder::destroy (
+    TAO_EC_Supplier_Filter*)
+{
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,193 @@
+// -*- C++ -*-
+
+/**
+ *  @file   EC_Type_Index_Supplier_Filter.h
+ *
+ * A supplier filtering strategy that indexes the consumers by the
+ * (source, type) pairs in their subscriptions.
+ */
+
+#ifndef TAO_EC_TYPE_INDEX_SUPPLIER_FILTER_H
+#define TAO_EC_TYPE_INDEX_SUPPLIER_FILTER_H
+
+#include /**/ "ace/pre.h"
+
+#include "orbsvcs/Event/EC_Supplier_Filter.h"
+#include "orbsvcs/Event/EC_Supplier_Filter_Builder.h"
+
+#include /**/ "orbsvcs/Event/event_serv_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/Hash_Map_Manager_T.h"
+#include "ace/Null_Mutex.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+template<class PROXY> class TAO_ESF_Proxy_Collection;
+class TAO_EC_Event_Channel_Base;
+
+/**
+ * @class TAO_EC_Type_Index_Key
+ *
+ * @brief The (source, type) pair used to index the consumers.
+ */
+class TAO_RTEvent_Serv_Export TAO_EC_Type_Index_Key
+{
+public:
+  /// Constructors
+  TAO_EC_Type_Index_Key (void);
+  TAO_EC_Type_Index_Key (RtecEventComm::EventSourceID source,
+                         RtecEventComm::EventType type);
+
+  /// Required by ACE_Hash_Map_Manager_Ex
+  bool operator== (const TAO_EC_Type_Index_Key &rhs) const;
+  u_long hash (void) const;
+
+  RtecEventComm::EventSourceID source;
+  RtecEventComm::EventType type;
+};
+
+// ****************************************************************
+
+/**
+ * @class TAO_EC_Type_Index_Supplier_Filter
+ *
+ * @brief Dispatch events through a (source, type) index of the
+ * consumers.
+ *
+ * This strategy is shared by all the suppliers (i.e. ProxyConsumers)
+ * of an event channel.  Consumers whose subscription is a plain
+ * disjunction of fully specified (source, type) pairs, the common
+ * case when using ACE_ConsumerQOS_Factory, are kept in one
+ * collection per pair.  Consumers with any other subscription
+ * (conjunctions, negations, bitmasks, timeouts, wildcards, etc.) are
+ * kept in a separate collection that is traversed for every event.
+ * An event with a fully specified header is thus only tested
+ * against the consumers that could possibly accept it and the
+ * consumers with non-trivial filter trees; events with wildcard
+ * headers and event sets with more than one event go through the
+ * complete set of consumers, as in the null strategy.
+ *
+ * The index only preselects the consumers, each one still runs the
+ * event through its own filter, so this strategy must not be
+ * combined with the null consumer filtering strategy.
+ *
+ * Empty collections are not reclaimed until the event channel is
+ * destroyed, this keeps the lookup path free of any locking beyond
+ * the short section that reads the index.
+ */
+class TAO_RTEvent_Serv_Export TAO_EC_Type_Index_Supplier_Filter
+  : public TAO_EC_Supplier_Filter
+{
+public:
+  /// Constructor
+  TAO_EC_Type_Index_Supplier_Filter (TAO_EC_Event_Channel_Base* ec);
+
+  /// Destructor
+  virtual ~TAO_EC_Type_Index_Supplier_Filter (void);
+
+  // = The TAO_EC_Supplier_Filter methods.
+  virtual void bind (TAO_EC_ProxyPushConsumer* consumer);
+  virtual void unbind (TAO_EC_ProxyPushConsumer* consumer);
+  virtual void connected (TAO_EC_ProxyPushSupplier* supplier);
+  virtual void reconnected (TAO_EC_ProxyPushSupplier* supplier);
+  virtual void disconnected (TAO_EC_ProxyPushSupplier* supplier);
+  virtual void shutdown (void);
+  virtual void push (const RtecEventComm::EventSet& event,
+                     TAO_EC_ProxyPushConsumer *consumer);
+  virtual void push_scheduled_event (RtecEventComm::EventSet &event,
+                                     const TAO_EC_QOS_Info &event_info);
+  virtual CORBA::ULong _decr_refcnt (void);
+  virtual CORBA::ULong _incr_refcnt (void);
+
+  /**
+   * Return true if the subscription in @a qos can be served by the
+   * index, i.e. if it is a single (source, type) pair or a
+   * disjunction of such pairs, where neither the source nor the
+   * type are wildcards or designators.
+   */
+  static bool is_indexable (const RtecEventChannelAdmin::ConsumerQOS &qos);
+
+private:
+  typedef TAO_ESF_Proxy_Collection<TAO_EC_ProxyPushSupplier> Collection;
+  typedef ACE_Hash_Map_Manager_Ex<TAO_EC_Type_Index_Key,
+                                  Collection*,
+                                  ACE_Hash<TAO_EC_Type_Index_Key>,
+                                  ACE_Equal_To<TAO_EC_Type_Index_Key>,
+                                  ACE_Null_Mutex> Index;
+
+  /// Add @a supplier to the index, the caller holds the write lock.
+  void insert_i (TAO_EC_ProxyPushSupplier *supplier);
+
+  /// Remove @a supplier from the collections selected by
+  /// @a subscriptions, the caller holds the write lock.
+  void remove_i (TAO_EC_ProxyPushSupplier *supplier,
+                 const RtecEventChannelAdmin::ConsumerQOS &subscriptions);
+
+  /// Remove @a supplier from every collection, used when the
+  /// previous subscription is not known anymore.
+  void remove_all_i (TAO_EC_ProxyPushSupplier *supplier);
+
+  /// Shutdown all the collections, the caller holds the write lock.
+  void shutdown_i (void);
+
+  /// Find the collection for @a key, creating it if needed.
+  Collection *collection_i (const TAO_EC_Type_Index_Key &key);
+
+  /// The event channel, used to create the collections and locate
+  /// the complete set of consumers.
+  TAO_EC_Event_Channel_Base *event_channel_;
+
+  /// The consumers indexed by (source, type)
+  Index index_;
+
+  /// The consumers that cannot be indexed.
+  Collection *unindexed_;
+
+  /// The number of ProxyPushConsumers bound to this filter, once it
+  /// drops to zero no more disconnect notifications will reach us,
+  /// so the index is cleared.
+  CORBA::ULong bound_;
+
+  /// Protect the index, the collections provide their own
+  /// synchronization for iteration.
+  TAO_SYNCH_RW_MUTEX lock_;
+};
+
+// ****************************************************************
+
+/**
+ * @class TAO_EC_Type_Index_Supplier_Filter_Builder
+ *
+ * @brief Create a single Type_Index_Supplier_Filter.
+ *
+ * This Factory creates a single Type_Index_Supplier_Filter that is
+ * used by all the suppliers (i.e. ProxyConsumers) of an event
+ * channel.
+ */
+class TAO_RTEvent_Serv_Export TAO_EC_Type_Index_Supplier_Filter_Builder
+  : public TAO_EC_Supplier_Filter_Builder
+{
+public:
+  /// constructor....
+  TAO_EC_Type_Index_Supplier_Filter_Builder (TAO_EC_Event_Channel_Base* ec);
+
+  // = The TAO_EC_Supplier_Filter_Builder methods...
+  virtual TAO_EC_Supplier_Filter*
+      create (RtecEventChannelAdmin::SupplierQOS& qos);
+  virtual void
+      destroy (TAO_EC_Supplier_Filter *filter);
+
+private:
+  /// The filter....
+  TAO_EC_Type_Index_Supplier_Filter filter_;
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_EC_TYPE_INDEX_SUPPLIER_FILTER_H */
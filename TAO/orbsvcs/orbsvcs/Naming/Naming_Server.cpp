@@ -19,6 +19,7 @@
 #include "orbsvcs/Naming/Storable_Naming_Context_Activator.h"
 
 #include "tao/Storable_FlatFileStream.h"
+#include "tao/Storable_LogStream.h"
 
 #endif /* CORBA_E_MICRO */
 
@@ -51,6 +52,7 @@ TAO_Naming_Server::TAO_Naming_Server (size_t bsize)
     persistence_dir_ (0),
     base_address_ (TAO_NAMING_BASE_ADDR),
     use_storable_context_ (0),
+    storable_log_shards_ (0),
     use_servant_activator_ (false),
     servant_activator_ (0),
 #endif /* CORBA_E_MICRO */
@@ -84,6 +86,7 @@ TAO_Naming_Server::TAO_Naming_Server (CORBA::ORB_ptr orb,
     persistence_dir_ (0),
     base_address_ (TAO_NAMING_BASE_ADDR),
     use_storable_context_ (use_storable_context),
+    storable_log_shards_ (0),
     use_servant_activator_ (false),
     servant_activator_ (0),
 #endif /* CORBA_E_MICRO */
@@ -178,7 +181,7 @@ TAO_Naming_Server::parse_args (int argc,
                                ACE_TCHAR *argv[])
 {
 #if (TAO_HAS_MINIMUM_POA == 0) && !defined (CORBA_E_COMPACT)
-  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("b:do:p:s:f:m:u:r:z:"));
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("b:do:p:s:f:m:u:r:k:z:"));
 #else
   ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("b:do:p:s:f:m:z:"));
 #endif /* TAO_HAS_MINIMUM_POA */
@@ -254,6 +257,11 @@ TAO_Naming_Server::parse_args (int argc,
         this->persistence_dir_ = get_opts.opt_arg ();
         u_opt_used = 1;
         break;
+      case 'k':
+        size = ACE_OS::atoi (get_opts.opt_arg ());
+        if (size >= 0)
+          this->storable_log_shards_ = size;
+        break;
 #endif /* TAO_HAS_MINIMUM_POA == 0 */
 #endif /* !CORBA_E_MICRO */
       case 'z':
@@ -269,7 +277,8 @@ TAO_Naming_Server::parse_args (int argc,
 #endif /* CORBA_E_MICRO */
 #if (TAO_HAS_MINIMUM_POA == 0) && !defined (CORBA_E_MICRO)
           ACE_TEXT ("-u <storable_persistence_directory (not used with -f)> ")
-          ACE_TEXT ("-r <redundant_persistence_directory> ");
+          ACE_TEXT ("-r <redundant_persistence_directory> ")
+          ACE_TEXT ("-k <number_of_log_shards (used with -u or -r)> ");
 #else
           ACE_TEXT ("");
 #endif /* TAO_HAS_MINIMUM_POA && !CORBA_E_MICRO */
@@ -483,7 +492,13 @@ TAO_Naming_Server::init_new_naming (CORBA::ORB_ptr orb,
           // command line for now.
           TAO::Storable_Factory* pf = 0;
           ACE_CString directory (ACE_TEXT_ALWAYS_CHAR (persistence_location));
-          ACE_NEW_RETURN (pf, TAO::Storable_FlatFileFactory (directory), -1);
+          if (this->storable_log_shards_ > 0)
+            ACE_NEW_RETURN (pf,
+                            TAO::Storable_LogFactory (directory,
+                                                      this->storable_log_shards_),
+                            -1);
+          else
+            ACE_NEW_RETURN (pf, TAO::Storable_FlatFileFactory (directory), -1);
 #if defined (ACE_HAS_CPP11)
           std::unique_ptr<TAO::Storable_Factory> persFactory(pf);
 #else
@@ -246,6 +246,10 @@ protected:
   /// If not zero use flat file persistence
   int use_storable_context_;
 
+  /// If not zero the storable contexts are kept in this number of
+  /// log files instead of one flat file per context.
+  size_t storable_log_shards_;
+
   /**
    * If not zero use servant activator that uses flat file persistence.
    */
@@ -10,6 +10,7 @@
 #include "tao/Storable_Factory.h"
 
 #include "ace/Auto_Ptr.h"
+#include "ace/Min_Max.h"
 #include "ace/OS_NS_stdio.h"
 #include "ace/OS_NS_sys_time.h"
 
@@ -248,6 +249,30 @@ void TAO_Storable_Naming_Context::Write (TAO::Storable_Base& wrtr)
   ACE_TRACE("Write");
   TAO_Storable_Naming_Context_ReaderWriter rw(wrtr);
   rw.write(*this);
+  this->appended_ = 0;
+}
+
+void
+TAO_Storable_Naming_Context::Write_Binding (TAO::Storable_Base& wrtr,
+                                            const char *id,
+                                            const char *kind)
+{
+  ACE_TRACE("Write_Binding");
+
+  // Loading the context replays the appended changes, rewrite it
+  // once there are more changes than bindings.
+  size_t const limit =
+    ACE_MAX (static_cast<size_t> (64), this->context_->current_size ());
+  if (this->appended_ < limit)
+    {
+      TAO_Storable_Naming_Context_ReaderWriter rw (wrtr);
+      if (rw.write_binding (*this, id, kind) == 0)
+        {
+          ++this->appended_;
+          return;
+        }
+    }
+  this->Write (wrtr);
 }
 
 // Helpers function to load a new context into the binding_map
@@ -398,7 +423,8 @@ TAO_Storable_Naming_Context::TAO_Storable_Naming_Context (
     hash_table_size_ (hash_table_size),
     last_changed_ (0),
     last_check_ (0),
-    write_occurred_ (0)
+    write_occurred_ (0),
+    appended_ (0)
 {
   ACE_TRACE("TAO_Storable_Naming_Context");
 }
@@ -649,7 +675,7 @@ TAO_Storable_Naming_Context::rebind (const CosNaming::Name& n,
           CosNaming::NamingContext::not_object,
           n);
 
-      this->Write (flck.peer());
+      this->Write_Binding (flck.peer (), n[0].id, n[0].kind);
     }
 }
 
@@ -690,7 +716,7 @@ TAO_Storable_Naming_Context::bind_context (const CosNaming::Name &n,
       else if (result == -1)
         throw CORBA::INTERNAL ();
 
-      this->Write(flck.peer());
+      this->Write_Binding (flck.peer (), n[0].id, n[0].kind);
     }
 }
 
@@ -731,7 +757,7 @@ TAO_Storable_Naming_Context::rebind_context (const CosNaming::Name &n,
           CosNaming::NamingContext::not_context,
           n);
 
-      this->Write(flck.peer());
+      this->Write_Binding (flck.peer (), n[0].id, n[0].kind);
     }
 }
 
@@ -797,7 +823,7 @@ TAO_Storable_Naming_Context::unbind (const CosNaming::Name& n)
           CosNaming::NamingContext::missing_node,
           n);
 
-      this->Write(flck.peer());
+      this->Write_Binding (flck.peer (), n[0].id, n[0].kind);
     }
 }
 
@@ -832,7 +858,7 @@ TAO_Storable_Naming_Context::bind (const CosNaming::Name& n,
       else if (result == -1)
         throw CORBA::INTERNAL ();
 
-      this->Write (flck.peer());
+      this->Write_Binding (flck.peer (), n[0].id, n[0].kind);
     }
 }
 
@@ -490,8 +490,17 @@ private:
 
   void Write(TAO::Storable_Base& wrtr);
 
+  /// Store the change made to the binding @a id / @a kind.  The change
+  /// is appended to the stored context when the stream allows it,
+  /// otherwise, or when the appended changes outgrow the context, the
+  /// whole context is written.
+  void Write_Binding (TAO::Storable_Base& wrtr, const char *id, const char *kind);
+
   /// Is set by the Write operation.  Used to determine
   int write_occurred_;
+
+  /// The number of changes stored after the bindings.
+  unsigned int appended_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
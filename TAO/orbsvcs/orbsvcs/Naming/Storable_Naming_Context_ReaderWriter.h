@@ -29,6 +29,9 @@ namespace TAO
 }
 
 class TAO_Storable_Naming_Context;
+class TAO_Storable_Bindings_Map;
+class TAO_Storable_ExtId;
+class TAO_Storable_IntId;
 class TAO_NS_Persistence_Record;
 class TAO_NS_Persistence_Header;
 class TAO_NS_Persistence_Global;
@@ -43,11 +46,42 @@ public:
 
   void write (TAO_Storable_Naming_Context & context);
 
+  /// Add the change made to the binding @a id / @a kind after the
+  /// bindings already stored, instead of writing all of them.
+  /// Returns -1 if the stream cannot append, in which case the caller
+  /// should fall back to write ().
+  int write_binding (TAO_Storable_Naming_Context & context,
+                     const char * id,
+                     const char * kind);
+
   void write_global (const TAO_NS_Persistence_Global & global);
   void read_global (TAO_NS_Persistence_Global & global);
 
 private:
 
+  /// The changes stored after the bindings by write_binding ().
+  enum Change_Type
+  {
+    BINDING_SET = 1,
+    BINDING_REMOVED = 2
+  };
+
+  /// Fill @a record with the binding @a ext_id / @a int_id.
+  void make_record (TAO_Storable_Naming_Context & context,
+                    TAO_Storable_ExtId & ext_id,
+                    const TAO_Storable_IntId & int_id,
+                    TAO_NS_Persistence_Record & record);
+
+  /// Add the binding described by @a record to @a bindings_map.
+  void bind_record (TAO_Storable_Naming_Context & context,
+                    TAO_Storable_Bindings_Map & bindings_map,
+                    const TAO_NS_Persistence_Record & record);
+
+  /// Apply the changes stored by write_binding (), returns how many
+  /// were found.
+  unsigned int read_changes (TAO_Storable_Naming_Context & context,
+                             TAO_Storable_Bindings_Map & bindings_map);
+
   void write_header (const TAO_NS_Persistence_Header & header);
   void read_header (TAO_NS_Persistence_Header & header);
 
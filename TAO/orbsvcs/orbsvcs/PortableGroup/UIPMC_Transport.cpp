@@ -28,6 +28,9 @@ TAO_UIPMC_Transport::TAO_UIPMC_Transport (
   delete this->ws_;
   ACE_NEW (this->ws_, TAO_UIPMC_Wait_Never (this));
 
+  // Each message is sent as datagrams of its own.
+  this->flush_combining_ = false;
+
   ACE_Utils::UUID uuid;
   ACE_Utils::UUID_GENERATOR::instance ()->generate_UUID (uuid);
 
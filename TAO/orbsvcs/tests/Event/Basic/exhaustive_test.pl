@@ -15,14 +15,16 @@ $status = 0;
 $conf_file = PerlACE::LocalFile ("exhaustive$PerlACE::svcconf_ext");
 
 @dispatching_configs   = ("-ECDispatching reactive",
-                          "-ECDispatching mt -ECDispatchingThreads 4");
+                          "-ECDispatching mt -ECDispatchingThreads 4",
+                          "-ECDispatching sharded -ECDispatchingThreads 4");
 @collection_strategies = ("copy_on_read",
                           "copy_on_write",
                           "delayed");
 @collection_types      = ("list",
                           "rb_tree");
 @filtering_configs     = ("-ECFiltering prefix -ECSupplierFilter per-supplier",
-                          "-ECFiltering prefix -ECSupplierFilter null");
+                          "-ECFiltering prefix -ECSupplierFilter null",
+                          "-ECFiltering prefix -ECSupplierFilter type-index");
 
 foreach $d (@dispatching_configs) {
     foreach $f (@filtering_configs) {
@@ -23,6 +23,8 @@ $svc_complex_conf = $test->LocalFile ("svc.complex$conf_suffix");
 $mt_svc_conf      = $test->LocalFile ("mt.svc$conf_suffix");
 $svc_complex_conf = $test->LocalFile ("svc.complex$conf_suffix");
 $control_conf     = $test->LocalFile ("control$conf_suffix");
+$type_index_conf  = $test->LocalFile ("svc.type_index$conf_suffix");
+$sharded_conf     = $test->LocalFile ("mt.sharded$conf_suffix");
 
 sub RunTest ($$$)
 {
@@ -70,6 +72,10 @@ RunTest ("Wildcard tests",
          "Wildcard",
          "-ORBsvcconf $svc_conf");
 
+RunTest ("Wildcard tests, using the type-index supplier filter",
+         "Wildcard",
+         "-ORBsvcconf $type_index_conf");
+
 RunTest ("Negation tests",
          "Negation",
          "-ORBsvcconf $svc_conf");
@@ -86,6 +92,10 @@ RunTest ("MT Disconnects test",
          "MT_Disconnect",
          "-ORBSvcConf $mt_svc_conf");
 
+RunTest ("MT Disconnects test, sharded dispatching",
+         "MT_Disconnect",
+         "-ORBSvcConf $sharded_conf");
+
 RunTest ("Atomic Reconnection test",
          "Atomic_Reconnect",
          "-ORBSvcConf $mt_svc_conf");
@@ -98,6 +108,10 @@ RunTest ("Control test",
          "Control",
          "-ORBSvcConf $control_conf");
 
+RunTest ("Reconnect suppliers and consumers, using the type-index supplier filter",
+         "Reconnect",
+         "-ORBsvcconf $type_index_conf -suppliers 100 -consumers 100 -d 100 -s -c");
+
 RunTest ("Random test",
          "Random",
          "-ORBSvcConf $svc_conf -suppliers 4 -consumers 4 -max_recursion 1");
@@ -45,12 +45,15 @@ $consumer_iorfile = $test->LocalFile ("consumer-ec.ior");
 $supplier_iorfile = $test->LocalFile ("supplier-ec.ior");
 
 @consumer_conffile = ($test->LocalFile ("consumer-ec.conf"),
-                      $test->LocalFile ("udp-consumer-ec.conf"));
+                      $test->LocalFile ("udp-consumer-ec.conf"),
+                      $test->LocalFile ("batch-consumer-ec.conf"));
 
 @supplier_conffile = ($test->LocalFile ("supplier-ec.conf"),
-                      $test->LocalFile ("udp-supplier-ec.conf"));
+                      $test->LocalFile ("udp-supplier-ec.conf"),
+                      $test->LocalFile ("batch-supplier-ec.conf"));
 
-@test_comments = ("Test 1: Mcast Handler", "Test 2: UDP Handler");
+@test_comments = ("Test 1: Mcast Handler", "Test 2: UDP Handler",
+                  "Test 3: UDP Handler, batched and coalesced");
 
 #################################################################
 # Subs
@@ -191,7 +194,7 @@ sub analyze_results {
 
 $status = 0;
 
-for ($i = 0; $i < 2; $i++) {
+for ($i = 0; $i < 3; $i++) {
     if (run_test ($i) == -1) {
         $status = 1;
     }
@@ -199,7 +202,7 @@ for ($i = 0; $i < 2; $i++) {
     print STDERR "$test_terminator\n\n";
 }
 
-for ($i = 0; $i < 2; $i++) {
+for ($i = 0; $i < 3; $i++) {
     for ($j= 0; $j < 4; $j++) {
         if (analyze_results ($i, $j) == -1) {
             $status = 1;
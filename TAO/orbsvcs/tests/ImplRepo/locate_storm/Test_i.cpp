@@ -0,0 +1,25 @@
+/* -*- C++ -*-  */
+
+#include "Test_i.h"
+
+Test_i::Test_i (CORBA::ORB_ptr orb)
+  : orb_ (CORBA::ORB::_duplicate(orb))
+  , num_requests_ (0)
+{
+}
+
+Test_i::~Test_i ()
+{
+}
+
+CORBA::Long
+Test_i::get_num_requests ()
+{
+  return ++this->num_requests_;
+}
+
+void
+Test_i::shutdown ()
+{
+  orb_->shutdown(0);
+}
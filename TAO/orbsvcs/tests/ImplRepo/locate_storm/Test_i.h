@@ -0,0 +1,28 @@
+/* -*- C++ -*-  */
+
+#ifndef TEST_I_H_
+#define TEST_I_H_
+
+#include "TestS.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+#pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+class  Test_i : public virtual POA_Test
+{
+public:
+  Test_i (CORBA::ORB_ptr orb);
+
+  virtual ~Test_i ();
+
+  virtual CORBA::Long get_num_requests ();
+
+  virtual void shutdown ();
+
+private:
+  CORBA::ORB_var orb_;
+  CORBA::Long num_requests_;
+};
+
+#endif /* TEST_I_H_ */
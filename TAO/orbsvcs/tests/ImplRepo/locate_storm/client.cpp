@@ -0,0 +1,185 @@
+#include "TestS.h"
+
+#include "tao/Messaging/Messaging.h"
+
+#include "ace/Get_Opt.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/OS_NS_sys_time.h"
+#include "ace/Array_Base.h"
+
+const ACE_TCHAR *ior = ACE_TEXT ("corbaloc::localhost:9876/TestObject");
+int requests = 10000;
+int rounds = 2;
+int max_wait_secs = 120;
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("k:n:r:w:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'k':
+        ior = get_opts.opt_arg ();
+        break;
+
+      case 'n':
+        requests = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'r':
+        rounds = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'w':
+        max_wait_secs = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-k <indirect ior> "
+                           "-n <concurrent requests per round> "
+                           "-r <rounds> "
+                           "-w <max seconds to wait for a round>"
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+class Handler : public virtual POA_AMI_TestHandler
+{
+public:
+  Handler (void)
+    : replies_ (0),
+      errors_ (0)
+  {
+  }
+
+  void reset (void)
+  {
+    this->replies_ = 0;
+    this->errors_ = 0;
+  }
+
+  int done (void) const
+  {
+    return this->replies_ + this->errors_;
+  }
+
+  int errors (void) const
+  {
+    return this->errors_;
+  }
+
+  virtual void get_num_requests (CORBA::Long)
+  {
+    ++this->replies_;
+  }
+
+  virtual void get_num_requests_excep (::Messaging::ExceptionHolder *holder)
+  {
+    try
+      {
+        holder->raise_exception ();
+      }
+    catch (const CORBA::Exception &ex)
+      {
+        if (this->errors_ == 0)
+          {
+            ex._tao_print_exception ("(%P|%t) Client: first failed request");
+          }
+      }
+    ++this->errors_;
+  }
+
+private:
+  int replies_;
+  int errors_;
+};
+
+int
+ACE_TMAIN (int argc, ACE_TCHAR *argv[])
+{
+  int status = 0;
+  try {
+    CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+    if (parse_args (argc, argv) != 0)
+      return 1;
+
+    CORBA::Object_var obj = orb->resolve_initial_references ("RootPOA");
+    PortableServer::POA_var root_poa = PortableServer::POA::_narrow (obj.in ());
+    PortableServer::POAManager_var mgr = root_poa->the_POAManager ();
+    mgr->activate ();
+
+    PortableServer::Servant_var<Handler> handler = new Handler;
+    PortableServer::ObjectId_var id = root_poa->activate_object (handler.in ());
+    obj = root_poa->id_to_reference (id.in ());
+    AMI_TestHandler_var handler_ref = AMI_TestHandler::_narrow (obj.in ());
+
+    for (int r = 0; r < rounds; ++r)
+      {
+        handler->reset ();
+
+        // Every request goes through its own reference, so that each
+        // one has to be located by the ImR rather than following the
+        // forward obtained by an earlier request.
+        ACE_Array_Base<Test_var> stubs (requests);
+
+        ACE_High_Res_Timer timer;
+        timer.start ();
+
+        for (int i = 0; i < requests; ++i)
+          {
+            obj = orb->string_to_object (ior);
+            stubs[i] = Test::_unchecked_narrow (obj.in ());
+            stubs[i]->sendc_get_num_requests (handler_ref.in ());
+          }
+
+        ACE_Time_Value const deadline =
+          ACE_OS::gettimeofday () + ACE_Time_Value (max_wait_secs);
+        while (handler->done () < requests &&
+               ACE_OS::gettimeofday () < deadline)
+          {
+            ACE_Time_Value tv (0, 100000);
+            orb->perform_work (tv);
+          }
+
+        timer.stop ();
+        ACE_hrtime_t usecs;
+        timer.elapsed_microseconds (usecs);
+        double const secs = static_cast<double> (usecs) / 1000000.0;
+
+        ACE_DEBUG ((LM_DEBUG,
+                    "(%P|%t) Client: round %d, %d of %d requests answered, "
+                    "%d failed, %.3f secs, %.0f requests/sec\n",
+                    r, handler->done (), requests, handler->errors (), secs,
+                    secs > 0.0 ? handler->done () / secs : 0.0));
+
+        if (handler->done () < requests || handler->errors () != 0)
+          {
+            ACE_ERROR ((LM_ERROR,
+                        "(%P|%t) Client: ERROR: round %d did not complete\n",
+                        r));
+            status = 1;
+            break;
+          }
+      }
+
+    root_poa->destroy (1, 1);
+    orb->destroy ();
+  }
+  catch (const CORBA::Exception& ex) {
+    ex._tao_print_exception ("Client:");
+    return 1;
+  }
+
+  return status;
+}
@@ -0,0 +1,199 @@
+eval '(exit $?0)' && eval 'exec perl -S $0 ${1+"$@"}'
+    & eval 'exec perl -S $0 $argv:q'
+    if 0;
+
+# -*- perl -*-
+
+###############################################################################
+use lib "$ENV{ACE_ROOT}/bin";
+use PerlACE::TestTarget;
+
+$status = 0;
+my $debug_level = '0';
+my $imr_debug_level = '0';
+
+my $requests = 10000;
+my $rounds = 2;
+my $forward_ttl = 10000;
+my $server_init_delay = 2;
+my $max_wait = 120;
+
+if ($#ARGV >= 0) {
+    for (my $i = 0; $i <= $#ARGV; $i++) {
+      if ($ARGV[$i] eq '-debug') {
+        $debug_level = '10';
+      }
+      elsif ($ARGV[$i] eq "-imrdebug") {
+        $i++;
+        $imr_debug_level = $ARGV[$i];
+      }
+      elsif ($ARGV[$i] eq "-requests") {
+        $i++;
+        $requests = $ARGV[$i];
+      }
+      elsif ($ARGV[$i] eq "-rounds") {
+        $i++;
+        $rounds = $ARGV[$i];
+      }
+      elsif ($ARGV[$i] eq "-forwardttl") {
+        $i++;
+        $forward_ttl = $ARGV[$i];
+      }
+      elsif ($ARGV[$i] eq "-server_init_delay") {
+        $i++;
+        $server_init_delay = $ARGV[$i];
+      }
+      elsif ($ARGV[$i] eq "-max_wait") {
+        $i++;
+        $max_wait = $ARGV[$i];
+      }
+      else {
+        usage();
+        exit 1;
+      }
+    }
+}
+
+my $imr = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
+my $act = PerlACE::TestTarget::create_target (2) || die "Create target 2 failed\n";
+my $ti  = PerlACE::TestTarget::create_target (3) || die "Create target 3 failed\n";
+my $srv = PerlACE::TestTarget::create_target (4) || die "Create target 4 failed\n";
+my $cli = PerlACE::TestTarget::create_target (5) || die "Create target 5 failed\n";
+
+my $port = $imr->RandomPort ();
+my $objprefix = "TestObject";
+
+$imriorfile = "imr_locator.ior";
+$actiorfile = "imr_activator.ior";
+$client_conf = "client$PerlACE::svcconf_ext";
+
+my $imr_imriorfile = $imr->LocalFile ($imriorfile);
+my $act_imriorfile = $act->LocalFile ($imriorfile);
+my $ti_imriorfile = $ti->LocalFile ($imriorfile);
+my $act_actiorfile = $act->LocalFile ($actiorfile);
+my $cli_conf = $cli->LocalFile ($client_conf);
+
+$IMR = $imr->CreateProcess ("$ENV{TAO_ROOT}/orbsvcs/ImplRepo_Service/tao_imr_locator");
+$ACT = $act->CreateProcess ("$ENV{TAO_ROOT}/orbsvcs/ImplRepo_Service/tao_imr_activator");
+$TI  = $ti->CreateProcess ("$ENV{ACE_ROOT}/bin/tao_imr");
+$SRV = $srv->CreateProcess ("server");
+$CLI = $cli->CreateProcess ("client");
+my $srv_server_cmd = $imr->LocalFile ($SRV->Executable ());
+
+$imr->DeleteFile ($imriorfile);
+$act->DeleteFile ($imriorfile);
+$ti->DeleteFile ($imriorfile);
+$act->DeleteFile ($actiorfile);
+
+sub locate_storm_test
+{
+    print "Running locate_storm test with $requests requests, forward ttl $forward_ttl ms.\n";
+
+    $IMR->Arguments ("-d $imr_debug_level -o $imr_imriorfile -ORBEndpoint iiop://:$port ".
+                     "--forwardttl $forward_ttl -ORBDebugLevel $debug_level");
+    print ">>> " . $IMR->CommandLine () . "\n";
+
+    $IMR_status = $IMR->Spawn ();
+    if ($IMR_status != 0) {
+        print STDERR "ERROR: ImplRepo Service returned $IMR_status\n";
+        return 1;
+    }
+    if ($imr->WaitForFileTimed ($imriorfile, $imr->ProcessStartWaitInterval()) == -1) {
+        print STDERR "ERROR: cannot find file <$imr_imriorfile>\n";
+        $IMR->Kill (); $IMR->TimedWait (1);
+        return 1;
+    }
+    if ($imr->GetFile ($imriorfile) == -1 ||
+        $act->PutFile ($imriorfile) == -1 ||
+        $ti->PutFile ($imriorfile) == -1) {
+        print STDERR "ERROR: cannot distribute file <$imriorfile>\n";
+        $IMR->Kill (); $IMR->TimedWait (1);
+        return 1;
+    }
+
+    $ACT->Arguments ("-d $imr_debug_level -o $act_actiorfile -ORBInitRef ImplRepoService=file://$act_imriorfile");
+    print ">>> " . $ACT->CommandLine () . "\n";
+
+    $ACT_status = $ACT->Spawn ();
+    if ($ACT_status != 0) {
+        print STDERR "ERROR: ImR Activator returned $ACT_status\n";
+        $IMR->Kill (); $IMR->TimedWait (1);
+        return 1;
+    }
+    if ($act->WaitForFileTimed ($actiorfile, $act->ProcessStartWaitInterval()) == -1) {
+        print STDERR "ERROR: cannot find file <$act_actiorfile>\n";
+        $ACT->Kill (); $ACT->TimedWait (1);
+        $IMR->Kill (); $IMR->TimedWait (1);
+        return 1;
+    }
+
+    ##### Add the server, it is started by the first request of the storm #####
+    $TI->Arguments ("-ORBInitRef ImplRepoService=file://$ti_imriorfile ".
+                    "add $objprefix -c \"$srv_server_cmd -ORBUseIMR 1 -d $server_init_delay ".
+                    "-ORBInitRef ImplRepoService=file://$imr_imriorfile\"");
+    print ">>> " . $TI->CommandLine () . "\n";
+    $TI_status = $TI->SpawnWaitKill ($ti->ProcessStartWaitInterval());
+    if ($TI_status != 0) {
+        print STDERR "ERROR: tao_imr returned $TI_status\n";
+        $ACT->Kill (); $ACT->TimedWait (1);
+        $IMR->Kill (); $IMR->TimedWait (1);
+        return 1;
+    }
+
+    ##### Run the storm #####
+    $CLI->Arguments ("-ORBSvcConf $cli_conf -k corbaloc::localhost:$port/$objprefix ".
+                     "-n $requests -r $rounds -w $max_wait");
+    print ">>> " . $CLI->CommandLine () . "\n";
+    $CLI_status = $CLI->SpawnWaitKill ($cli->ProcessStartWaitInterval() +
+                                       $server_init_delay + $rounds * $max_wait);
+    if ($CLI_status != 0) {
+        print STDERR "ERROR: client returned $CLI_status\n";
+        $status = 1;
+    }
+
+    ##### Shutdown #####
+    $TI->Arguments ("-ORBInitRef ImplRepoService=file://$ti_imriorfile shutdown $objprefix");
+    print ">>> " . $TI->CommandLine () . "\n";
+    $TI_status = $TI->SpawnWaitKill ($ti->ProcessStartWaitInterval());
+    if ($TI_status != 0) {
+        print STDERR "ERROR: tao_imr shutdown returned $TI_status\n";
+        $status = 1;
+    }
+
+    my $ACT_status = $ACT->TerminateWaitKill ($act->ProcessStopWaitInterval());
+    if ($ACT_status != 0) {
+        print STDERR "ERROR: IMR Activator returned $ACT_status\n";
+        $status = 1;
+    }
+
+    my $IMR_status = $IMR->TerminateWaitKill ($imr->ProcessStopWaitInterval());
+    if ($IMR_status != 0) {
+        print STDERR "ERROR: IMR returned $IMR_status\n";
+        $status = 1;
+    }
+
+    return $status;
+}
+
+sub usage() {
+    print "Usage: run_test.pl ".
+      "[-requests <num=$requests>] ".
+      "[-rounds <num=$rounds>] ".
+      "[-forwardttl <msecs=$forward_ttl>] ".
+      "[-server_init_delay <seconds=$server_init_delay>] ".
+      "[-max_wait <seconds=$max_wait>] ".
+      "[-imrdebug <level=$imr_debug_level>]" .
+      "\n";
+}
+
+###############################################################################
+###############################################################################
+
+my $ret = locate_storm_test();
+
+$imr->DeleteFile ($imriorfile);
+$act->DeleteFile ($imriorfile);
+$ti->DeleteFile ($imriorfile);
+$act->DeleteFile ($actiorfile);
+
+exit $ret;
@@ -22,6 +22,7 @@ ServerApp::ServerApp()
     num_collocated_clients_(0),
     num_loops_(1),
     use_csd_(1),
+    work_stealing_(0),
     scenario_id_("UnknownScenarioId"),
     trial_id_(0)
 {
@@ -117,7 +118,9 @@ ServerApp::poa_setup(void)
 void
 ServerApp::csd_setup(void)
 {
-  this->tp_strategy_ = new TAO::CSD::TP_Strategy(this->num_csd_threads_);
+  this->tp_strategy_ = new TAO::CSD::TP_Strategy(this->num_csd_threads_,
+                                                 true,
+                                                 this->work_stealing_ > 0);
 
   if (this->use_csd_ > 0)
     {
@@ -207,7 +210,7 @@ ServerApp::parse_args(int argc, ACE_TCHAR* argv[])
 {
   this->exe_name_ = argv[0];
 
-  ACE_Get_Opt get_opts(argc, argv, ACE_TEXT("p:s:n:t:r:c:l:u:x:z:"));
+  ACE_Get_Opt get_opts(argc, argv, ACE_TEXT("p:s:n:t:r:c:l:u:w:x:z:"));
 
   int c;
 
@@ -273,6 +276,13 @@ ServerApp::parse_args(int argc, ACE_TCHAR* argv[])
                         "use_csd_flag");
           break;
 
+        case 'w':
+          result = this->set_arg(this->work_stealing_,
+                        get_opts.opt_arg(),
+                        c,
+                        "work_stealing_flag");
+          break;
+
         case 'x':
           this->scenario_id_ = ACE_TEXT_ALWAYS_CHAR(get_opts.opt_arg());
           break;
@@ -317,6 +327,7 @@ ServerApp::usage_statement()
              "\t[-c <num_collocated_clients>]\n"
              "\t[-l <num_loops>]\n"
              "\t[-u <use_csd_flag>]\n"
+             "\t[-w <work_stealing_flag>]\n"
              "\t[-x <scenario_id_string>]\n"
              "\t[-z <trial_id_number>]\n"
              "\t[-?]\n\n",
@@ -82,6 +82,7 @@ class ServerApp : public TestAppBase
     unsigned    num_collocated_clients_;
     unsigned    num_loops_;
     unsigned    use_csd_;
+    unsigned    work_stealing_;
 
     ACE_CString scenario_id_;
     unsigned    trial_id_;
@@ -28,6 +28,7 @@ my $num_csd_threads        = 1;
 my $num_collocated_clients = 0;
 my $num_loops              = 100;
 my $use_csd                = 1;
+my $work_stealing          = 0;
 my $scenario_id            = "UnsetScenarioId";
 my $trial_id               = 1;
 
@@ -63,6 +64,10 @@ if ($ARGC > 0) {
         $subtest = $1;
         $use_csd = 0;
     }
+    elsif ($subtest =~ /^w_(.+)$/) {
+        $subtest = $1;
+        $work_stealing = 1;
+    }
 
     if ($subtest eq 'remote') {
         $num_remote_clients = 40;
@@ -118,6 +123,16 @@ if ($ARGC > 0) {
         $num_remote_clients = 0;
         $num_collocated_clients = 40;
     }
+    elsif ($subtest eq 'remote_deep') {
+        # Many requests wait for the few busy servants.
+        $num_csd_threads = 8;
+        $num_servants = 2;
+        $num_orb_threads = 4;
+        $num_remote_clients = 200;
+        $num_loops = $num_loops / 10;
+        # 15 minute server timeout
+        $server_timeout_secs = 1800;
+    }
     elsif ($subtest eq 'usage') {
         print STDOUT "Usage: $0 [<subtest>]\n" .
                     "\n" .
@@ -133,7 +148,11 @@ if ($ARGC > 0) {
                     "\tbig\n" .
                     "\tremote_huge\n" .
                     "\tcollocated_huge\n" .
+                    "\tremote_deep\n" .
                     "\tusage\n" .
+                    "\n" .
+                    "Prefix a <subtest> with x_ to run it without the CSD\n" .
+                    "strategy, or with w_ to turn on work stealing.\n" .
                     "\n";
         exit 0;
     }
@@ -163,6 +182,7 @@ $SV = $server->CreateProcess ("server_main",
                               "-c $num_collocated_clients " .
                               "-l $num_loops "              .
                               "-u $use_csd "                .
+                              "-w $work_stealing "          .
                               "-x $scenario_id "            .
                               "-z $trial_id");
 $SV->Spawn();
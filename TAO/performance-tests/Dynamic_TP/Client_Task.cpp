@@ -0,0 +1,108 @@
+#include "Client_Task.h"
+#include "ace/OS_NS_time.h"
+#include "ace/OS_NS_unistd.h"
+
+Client_Task::Client_Task (Test::Worker_ptr worker,
+                          int nthreads,
+                          int nbursts,
+                          int calls_per_burst,
+                          CORBA::ULong work_usecs,
+                          const ACE_Time_Value &idle_time)
+  : worker_ (Test::Worker::_duplicate (worker))
+  , nthreads_ (nthreads)
+  , nbursts_ (nbursts)
+  , calls_per_burst_ (calls_per_burst)
+  , work_usecs_ (work_usecs)
+  , idle_time_ (idle_time)
+  , barrier_ (nthreads)
+  , started_ (0)
+  , peak_sum_ (0)
+  , peak_max_ (0)
+{
+}
+
+int
+Client_Task::start (void)
+{
+  return this->activate (THR_NEW_LWP | THR_JOINABLE, this->nthreads_);
+}
+
+const ACE_Latency_Histogram &
+Client_Task::latency (void) const
+{
+  return this->latency_;
+}
+
+void
+Client_Task::dump_peaks (void) const
+{
+  ACE_DEBUG ((LM_DEBUG,
+              "Server threads per burst: %.1f/%u (avg/max)\n",
+              this->nbursts_ == 0 ? 0.0
+                : double (this->peak_sum_) / this->nbursts_,
+              this->peak_max_));
+}
+
+int
+Client_Task::svc (void)
+{
+  ACE_Latency_Histogram latency;
+  bool leader = false;
+  {
+    // The first thread collects the peaks.
+    ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->lock_, -1);
+    leader = this->started_++ == 0;
+  }
+
+  try
+    {
+      this->validate_connection ();
+
+      for (int burst = 0; burst != this->nbursts_; ++burst)
+        {
+          this->barrier_.wait ();
+
+          for (int i = 0; i != this->calls_per_burst_; ++i)
+            {
+              ACE_hrtime_t start = ACE_OS::gethrtime ();
+
+              this->worker_->work (this->work_usecs_);
+
+              ACE_hrtime_t now = ACE_OS::gethrtime ();
+              latency.sample (now - start);
+            }
+
+          this->barrier_.wait ();
+          if (leader)
+            {
+              CORBA::ULong const peak = this->worker_->peak_concurrency ();
+              ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->lock_, -1);
+              this->peak_sum_ += peak;
+              if (peak > this->peak_max_)
+                this->peak_max_ = peak;
+            }
+          ACE_OS::sleep (this->idle_time_);
+        }
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Client_Task::svc");
+    }
+
+  ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->lock_, -1);
+  this->latency_.accumulate (latency);
+  return 0;
+}
+
+void
+Client_Task::validate_connection (void)
+{
+  for (int i = 0; i != 10; ++i)
+    {
+      try
+        {
+          this->worker_->work (0);
+        }
+      catch (const CORBA::Exception&){}
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef CLIENT_TASK_H
+#define CLIENT_TASK_H
+#include /**/ "ace/pre.h"
+
+#include "TestC.h"
+#include "ace/Task.h"
+#include "ace/Barrier.h"
+#include "ace/Latency_Histogram.h"
+
+/// Run the client threads, which all send their requests at the same
+/// time, then all wait, to load the server in bursts.
+class Client_Task : public ACE_Task_Base
+{
+public:
+  /// Constructor
+  Client_Task (Test::Worker_ptr worker,
+               int nthreads,
+               int nbursts,
+               int calls_per_burst,
+               CORBA::ULong work_usecs,
+               const ACE_Time_Value &idle_time);
+
+  /// Start the threads.
+  int start (void);
+
+  /// The latency of all the requests.
+  const ACE_Latency_Histogram &latency (void) const;
+
+  /// Print the average and largest number of requests the server ran
+  /// at the same time in a burst.
+  void dump_peaks (void) const;
+
+  /// The service method
+  virtual int svc (void);
+
+private:
+  /// Make sure that the current thread has a connection available.
+  void validate_connection (void);
+
+private:
+  /// The object reference used for this test
+  Test::Worker_var worker_;
+
+  int nthreads_;
+  int nbursts_;
+  int calls_per_burst_;
+  CORBA::ULong work_usecs_;
+  ACE_Time_Value idle_time_;
+
+  /// Start all the threads together at each burst
+  ACE_Barrier barrier_;
+
+  /// Protect the results
+  ACE_SYNCH_MUTEX lock_;
+
+  /// The number of threads started
+  int started_;
+
+  ACE_Latency_Histogram latency_;
+
+  /// The sum and largest of the server peak concurrency of each burst
+  CORBA::ULong peak_sum_;
+  CORBA::ULong peak_max_;
+};
+
+#include /**/ "ace/post.h"
+#endif /* CLIENT_TASK_H */
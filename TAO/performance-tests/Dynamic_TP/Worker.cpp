@@ -0,0 +1,40 @@
+#include "Worker.h"
+#include "ace/OS_NS_unistd.h"
+
+Worker::Worker (CORBA::ORB_ptr orb)
+  : orb_ (CORBA::ORB::_duplicate (orb))
+  , concurrency_ (0)
+  , peak_ (0)
+{
+}
+
+void
+Worker::work (CORBA::ULong usecs)
+{
+  {
+    ACE_GUARD (ACE_Thread_Mutex, ace_mon, this->lock_);
+    ++this->concurrency_;
+    if (this->concurrency_ > this->peak_)
+      this->peak_ = this->concurrency_;
+  }
+
+  ACE_OS::sleep (ACE_Time_Value (0, usecs));
+
+  ACE_GUARD (ACE_Thread_Mutex, ace_mon, this->lock_);
+  --this->concurrency_;
+}
+
+CORBA::ULong
+Worker::peak_concurrency (void)
+{
+  ACE_GUARD_RETURN (ACE_Thread_Mutex, ace_mon, this->lock_, 0);
+  CORBA::ULong const peak = this->peak_;
+  this->peak_ = this->concurrency_;
+  return peak;
+}
+
+void
+Worker::shutdown (void)
+{
+  this->orb_->shutdown (0);
+}
@@ -0,0 +1,48 @@
+#ifndef WORKER_H
+#define WORKER_H
+#include /**/ "ace/pre.h"
+
+#include "TestS.h"
+#include "ace/Thread_Mutex.h"
+
+#if defined (_MSC_VER)
+# pragma warning(push)
+# pragma warning (disable:4250)
+#endif /* _MSC_VER */
+
+/// Implement the Test::Worker interface
+class Worker
+  : public virtual POA_Test::Worker
+{
+public:
+  /// Constructor
+  Worker (CORBA::ORB_ptr orb);
+
+  // = The skeleton methods
+  virtual void work (CORBA::ULong usecs);
+
+  virtual CORBA::ULong peak_concurrency (void);
+
+  virtual void shutdown (void);
+
+private:
+  /// Use an ORB reference to convert strings to objects and shutdown
+  /// the application.
+  CORBA::ORB_var orb_;
+
+  /// Protect the counters
+  ACE_Thread_Mutex lock_;
+
+  /// The number of work() calls in progress
+  CORBA::ULong concurrency_;
+
+  /// The largest value of concurrency_ since peak_concurrency()
+  CORBA::ULong peak_;
+};
+
+#if defined(_MSC_VER)
+# pragma warning(pop)
+#endif /* _MSC_VER */
+
+#include /**/ "ace/post.h"
+#endif /* WORKER_H */
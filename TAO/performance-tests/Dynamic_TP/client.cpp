@@ -0,0 +1,147 @@
+#include "Client_Task.h"
+#include "ace/Get_Opt.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/Throughput_Stats.h"
+
+const ACE_TCHAR *ior = ACE_TEXT("file://test.ior");
+int nthreads = 32;
+int nbursts = 20;
+int calls_per_burst = 4;
+int work_usecs = 2000;
+int idle_msecs = 1000;
+int do_shutdown = 1;
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("xk:n:b:c:w:i:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'x':
+        do_shutdown = 0;
+        break;
+
+      case 'k':
+        ior = get_opts.opt_arg ();
+        break;
+
+      case 'n':
+        nthreads = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'b':
+        nbursts = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'c':
+        calls_per_burst = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'w':
+        work_usecs = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'i':
+        idle_msecs = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-k <ior> "
+                           "-n <threads per burst> "
+                           "-b <bursts> "
+                           "-c <calls per thread and burst> "
+                           "-w <usecs of work per call> "
+                           "-i <msecs between bursts> "
+                           "-x (disable shutdown) "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Object_var object =
+        orb->string_to_object (ior);
+
+      Test::Worker_var worker =
+        Test::Worker::_narrow (object.in ());
+
+      if (CORBA::is_nil (worker.in ()))
+        {
+          ACE_ERROR_RETURN ((LM_ERROR,
+                             "Nil Test::Worker reference <%s>\n",
+                             ior),
+                            1);
+        }
+
+      ACE_Time_Value idle_time;
+      idle_time.msec (idle_msecs);
+
+      Client_Task task (worker.in (),
+                        nthreads,
+                        nbursts,
+                        calls_per_burst,
+                        static_cast<CORBA::ULong> (work_usecs),
+                        idle_time);
+
+      ACE_DEBUG ((LM_DEBUG,
+                  "Starting %d threads, %d bursts of %d calls each\n",
+                  nthreads, nbursts, calls_per_burst));
+
+      ACE_hrtime_t test_start = ACE_OS::gethrtime ();
+      if (task.start () != 0)
+        {
+          ACE_ERROR_RETURN ((LM_ERROR,
+                             "Cannot activate client threads\n"),
+                            1);
+        }
+      task.wait ();
+      ACE_hrtime_t test_end = ACE_OS::gethrtime ();
+
+      ACE_DEBUG ((LM_DEBUG, "Threads finished\n"));
+
+      ACE_High_Res_Timer::global_scale_factor_type gsf =
+        ACE_High_Res_Timer::global_scale_factor ();
+
+      task.latency ().dump_results (ACE_TEXT("Latency"), gsf);
+
+      ACE_Throughput_Stats::dump_throughput (
+        ACE_TEXT("Total"), gsf,
+        test_end - test_start,
+        static_cast<ACE_UINT32> (task.latency ().samples_count ()));
+
+      task.dump_peaks ();
+
+      if (do_shutdown)
+        {
+          worker->shutdown ();
+        }
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,107 @@
+eval '(exit $?0)' && eval 'exec perl -S $0 ${1+"$@"}'
+     & eval 'exec perl -S $0 $argv:q'
+     if 0;
+
+# -*- perl -*-
+
+use lib "$ENV{ACE_ROOT}/bin";
+use PerlACE::TestTarget;
+
+$status = 0;
+$debug_level = '0';
+$bursts = 20;
+@modes = ('idle', 'latency');
+
+for ($iter = 0; $iter <= $#ARGV; $iter++) {
+    if ($ARGV[$iter] eq "-h" || $ARGV[$iter] eq "-?") {
+        print "Run_Test Perl script for the Dynamic Thread Pool burst test\n\n";
+        print "run_test [-b bursts] [-m idle|latency] [-debug] [-h]\n";
+        print "\n";
+        print "-b bursts           -- number of bursts of requests\n";
+        print "-m idle|latency     -- only run with the given sizing\n";
+        print "-debug              -- run the server at debug level 10\n";
+        print "-h                  -- prints this information\n";
+        exit 0;
+    }
+    elsif ($ARGV[$iter] eq "-b") {
+        $bursts = $ARGV[$iter + 1];
+        $iter++;
+    }
+    elsif ($ARGV[$iter] eq "-m") {
+        @modes = ($ARGV[$iter + 1]);
+        $iter++;
+    }
+    elsif ($ARGV[$iter] eq "-debug") {
+        $debug_level = '10';
+    }
+}
+
+my $server = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
+my $client = PerlACE::TestTarget::create_target (2) || die "Create target 2 failed\n";
+
+my $iorbase = "server.ior";
+my $server_iorfile = $server->LocalFile ($iorbase);
+my $client_iorfile = $client->LocalFile ($iorbase);
+
+foreach $mode (@modes) {
+    my $conf = "svc_$mode.conf";
+    my $server_conf = $server->LocalFile ($conf);
+
+    if ($server->PutFile ($conf) == -1) {
+        print STDERR "ERROR: cannot set file <$server_conf>\n";
+        exit 1;
+    }
+
+    $server->DeleteFile($iorbase);
+    $client->DeleteFile($iorbase);
+
+    $SV = $server->CreateProcess ("server", "-ORBdebuglevel $debug_level -ORBSvcConf $server_conf -o $server_iorfile");
+    $CL = $client->CreateProcess ("client", "-k file://$client_iorfile -b $bursts");
+
+    print STDERR "================ Dynamic Thread Pool burst test, $mode sizing\n";
+
+    $server_status = $SV->Spawn ();
+
+    if ($server_status != 0) {
+        print STDERR "ERROR: server returned $server_status\n";
+        exit 1;
+    }
+
+    if ($server->WaitForFileTimed ($iorbase,
+                                   $server->ProcessStartWaitInterval()) == -1) {
+        print STDERR "ERROR: cannot find file <$server_iorfile>\n";
+        $SV->Kill (); $SV->TimedWait (1);
+        exit 1;
+    }
+
+    if ($server->GetFile ($iorbase) == -1) {
+        print STDERR "ERROR: cannot retrieve file <$server_iorfile>\n";
+        $SV->Kill (); $SV->TimedWait (1);
+        exit 1;
+    }
+
+    if ($client->PutFile ($iorbase) == -1) {
+        print STDERR "ERROR: cannot set file <$client_iorfile>\n";
+        $SV->Kill (); $SV->TimedWait (1);
+        exit 1;
+    }
+
+    $client_status = $CL->SpawnWaitKill ($client->ProcessStartWaitInterval() + 2 * $bursts);
+
+    if ($client_status != 0) {
+        print STDERR "ERROR: client returned $client_status\n";
+        $status = 1;
+    }
+
+    $server_status = $SV->WaitKill ($server->ProcessStopWaitInterval());
+
+    if ($server_status != 0) {
+        print STDERR "ERROR: server returned $server_status\n";
+        $status = 1;
+    }
+
+    $server->DeleteFile($iorbase);
+    $client->DeleteFile($iorbase);
+}
+
+exit $status;
@@ -4,7 +4,7 @@
 #include "ace/Sched_Params.h"
 #include "ace/Stats.h"
 #include "ace/Throughput_Stats.h"
-#include "ace/Sample_History.h"
+#include "ace/Latency_Histogram.h"
 #include "ace/OS_NS_errno.h"
 
 #include "tao/Strategies/advanced_resource.h"
@@ -46,7 +46,7 @@ parse_args (int argc, ACE_TCHAR *argv[])
                            "-k <ior> "
                            "-i <niterations> "
                            "-x (disable shutdown) "
-                           "-h (dump history) "
+                           "-h (dump distribution) "
                            "\n",
                            argv [0]),
                           -1);
@@ -106,7 +106,7 @@ ACE_TMAIN(int argc, ACE_TCHAR *argv[])
           (void) roundtrip->test_method (start);
         }
 
-      ACE_Sample_History history (niterations);
+      ACE_Latency_Histogram latency;
 
       ACE_hrtime_t test_start = ACE_OS::gethrtime ();
       for (int i = 0; i < niterations; ++i)
@@ -116,7 +116,7 @@ ACE_TMAIN(int argc, ACE_TCHAR *argv[])
           (void) roundtrip->test_method (start);
 
           ACE_hrtime_t now = ACE_OS::gethrtime ();
-          history.sample (now - start);
+          latency.sample (now - start);
         }
 
       ACE_hrtime_t test_end = ACE_OS::gethrtime ();
@@ -130,16 +130,15 @@ ACE_TMAIN(int argc, ACE_TCHAR *argv[])
 
       if (do_dump_history)
         {
-          history.dump_samples (ACE_TEXT("HISTORY"), gsf);
+          latency.dump_cdf (ACE_TEXT("CDF"), gsf);
         }
 
-      ACE_Basic_Stats stats;
-      history.collect_basic_stats (stats);
-      stats.dump_results (ACE_TEXT("Total"), gsf);
+      latency.dump_results (ACE_TEXT("Total"), gsf);
 
-      ACE_Throughput_Stats::dump_throughput (ACE_TEXT("Total"), gsf,
-                                             test_end - test_start,
-                                             stats.samples_count ());
+      ACE_Throughput_Stats::dump_throughput (
+        ACE_TEXT("Total"), gsf,
+        test_end - test_start,
+        static_cast<ACE_UINT32> (latency.samples_count ()));
 
       if (do_shutdown)
         {
@@ -116,7 +116,7 @@ ACE_TMAIN(int argc, ACE_TCHAR *argv[])
         ACE_High_Res_Timer::global_scale_factor ();
       ACE_DEBUG ((LM_DEBUG, "done\n"));
 
-      ACE_Basic_Stats totals;
+      ACE_Latency_Histogram totals;
       task0.accumulate_and_dump (totals, ACE_TEXT("Task[0]"), gsf);
       task1.accumulate_and_dump (totals, ACE_TEXT("Task[1]"), gsf);
       task2.accumulate_and_dump (totals, ACE_TEXT("Task[2]"), gsf);
@@ -124,9 +124,10 @@ ACE_TMAIN(int argc, ACE_TCHAR *argv[])
 
       totals.dump_results (ACE_TEXT("Total"), gsf);
 
-      ACE_Throughput_Stats::dump_throughput (ACE_TEXT("Total"), gsf,
-                                             test_end - test_start,
-                                             totals.samples_count ());
+      ACE_Throughput_Stats::dump_throughput (
+        ACE_TEXT("Total"), gsf,
+        test_end - test_start,
+        static_cast<ACE_UINT32> (totals.samples_count ()));
 
       if (do_shutdown)
         {
@@ -0,0 +1,75 @@
+#include "tao/Base_Interface_Table.h"
+
+#if (TAO_HAS_BASE_INTERFACE_TABLE == 1)
+
+#include "ace/Static_Object_Lock.h"
+#include "ace/Recursive_Thread_Mutex.h"
+#include "ace/Guard_T.h"
+#include "ace/OS_NS_string.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+// Zero initialized before any registration runs.
+TAO::Base_Interface_Table::Registration *
+TAO::Base_Interface_Table::head_ = 0;
+
+TAO::Base_Interface_Table::Registration::Registration (const char * const *ids)
+  : ids_ (ids)
+  , next_ (0)
+{
+  // Registrations are made by static objects, while the libraries
+  // holding the stubs are loaded.
+  ACE_MT (ACE_GUARD (TAO_SYNCH_RECURSIVE_MUTEX,
+                     guard,
+                     *ACE_Static_Object_Lock::instance ()));
+
+  this->next_ = Base_Interface_Table::head_;
+  Base_Interface_Table::head_ = this;
+}
+
+TAO::Base_Interface_Table::Registration::~Registration (void)
+{
+  ACE_MT (ACE_GUARD (TAO_SYNCH_RECURSIVE_MUTEX,
+                     guard,
+                     *ACE_Static_Object_Lock::instance ()));
+
+  for (Registration **r = &Base_Interface_Table::head_;
+       *r != 0;
+       r = &(*r)->next_)
+    {
+      if (*r == this)
+        {
+          *r = this->next_;
+          break;
+        }
+    }
+}
+
+bool
+TAO::Base_Interface_Table::is_a (const char *type_id, const char *base_id)
+{
+  ACE_MT (ACE_GUARD_RETURN (TAO_SYNCH_RECURSIVE_MUTEX,
+                            guard,
+                            *ACE_Static_Object_Lock::instance (),
+                            false));
+
+  for (Registration *r = Base_Interface_Table::head_; r != 0; r = r->next_)
+    {
+      if (ACE_OS::strcmp (r->ids_[0], type_id) != 0)
+        continue;
+
+      for (const char * const *id = r->ids_; *id != 0; ++id)
+        {
+          if (ACE_OS::strcmp (*id, base_id) == 0)
+            return true;
+        }
+
+      return false;
+    }
+
+  return false;
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* TAO_HAS_BASE_INTERFACE_TABLE == 1 */
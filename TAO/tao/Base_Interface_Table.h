@@ -0,0 +1,93 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file Base_Interface_Table.h
+ *
+ *  Repository ids of the interfaces whose stubs are linked into the
+ *  process, with the ids of their base interfaces.
+ */
+//=============================================================================
+
+#ifndef TAO_BASE_INTERFACE_TABLE_H
+#define TAO_BASE_INTERFACE_TABLE_H
+
+#include /**/ "ace/pre.h"
+#include "tao/orbconf.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/TAO_Export.h"
+#include /**/ "tao/Versioned_Namespace.h"
+
+#if (TAO_HAS_BASE_INTERFACE_TABLE == 1)
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  /**
+   * @class Base_Interface_Table
+   *
+   * @brief Local knowledge of the interface hierarchy.
+   *
+   * The stubs generated by the IDL compiler register, for each
+   * interface, the repository ids its generated _is_a() knows: the id
+   * of the interface itself followed by those of all its base
+   * interfaces.  That lets CORBA::Object::_is_a() answer for an
+   * object reference whose IOR names a more derived type than the
+   * proxy it is held by, without asking the object.  Only positive
+   * answers are given, the IOR may name a base of the actual type of
+   * the object.
+   */
+  class TAO_Export Base_Interface_Table
+  {
+  public:
+    /**
+     * @class Registration
+     *
+     * @brief The repository ids of an interface, registered for as
+     * long as the stubs are loaded.
+     *
+     * @a ids is a null terminated array whose first element is the
+     * repository id of the interface, it is not copied.
+     */
+    class TAO_Export Registration
+    {
+    public:
+      Registration (const char * const *ids);
+
+      ~Registration (void);
+
+    private:
+      ACE_UNIMPLEMENTED_FUNC (Registration (const Registration &))
+      ACE_UNIMPLEMENTED_FUNC (Registration &operator= (const Registration &))
+
+      friend class Base_Interface_Table;
+
+      const char * const *ids_;
+      Registration *next_;
+    };
+
+    /// True if the interface with repository id @a type_id is known
+    /// to be, or to derive from, the interface with repository id
+    /// @a base_id.  False does not mean an object whose IOR names
+    /// @a type_id does not support @a base_id, its actual type may
+    /// derive from @a type_id.
+    static bool is_a (const char *type_id, const char *base_id);
+
+  private:
+    /// The registered interfaces, most recent first.
+    static Registration *head_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* TAO_HAS_BASE_INTERFACE_TABLE == 1 */
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_BASE_INTERFACE_TABLE_H */
@@ -356,5 +356,16 @@ TAO_InputCDR::clr_mb_flags( ACE_Message_Block::Message_Flags less_flags )
   return start_.clr_self_flags( less_flags );
 }
 
+bool
+TAO_InputCDR::data_block_shareable (void) const
+{
+  if (ACE_BIT_ENABLED (this->start_.flags (), ACE_Message_Block::DONT_DELETE))
+    return false;
+
+  return this->orb_core_ != 0
+    && this->orb_core_->resource_factory ()->
+         input_cdr_allocator_type_locked () == 1;
+}
+
 
 TAO_END_VERSIONED_NAMESPACE_DECL
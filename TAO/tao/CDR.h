@@ -421,6 +421,11 @@ public:
   ACE_Message_Block::Message_Flags
     clr_mb_flags( ACE_Message_Block::Message_Flags less_flags );
 
+  /// True if sequences may keep a reference on the data block of the
+  /// stream instead of copying their elements: it is not on the stack
+  /// and its allocator can be used by any thread that releases it.
+  bool data_block_shareable (void) const;
+
   // = TAO specific methods.
   static void throw_stub_exception (int error_num);
   static void throw_skel_exception (int error_num);
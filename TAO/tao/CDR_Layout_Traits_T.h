@@ -0,0 +1,112 @@
+#ifndef guard_cdr_layout_traits_hpp
+#define guard_cdr_layout_traits_hpp
+/**
+ * @file
+ *
+ * @brief Describe the types whose CDR encoding has the same layout as
+ * their representation in memory.
+ */
+
+#include "tao/Basic_Types.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+/**
+ * Sequences of these types can refer to the elements in a CDR stream
+ * of the native byte order, instead of copying them one by one (see
+ * TAO_NO_COPY_VALUE_SEQUENCES).  The IDL compiler specializes the
+ * traits for the structs with only numeric members and no padding
+ * that differs between CDR and memory.
+ */
+template<typename T>
+struct CDR_Layout_Traits
+{
+  enum
+  {
+    /// The size of an element in memory, 0 if its layout differs from
+    /// the one in CDR.  The elements of a sequence are as far apart
+    /// in CDR as in memory.
+    size = 0,
+
+    /// The number of octets of an element in CDR, without the padding
+    /// that follows it in memory.
+    encoded_size = 0,
+
+    /// The alignment of the read pointer before the first element,
+    /// the alignment of its first member.
+    read_alignment = 1,
+
+    /// The alignment the first element needs to have the layout it
+    /// has in memory.
+    alignment = 1
+  };
+};
+
+/// The traits of the numeric types, aligned on their size.
+template<size_t N>
+struct Basic_CDR_Layout_Traits
+{
+  enum
+  {
+    size = N,
+    encoded_size = N,
+    read_alignment = N,
+    alignment = N
+  };
+};
+
+template<>
+struct CDR_Layout_Traits<CORBA::Short>
+  : public Basic_CDR_Layout_Traits<ACE_CDR::SHORT_SIZE>
+{
+};
+
+template<>
+struct CDR_Layout_Traits<CORBA::UShort>
+  : public Basic_CDR_Layout_Traits<ACE_CDR::SHORT_SIZE>
+{
+};
+
+template<>
+struct CDR_Layout_Traits<CORBA::Long>
+  : public Basic_CDR_Layout_Traits<ACE_CDR::LONG_SIZE>
+{
+};
+
+template<>
+struct CDR_Layout_Traits<CORBA::ULong>
+  : public Basic_CDR_Layout_Traits<ACE_CDR::LONG_SIZE>
+{
+};
+
+template<>
+struct CDR_Layout_Traits<CORBA::LongLong>
+  : public Basic_CDR_Layout_Traits<ACE_CDR::LONGLONG_SIZE>
+{
+};
+
+template<>
+struct CDR_Layout_Traits<CORBA::ULongLong>
+  : public Basic_CDR_Layout_Traits<ACE_CDR::LONGLONG_SIZE>
+{
+};
+
+template<>
+struct CDR_Layout_Traits<CORBA::Float>
+  : public Basic_CDR_Layout_Traits<ACE_CDR::LONG_SIZE>
+{
+};
+
+template<>
+struct CDR_Layout_Traits<CORBA::Double>
+  : public Basic_CDR_Layout_Traits<ACE_CDR::LONGLONG_SIZE>
+{
+};
+
+} // namespace TAO
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#endif // guard_cdr_layout_traits_hpp
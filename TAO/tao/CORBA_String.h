@@ -26,6 +26,7 @@
 #include "ace/iosfwd.h"
 
 #include <algorithm>
+#include <utility>
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -71,6 +72,22 @@ namespace TAO
     {
     }
 
+#if defined (ACE_HAS_CPP11)
+    /// Move constructor, takes the string of @a s.
+    inline String_var (String_var<charT> &&s) noexcept : ptr_ (s.ptr_)
+    {
+      s.ptr_ = 0;
+    }
+
+    /// Move assignment operator.
+    inline String_var &operator= (String_var<character_type> &&s) noexcept
+    {
+      String_var <charT> tmp (std::move (s));
+      std::swap (this->ptr_, tmp.ptr_);
+      return *this;
+    }
+#endif /* ACE_HAS_CPP11 */
+
     /// Destructor.
     inline ~String_var (void)
     {
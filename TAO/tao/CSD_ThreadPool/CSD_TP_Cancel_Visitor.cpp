@@ -32,6 +32,10 @@ TAO::CSD::TP_Cancel_Visitor::visit_request(TP_Request* request,
 
       // Cancel the request
       request->cancel();
+
+      // A work stealing task keeps the other requests to the same servant
+      // behind this one, in the servant's own queue.  Cancel those too.
+      request->cancel_queued_servant_requests(true);
     }
 
    // Since we are either cancelling requests to any servant or a
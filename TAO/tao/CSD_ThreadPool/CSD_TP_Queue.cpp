@@ -38,6 +38,32 @@ TAO::CSD::TP_Queue::put(TP_Request* request)
 }
 
 
+TAO::CSD::TP_Request*
+TAO::CSD::TP_Queue::get()
+{
+  TP_Request* request = this->head_;
+
+  if (request != 0)
+    {
+      this->head_ = request->next_;
+
+      if (this->head_ == 0)
+        {
+          this->tail_ = 0;
+        }
+      else
+        {
+          this->head_->prev_ = 0;
+        }
+
+      request->prev_ = request->next_ = 0;
+    }
+
+  // The caller now owns the queue's "copy" of the request.
+  return request;
+}
+
+
 void
 TAO::CSD::TP_Queue::accept_visitor(TP_Queue_Visitor& visitor)
 {
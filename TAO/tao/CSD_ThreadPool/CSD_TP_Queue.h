@@ -68,6 +68,11 @@ namespace TAO
       /// Place a request at the end of the queue.
       void put(TP_Request* request);
 
+      /// Remove the request at the front of the queue and return it,
+      /// along with the reference the queue held on it.  Returns a NULL
+      /// pointer if the queue is empty.
+      TP_Request* get();
+
       /// Returns true if the queue is empty.  Returns false otherwise.
       bool is_empty() const;
 
@@ -23,6 +23,7 @@
 #include "tao/PortableServer/Servant_Base.h"
 #include "tao/Intrusive_Ref_Count_Base_T.h"
 #include "tao/Intrusive_Ref_Count_Handle_T.h"
+#include "ace/OS_NS_time.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -76,6 +77,27 @@ namespace TAO
       /// servant object.
       bool is_target(PortableServer::Servant servant);
 
+      /// Used by a work stealing TP_Task instead of the busy flag.
+      /// Returns true if the request may be dispatched now, or false if
+      /// it has been queued behind another request to the target servant.
+      bool schedule();
+
+      /// Used by a work stealing TP_Task once this (scheduled) request
+      /// has been dispatched.  Returns the next request to the target
+      /// servant, now scheduled, or a NULL pointer.  The caller owns the
+      /// returned request.
+      TP_Request* next_servant_request();
+
+      /// Used by a work stealing TP_Task to cancel the requests queued
+      /// behind this (scheduled) request.  The unschedule flag is true if
+      /// this request has been cancelled as well.
+      void cancel_queued_servant_requests(bool unschedule);
+
+      /// Set and get the time (from ACE_OS::gethrtime()) the request
+      /// was put in a request queue.  Only set by queues that measure
+      /// the time requests wait, 0 otherwise.
+      void queued_at(ACE_hrtime_t when);
+      ACE_hrtime_t queued_at() const;
 
     protected:
 
@@ -118,6 +140,9 @@ namespace TAO
 
       /// Reference to the servant "state" object (contains the busy flag).
       TP_Servant_State::HandleType servant_state_;
+
+      /// When the request was queued, see queued_at().
+      ACE_hrtime_t queued_at_;
     };
 
   }
@@ -7,7 +7,8 @@ TAO::CSD::TP_Request::TP_Request(PortableServer::Servant servant,
   : prev_(0),
     next_(0),
     servant_ (servant),
-    servant_state_(servant_state, false)
+    servant_state_(servant_state, false),
+    queued_at_(0)
 {
   this->servant_->_add_ref ();
 }
@@ -77,6 +78,59 @@ TAO::CSD::TP_Request::is_target(PortableServer::Servant servant)
 }
 
 
+ACE_INLINE
+bool
+TAO::CSD::TP_Request::schedule()
+{
+  if (this->servant_state_.is_nil())
+    {
+      return true;
+    }
+
+  return this->servant_state_->schedule_request(this);
+}
+
+
+ACE_INLINE
+TAO::CSD::TP_Request*
+TAO::CSD::TP_Request::next_servant_request()
+{
+  if (this->servant_state_.is_nil())
+    {
+      return 0;
+    }
+
+  return this->servant_state_->next_request();
+}
+
+
+ACE_INLINE
+void
+TAO::CSD::TP_Request::cancel_queued_servant_requests(bool unschedule)
+{
+  if (!this->servant_state_.is_nil())
+    {
+      this->servant_state_->cancel_queued_requests(unschedule);
+    }
+}
+
+
+ACE_INLINE
+void
+TAO::CSD::TP_Request::queued_at(ACE_hrtime_t when)
+{
+  this->queued_at_ = when;
+}
+
+
+ACE_INLINE
+ACE_hrtime_t
+TAO::CSD::TP_Request::queued_at() const
+{
+  return this->queued_at_;
+}
+
+
 ACE_INLINE
 void
 TAO::CSD::TP_Request::dispatch()
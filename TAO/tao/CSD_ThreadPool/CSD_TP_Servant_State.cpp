@@ -1,4 +1,5 @@
 #include "tao/CSD_ThreadPool/CSD_TP_Servant_State.h"
+#include "tao/CSD_ThreadPool/CSD_TP_Request.h"
 
 #if !defined (__ACE_INLINE__)
 # include "tao/CSD_ThreadPool/CSD_TP_Servant_State.inl"
@@ -10,4 +11,57 @@ TAO::CSD::TP_Servant_State::~TP_Servant_State()
 {
 }
 
+
+bool
+TAO::CSD::TP_Servant_State::schedule_request(TP_Request* request)
+{
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->lock_, false);
+
+  if (this->scheduled_)
+    {
+      this->queue_.put(request);
+      return false;
+    }
+
+  this->scheduled_ = true;
+  return true;
+}
+
+
+TAO::CSD::TP_Request*
+TAO::CSD::TP_Servant_State::next_request()
+{
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->lock_, 0);
+
+  TP_Request* request = this->queue_.get();
+
+  if (request == 0)
+    {
+      this->scheduled_ = false;
+    }
+
+  return request;
+}
+
+
+void
+TAO::CSD::TP_Servant_State::cancel_queued_requests(bool unschedule)
+{
+  ACE_GUARD (TAO_SYNCH_MUTEX, guard, this->lock_);
+
+  TP_Request* request;
+
+  while ((request = this->queue_.get()) != 0)
+    {
+      // Take over the queue's "copy" of the request.
+      TP_Request_Handle handle = request;
+      request->cancel();
+    }
+
+  if (unschedule)
+    {
+      this->scheduled_ = false;
+    }
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
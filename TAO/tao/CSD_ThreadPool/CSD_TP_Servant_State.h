@@ -14,6 +14,7 @@
 #include /**/ "ace/pre.h"
 
 #include "tao/CSD_ThreadPool/CSD_TP_Export.h"
+#include "tao/CSD_ThreadPool/CSD_TP_Queue.h"
 #include "tao/orbconf.h"
 
 #if !defined (ACE_LACKS_PRAGMA_ONCE)
@@ -47,8 +48,11 @@ namespace TAO
      * class.  Each request placed on to the request queue will hold a
      * reference (via a smart pointer) to the servant state object.
      *
-     * Currently, the only "state" info held in this TP_Servant_State class
-     * is the servant's busy flag.
+     * The busy flag is used by a TP_Task that keeps all of the requests
+     * in one queue.  A TP_Task using work stealing instead keeps the
+     * requests to a servant in the servant's own queue, behind the one
+     * request that is "scheduled" (ie, queued to a worker thread or
+     * being dispatched).
      *
      */
     class TAO_CSD_TP_Export TP_Servant_State
@@ -71,10 +75,35 @@ namespace TAO
       /// Mutator for the servant busy flag.
       void busy_flag(bool new_value);
 
+      /// Schedule the request if the servant has no scheduled request,
+      /// and return true.  Otherwise, put it at the end of the servant's
+      /// queue and return false.
+      bool schedule_request(TP_Request* request);
+
+      /// The scheduled request has been handled.  Remove the next request
+      /// from the servant's queue, schedule it and return it (the caller
+      /// owns the queue's reference).  Returns a NULL pointer, and leaves
+      /// the servant without a scheduled request, if the queue is empty.
+      TP_Request* next_request();
+
+      /// Cancel the requests in the servant's queue.  If unschedule is
+      /// true, the scheduled request has been cancelled too and the
+      /// servant is left without a scheduled request.
+      void cancel_queued_requests(bool unschedule);
+
     private:
 
       /// The servant's current "busy" state (true == busy, false == not busy)
       bool busy_flag_;
+
+      /// Lock protecting the scheduled_ flag and the queue_.
+      TAO_SYNCH_MUTEX lock_;
+
+      /// True if the servant has a scheduled request.
+      bool scheduled_;
+
+      /// The requests waiting for the scheduled request to be handled.
+      TP_Queue queue_;
     };
 
   }
@@ -3,7 +3,8 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 ACE_INLINE
 TAO::CSD::TP_Servant_State::TP_Servant_State()
-  : busy_flag_(false)
+  : busy_flag_(false),
+    scheduled_(false)
 {
 }
 
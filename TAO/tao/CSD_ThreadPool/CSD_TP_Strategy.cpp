@@ -58,6 +58,7 @@ bool
 TAO::CSD::TP_Strategy::poa_activated_event_i(TAO_ORB_Core& orb_core)
 {
   this->task_.thr_mgr(orb_core.thr_mgr());
+  this->task_.work_stealing(this->work_stealing_);
   // Activates the worker threads, and waits until all have been started.
   return (this->task_.open(&(this->num_threads_)) == 0);
 }
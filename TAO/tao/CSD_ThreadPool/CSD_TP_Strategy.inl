@@ -3,9 +3,11 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 ACE_INLINE
 TAO::CSD::TP_Strategy::TP_Strategy(Thread_Counter  num_threads,
-                                   bool     serialize_servants)
+                                   bool     serialize_servants,
+                                   bool     work_stealing)
   : num_threads_(num_threads),
-    serialize_servants_(serialize_servants)
+    serialize_servants_(serialize_servants),
+    work_stealing_(work_stealing)
 {
   // Assumes that num_threads > 0.
 }
@@ -29,4 +31,13 @@ TAO::CSD::TP_Strategy::set_servant_serialization(bool serialize_servants)
 }
 
 
+ACE_INLINE
+void
+TAO::CSD::TP_Strategy::set_work_stealing(bool work_stealing)
+{
+  // Simple Mutator.
+  this->work_stealing_ = work_stealing;
+}
+
+
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -64,6 +64,7 @@ TAO::CSD::TP_Strategy_Factory::init (int argc,
           ACE_CString poa_name;
           unsigned long num_threads = 1;
           bool serialize_servants = true;
+          bool work_stealing = false;
 
           curarg++;
           if (curarg >= argc)
@@ -86,20 +87,39 @@ TAO::CSD::TP_Strategy_Factory::init (int argc,
                 {
                   return -1;
                 }
-              if (*sep == ':')
+
+              // The remaining fields are flags: OFF turns off servant
+              // serialization, STEAL turns on work stealing.
+              ACE_TCHAR *flag = (*sep == ':') ? sep + 1 : 0;
+              while (flag != 0)
                 {
+                  ACE_TCHAR *next = ACE_OS::strchr (flag, ':');
+                  if (next != 0)
+                    {
+                      *next++ = 0;
+                    }
+
                   if (ACE_OS::strcasecmp (
-                    sep + 1, ACE_TEXT_CHAR_TO_TCHAR ("OFF")) == 0)
+                    flag, ACE_TEXT_CHAR_TO_TCHAR ("OFF")) == 0)
                     {
                       serialize_servants = false;
                     }
+                  else if (ACE_OS::strcasecmp (
+                    flag, ACE_TEXT_CHAR_TO_TCHAR ("STEAL")) == 0)
+                    {
+                      work_stealing = true;
+                    }
+
+                  flag = next;
                 }
             }
 
           // Create the ThreadPool strategy for each named poa.
           TP_Strategy* strategy = 0;
           ACE_NEW_RETURN (strategy,
-                          TP_Strategy (num_threads, serialize_servants),
+                          TP_Strategy (num_threads,
+                                       serialize_servants,
+                                       work_stealing),
                           -1);
           CSD_Framework::Strategy_var objref = strategy;
           repo->add_strategy (poa_name, strategy);
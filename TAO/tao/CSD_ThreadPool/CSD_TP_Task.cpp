@@ -11,6 +11,7 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 TAO::CSD::TP_Task::~TP_Task()
 {
+  delete [] this->workers_;
 }
 
 
@@ -34,6 +35,31 @@ TAO::CSD::TP_Task::add_request(TP_Request* request)
   // the request can be properly placed into a queue.
   request->prepare_for_queue();
 
+  if (this->work_stealing_)
+    {
+      // Unless the target servant already has a scheduled request, in
+      // which case the request waits in the servant's queue, give the
+      // request to the next worker.  An idle worker will steal it if that
+      // worker is busy.
+      if (request->schedule())
+        {
+          Worker_Queue& worker =
+            this->workers_[this->next_queue_++ % this->num_workers_];
+
+          {
+            ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, worker_guard, worker.lock_, false);
+            worker.queue_.put(request);
+          }
+
+          if (this->idle_workers_ > 0)
+            {
+              this->work_available_.signal();
+            }
+        }
+
+      return true;
+    }
+
   this->queue_.put(request);
 
   this->work_available_.signal();
@@ -80,6 +106,23 @@ TAO::CSD::TP_Task::open(void* args)
       return 0;
     }
 
+  // Each worker thread gets a queue when work stealing is enabled.  The
+  // queues may still be in use by a thread that initiated the previous
+  // shutdown, in which case they are kept.
+  if (this->work_stealing_)
+    {
+      if (this->workers_ == 0 || this->num_threads_ == 0)
+        {
+          delete [] this->workers_;
+          this->workers_ = 0;
+          ACE_NEW_RETURN (this->workers_, Worker_Queue[num], -1);
+          this->num_workers_ = num;
+        }
+
+      this->next_worker_ = 0;
+      this->next_queue_ = 0;
+    }
+
   // Activate this task object with 'num' worker threads.
   if (this->activate(THR_NEW_LWP | THR_JOINABLE, num) != 0)
     {
@@ -113,6 +156,7 @@ TAO::CSD::TP_Task::svc()
 {
   // Account for this current worker thread having started the
   // execution of this svc() method.
+  Thread_Counter worker_index = 0;
   {
     ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->lock_, false);
     // Put the thread id into a collection which is used to check whether
@@ -121,8 +165,18 @@ TAO::CSD::TP_Task::svc()
     this->activated_threads_.push_back(thr_id);
     ++this->num_threads_;
     this->active_workers_.signal();
+
+    if (this->work_stealing_)
+      {
+        worker_index = this->next_worker_++ % this->num_workers_;
+      }
   }
 
+  if (this->work_stealing_)
+    {
+      return this->work_stealing_svc(worker_index);
+    }
+
   // This visitor object will be re-used over and over again as part of
   // the "GetWork" logic below.
   TP_Dispatchable_Visitor dispatchable_visitor;
@@ -211,6 +265,170 @@ TAO::CSD::TP_Task::svc()
 }
 
 
+int
+TAO::CSD::TP_Task::work_stealing_svc(Thread_Counter index)
+{
+  Worker_Queue& own = this->workers_[index];
+
+  while (1)
+    {
+      // Shutdown checks need the lock_, so only perform them once a
+      // shutdown has been initiated.
+      if (this->stop_requested_.value() != 0)
+        {
+          ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->lock_, 0);
+
+          if (this->stop_worker_i())
+            {
+              break;
+            }
+        }
+
+      TP_Request* work = this->get_work(index);
+
+      if (work == 0)
+        {
+          // All of the queues were empty.  Check them again with the lock_
+          // held, since add_request() holds it too, before waiting until
+          // we hear about the possibility of work.
+          ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->lock_, 0);
+
+          if (this->stop_worker_i())
+            {
+              break;
+            }
+
+          work = this->get_work(index);
+
+          if (work == 0)
+            {
+              ++this->idle_workers_;
+              this->work_available_.wait();
+              --this->idle_workers_;
+              continue;
+            }
+        }
+
+      // Take over the reference to the request.
+      TP_Request_Handle request = work;
+
+      // Do the "PerformWork" step.  No lock is needed to do this.
+      request->dispatch();
+
+      // Schedule the next request to the same servant, if there is one,
+      // at the end of our own queue.
+      bool more_work = false;
+      {
+        ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, own.lock_, 0);
+
+        TP_Request_Handle next = request->next_servant_request();
+
+        if (!next.is_nil())
+          {
+            more_work = !own.queue_.is_empty();
+            own.queue_.put(next.in());
+          }
+
+        own.current_ = 0;
+      }
+
+      // Let an idle worker, if any, steal from our queue.
+      if (more_work)
+        {
+          this->work_available_.signal();
+        }
+    }
+
+  // Cancel the requests left in our queue.  A worker thread that
+  // initiated the shutdown may have scheduled some after the shutdown
+  // cancelled the queued requests.
+  {
+    ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, own.lock_, 0);
+    TP_Cancel_Visitor cancel_visitor;
+    own.queue_.accept_visitor(cancel_visitor);
+  }
+
+  return 0;
+}
+
+
+TAO::CSD::TP_Request*
+TAO::CSD::TP_Task::get_work(Thread_Counter index)
+{
+  Worker_Queue& own = this->workers_[index];
+
+  {
+    ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, own.lock_, 0);
+
+    TP_Request* request = own.queue_.get();
+
+    if (request != 0)
+      {
+        own.current_ = request;
+        return request;
+      }
+  }
+
+  // Our queue is empty.  Steal the oldest request of another worker.
+  // The two worker locks are acquired in index order, and the stolen
+  // request becomes our current_ request before the victim's lock is
+  // released, so that cancel_servant() always finds it.
+  for (Thread_Counter i = 1; i < this->num_workers_; ++i)
+    {
+      Thread_Counter const victim_index = (index + i) % this->num_workers_;
+      Worker_Queue& victim = this->workers_[victim_index];
+
+      Worker_Queue& first = (victim_index < index) ? victim : own;
+      Worker_Queue& second = (victim_index < index) ? own : victim;
+
+      ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, first_guard, first.lock_, 0);
+      ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, second_guard, second.lock_, 0);
+
+      TP_Request* request = victim.queue_.get();
+
+      if (request != 0)
+        {
+          own.current_ = request;
+          return request;
+        }
+    }
+
+  return 0;
+}
+
+
+bool
+TAO::CSD::TP_Task::stop_worker_i()
+{
+  if (this->shutdown_initiated_)
+    {
+      return true;
+    }
+
+  if (this->deferred_shutdown_initiated_)
+    {
+      this->deferred_shutdown_initiated_ = false;
+      this->stop_requested_ = 0;
+      return true;
+    }
+
+  return false;
+}
+
+
+void
+TAO::CSD::TP_Task::work_stealing(bool enable)
+{
+  ACE_GUARD (TAO_SYNCH_MUTEX, guard, this->lock_);
+
+  // The implementation cannot change while worker threads are running.
+  if (!this->opened_)
+    {
+      this->work_stealing_ = enable;
+    }
+}
+
+
 int
 TAO::CSD::TP_Task::close(u_long flag)
 {
@@ -234,6 +452,7 @@ TAO::CSD::TP_Task::close(u_long flag)
 
       // Set the shutdown flag to true.
       this->shutdown_initiated_ = true;
+      this->stop_requested_ = 1;
 
       // Stop accepting requests.
       this->accepting_requests_ = false;
@@ -270,8 +489,24 @@ TAO::CSD::TP_Task::close(u_long flag)
       TP_Cancel_Visitor cancel_visitor;
       this->queue_.accept_visitor(cancel_visitor);
 
+      if (this->work_stealing_)
+        {
+          for (Thread_Counter i = 0; i < this->num_workers_; ++i)
+            {
+              Worker_Queue& worker = this->workers_[i];
+              ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, worker_guard, worker.lock_, 0);
+              worker.queue_.accept_visitor(cancel_visitor);
+            }
+        }
+
       this->opened_ = false;
       this->shutdown_initiated_ = false;
+
+      // A worker thread that initiated the shutdown has yet to stop.
+      if (!this->deferred_shutdown_initiated_)
+        {
+          this->stop_requested_ = 0;
+        }
     }
 
   return 0;
@@ -287,6 +522,23 @@ TAO::CSD::TP_Task::cancel_servant (PortableServer::Servant servant)
   // Cancel the requests targeted for the provided servant.
   TP_Cancel_Visitor cancel_visitor(servant);
   this->queue_.accept_visitor(cancel_visitor);
+
+  if (this->work_stealing_)
+    {
+      for (Thread_Counter i = 0; i < this->num_workers_; ++i)
+        {
+          Worker_Queue& worker = this->workers_[i];
+          ACE_GUARD (TAO_SYNCH_MUTEX, worker_guard, worker.lock_);
+          worker.queue_.accept_visitor(cancel_visitor);
+
+          // The requests queued behind one being dispatched are only
+          // found through the servant.
+          if (worker.current_ != 0 && worker.current_->is_target(servant))
+            {
+              worker.current_->cancel_queued_servant_requests(false);
+            }
+        }
+    }
 }
 
 TAO_END_VERSIONED_NAMESPACE_DECL
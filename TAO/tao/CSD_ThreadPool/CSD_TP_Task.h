@@ -25,6 +25,7 @@
 
 #include "ace/Task.h"
 #include "ace/Synch.h"
+#include "ace/Atomic_Op.h"
 #include "ace/Containers_T.h"
 #include "ace/Vector_T.h"
 
@@ -61,6 +62,19 @@ namespace TAO
      * worker thread will invoke this task's close() method (with the
      * flag argument equal to 0).
      *
+     * By default, all requests are kept in one queue, which the worker
+     * threads search for a request whose servant is not busy.  With
+     * work stealing enabled, only one request per servant is "scheduled"
+     * at a time; the others wait in the servant's own queue (see
+     * TP_Servant_State).  Each worker thread has a queue of scheduled
+     * requests, fed round-robin by add_request(), and takes requests
+     * from the queues of the other workers when its own is empty.  When
+     * a worker has dispatched a request, it puts the next request to the
+     * same servant at the end of its own queue.  Finding a dispatchable
+     * request then takes constant time, no matter how many requests wait
+     * for busy servants, and the worker threads only use the task's lock
+     * when they run out of work.
+     *
      * @note I just wanted to document an idea...  When the pool consists
      *       of only one worker thread, we could care less about checking
      *       if target servant objects are busy or not.  The simple fact
@@ -102,8 +116,45 @@ namespace TAO
       /// Cancel all requests that are targeted for the provided servant.
       void cancel_servant (PortableServer::Servant servant);
 
+      /// Turn on/off work stealing (see above).  This only has an effect
+      /// when called before open().
+      void work_stealing(bool enable);
+
     private:
 
+      /**
+       * @class Worker_Queue
+       *
+       * @brief The queue of scheduled requests of one worker thread,
+       *        when work stealing is enabled.
+       */
+      class Worker_Queue
+      {
+      public:
+        Worker_Queue();
+
+        /// Lock protecting the queue_ and current_.
+        TAO_SYNCH_MUTEX lock_;
+
+        /// The scheduled requests.
+        TP_Queue queue_;
+
+        /// The request being dispatched by the worker thread, if any.
+        TP_Request* current_;
+      };
+
+      /// The "mainline" of a worker thread when work stealing is enabled.
+      int work_stealing_svc(Thread_Counter index);
+
+      /// Take a request from the queue of the worker at index, or steal
+      /// one from another worker.  The caller owns the returned request.
+      /// Returns a NULL pointer if all of the worker queues are empty.
+      TP_Request* get_work(Thread_Counter index);
+
+      /// Returns true if the calling worker thread is to stop.  Assumes
+      /// that the lock_ is held.
+      bool stop_worker_i();
+
       typedef TAO_SYNCH_MUTEX         LockType;
       typedef TAO_Condition<LockType> ConditionType;
 
@@ -148,6 +199,29 @@ namespace TAO
       /// The list of ids for the threads launched by this task.
       Thread_Ids activated_threads_;
 
+      /// Flag used to select the work stealing implementation.
+      bool work_stealing_;
+
+      /// The worker queues, when work stealing is enabled.
+      Worker_Queue* workers_;
+
+      /// The number of worker queues.
+      Thread_Counter num_workers_;
+
+      /// The worker queue of the next worker thread to start.
+      Thread_Counter next_worker_;
+
+      /// The worker queue add_request() puts the next request into.
+      Thread_Counter next_queue_;
+
+      /// The number of worker threads waiting for work_available_, when
+      /// work stealing is enabled.
+      Thread_Counter idle_workers_;
+
+      /// Set while a shutdown is initiated, so that work stealing worker
+      /// threads do not need the lock_ to find out.
+      ACE_Atomic_Op<TAO_SYNCH_MUTEX, unsigned long> stop_requested_;
+
       enum { MAX_THREADPOOL_TASK_WORKER_THREADS = 50 };
     };
 
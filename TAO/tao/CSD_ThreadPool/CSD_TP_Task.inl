@@ -10,7 +10,21 @@ TAO::CSD::TP_Task::TP_Task()
     deferred_shutdown_initiated_(false),
     opened_(false),
     num_threads_(0),
-    activated_threads_ ((size_t)MAX_THREADPOOL_TASK_WORKER_THREADS)
+    activated_threads_ ((size_t)MAX_THREADPOOL_TASK_WORKER_THREADS),
+    work_stealing_(false),
+    workers_(0),
+    num_workers_(0),
+    next_worker_(0),
+    next_queue_(0),
+    idle_workers_(0),
+    stop_requested_(0)
+{
+}
+
+
+ACE_INLINE
+TAO::CSD::TP_Task::Worker_Queue::Worker_Queue()
+  : current_(0)
 {
 }
 
@@ -14,6 +14,7 @@ namespace TAO
     : transport_ (transport)
     , recycle_state_ (ENTRY_UNKNOWN)
     , is_connected_ (false)
+    , idle_lookups_ (0)
   {
     this->is_connected_ = transport->is_connected();
     transport->add_reference ();
@@ -40,6 +41,7 @@ namespace TAO
       {
         this->recycle_state_ = rhs.recycle_state_;
         this->is_connected_ = rhs.is_connected_;
+        this->idle_lookups_ = rhs.idle_lookups_;
         transport_type *old_transport = this->transport_;
         this->transport_ = rhs.transport_;
         if (this->transport_)
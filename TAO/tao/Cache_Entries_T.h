@@ -114,6 +114,13 @@ namespace TAO
     /// Set the connected flag
     void is_connected (bool connected);
 
+    /// Get the number of consecutive lookups that passed over this
+    /// idle entry for another connection to the same endpoint.
+    unsigned long idle_lookups (void) const;
+
+    /// Set the number of idle lookups.
+    void idle_lookups (unsigned long count);
+
     static const char *state_name (Cache_Entries_State st);
 
   private:
@@ -126,6 +133,9 @@ namespace TAO
     /// This is an analog for the transport::is_connected(), which is
     /// guarded by a mutex.
     bool is_connected_;
+
+    /// Used to shrink a pool of connections to the same endpoint.
+    unsigned long idle_lookups_;
   };
 
 
@@ -10,7 +10,8 @@ namespace TAO
   Cache_IntId_T<TRANSPORT_TYPE>::Cache_IntId_T (void)
     : transport_ (0),
       recycle_state_ (ENTRY_UNKNOWN),
-      is_connected_ (false)
+      is_connected_ (false),
+      idle_lookups_ (0)
   {
   }
 
@@ -18,7 +19,8 @@ namespace TAO
   Cache_IntId_T<TRANSPORT_TYPE>::Cache_IntId_T (const Cache_IntId_T &rhs)
     : transport_ (0),
       recycle_state_ (ENTRY_UNKNOWN),
-      is_connected_ (false)
+      is_connected_ (false),
+      idle_lookups_ (0)
   {
     *this = rhs;
   }
@@ -63,6 +65,20 @@ namespace TAO
     this->is_connected_ = connected;
   }
 
+  template <typename TRANSPORT_TYPE> ACE_INLINE
+  unsigned long
+  Cache_IntId_T<TRANSPORT_TYPE>::idle_lookups (void) const
+  {
+    return this->idle_lookups_;
+  }
+
+  template <typename TRANSPORT_TYPE> ACE_INLINE
+  void
+  Cache_IntId_T<TRANSPORT_TYPE>::idle_lookups (unsigned long count)
+  {
+    this->idle_lookups_ = count;
+  }
+
   template <typename TRANSPORT_TYPE> ACE_INLINE Cache_Entries_State
   Cache_IntId_T<TRANSPORT_TYPE>::recycle_state (void) const
   {
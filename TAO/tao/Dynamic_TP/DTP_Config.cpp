@@ -168,6 +168,30 @@ TAO_DTP_Config::init (int argc, ACE_TCHAR* argv[])
             }
              entry.queue_depth_ = val;
         }
+      else if ((r = this->parse_long (curarg,
+                                      argc,
+                                      argv,
+                                      ACE_TEXT("-DTPLatency"),
+                                      val )) != 0)
+        {
+          if (r < 0)
+            {
+              return -1;
+            }
+          entry.target_latency_.msec (val);
+        }
+      else if ((r = this->parse_long (curarg,
+                                      argc,
+                                      argv,
+                                      ACE_TEXT("-DTPInterval"),
+                                      val )) != 0)
+        {
+          if (r < 0)
+            {
+              return -1;
+            }
+          entry.latency_interval_.msec (val);
+        }
       else
         {
           if (TAO_debug_level > 0)
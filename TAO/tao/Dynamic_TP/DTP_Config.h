@@ -38,6 +38,8 @@ struct TAO_Dynamic_TP_Export TAO_DTP_Definition
   size_t stack_size_;
   ACE_Time_Value timeout_;   // default to 60 seconds
   int queue_depth_;
+  ACE_Time_Value target_latency_;   // default of 0 grows when all threads are busy
+  ACE_Time_Value latency_interval_; // default to 100 milliseconds
 
   // Create explicit constructor to eliminate issues with non-initialized struct values.
   TAO_DTP_Definition() :
@@ -46,7 +48,9 @@ struct TAO_Dynamic_TP_Export TAO_DTP_Definition
     max_threads_(-1),
     stack_size_(ACE_DEFAULT_THREAD_STACKSIZE),
     timeout_(60,0),
-    queue_depth_(0){}
+    queue_depth_(0),
+    target_latency_(0,0),
+    latency_interval_(0,100000){}
 
 };
 
@@ -92,6 +96,10 @@ public:
   /// idle timeout is in secondes, default = 60
   /// default stack size = 0, system defined default used.
   /// queue depth is in number of messages, default is infinite
+  /// target latency is in milliseconds, default = 0.  When set, threads
+  /// are added or retired to keep the time requests wait in the queue
+  /// under the target, measured over the latency interval, in
+  /// milliseconds, default = 100.  The idle timeout is not used then.
   /// Init can be called multiple times,
   virtual int init (int argc, ACE_TCHAR* []);
 
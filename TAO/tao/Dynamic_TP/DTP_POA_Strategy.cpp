@@ -6,6 +6,7 @@
 #include "tao/CSD_ThreadPool/CSD_TP_Custom_Asynch_Request.h"
 #include "tao/CSD_ThreadPool/CSD_TP_Collocated_Synch_With_Server_Request.h"
 #include "tao/ORB_Core.h"
+#include "ace/OS_NS_stdio.h"
 
 #if defined (TAO_HAS_CORBA_MESSAGING) && TAO_HAS_CORBA_MESSAGING != 0
 
@@ -69,6 +70,26 @@ TAO_DTP_POA_Strategy::poa_activated_event_i (TAO_ORB_Core& orb_core)
 
   this->dtp_task_.thr_mgr (orb_core.thr_mgr ());
 
+  // Name the task after its configuration, or after this strategy when
+  // configured by the application.
+  ACE_CString task_name ("DTP_");
+  task_name += orb_core.orbid ();
+  task_name += '_';
+  if (this->dynamic_tp_config_name_.length () != 0)
+    {
+      task_name += this->dynamic_tp_config_name_;
+    }
+  else
+    {
+      char hex_string[2 * sizeof (void *) + 1];
+      ACE_OS::sprintf (hex_string,
+                       "%8.8lX",
+                       static_cast<unsigned long> (
+                         reinterpret_cast<uintptr_t> (this)));
+      task_name += hex_string;
+    }
+  this->dtp_task_.set_name (task_name);
+
   // Activates the worker threads, and waits until all have been started.
   if (!this->config_initialized_)
     {
@@ -397,6 +418,10 @@ TAO_DTP_POA_Strategy::set_dtp_config (TAO_DTP_Definition &tp_config)
       this->dtp_task_.set_max_request_queue_depth (tp_config.queue_depth_);
     }
 
+  // target_latency_ and latency_interval_
+  this->dtp_task_.set_target_latency (tp_config.target_latency_);
+  this->dtp_task_.set_latency_interval (tp_config.latency_interval_);
+
   if (TAO_debug_level > 4)
     {
       TAOLIB_DEBUG ((LM_DEBUG,
@@ -409,13 +434,17 @@ TAO_DTP_POA_Strategy::set_dtp_config (TAO_DTP_Definition &tp_config)
         ACE_TEXT ("TAO (%P|%t) - DTP_POA_Strategy max_request_queue_depth_=")
         ACE_TEXT ("[%d]\n")
         ACE_TEXT ("TAO (%P|%t) - DTP_POA_Strategy thread_stack_size_=[%d]\n")
-        ACE_TEXT ("TAO (%P|%t) - DTP_POA_Strategy thread_idle_time_=[%d]\n"),
+        ACE_TEXT ("TAO (%P|%t) - DTP_POA_Strategy thread_idle_time_=[%d]\n")
+        ACE_TEXT ("TAO (%P|%t) - DTP_POA_Strategy target_latency_=[%d]\n")
+        ACE_TEXT ("TAO (%P|%t) - DTP_POA_Strategy latency_interval_=[%d]\n"),
         this->dtp_task_.get_init_pool_threads(),
         this->dtp_task_.get_min_pool_threads(),
         this->dtp_task_.get_max_pool_threads(),
         this->dtp_task_.get_max_request_queue_depth(),
         this->dtp_task_.get_thread_stack_size(),
-        this->dtp_task_.get_thread_idle_time()));
+        this->dtp_task_.get_thread_idle_time(),
+        this->dtp_task_.get_target_latency().msec(),
+        this->dtp_task_.get_latency_interval().msec()));
     }
 }
 
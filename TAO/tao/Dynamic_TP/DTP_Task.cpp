@@ -5,6 +5,9 @@
 #include "tao/CSD_ThreadPool/CSD_TP_Request.h"
 #include "tao/CSD_ThreadPool/CSD_TP_Dispatchable_Visitor.h"
 #include "tao/CSD_ThreadPool/CSD_TP_Cancel_Visitor.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/Numeric_Limits.h"
+#include "ace/OS_NS_time.h"
 
 #if !defined (__ACE_INLINE__)
 # include "tao/Dynamic_TP/DTP_Task.inl"
@@ -28,12 +31,36 @@ TAO_DTP_Task::TAO_DTP_Task ()
     min_pool_threads_ ((size_t)0),
     max_pool_threads_ ((size_t)0),
     max_request_queue_depth_ ((size_t)0),
-    thread_stack_size_ ((size_t)0)
+    thread_stack_size_ ((size_t)0),
+    target_latency_ (ACE_Time_Value::zero),
+    latency_interval_ (0, 100000),
+    target_ticks_ (0),
+    interval_ticks_ (0),
+    interval_start_ (0),
+    min_sojourn_ (ACE_Numeric_Limits<ACE_hrtime_t>::max ()),
+    busy_ticks_ (0),
+    dispatched_ ((size_t)0),
+    retire_count_ ((size_t)0)
 {
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+  ACE_NEW (this->threads_monitor_,
+           ACE::Monitor_Control::Size_Monitor);
+  ACE_NEW (this->sojourn_monitor_,
+           ACE::Monitor_Control::Size_Monitor);
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
 }
 
 TAO_DTP_Task::~TAO_DTP_Task()
 {
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+  if (this->name_.length () != 0)
+    {
+      this->threads_monitor_->remove_from_registry ();
+      this->sojourn_monitor_->remove_from_registry ();
+    }
+  this->threads_monitor_->remove_ref ();
+  this->sojourn_monitor_->remove_ref ();
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
 }
 
 bool
@@ -73,6 +100,10 @@ TAO_DTP_Task::add_request (TAO::CSD::TP_Request* request)
     // to perfom a "clone" operation on some underlying request data before
     // the request can be properly placed into a queue.
     request->prepare_for_queue();
+    if (this->target_ticks_ != 0)
+      {
+        request->queued_at (ACE_OS::gethrtime ());
+      }
     this->queue_.put(request);
   }
   {
@@ -87,6 +118,13 @@ TAO_DTP_Task::add_request (TAO::CSD::TP_Request* request)
       }
   }
 
+  if (this->target_ticks_ != 0)
+    {
+      // The workers may all be stuck in long requests, so the queue is
+      // watched from here as well.
+      this->add_threads (this->control (false, 0, 0));
+    }
+
   return true;
 }
 
@@ -125,6 +163,18 @@ TAO_DTP_Task::get_thread_idle_time ()
   return this->thread_idle_time_.sec();
 }
 
+const ACE_Time_Value &
+TAO_DTP_Task::get_target_latency ()
+{
+  return this->target_latency_;
+}
+
+const ACE_Time_Value &
+TAO_DTP_Task::get_latency_interval ()
+{
+  return this->latency_interval_;
+}
+
 int
 TAO_DTP_Task::open (void* /* args */)
 {
@@ -147,13 +197,17 @@ TAO_DTP_Task::open (void* /* args */)
                     ACE_TEXT ("TAO (%P|%t) - DTP_Task::open() max_pool_threads_ \t\t: [%d]\n")
                     ACE_TEXT ("TAO (%P|%t) - DTP_Task::open() max_request_queue_depth_ \t: [%d]\n")
                     ACE_TEXT ("TAO (%P|%t) - DTP_Task::open() thread_stack_size_ \t\t: [%d]\n")
-                    ACE_TEXT ("TAO (%P|%t) - DTP_Task::open() thread_idle_time_ \t\t: [%d]\n"),
+                    ACE_TEXT ("TAO (%P|%t) - DTP_Task::open() thread_idle_time_ \t\t: [%d]\n")
+                    ACE_TEXT ("TAO (%P|%t) - DTP_Task::open() target_latency_ \t\t: [%d]\n")
+                    ACE_TEXT ("TAO (%P|%t) - DTP_Task::open() latency_interval_ \t\t: [%d]\n"),
                     this->init_pool_threads_,
                     this->min_pool_threads_,
                     this->max_pool_threads_,
                     this->max_request_queue_depth_,
                     this->thread_stack_size_,
-                    this->thread_idle_time_.sec ())
+                    this->thread_idle_time_.sec (),
+                    this->target_latency_.msec (),
+                    this->latency_interval_.msec ())
                    );
     }
 
@@ -176,6 +230,28 @@ TAO_DTP_Task::open (void* /* args */)
 
   this->busy_threads_ = 0;
 
+  // Measure the waits in the units of ACE_OS::gethrtime(), for which
+  // ticks / global_scale_factor == microseconds.
+  if (this->target_latency_ != ACE_Time_Value::zero)
+    {
+      ACE_UINT64 usec = 0;
+      ACE_High_Res_Timer::global_scale_factor_type const gsf =
+        ACE_High_Res_Timer::global_scale_factor ();
+      this->target_latency_.to_usec (usec);
+      this->target_ticks_ = usec * gsf;
+      this->latency_interval_.to_usec (usec);
+      this->interval_ticks_ = usec * gsf;
+      if (this->interval_ticks_ < this->target_ticks_)
+        {
+          this->interval_ticks_ = this->target_ticks_;
+        }
+      this->interval_start_ = ACE_OS::gethrtime ();
+    }
+  else
+    {
+      this->target_ticks_ = 0;
+    }
+
   // Create the stack size arrays if the stack size is set > 0.
 
   // Activate this task object with 'num' worker threads.
@@ -226,6 +302,9 @@ TAO_DTP_Task::open (void* /* args */)
     }
 
   this->active_count_ = static_cast<size_t> (num);
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+  this->threads_monitor_->receive (this->active_count_);
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
 
   this->opened_ = true;
   this->accepting_requests_ = true;
@@ -288,6 +367,9 @@ TAO_DTP_Task::add_active (void)
 {
   ACE_GUARD (TAO_SYNCH_MUTEX, mon, this->aw_lock_);
   ++this->active_count_;
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+  this->threads_monitor_->receive (this->active_count_);
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
 }
 
 bool
@@ -297,6 +379,9 @@ TAO_DTP_Task::remove_active (bool force)
   if (force || this->above_minimum())
     {
       --this->active_count_;
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+      this->threads_monitor_->receive (this->active_count_);
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
       this->active_workers_.signal ();
       return true;
     }
@@ -306,6 +391,12 @@ TAO_DTP_Task::remove_active (bool force)
 bool
 TAO_DTP_Task::need_active (void)
 {
+  if (this->target_ticks_ != 0)
+    {
+      // Threads are added by control() instead.
+      return false;
+    }
+
   ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, mon, this->aw_lock_, false);
   return ((this->busy_threads_ == static_cast<unsigned long> (this->active_count_)) &&
           ((this->max_pool_threads_ < 1) ||
@@ -319,6 +410,195 @@ TAO_DTP_Task::above_minimum (void)
     this->active_count_ > this->min_pool_threads_;
 }
 
+bool
+TAO_DTP_Task::add_thread (void)
+{
+  if (this->activate (THR_NEW_LWP | THR_DETACHED,
+                      1,
+                      1,
+                      ACE_DEFAULT_THREAD_PRIORITY,
+                      -1,
+                      0,
+                      0,
+                      0,
+                      this->thread_stack_size_ == 0 ? 0 :
+                      &this->thread_stack_size_) != 0)
+    {
+      TAOLIB_ERROR ((LM_ERROR,
+                     ACE_TEXT ("(%P|%t) DTP_Task::svc() failed to ")
+                     ACE_TEXT ("grow thread pool.\n")));
+      return false;
+    }
+
+  this->add_active ();
+  if (TAO_debug_level > 4)
+    {
+      TAOLIB_DEBUG ((LM_DEBUG,
+                     ACE_TEXT ("TAO (%P|%t) - DTP_Task::svc() ")
+                     ACE_TEXT ("Growing threadcount. ")
+                     ACE_TEXT ("New thread count:%d\n"),
+                     this->thr_count ()));
+    }
+  return true;
+}
+
+void
+TAO_DTP_Task::add_threads (size_t count)
+{
+  for (; count != 0; --count)
+    {
+      if (!this->add_thread ())
+        {
+          break;
+        }
+    }
+}
+
+size_t
+TAO_DTP_Task::control (bool dispatched,
+                       ACE_hrtime_t sojourn,
+                       ACE_hrtime_t service)
+{
+  ACE_hrtime_t const now = ACE_OS::gethrtime ();
+
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, mon, this->aw_lock_, 0);
+  if (dispatched)
+    {
+      ++this->dispatched_;
+      this->busy_ticks_ += service;
+      if (sojourn < this->min_sojourn_)
+        {
+          this->min_sojourn_ = sojourn;
+        }
+    }
+
+  if (now < this->interval_start_ ||
+      now - this->interval_start_ < this->interval_ticks_)
+    {
+      return 0;
+    }
+
+  ACE_hrtime_t const elapsed = now - this->interval_start_;
+
+  size_t waiting = 0;
+  {
+    ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->queue_lock_, 0);
+    // The queued requests include the ones being dispatched.
+    unsigned long const busy = this->busy_threads_.value ();
+    if (this->num_queue_requests_ > busy)
+      {
+        waiting = this->num_queue_requests_ - busy;
+      }
+  }
+
+  // By Little's law, the average number of busy threads.
+  size_t const needed =
+    static_cast<size_t> ((this->busy_ticks_ + elapsed - 1) / elapsed);
+  size_t const floor =
+    this->min_pool_threads_ > 0 ? this->min_pool_threads_ : 1;
+
+  // Without a dispatch during the whole interval the requests left
+  // waiting have waited longer than the target.
+  bool const standing = this->dispatched_ == 0
+    ? waiting > 0
+    : this->min_sojourn_ > this->target_ticks_;
+
+  size_t grow = 0;
+  if (standing)
+    {
+      grow = 1;
+      if (this->dispatched_ != 0 && waiting > 0)
+        {
+          ACE_hrtime_t const mean_service =
+            this->busy_ticks_ / this->dispatched_;
+          size_t const drain =
+            static_cast<size_t> (waiting * mean_service / this->target_ticks_);
+          if (drain > grow)
+            {
+              grow = drain;
+            }
+        }
+      if (grow > this->active_count_)
+        {
+          grow = this->active_count_;
+        }
+      if (this->max_pool_threads_ > 0)
+        {
+          size_t const room = this->max_pool_threads_ > this->active_count_
+            ? this->max_pool_threads_ - this->active_count_ : 0;
+          if (grow > room)
+            {
+              grow = room;
+            }
+        }
+      this->retire_count_ = 0;
+    }
+  else if (needed + 1 < this->active_count_ &&
+           this->active_count_ > floor)
+    {
+      size_t const keep = needed + 1 > floor ? needed + 1 : floor;
+      this->retire_count_ = (this->active_count_ - keep + 1) / 2;
+    }
+
+  if (TAO_debug_level > 4)
+    {
+      TAOLIB_DEBUG ((LM_DEBUG,
+                     ACE_TEXT ("TAO (%P|%t) - DTP_Task::control() ")
+                     ACE_TEXT ("dispatched:%B waiting:%B min sojourn:%Q ")
+                     ACE_TEXT ("load:%B active:%B grow:%B retire:%B\n"),
+                     this->dispatched_,
+                     waiting,
+                     this->dispatched_ == 0 ? ACE_UINT64 (0)
+                       : ACE_UINT64 (this->min_sojourn_),
+                     needed,
+                     this->active_count_,
+                     grow,
+                     this->retire_count_));
+    }
+
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+  if (this->dispatched_ != 0)
+    {
+      this->sojourn_monitor_->receive (
+        static_cast<size_t> (this->min_sojourn_
+                             / ACE_High_Res_Timer::global_scale_factor ()));
+    }
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
+
+  this->interval_start_ = now;
+  this->min_sojourn_ = ACE_Numeric_Limits<ACE_hrtime_t>::max ();
+  this->busy_ticks_ = 0;
+  this->dispatched_ = 0;
+  return grow;
+}
+
+bool
+TAO_DTP_Task::retire (void)
+{
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, mon, this->aw_lock_, false);
+  if (this->retire_count_ == 0)
+    {
+      return false;
+    }
+
+  size_t const floor =
+    this->min_pool_threads_ > 0 ? this->min_pool_threads_ : 1;
+  if (this->active_count_ <= floor)
+    {
+      this->retire_count_ = 0;
+      return false;
+    }
+
+  --this->retire_count_;
+
+  --this->active_count_;
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+  this->threads_monitor_->receive (this->active_count_);
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
+  this->active_workers_.signal ();
+  return true;
+}
+
 int
 TAO_DTP_Task::svc (void)
 {
@@ -349,14 +629,20 @@ TAO_DTP_Task::svc (void)
                               this->busy_threads_.value()));
                 }
 
-              ACE_Time_Value tmp_sec = this->thread_idle_time_.to_absolute_time();
+              // When sized from the queue latency, idle threads wake up
+              // every interval so the controller runs without traffic.
+              bool const latency = this->target_ticks_ != 0;
+              ACE_Time_Value tmp_sec = latency
+                ? this->latency_interval_.to_absolute_time ()
+                : this->thread_idle_time_.to_absolute_time();
+              bool interval_passed = false;
 
               {
                 ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->work_lock_, false);
                 int wait_state = 0;
                 while (!(this->shutdown_ || this->check_queue_) && wait_state != -1)
                   {
-                    wait_state = this->thread_idle_time_.sec () == 0
+                    wait_state = (this->thread_idle_time_.sec () == 0 && !latency)
                       ? this->work_available_.wait ()
                       : this->work_available_.wait (&tmp_sec);
                   }
@@ -365,7 +651,11 @@ TAO_DTP_Task::svc (void)
                   return 0;
                 if (wait_state == -1)
                   {
-                    if (errno != ETIME || this->remove_active (false))
+                    if (latency && errno == ETIME)
+                      {
+                        interval_passed = true;
+                      }
+                    else if (errno != ETIME || this->remove_active (false))
                       {
                         if (TAO_debug_level > 4)
                           {
@@ -379,6 +669,21 @@ TAO_DTP_Task::svc (void)
                 this->check_queue_ = false;
               }
 
+              if (interval_passed)
+                {
+                  this->add_threads (this->control (false, 0, 0));
+                  if (this->retire ())
+                    {
+                      if (TAO_debug_level > 4)
+                        {
+                          TAOLIB_DEBUG ((LM_DEBUG,
+                                      ACE_TEXT ("TAO (%P|%t) - DTP_Task::svc() ")
+                                      ACE_TEXT ("Existing thread expiring.\n")));
+                        }
+                      return 0;
+                    }
+                }
+
               this->add_busy ();
               if (TAO_debug_level > 4)
                 {
@@ -393,38 +698,38 @@ TAO_DTP_Task::svc (void)
 
       if (this->need_active ())
         {
-          if (this->activate (THR_NEW_LWP | THR_DETACHED,
-                              1,
-                              1,
-                              ACE_DEFAULT_THREAD_PRIORITY,
-                              -1,
-                              0,
-                              0,
-                              0,
-                              this->thread_stack_size_ == 0 ? 0 :
-                              &this->thread_stack_size_) != 0)
-            {
-              TAOLIB_ERROR ((LM_ERROR,
-                             ACE_TEXT ("(%P|%t) DTP_Task::svc() failed to ")
-                             ACE_TEXT ("grow thread pool.\n")));
-            }
-          else
-            {
-              this->add_active ();
-              if (TAO_debug_level > 4)
-                {
-                  TAOLIB_DEBUG ((LM_DEBUG,
-                                 ACE_TEXT ("TAO (%P|%t) - DTP_Task::svc() ")
-                                 ACE_TEXT ("Growing threadcount. ")
-                                 ACE_TEXT ("New thread count:%d\n"),
-                                 this->thr_count ()));
-                }
-            }
+          this->add_thread ();
         }
 
+      ACE_hrtime_t const start =
+        this->target_ticks_ != 0 ? ACE_OS::gethrtime () : 0;
+
       request->dispatch ();
       this->clear_request (request);
       dispatchable_visitor.reset ();
+
+      if (this->target_ticks_ == 0)
+        {
+          continue;
+        }
+
+      ACE_hrtime_t const sojourn = start > request->queued_at ()
+        ? start - request->queued_at () : 0;
+      this->add_threads (this->control (true,
+                                        sojourn,
+                                        ACE_OS::gethrtime () - start));
+
+      if (this->retire ())
+        {
+          this->remove_busy ();
+          if (TAO_debug_level > 4)
+            {
+              TAOLIB_DEBUG ((LM_DEBUG,
+                          ACE_TEXT ("TAO (%P|%t) - DTP_Task::svc() ")
+                          ACE_TEXT ("Existing thread expiring.\n")));
+            }
+          return 0;
+        }
     }
   this->remove_active (true);
   return 0;
@@ -516,6 +821,42 @@ TAO_DTP_Task::set_max_request_queue_depth (size_t queue_depth)
   this->max_request_queue_depth_ = queue_depth;
 }
 
+void
+TAO_DTP_Task::set_target_latency (ACE_Time_Value target)
+{
+  this->target_latency_ = target;
+}
+
+void
+TAO_DTP_Task::set_latency_interval (ACE_Time_Value interval)
+{
+  this->latency_interval_ = interval;
+}
+
+void
+TAO_DTP_Task::set_name (const ACE_CString &name)
+{
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+  if (this->name_.length () != 0)
+    {
+      this->threads_monitor_->remove_from_registry ();
+      this->sojourn_monitor_->remove_from_registry ();
+    }
+
+  ACE_CString threads_name (name);
+  threads_name += "_Threads";
+  this->threads_monitor_->name (threads_name.c_str ());
+  this->threads_monitor_->add_to_registry ();
+
+  ACE_CString sojourn_name (name);
+  sojourn_name += "_Sojourn";
+  this->sojourn_monitor_->name (sojourn_name.c_str ());
+  this->sojourn_monitor_->add_to_registry ();
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
+
+  this->name_ = name;
+}
+
 void
 TAO_DTP_Task::cancel_servant (PortableServer::Servant servant)
 {
@@ -32,6 +32,10 @@
 #include "ace/Containers_T.h"
 #include "ace/Vector_T.h"
 
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+#include "ace/Monitor_Size.h"
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
+
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
     /**
@@ -57,6 +61,19 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
      * invoke this task's svc() method, and when the svc() returns, the
      * worker thread will invoke this task's close() method (with the
      * flag argument equal to 0).
+     *
+     * By default a thread is added whenever all the threads are busy, and
+     * a thread idle for the thread idle time goes away.  When a target
+     * latency is set, the threads are instead sized from the time the
+     * requests wait in the queue.  Every latency interval the task looks
+     * at the shortest wait of the interval: if even that one exceeded the
+     * target there is a standing queue, and the task adds the threads
+     * needed to drain the waiting requests within the target, from their
+     * mean service time, at most doubling the pool.  Otherwise, when the
+     * busy time of the interval (the average number of busy threads, by
+     * Little's law) leaves more than one thread idle, half of the surplus
+     * is retired.  With TAO_HAS_MONITOR_POINTS the thread count and the
+     * shortest wait of each interval are exported as monitor points.
      */
     class TAO_Dynamic_TP_Export TAO_DTP_Task : public ACE_Task_Base
     {
@@ -99,6 +116,13 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
       void set_max_request_queue_depth(size_t queue_depth);
 
+      void set_target_latency(ACE_Time_Value target);
+
+      void set_latency_interval(ACE_Time_Value interval);
+
+      /// Set the name of the task, used for its monitor points.
+      void set_name(const ACE_CString &name);
+
       /// Get the thread and queue config.
 
       size_t get_init_pool_threads();
@@ -113,6 +137,10 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
       time_t get_thread_idle_time();
 
+      const ACE_Time_Value &get_target_latency();
+
+      const ACE_Time_Value &get_latency_interval();
+
       /// Cancel all requests that are targeted for the provided servant.
       void cancel_servant (PortableServer::Servant servant);
 
@@ -131,6 +159,24 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
       bool need_active (void);
       bool above_minimum (void);
 
+      /// Start one more worker thread.
+      bool add_thread (void);
+
+      /// Start @a count more worker threads.
+      void add_threads (size_t count);
+
+      /// Account for a request that waited @a sojourn and was serviced
+      /// in @a service, if @a dispatched, and once per latency interval
+      /// decide how many threads to add or retire.  Returns the number
+      /// of threads the caller has to add.
+      size_t control (bool dispatched,
+                      ACE_hrtime_t sojourn,
+                      ACE_hrtime_t service);
+
+      /// Returns true if the calling thread has to go away, as decided
+      /// by control().
+      bool retire (void);
+
       typedef TAO_SYNCH_MUTEX         LockType;
       typedef TAO_Condition<LockType> ConditionType;
 
@@ -201,6 +247,38 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
       /// This is the maximum amount of time in seconds that an idle thread can
       /// stay alive before being taken out of the pool.
       ACE_Time_Value thread_idle_time_;
+
+      /// The longest time requests should wait in the queue, zero unless
+      /// the threads are sized from it.
+      ACE_Time_Value target_latency_;
+
+      /// The period over which the waits are measured.
+      ACE_Time_Value latency_interval_;
+
+      /// The above in ACE_OS::gethrtime() units, set by open().
+      ACE_hrtime_t target_ticks_;
+      ACE_hrtime_t interval_ticks_;
+
+      /// Measures of the current latency interval, guarded by aw_lock_.
+      ACE_hrtime_t interval_start_;
+      ACE_hrtime_t min_sojourn_;
+      ACE_hrtime_t busy_ticks_;
+      size_t dispatched_;
+
+      /// The number of threads control() asked to go away.
+      size_t retire_count_;
+
+      /// Name of the task.
+      ACE_CString name_;
+
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+      /// The number of active threads.
+      ACE::Monitor_Control::Size_Monitor *threads_monitor_;
+
+      /// The shortest queue wait of each latency interval, in
+      /// microseconds.
+      ACE::Monitor_Control::Size_Monitor *sojourn_monitor_;
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
     };
 
 
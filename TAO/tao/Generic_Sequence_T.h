@@ -58,6 +58,7 @@
 #include "ace/checked_iterator.h"
 
 #include <algorithm>
+#include <utility>
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -167,6 +168,31 @@ public:
     return * this;
   }
 
+#if defined (ACE_HAS_CPP11)
+  /// Move constructor, takes the buffer of @a rhs and leaves it
+  /// without one.  A buffer not owned by @a rhs is not owned by this
+  /// sequence either.
+  generic_sequence(generic_sequence && rhs) noexcept
+    : maximum_(rhs.maximum_)
+    , length_(rhs.length_)
+    , buffer_(rhs.buffer_)
+    , release_(rhs.release_)
+  {
+    rhs.maximum_ = allocation_traits::default_maximum();
+    rhs.length_ = 0;
+    rhs.buffer_ = 0;
+    rhs.release_ = false;
+  }
+
+  /// Move assignment operator
+  generic_sequence & operator=(generic_sequence && rhs) noexcept
+  {
+    generic_sequence tmp(std::move(rhs));
+    swap(tmp);
+    return * this;
+  }
+#endif /* ACE_HAS_CPP11 */
+
   /// Destructor.
   ~generic_sequence()
   {
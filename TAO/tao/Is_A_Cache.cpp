@@ -0,0 +1,97 @@
+#include "tao/Is_A_Cache.h"
+#include "tao/debug.h"
+
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+TAO::Is_A_Cache_Key::Is_A_Cache_Key (void)
+{
+}
+
+TAO::Is_A_Cache_Key::Is_A_Cache_Key (const char *type_id,
+                                     const char *base_id)
+  : type_id_ (type_id)
+  , base_id_ (base_id)
+{
+}
+
+u_long
+TAO::Is_A_Cache_Key::hash (void) const
+{
+  return this->type_id_.hash () * 31 + this->base_id_.hash ();
+}
+
+bool
+TAO::Is_A_Cache_Key::operator== (const Is_A_Cache_Key &rhs) const
+{
+  return this->type_id_ == rhs.type_id_ && this->base_id_ == rhs.base_id_;
+}
+
+/********************************************************/
+TAO::Is_A_Cache::Is_A_Cache (void)
+  : table_ ()
+  , maximum_ (0)
+{
+}
+
+TAO::Is_A_Cache::~Is_A_Cache (void)
+{
+}
+
+void
+TAO::Is_A_Cache::maximum (size_t maximum)
+{
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+  this->maximum_ = maximum;
+}
+
+bool
+TAO::Is_A_Cache::enabled (void) const
+{
+  return this->maximum_ != 0;
+}
+
+bool
+TAO::Is_A_Cache::find (const char *type_id, const char *base_id)
+{
+  Is_A_Cache_Key const key (type_id, base_id);
+
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->lock_, false);
+
+  return this->table_.find (key) == 0;
+}
+
+void
+TAO::Is_A_Cache::bind (const char *type_id, const char *base_id)
+{
+  Is_A_Cache_Key const key (type_id, base_id);
+
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+  if (this->maximum_ == 0)
+    return;
+
+  if (this->table_.current_size () >= this->maximum_)
+    {
+      if (TAO_debug_level > 6)
+        TAOLIB_DEBUG ((LM_DEBUG,
+                       ACE_TEXT ("TAO (%P|%t) - Is_A_Cache::bind, ")
+                       ACE_TEXT ("emptying the table of %B answers\n"),
+                       this->table_.current_size ()));
+
+      this->table_.unbind_all ();
+    }
+
+  this->table_.rebind (key, true);
+}
+
+void
+TAO::Is_A_Cache::clear (void)
+{
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+  this->table_.unbind_all ();
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,122 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file Is_A_Cache.h
+ *
+ *  Cache of the answers to _is_a() for the types named in IORs.
+ */
+//=============================================================================
+
+#ifndef TAO_IS_A_CACHE_H
+#define TAO_IS_A_CACHE_H
+
+#include /**/ "ace/pre.h"
+#include "tao/orbconf.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/Hash_Map_Manager_T.h"
+#include "ace/Null_Mutex.h"
+#include "ace/SString.h"
+
+#include "tao/TAO_Export.h"
+#include /**/ "tao/Versioned_Namespace.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  /**
+   * @class Is_A_Cache_Key
+   *
+   * @brief The type id of an IOR and the repository id it was
+   * checked against.
+   */
+  class TAO_Export Is_A_Cache_Key
+  {
+  public:
+    Is_A_Cache_Key (void);
+
+    Is_A_Cache_Key (const char *type_id, const char *base_id);
+
+    u_long hash (void) const;
+
+    bool operator== (const Is_A_Cache_Key &rhs) const;
+
+    ACE_CString type_id_;
+    ACE_CString base_id_;
+  };
+
+  /**
+   * @class Is_A_Cache
+   *
+   * @brief Table of the repository ids the objects of the types found
+   * in IORs are known to support.
+   *
+   * Narrowing an object reference held as a base interface, as
+   * returned by the Naming Service, asks the object whether it
+   * supports the target interface unless the type id in its IOR is
+   * the target's.  When the stubs of the type named in the IOR are
+   * linked in (see TAO::Base_Interface_Table) and the target is among
+   * its base interfaces, the object supports it whatever its most
+   * derived type, the ORB remembers that for the type id.
+   *
+   * Only positive answers are kept.  The IOR may name a base of the
+   * actual type of the object, as with POA::create_reference(), so
+   * that an object does not support an interface says nothing about
+   * other objects with the same type id.
+   *
+   * The table keeps at most maximum() answers, it is emptied when it
+   * outgrows them.  With a maximum of 0 the cache is disabled.
+   */
+  class TAO_Export Is_A_Cache
+  {
+  public:
+    Is_A_Cache (void);
+
+    ~Is_A_Cache (void);
+
+    /// Set the number of answers kept, 0 disables the cache.
+    void maximum (size_t maximum);
+
+    /// True unless the cache is disabled.
+    bool enabled (void) const;
+
+    /// True if objects of type @a type_id are known to support
+    /// @a base_id.
+    bool find (const char *type_id, const char *base_id);
+
+    /// Remember that objects of type @a type_id support @a base_id.
+    void bind (const char *type_id, const char *base_id);
+
+    /// Forget all answers.
+    void clear (void);
+
+  private:
+    ACE_UNIMPLEMENTED_FUNC (Is_A_Cache (const Is_A_Cache &))
+    ACE_UNIMPLEMENTED_FUNC (Is_A_Cache &operator= (const Is_A_Cache &))
+
+    /// The values are not used, the keys are the answers.
+    typedef ACE_Hash_Map_Manager_Ex<Is_A_Cache_Key,
+                                    bool,
+                                    ACE_Hash<Is_A_Cache_Key>,
+                                    ACE_Equal_To<Is_A_Cache_Key>,
+                                    ACE_Null_Mutex> TABLE;
+
+    /// Lock for the table.
+    TAO_SYNCH_MUTEX lock_;
+
+    TABLE table_;
+
+    size_t maximum_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_IS_A_CACHE_H */
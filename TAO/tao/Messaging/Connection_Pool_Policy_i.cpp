@@ -0,0 +1,146 @@
+// -*- C++ -*-
+#include "tao/Messaging/Connection_Pool_Policy_i.h"
+#include "tao/ORB_Core.h"
+#include "tao/Stub.h"
+#include "tao/debug.h"
+#include "tao/SystemException.h"
+#include "tao/AnyTypeCode/Any.h"
+
+#if (TAO_HAS_CONNECTION_POOL_POLICY == 1)
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+TAO_ConnectionPoolPolicy::TAO_ConnectionPoolPolicy (
+  CORBA::ULong maximum_connections)
+  : ::CORBA::Object ()
+  , ::CORBA::Policy ()
+  , TAO::ConnectionPoolPolicy ()
+  , ::CORBA::LocalObject ()
+  , maximum_connections_ (maximum_connections)
+{
+}
+
+TAO_ConnectionPoolPolicy::TAO_ConnectionPoolPolicy (
+  const TAO_ConnectionPoolPolicy &rhs)
+  : ::CORBA::Object ()
+  , ::CORBA::Policy ()
+  , TAO::ConnectionPoolPolicy ()
+  , ::CORBA::LocalObject ()
+  , maximum_connections_ (rhs.maximum_connections_)
+{
+}
+
+CORBA::ULong
+TAO_ConnectionPoolPolicy::maximum_connections (void)
+{
+  return this->maximum_connections_;
+}
+
+CORBA::PolicyType
+TAO_ConnectionPoolPolicy::policy_type (void)
+{
+  return TAO::CONNECTION_POOL_POLICY_TYPE;
+}
+
+void
+TAO_ConnectionPoolPolicy::hook (TAO_ORB_Core *orb_core,
+                                TAO_Stub *stub,
+                                bool &has_pool,
+                                CORBA::ULong &pool_maximum)
+{
+  try
+    {
+      CORBA::Policy_var policy = CORBA::Policy::_nil ();
+
+      if (stub == 0)
+        {
+          policy =
+            orb_core->get_cached_policy_including_current (
+              TAO_CACHED_POLICY_CONNECTION_POOL);
+        }
+      else
+        {
+          policy =
+            stub->get_cached_policy (TAO_CACHED_POLICY_CONNECTION_POOL);
+        }
+
+      if (CORBA::is_nil (policy.in ()))
+        {
+          has_pool = false;
+          return;
+        }
+
+      TAO::ConnectionPoolPolicy_var p =
+        TAO::ConnectionPoolPolicy::_narrow (policy.in ());
+
+      pool_maximum = p->maximum_connections ();
+
+      // Set the flag once all operations complete successfully
+      has_pool = true;
+
+      if (TAO_debug_level > 6)
+        {
+          TAOLIB_DEBUG ((LM_DEBUG,
+                      ACE_TEXT ("TAO (%P|%t) - Connection pool maximum ")
+                      ACE_TEXT ("is %u\n"),
+                      pool_maximum));
+        }
+    }
+  catch (const ::CORBA::Exception&)
+    {
+      // Ignore all exceptions...
+    }
+}
+
+CORBA::Policy_ptr
+TAO_ConnectionPoolPolicy::create (const CORBA::Any& val)
+{
+  CORBA::ULong value;
+  if ((val >>= value) == 0)
+    throw ::CORBA::PolicyError (CORBA::BAD_POLICY_VALUE);
+
+  TAO_ConnectionPoolPolicy *tmp = 0;
+  ACE_NEW_THROW_EX (tmp,
+                    TAO_ConnectionPoolPolicy (value),
+                    CORBA::NO_MEMORY (TAO::VMCID,
+                                      CORBA::COMPLETED_NO));
+
+  return tmp;
+}
+
+TAO_ConnectionPoolPolicy *
+TAO_ConnectionPoolPolicy::clone (void) const
+{
+  TAO_ConnectionPoolPolicy *copy = 0;
+  ACE_NEW_RETURN (copy,
+                  TAO_ConnectionPoolPolicy (*this),
+                  0);
+  return copy;
+}
+
+CORBA::Policy_ptr
+TAO_ConnectionPoolPolicy::copy (void)
+{
+  TAO_ConnectionPoolPolicy* tmp = 0;
+  ACE_NEW_THROW_EX (tmp,
+                    TAO_ConnectionPoolPolicy (*this),
+                    CORBA::NO_MEMORY (TAO::VMCID,
+                                      CORBA::COMPLETED_NO));
+
+  return tmp;
+}
+
+void
+TAO_ConnectionPoolPolicy::destroy (void)
+{
+}
+
+TAO_Cached_Policy_Type
+TAO_ConnectionPoolPolicy::_tao_cached_type (void) const
+{
+  return TAO_CACHED_POLICY_CONNECTION_POOL;
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* TAO_HAS_CONNECTION_POOL_POLICY == 1 */
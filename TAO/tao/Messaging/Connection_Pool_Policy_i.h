@@ -0,0 +1,96 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file   Connection_Pool_Policy_i.h
+ */
+//=============================================================================
+
+#ifndef TAO_CONNECTION_POOL_POLICY_I_H
+#define TAO_CONNECTION_POOL_POLICY_I_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/orbconf.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/Messaging/TAO_ExtC.h"
+#include "tao/LocalObject.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4250)
+#endif /* _MSC_VER */
+
+
+#if (TAO_HAS_CONNECTION_POOL_POLICY == 1)
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/*
+ * @class TAO_ConnectionPoolPolicy
+ *
+ * @brief TAO::ConnectionPoolPolicy implementation
+ *
+ *  This policy sets the number of muxed connections to an endpoint
+ *  that the client balances its requests over, overriding the
+ *  -ORBConnectionPoolMax option.  A value of 0 disables pooling.
+ *  This policy is proprietary to TAO.
+ */
+class TAO_ConnectionPoolPolicy
+  : public TAO::ConnectionPoolPolicy,
+    public ::CORBA::LocalObject
+{
+
+public:
+  /// Constructor.
+  TAO_ConnectionPoolPolicy (CORBA::ULong maximum_connections);
+
+  /// Copy constructor.
+  TAO_ConnectionPoolPolicy (const TAO_ConnectionPoolPolicy &rhs);
+
+  /// Implement the connection pool hook, this is set in the ORB_Core
+  /// at initialization time.
+  static void hook (TAO_ORB_Core *orb_core,
+                    TAO_Stub *stub,
+                    bool &has_pool,
+                    CORBA::ULong &pool_maximum);
+
+  /// Helper method for the implementation of
+  /// CORBA::ORB::create_policy.
+  static CORBA::Policy_ptr create (const CORBA::Any& val);
+
+  /// Returns a copy of <this>.
+  virtual TAO_ConnectionPoolPolicy *clone (void) const;
+
+  // = The TAO::ConnectionPoolPolicy methods
+  virtual CORBA::ULong maximum_connections (void);
+
+  virtual CORBA::PolicyType policy_type (void);
+
+  virtual CORBA::Policy_ptr copy (void);
+
+  virtual void destroy (void);
+
+  /// Return the cached policy type for this policy.
+  virtual TAO_Cached_Policy_Type _tao_cached_type (void) const;
+
+private:
+  /// The attribute
+  CORBA::ULong maximum_connections_;
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* TAO_HAS_CONNECTION_POOL_POLICY == 1 */
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif /* _MSC_VER */
+
+#include /**/ "ace/post.h"
+
+#endif  /* TAO_CONNECTION_POOL_POLICY_I_H */
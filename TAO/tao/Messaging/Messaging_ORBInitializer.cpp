@@ -2,6 +2,7 @@
 #include "tao/Messaging/Messaging_ORBInitializer.h"
 #include "tao/Messaging/Messaging_Policy_i.h"
 #include "tao/Messaging/Connection_Timeout_Policy_i.h"
+#include "tao/Messaging/Connection_Pool_Policy_i.h"
 #include "tao/Messaging/Messaging_PolicyFactory.h"
 #include "tao/Messaging/ExceptionHolder_i.h"
 #include "tao/Messaging/Messaging_Queueing_Strategies.h"
@@ -58,6 +59,10 @@ TAO_Messaging_ORBInitializer::pre_init (PortableInterceptor::ORBInitInfo_ptr inf
   TAO_ORB_Core::connection_timeout_hook (TAO_ConnectionTimeoutPolicy::hook);
 #endif  /* TAO_HAS_CONNECTION_TIMEOUT_POLICY == 1 */
 
+#if (TAO_HAS_CONNECTION_POOL_POLICY == 1)
+  tao_info->orb_core ()->set_connection_pool_hook (TAO_ConnectionPoolPolicy::hook);
+#endif  /* TAO_HAS_CONNECTION_POOL_POLICY == 1 */
+
 }
 
 void
@@ -163,8 +168,11 @@ TAO_Messaging_ORBInitializer::register_policy_factories (
 #endif  /* TAO_HAS_MAX_HOPS_POLICY == 1 */
     Messaging::QUEUE_ORDER_POLICY_TYPE,
 #if (TAO_HAS_CONNECTION_TIMEOUT_POLICY == 1)
-    TAO::CONNECTION_TIMEOUT_POLICY_TYPE
+    TAO::CONNECTION_TIMEOUT_POLICY_TYPE,
 #endif  /* TAO_HAS_CONNECTION_TIMEOUT_POLICY == 1 */
+#if (TAO_HAS_CONNECTION_POOL_POLICY == 1)
+    TAO::CONNECTION_POOL_POLICY_TYPE
+#endif  /* TAO_HAS_CONNECTION_POOL_POLICY == 1 */
   };
 
   const CORBA::PolicyType *end = type + sizeof (type) / sizeof (type[0]);
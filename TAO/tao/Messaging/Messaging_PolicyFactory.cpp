@@ -2,6 +2,7 @@
 #include "tao/Messaging/Messaging_PolicyFactory.h"
 #include "tao/Messaging/Messaging_Policy_i.h"
 #include "tao/Messaging/Connection_Timeout_Policy_i.h"
+#include "tao/Messaging/Connection_Pool_Policy_i.h"
 #include "tao/Messaging/Buffering_Constraint_Policy.h"
 
 #include "tao/PolicyC.h"
@@ -24,6 +25,11 @@ TAO_Messaging_PolicyFactory::create_policy (
     return TAO_ConnectionTimeoutPolicy::create (value);
 #endif /* TAO_HAS_RELATIVE_ROUNDTRIP_TIMEOUT_POLICY == 1 */
 
+#if (TAO_HAS_CONNECTION_POOL_POLICY == 1)
+  if (type == TAO::CONNECTION_POOL_POLICY_TYPE)
+    return TAO_ConnectionPoolPolicy::create (value);
+#endif /* TAO_HAS_CONNECTION_POOL_POLICY == 1 */
+
 #if (TAO_HAS_SYNC_SCOPE_POLICY == 1)
   if (type == Messaging::SYNC_SCOPE_POLICY_TYPE)
     return TAO_Sync_Scope_Policy::create (value);
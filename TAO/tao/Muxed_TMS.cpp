@@ -13,6 +13,7 @@ TAO_Muxed_TMS::TAO_Muxed_TMS (TAO_Transport *transport)
     , request_id_generator_ (0)
     , orb_core_ (transport->orb_core ())
     , dispatcher_table_ (this->orb_core_->client_factory ()->reply_dispatcher_table_size ())
+    , pending_requests_ (0)
 {
   this->lock_ =
     this->orb_core_->client_factory ()->create_transport_mux_strategy_lock ();
@@ -79,6 +80,7 @@ TAO_Muxed_TMS::bind_dispatcher (CORBA::ULong request_id,
     }
 
   int const result = this->dispatcher_table_.bind (request_id, rd);
+  this->pending_requests_ = this->dispatcher_table_.current_size ();
 
   if (result != 0)
     {
@@ -102,7 +104,9 @@ TAO_Muxed_TMS::unbind_dispatcher (CORBA::ULong request_id)
                     *this->lock_,
                     -1);
 
-  return this->dispatcher_table_.unbind (request_id);
+  int const result = this->dispatcher_table_.unbind (request_id);
+  this->pending_requests_ = this->dispatcher_table_.current_size ();
+  return result;
 }
 
 bool
@@ -116,6 +120,12 @@ TAO_Muxed_TMS::has_request (void)
   return this->dispatcher_table_.current_size () > 0;
 }
 
+size_t
+TAO_Muxed_TMS::pending_requests (void) const
+{
+  return this->pending_requests_.value ();
+}
+
 int
 TAO_Muxed_TMS::dispatch_reply (TAO_Pluggable_Reply_Params &params)
 {
@@ -129,6 +139,7 @@ TAO_Muxed_TMS::dispatch_reply (TAO_Pluggable_Reply_Params &params)
                       *this->lock_,
                       -1);
     result = this->dispatcher_table_.unbind (params.request_id_, rd);
+    this->pending_requests_ = this->dispatcher_table_.current_size ();
   }
 
     if (result == 0 && rd)
@@ -177,6 +188,7 @@ TAO_Muxed_TMS::reply_timed_out (CORBA::ULong request_id)
                       -1);
 
     result = this->dispatcher_table_.unbind (request_id, rd);
+    this->pending_requests_ = this->dispatcher_table_.current_size ();
   }
 
   if (result == 0 && rd)
@@ -270,6 +282,7 @@ TAO_Muxed_TMS::clear_cache_i (void)
     }
 
   this->dispatcher_table_.unbind_all ();
+  this->pending_requests_ = 0;
   size_t const sz = ubs.size ();
 
   for (size_t k = 0 ; k != sz ; ++k)
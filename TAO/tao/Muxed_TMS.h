@@ -22,6 +22,7 @@
 
 #include "ace/Hash_Map_Manager_T.h"
 #include "ace/Null_Mutex.h"
+#include "ace/Atomic_Op.h"
 
 ACE_BEGIN_VERSIONED_NAMESPACE_DECL
 template <class X> class ACE_Intrusive_Auto_Ptr;
@@ -71,6 +72,7 @@ public:
   virtual bool idle_after_reply (void);
   virtual void connection_closed (void);
   virtual bool has_request (void);
+  virtual size_t pending_requests (void) const;
 
 private:
   void operator= (const TAO_Muxed_TMS &);
@@ -98,6 +100,10 @@ private:
   /// Table of <Request ID, Reply Dispatcher> pairs.
   REQUEST_DISPATCHER_TABLE dispatcher_table_;
 
+  /// Size of the dispatcher table, updated with the table so it can
+  /// be read without taking the lock.
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, unsigned long> pending_requests_;
+
   int clear_cache_i (void);
 };
 
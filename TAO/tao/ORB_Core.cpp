@@ -209,6 +209,8 @@ TAO_ORB_Core::TAO_ORB_Core (const char *orbid,
     init_ref_map_ (TAO_DEFAULT_OBJECT_REF_TABLE_SIZE),
     object_ref_table_ (),
     object_key_table_ (),
+    stub_cache_ (),
+    is_a_cache_ (),
     orbid_ (ACE_OS::strdup (orbid ? orbid : "")),
     resource_factory_ (0),
     client_factory_ (0),
@@ -265,7 +267,8 @@ TAO_ORB_Core::TAO_ORB_Core (const char *orbid,
     config_ (gestalt),
     sync_scope_hook_ (0),
     default_sync_scope_ (Messaging::SYNC_WITH_TRANSPORT),
-    timeout_hook_ (0)
+    timeout_hook_ (0),
+    connection_pool_hook_ (0)
 {
 #if (TAO_HAS_BUFFERING_CONSTRAINT_POLICY == 1)
 
@@ -1310,6 +1313,12 @@ TAO_ORB_Core::init (int &argc, char *argv[] )
 
   trf->use_local_memory_pool (this->use_local_memory_pool_);
 
+  if (trf->stub_cache_maximum () > 0)
+    this->stub_cache_.maximum (trf->stub_cache_maximum ());
+
+  if (trf->is_a_cache_maximum () > 0)
+    this->is_a_cache_.maximum (trf->is_a_cache_maximum ());
+
   // @@ ????
   // Make sure the reactor is initialized...
   ACE_Reactor *reactor = this->reactor ();
@@ -2423,6 +2432,9 @@ TAO_ORB_Core::shutdown (CORBA::Boolean wait_for_completion)
   // reference to this ORB.
   this->object_ref_table_.destroy ();
 
+  // The cached stubs hold references to this ORB as well.
+  this->stub_cache_.destroy ();
+
   // Release implrepo_service_ if one existed. If everything went
   // fine then this must release reference from implrepo_service_
   // object to this orb core.
@@ -3204,6 +3216,21 @@ TAO_ORB_Core::call_timeout_hook (TAO_Stub *stub,
   (*timeout_hook) (this, stub, has_timeout, time_value);
 }
 
+void
+TAO_ORB_Core::call_connection_pool_hook (TAO_Stub *stub,
+                                         bool &has_pool,
+                                         CORBA::ULong &pool_maximum)
+{
+  Connection_Pool_Hook connection_pool_hook = this->connection_pool_hook_;
+
+  if (connection_pool_hook == 0)
+    {
+      has_pool = false;
+      return;
+    }
+  (*connection_pool_hook) (this, stub, has_pool, pool_maximum);
+}
+
 void
 TAO_ORB_Core::connection_timeout (TAO_Stub *stub,
                                   bool &has_timeout,
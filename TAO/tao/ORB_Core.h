@@ -29,6 +29,8 @@
 #include "tao/Cleanup_Func_Registry.h"
 #include "tao/Object_Ref_Table.h"
 #include "tao/ObjectKey_Table.h"
+#include "tao/Stub_Cache.h"
+#include "tao/Is_A_Cache.h"
 #include "tao/Messaging_SyncScopeC.h"
 #include "tao/Object.h"
 #include "tao/Invocation_Utils.h"
@@ -514,6 +516,29 @@ public:
    */
   static void connection_timeout_hook (Timeout_Hook hook);
 
+  /// Invoke the connection pool hook if present.
+  /**
+   * The connection pool hook is used to determine if the
+   * ConnectionPoolPolicy is set and with what value.  If the ORB is
+   * compiled without support for Messaging this feature does not take
+   * effect.
+   * \param has_pool returns false if there is no connection pool
+   * policy set.
+   * \param pool_maximum returns the number of connections to an
+   * endpoint in effect for the object, thread and current ORB.
+   */
+  void call_connection_pool_hook (TAO_Stub *stub,
+                                  bool &has_pool,
+                                  CORBA::ULong &pool_maximum);
+
+  /// Define the Connection_Pool_Hook signature
+  typedef void (*Connection_Pool_Hook) (TAO_ORB_Core *,
+                                        TAO_Stub *,
+                                        bool&,
+                                        CORBA::ULong&);
+
+  void set_connection_pool_hook (Connection_Pool_Hook hook);
+
   void call_sync_scope_hook (TAO_Stub *stub,
                              bool &has_synchronization,
                              Messaging::SyncScope &scope);
@@ -856,6 +881,14 @@ public:
   /// Acceessor to the table that stores the object_keys.
   TAO::ObjectKey_Table &object_key_table (void);
 
+  /// Accessor to the table of the profiles of demarshaled object
+  /// references.
+  TAO::Stub_Cache &stub_cache (void);
+
+  /// Accessor to the table of the _is_a() answers for the type ids of
+  /// object references.
+  TAO::Is_A_Cache &is_a_cache (void);
+
   /// Return the current request dispatcher strategy.
   TAO_Request_Dispatcher *request_dispatcher (void);
 
@@ -1101,6 +1134,13 @@ protected:
   /// Table that stores the object key instead of caching one per-profile.
   TAO::ObjectKey_Table object_key_table_;
 
+  /// Table of the profiles shared by object references demarshaled
+  /// from the same octets.
+  TAO::Stub_Cache stub_cache_;
+
+  /// Table of the _is_a() answers used to narrow object references.
+  TAO::Is_A_Cache is_a_cache_;
+
   /// The ORBid for this ORB.
   char *orbid_;
 
@@ -1282,6 +1322,9 @@ protected:
 
   /// The hook to be set for the RelativeRoundtripTimeoutPolicy.
   Timeout_Hook timeout_hook_;
+
+  /// The hook to be set for the ConnectionPoolPolicy.
+  Connection_Pool_Hook connection_pool_hook_;
 };
 
 // ****************************************************************
@@ -70,6 +70,18 @@ TAO_ORB_Core::object_key_table (void)
   return this->object_key_table_;
 }
 
+ACE_INLINE TAO::Stub_Cache &
+TAO_ORB_Core::stub_cache (void)
+{
+  return this->stub_cache_;
+}
+
+ACE_INLINE TAO::Is_A_Cache &
+TAO_ORB_Core::is_a_cache (void)
+{
+  return this->is_a_cache_;
+}
+
 ACE_INLINE TAO_Flushing_Strategy *
 TAO_ORB_Core::flushing_strategy (void)
 {
@@ -674,6 +686,13 @@ TAO_ORB_Core::set_timeout_hook (Timeout_Hook hook)
   this->timeout_hook_ = hook;
 }
 
+ACE_INLINE
+void
+TAO_ORB_Core::set_connection_pool_hook (Connection_Pool_Hook hook)
+{
+  this->connection_pool_hook_ = hook;
+}
+
 #if (TAO_HAS_BUFFERING_CONSTRAINT_POLICY == 1)
 
 ACE_INLINE
@@ -19,6 +19,7 @@
 #include "tao/CDR.h"
 #include "tao/SystemException.h"
 #include "tao/PolicyC.h"
+#include "tao/Base_Interface_Table.h"
 
 #include "ace/Dynamic_Service.h"
 #include "ace/OS_NS_string.h"
@@ -222,12 +223,49 @@ CORBA::Object::_is_a (const char *type_id)
       throw ::CORBA::NO_IMPLEMENT ();
     }
 
-  if (this->_stubobj ()->type_id.in () != 0
-      && ACE_OS::strcmp (type_id,
-                         this->_stubobj ()->type_id.in ()) == 0)
+  const char *ior_type_id = this->_stubobj ()->type_id.in ();
+
+  if (ior_type_id != 0
+      && ACE_OS::strcmp (type_id, ior_type_id) == 0)
     return true;
 
-  return this->proxy_broker ()->_is_a (this, type_id);
+  // Otherwise the object supports the bases of the type its IOR
+  // names, whatever its most derived type.  The IOR may name a base of
+  // that type, so other answers only hold for this object.
+  TAO::Is_A_Cache *is_a_cache = 0;
+  if (ior_type_id != 0
+      && *ior_type_id != '\0'
+      && ACE_OS::strcmp (ior_type_id, "IDL:omg.org/CORBA/Object:1.0") != 0)
+    {
+      is_a_cache = &this->_stubobj ()->orb_core ()->is_a_cache ();
+      if (!is_a_cache->enabled ())
+        is_a_cache = 0;
+    }
+
+  if (is_a_cache != 0)
+    {
+      if (is_a_cache->find (ior_type_id, type_id))
+        return true;
+
+#if (TAO_HAS_BASE_INTERFACE_TABLE == 1)
+      if (TAO::Base_Interface_Table::is_a (ior_type_id, type_id))
+        {
+          is_a_cache->bind (ior_type_id, type_id);
+          return true;
+        }
+#endif /* TAO_HAS_BASE_INTERFACE_TABLE == 1 */
+
+      int const known = this->_stubobj ()->is_a_answer (type_id);
+      if (known != -1)
+        return known == 1;
+    }
+
+  CORBA::Boolean const is_a = this->proxy_broker ()->_is_a (this, type_id);
+
+  if (is_a_cache != 0)
+    this->_stubobj ()->is_a_answer (type_id, is_a);
+
+  return is_a;
 }
 
 const char*
@@ -871,23 +909,60 @@ operator>> (TAO_InputCDR& cdr, CORBA::Object*& x)
   if (!lazy_strategy)
     {
       // If the user has set up a eager strategy..
-      CORBA::String_var type_hint;
 
-      if (!(cdr >> type_hint.inout ()))
-        return false;
+      // Object references demarshaled from the same octets before
+      // get a stub for the profiles decoded then.
+      TAO::Stub_Cache &stub_cache = orb_core->stub_cache ();
+      const char *encoded = 0;
+      size_t encoded_length = 0;
+      if (stub_cache.enabled ()
+          && cdr.align_read_ptr (ACE_CDR::LONG_ALIGN) == 0)
+        {
+          encoded = cdr.rd_ptr ();
+          encoded_length =
+            TAO::Stub_Cache::encoded_length (encoded,
+                                             cdr.length (),
+                                             cdr.do_byte_swap ());
+        }
 
-      CORBA::ULong profile_count;
-      if (!(cdr >> profile_count))
-        return false;
+      CORBA::String_var type_hint;
 
-      if (profile_count == 0)
+      // get a profile container to store all profiles in the IOR.
+      TAO_MProfile mp;
+
+      bool const cached =
+        encoded_length != 0
+        && stub_cache.find (encoded,
+                            encoded_length,
+                            cdr.byte_order (),
+                            type_hint,
+                            mp);
+
+      CORBA::ULong profile_count = 0;
+      if (cached)
         {
-          x = CORBA::Object::_nil ();
-          return (CORBA::Boolean) cdr.good_bit ();
+          if (!cdr.skip_bytes (encoded_length))
+            return false;
+
+          profile_count = mp.profile_count ();
         }
+      else
+        {
+          if (!(cdr >> type_hint.inout ()))
+            return false;
 
-      // get a profile container to store all profiles in the IOR.
-      TAO_MProfile mp (profile_count);
+          if (!(cdr >> profile_count))
+            return false;
+
+          if (profile_count == 0)
+            {
+              x = CORBA::Object::_nil ();
+              return (CORBA::Boolean) cdr.good_bit ();
+            }
+
+          if (mp.set (profile_count) == -1)
+            return false;
+        }
 
       TAO_ORB_Core *orb_core = cdr.orb_core ();
       if (orb_core == 0)
@@ -912,7 +987,10 @@ operator>> (TAO_InputCDR& cdr, CORBA::Object*& x)
           TAO_Connector_Registry *connector_registry =
             orb_core->connector_registry ();
 
-          for (CORBA::ULong i = 0; i != profile_count && cdr.good_bit (); ++i)
+          // The cached profiles are complete already.
+          for (CORBA::ULong i = mp.profile_count ();
+               i != profile_count && cdr.good_bit ();
+               ++i)
             {
               TAO_Profile *pfile = connector_registry->create_profile (cdr);
               if (pfile != 0)
@@ -962,6 +1040,17 @@ operator>> (TAO_InputCDR& cdr, CORBA::Object*& x)
 
       // Transfer ownership to the CORBA::Object
       (void) safe_objdata.release ();
+
+      if (!cached
+          && encoded_length != 0
+          && cdr.rd_ptr () == encoded + encoded_length)
+        {
+          (void) stub_cache.bind (encoded,
+                                  encoded_length,
+                                  cdr.byte_order (),
+                                  type_hint.in (),
+                                  mp);
+        }
     }
   else
     {
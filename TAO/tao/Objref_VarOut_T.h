@@ -54,6 +54,12 @@ public:
 
   TAO_Objref_Var_T<T> & operator= (T *);
   TAO_Objref_Var_T<T> & operator= (const TAO_Objref_Var_T<T> &);
+
+#if defined (ACE_HAS_CPP11)
+  /// Take the reference held by the other _var.
+  TAO_Objref_Var_T (TAO_Objref_Var_T<T> &&) noexcept;
+  TAO_Objref_Var_T<T> & operator= (TAO_Objref_Var_T<T> &&) noexcept;
+#endif /* ACE_HAS_CPP11 */
   T * operator-> (void) const;
 
   /// Cast operators.
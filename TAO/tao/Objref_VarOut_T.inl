@@ -8,6 +8,29 @@ TAO_Objref_Var_T<T>::TAO_Objref_Var_T (void)
 {
 }
 
+#if defined (ACE_HAS_CPP11)
+template <typename T>
+ACE_INLINE
+TAO_Objref_Var_T<T>::TAO_Objref_Var_T (TAO_Objref_Var_T<T> && p) noexcept
+  : TAO_Base_var (),
+    ptr_ (p.ptr_)
+{
+  p.ptr_ = TAO::Objref_Traits<T>::nil ();
+}
+
+template <typename T>
+ACE_INLINE
+TAO_Objref_Var_T<T> &
+TAO_Objref_Var_T<T>::operator= (TAO_Objref_Var_T<T> && p) noexcept
+{
+  T * old_ptr = this->ptr_;
+  this->ptr_ = p.ptr_;
+  p.ptr_ = TAO::Objref_Traits<T>::nil ();
+  TAO::Objref_Traits<T>::release (old_ptr);
+  return *this;
+}
+#endif /* ACE_HAS_CPP11 */
+
 template <typename T>
 ACE_INLINE
 TAO_Objref_Var_T<T>::~TAO_Objref_Var_T (void)
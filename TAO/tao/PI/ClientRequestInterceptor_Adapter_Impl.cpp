@@ -26,6 +26,14 @@ namespace TAO
 
     bool const is_remote_request = invocation.is_remote_request();
 
+    if (!this->should_be_processed (is_remote_request))
+      {
+        // None of the interceptors processes this request, just push
+        // them on to the flow stack.
+        invocation.stack_size () += this->interceptor_list_.size ();
+        return;
+      }
+
     try
       {
         TAO_ClientRequestInfo ri (&invocation);
@@ -60,6 +68,14 @@ namespace TAO
 
     bool const is_remote_request = invocation.is_remote_request();
 
+    if (!this->should_be_processed (is_remote_request))
+      {
+        // None of the interceptors processes this request, just pop
+        // them off of the flow stack.
+        invocation.stack_size () = 0;
+        return;
+      }
+
     // Notice that the interceptors are processed in the opposite order
     // they were pushed onto the stack since this is an "ending"
     // interception point.
@@ -100,6 +116,12 @@ namespace TAO
 
     bool const is_remote_request = invocation.is_remote_request();
 
+    if (!this->should_be_processed (is_remote_request))
+      {
+        invocation.stack_size () = 0;
+        return;
+      }
+
     // Notice that the interceptors are processed in the opposite order
     // they were pushed onto the stack since this is an "ending"
     // interception point.
@@ -168,6 +190,12 @@ namespace TAO
 
     bool const is_remote_request = invocation.is_remote_request();
 
+    if (!this->should_be_processed (is_remote_request))
+      {
+        invocation.stack_size () = 0;
+        return;
+      }
+
     // Notice that the interceptors are processed in the opposite order
     // they were pushed onto the stack since this is an "ending"
     // interception point.
@@ -244,6 +272,7 @@ namespace TAO
     PortableInterceptor::ClientRequestInterceptor_ptr interceptor)
   {
     this->interceptor_list_.add_interceptor (interceptor);
+    this->update_processing_mode ();
   }
 
   void
@@ -252,6 +281,25 @@ namespace TAO
     const CORBA::PolicyList& policies)
   {
     this->interceptor_list_.add_interceptor (interceptor, policies);
+    this->update_processing_mode ();
+  }
+
+  void
+  ClientRequestInterceptor_Adapter_Impl::update_processing_mode (void)
+  {
+    ClientRequestInterceptor_List::RegisteredInterceptor &registered =
+      this->interceptor_list_.registered_interceptor (
+        this->interceptor_list_.size () - 1);
+
+    if (registered.details_.should_be_processed (true))
+      {
+        this->process_remote_ = true;
+      }
+
+    if (registered.details_.should_be_processed (false))
+      {
+        this->process_collocated_ = true;
+      }
   }
 
   void
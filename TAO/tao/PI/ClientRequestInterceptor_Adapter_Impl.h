@@ -119,8 +119,25 @@ namespace TAO
                                   const PortableInterceptor::ForwardRequest &exc);
 
   private:
+    /// Remember whether the interceptor registered last processes
+    /// remote and collocated requests.
+    void update_processing_mode (void);
+
+    /// Whether any registered interceptor processes the request.
+    bool should_be_processed (bool is_remote_request) const;
+
     /// List of registered interceptors.
     ClientRequestInterceptor_List interceptor_list_;
+
+    /// Whether any registered interceptor processes remote requests,
+    /// respectively collocated requests.
+    /**
+     * Found out when the interceptors are registered, the interception
+     * points of a request that no interceptor processes only maintain
+     * the flow stack, without setting up a request info.
+     */
+    bool process_remote_;
+    bool process_collocated_;
   };
 }
 
@@ -5,8 +5,20 @@ namespace TAO
 {
   ACE_INLINE
   ClientRequestInterceptor_Adapter_Impl::ClientRequestInterceptor_Adapter_Impl (void)
+    : process_remote_ (false)
+    , process_collocated_ (false)
   {
   }
+
+  ACE_INLINE
+  bool
+  ClientRequestInterceptor_Adapter_Impl::should_be_processed (
+    bool is_remote_request) const
+  {
+    return is_remote_request
+           ? this->process_remote_
+           : this->process_collocated_;
+  }
 }
 
 TAO_END_VERSIONED_NAMESPACE_DECL
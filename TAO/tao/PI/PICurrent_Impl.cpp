@@ -21,23 +21,13 @@ TAO::PICurrent_Impl::get_slot (PortableInterceptor::SlotId identifier)
   // No need to check validity of SlotId.  It is validated before this
   // method is invoked.
 
-  // The active slot table should never be a lazy copy of itself!
-  if ( (0 != this->lazy_copy_)
-      && (&this->lazy_copy_->current_slot_table () == &this->slot_table_))
-  {
-    if (TAO_debug_level > 0)
-      TAOLIB_DEBUG ((LM_DEBUG, ACE_TEXT ("TAO (%P|%t) Lazy copy of self detected at %N,%l\n")));
-    throw ::CORBA::INTERNAL ();
-  }
-
-  // Get the slot table that is currently active
-  PICurrent_Impl::Table & table = this->current_slot_table ();
   CORBA::Any * any = 0;
 
-  if (identifier < table.size ())
+  if (0 != this->slot_table_
+      && identifier < this->slot_table_->table_.size ())
     {
       ACE_NEW_THROW_EX (any,
-                        CORBA::Any (table[identifier]), // Make a copy.
+                        CORBA::Any (this->slot_table_->table_[identifier]), // Make a copy.
                         CORBA::NO_MEMORY (
                           CORBA::SystemException::_tao_minor_code (
                             0,
@@ -68,60 +58,57 @@ TAO::PICurrent_Impl::set_slot (PortableInterceptor::SlotId identifier,
   // No need to check validity of SlotId.  It is validated before this
   // method is invoked.
 
-  // Break any existing ties that another PICurrent has with our table
-  // since our table is changing.
-  if (0 != this->impending_change_callback_)
-    this->impending_change_callback_->convert_from_lazy_to_real_copy ();
+  // Ensure that we have a physical copy of the table that nobody else
+  // refers to before making any changes to it.
+  if (0 == this->slot_table_ || this->slot_table_->refcount_ != 1)
+    {
+      Shared_Table *table = 0;
+      ACE_NEW_THROW_EX (table,
+                        Shared_Table,
+                        CORBA::NO_MEMORY (
+                          CORBA::SystemException::_tao_minor_code (
+                            0,
+                            ENOMEM),
+                          CORBA::COMPLETED_NO));
+
+      if (0 != this->slot_table_)
+        {
+          table->table_ = this->slot_table_->table_;
+        }
 
-  // Ensure that we have a real physical copy of the table before
-  // making any changes to it.
-  this->convert_from_lazy_to_real_copy ();
+      this->release_slot_table ();
+      this->slot_table_ = table;
+    }
+
+  Table &table = this->slot_table_->table_;
 
   // If the slot table array isn't large enough, then increase its
   // size.  We're guaranteed not to exceed the number of allocated
   // slots for the reason stated above.
-  if (identifier >= this->slot_table_.size ()
-      && this->slot_table_.size (identifier + 1) != 0)
+  if (identifier >= table.size ()
+      && table.size (identifier + 1) != 0)
     throw ::CORBA::INTERNAL ();
 
-  this->slot_table_[identifier] = CORBA::Any (data);
+  table[identifier] = CORBA::Any (data);
 }
 
 void
 TAO::PICurrent_Impl::take_lazy_copy (
   TAO::PICurrent_Impl * p)
 {
-  // Check that we are being told to actually change which table we are
-  // copying from. (If it is the same as before OR it would ultimately be
-  // the same table, we are already correctly setup and we do nothing.)
-  if ( (p != this->lazy_copy_)
-      && ((0 == p) || (&p->current_slot_table () != &this->current_slot_table ()))
-      )
+  Shared_Table * const table = (0 == p) ? 0 : p->slot_table_;
+
+  // If we already share the table (or copy ourself) there is nothing
+  // to do.
+  if (table != this->slot_table_)
     {
-      // Break any existing ties that another PICurrent has with our table
-      // since our table is changing.
-      if (0 != this->impending_change_callback_)
-        this->impending_change_callback_->convert_from_lazy_to_real_copy ();
-
-      // If we have previously logically copied another table, ensure it is
-      // told that we are no longer interested in it so that it will not
-      // call our conver_from_lazy_to_real_copy() when it changes/destructs.
-      if (0 != this->lazy_copy_)
-        this->lazy_copy_->set_callback_for_impending_change (0);
-
-      // Are we being asked to copy ourself (or nothing)
-      if ((0 == p) || (this == p))
+      if (0 != table)
         {
-          this->lazy_copy_ = 0; // Use our own physical slot_table_
+          ++table->refcount_;
         }
-      else
-        {
-          this->lazy_copy_ = p;
 
-          // Must tell the newly copied PICurrent_Impl that we want to
-          // be told when/if it is going to be changed or destroyed.
-          this->lazy_copy_->set_callback_for_impending_change (this);
-        }
+      this->release_slot_table ();
+      this->slot_table_ = table;
     }
 }
 
@@ -144,16 +131,8 @@ TAO::PICurrent_Impl::~PICurrent_Impl ()
       this->orb_core_->set_tss_resource (this->tss_slot_, 0);
     }
 
-  // Break any existing ties that another PICurrent has with our table
-  // since our table will no longer exists once this destructor completes.
-  if (0 != this->impending_change_callback_)
-    this->impending_change_callback_->convert_from_lazy_to_real_copy ();
-
-  // If we have logically copied another table, ensure it is told about our
-  // demise so that it will not call our non-existant
-  // convert_from_lazy_to_real_copy() when it changes/destructs.
-  if (0 != this->lazy_copy_)
-    this->lazy_copy_->set_callback_for_impending_change (0);
+  // Whoever shares our table keeps it.
+  this->release_slot_table ();
 
   if (this->pop_)
     {
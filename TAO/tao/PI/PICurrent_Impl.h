@@ -26,6 +26,11 @@
 #include "tao/PI/PI_includeC.h"
 #include "tao/AnyTypeCode/Any.h"
 #include "ace/Array_Base.h"
+#if defined (ACE_HAS_CPP11)
+# include <atomic>
+#else
+# include "ace/Atomic_Op.h"
+#endif /* ACE_HAS_CPP11 */
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -63,8 +68,17 @@ namespace TAO
                    const CORBA::Any & data);
 
     /// Logically/Lazy (shallow) copy the given object's slot table.
+    /**
+     * The slot table is shared until either object changes a slot,
+     * then the one changing it takes a physical copy first.  A nil
+     * @a p empties the slot table.
+     */
     void take_lazy_copy (PICurrent_Impl *p);
 
+    /// True if no slot has been set, in this object or in the slot
+    /// table it copied.
+    bool empty (void) const;
+
     /// Push a new PICurrent_Impl on stack
     void push (void);
 
@@ -72,27 +86,28 @@ namespace TAO
     void pop (void);
 
   private:
-    /// Force this object to convert from a logical (referenced)
-    /// copy, to a physical (or deep, actual) copy.
-    void convert_from_lazy_to_real_copy ();
-
-    /// Set the callback PICurrent_Impl object that will be notified
-    /// of this object's impending destruction or change.
-    /// Set to 0 to clear. (NOTE Only handles a SINGLE object at
-    /// at time, does NOT warn previous callback that this has
-    /// been changed.)
-    void set_callback_for_impending_change (PICurrent_Impl *p);
-
     /// Typedef for the underyling "slot table."
     typedef ACE_Array_Base<CORBA::Any> Table;
 
-    /// Return a reference to the slot table currently associated
-    /// with this PICurrent_Impl object.
-    /**
-     * @return Logically copied slot table if available, otherwise
-     *         underlying slot table.
-     */
-    Table & current_slot_table ();
+    /// Slot table shared by the PICurrent_Impl objects that copied
+    /// it and did not change it since.
+    struct Shared_Table
+    {
+      Shared_Table (void);
+
+      Table table_;
+
+      /// Number of PICurrent_Impl objects sharing the table.
+#if defined (ACE_HAS_CPP11)
+      std::atomic<uint32_t> refcount_;
+#else
+      ACE_Atomic_Op<TAO_SYNCH_MUTEX, unsigned long> refcount_;
+#endif /* ACE_HAS_CPP11 */
+    };
+
+    /// Drop the reference to the slot table, deleting it if it was
+    /// the last one.
+    void release_slot_table (void);
 
     /// Prevent copying through the copy constructor and the assignment
     /// operator.
@@ -108,19 +123,9 @@ namespace TAO
     PICurrent_Impl *pop_;
     PICurrent_Impl *push_;
 
-    /// Array of CORBA::Anys that is the underlying "slot table."
-    Table slot_table_;
-
-    /// Access to logical copy from a PICurrent_Impl in another
-    /// scope, i.e. either the request scope or the thread scope.
-    PICurrent_Impl *lazy_copy_;
-
-    /// PICurrent_Impl object that will be notified of this object's
-    /// impending destruction or change to its slot_table_. This is
-    /// the PICurrent_Impl that has access to our slot_table_ via its
-    /// lazy_copy_ pointer. As necessary this allows that object's
-    /// convert_from_lazy_to_real_copy() to be called.
-    PICurrent_Impl *impending_change_callback_;
+    /// The slot table, 0 until a slot is set or a non-empty slot
+    /// table is copied.
+    Shared_Table *slot_table_;
   };
 }
 
@@ -12,8 +12,9 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 TAO::PICurrent_Guard::PICurrent_Guard (TAO_ServerRequest &server_request,
                                        bool tsc_to_rsc)
-  : src_ (0),
-    dest_ (0)
+  : server_request_ (0),
+    tsc_ (0),
+    tsc_to_rsc_ (tsc_to_rsc)
 {
   // This constructor is used on the server side.
 
@@ -28,37 +29,50 @@ TAO::PICurrent_Guard::PICurrent_Guard (TAO_ServerRequest &server_request,
   // copying (and hence TSS accesses) from occurring.
   if (pi_current != 0 && pi_current->slot_count () != 0)
     {
-      // Retrieve the request scope current.
-      PICurrent_Impl * rsc = server_request.rs_pi_current ();
+      this->server_request_ = &server_request;
 
       // Retrieve the thread scope current.
-      PICurrent_Impl * tsc = pi_current->tsc ();
-
-      if (tsc_to_rsc)
-        {
-          // TSC to RSC copy.
-          // Occurs after receive_request() interception point and
-          // upcall.
-          this->src_  = tsc;
-          this->dest_ = rsc;
-        }
-      else
-        {
-          // RSC to TSC copy.
-          // Occurs after receive_request_service_contexts()
-          // interception point.
-          this->src_  = rsc;
-          this->dest_ = tsc;
-        }
+      this->tsc_ = pi_current->tsc ();
     }
 }
 
 TAO::PICurrent_Guard::~PICurrent_Guard (void)
 {
-  if (this->src_ != 0 && this->dest_ != 0
-      && this->src_ != this->dest_)
+  if (this->server_request_ == 0 || this->tsc_ == 0)
     {
-      this->dest_->take_lazy_copy (this->src_);
+      return;
+    }
+
+  if (this->tsc_to_rsc_)
+    {
+      // TSC to RSC copy.
+      // Occurs after receive_request() interception point and
+      // upcall.  An empty TSC leaves a request scope current that
+      // does not exist yet alone.
+      if (!this->tsc_->empty () || this->server_request_->has_rs_pi_current ())
+        {
+          PICurrent_Impl *rsc = this->server_request_->rs_pi_current ();
+
+          if (rsc != 0)
+            {
+              rsc->take_lazy_copy (this->tsc_);
+            }
+        }
+    }
+  else
+    {
+      // RSC to TSC copy.
+      // Occurs after receive_request_service_contexts()
+      // interception point.  If no interceptor used the request
+      // scope current it is empty, and so becomes the TSC.
+      PICurrent_Impl *rsc = 0;
+
+      if (this->server_request_->has_rs_pi_current ())
+        {
+          rsc = this->server_request_->rs_pi_current ();
+        }
+
+      this->tsc_->take_lazy_copy (rsc);
     }
 }
 
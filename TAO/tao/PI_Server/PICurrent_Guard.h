@@ -76,12 +76,19 @@ namespace TAO
 
   private:
 
-    /// The PICurrent implementation whose slot table will be copied.
-    PICurrent_Impl *src_;
+    /// The server request whose request scope current is copied, 0
+    /// if there are no slots and hence nothing to copy.
+    /**
+     * The request scope current is only created when there is
+     * something to copy into it, or when an interceptor used it.
+     */
+    TAO_ServerRequest *server_request_;
+
+    /// The thread scope current.
+    PICurrent_Impl *tsc_;
 
-    /// The PICurrent implementation whose slot table will be filled
-    /// with the contents of another PICurrent's slot table.
-    PICurrent_Impl *dest_;
+    /// true when copying TSC slot table to RSC slot table.
+    bool const tsc_to_rsc_;
   };
 }
 
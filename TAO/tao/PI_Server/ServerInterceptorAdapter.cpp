@@ -16,6 +16,8 @@
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 TAO::ServerRequestInterceptor_Adapter_Impl::ServerRequestInterceptor_Adapter_Impl (void)
+  : process_remote_ (false)
+  , process_collocated_ (false)
 {
 }
 
@@ -38,6 +40,16 @@ TAO::ServerRequestInterceptor_Adapter_Impl::tao_ft_interception_point (
       oc = 0;
 
       bool is_remote_request = !server_request.collocated ();
+
+      if (!this->should_be_processed (is_remote_request))
+        {
+          // None of the interceptors processes this request, just
+          // push them on to the flow stack.
+          server_request.interceptor_count () +=
+            this->interceptor_list_.size ();
+          return;
+        }
+
       TAO::ServerRequestInfo request_info (server_request,
                                           args,
                                           nargs,
@@ -122,6 +134,12 @@ TAO::ServerRequestInterceptor_Adapter_Impl::receive_request_service_contexts (
                                            false /* Copy RSC to TSC */);
 
       bool is_remote_request = !server_request.collocated ();
+
+      if (!this->should_be_processed (is_remote_request))
+        {
+          return;
+        }
+
       TAO::ServerRequestInfo request_info (server_request,
                                            args,
                                            nargs,
@@ -183,6 +201,15 @@ TAO::ServerRequestInterceptor_Adapter_Impl::receive_request_service_contexts (
 
       bool is_remote_request = !server_request.collocated ();
 
+      if (!this->should_be_processed (is_remote_request))
+        {
+          // None of the interceptors processes this request, just
+          // push them on to the flow stack.
+          server_request.interceptor_count () +=
+            this->interceptor_list_.size ();
+          return;
+        }
+
       TAO::ServerRequestInfo request_info (server_request,
                                            args,
                                            nargs,
@@ -249,6 +276,13 @@ TAO::ServerRequestInterceptor_Adapter_Impl::receive_request (
       throw ::CORBA::INTERNAL ();
     }
 
+  bool const is_remote_request = !server_request.collocated ();
+
+  if (!this->should_be_processed (is_remote_request))
+    {
+      return;
+    }
+
   TAO::ServerRequestInfo request_info (server_request,
                                        args,
                                        nargs,
@@ -258,7 +292,6 @@ TAO::ServerRequestInterceptor_Adapter_Impl::receive_request (
 
   try
     {
-      bool is_remote_request = !server_request.collocated ();
 
       for (size_t i = 0; i < server_request.interceptor_count (); ++i)
         {
@@ -304,6 +337,14 @@ TAO::ServerRequestInterceptor_Adapter_Impl::send_reply (
 
   bool const is_remote_request = !server_request.collocated ();
 
+  if (!this->should_be_processed (is_remote_request))
+    {
+      // None of the interceptors processes this request, just pop
+      // them off of the flow stack.
+      server_request.interceptor_count () = 0;
+      return;
+    }
+
   // Notice that the interceptors are processed in the opposite order
   // they were pushed onto the stack since this is an "ending"
   // interception point.
@@ -353,6 +394,12 @@ TAO::ServerRequestInterceptor_Adapter_Impl::send_exception (
   // process the interceptors pushed on to the flow stack.
   bool const is_remote_request = !server_request.collocated ();
 
+  if (!this->should_be_processed (is_remote_request))
+    {
+      server_request.interceptor_count () = 0;
+      return;
+    }
+
   // Notice that the interceptors are processed in the opposite order
   // they were pushed onto the stack since this is an "ending" server
   // side interception point.
@@ -444,6 +491,12 @@ TAO::ServerRequestInterceptor_Adapter_Impl::send_other (
   // process the interceptors pushed on to the flow stack.
   bool const is_remote_request = !server_request.collocated ();
 
+  if (!this->should_be_processed (is_remote_request))
+    {
+      server_request.interceptor_count () = 0;
+      return;
+    }
+
   TAO::ServerRequestInfo request_info (server_request,
                                        args,
                                        nargs,
@@ -496,6 +549,7 @@ TAO::ServerRequestInterceptor_Adapter_Impl::add_interceptor (
   PortableInterceptor::ServerRequestInterceptor_ptr interceptor)
 {
   this->interceptor_list_.add_interceptor (interceptor);
+  this->update_processing_mode ();
 }
 
 void
@@ -504,6 +558,25 @@ TAO::ServerRequestInterceptor_Adapter_Impl::add_interceptor (
   const CORBA::PolicyList& policies)
 {
   this->interceptor_list_.add_interceptor (interceptor, policies);
+  this->update_processing_mode ();
+}
+
+void
+TAO::ServerRequestInterceptor_Adapter_Impl::update_processing_mode (void)
+{
+  ServerRequestInterceptor_List::RegisteredInterceptor &registered =
+    this->interceptor_list_.registered_interceptor (
+      this->interceptor_list_.size () - 1);
+
+  if (registered.details_.should_be_processed (true))
+    {
+      this->process_remote_ = true;
+    }
+
+  if (registered.details_.should_be_processed (false))
+    {
+      this->process_collocated_ = true;
+    }
 }
 
 void
@@ -170,8 +170,28 @@ namespace TAO
       {TAO_RequestInterceptor_Adapter_Impl::pushTSC (orb_core);}
 
   private:
+    /// Remember whether the interceptor registered last processes
+    /// remote and collocated requests.
+    void update_processing_mode (void);
+
+    /// Whether any registered interceptor processes the request.
+    bool should_be_processed (bool is_remote_request) const
+      {return is_remote_request ? this->process_remote_
+                                : this->process_collocated_;}
+
     /// List of registered interceptors.
     ServerRequestInterceptor_List interceptor_list_;
+
+    /// Whether any registered interceptor processes remote requests,
+    /// respectively collocated requests.
+    /**
+     * Found out when the interceptors are registered, the interception
+     * points of a request that no interceptor processes only maintain
+     * the flow stack and the PICurrent, without setting up a request
+     * info.
+     */
+    bool process_remote_;
+    bool process_collocated_;
   };
 }  // End namespace TAO
 
@@ -44,6 +44,7 @@ TAO_Active_Object_Map::set_system_id_size (
             {
 #if (TAO_HAS_MINIMUM_POA_MAPS == 0)
             case TAO_LINEAR:
+            case TAO_FLAT_HASH:
               TAO_Active_Object_Map::system_id_size_ = sizeof (CORBA::ULong);
               break;
 #endif /* TAO_HAS_MINIMUM_POA_MAPS == 0 */
@@ -71,6 +72,7 @@ TAO_Active_Object_Map::set_system_id_size (
               break;
 
             case TAO_DYNAMIC_HASH:
+            case TAO_FLAT_HASH:
               TAO_Active_Object_Map::system_id_size_ = sizeof (CORBA::ULong);
               break;
 #endif /* TAO_HAS_MINIMUM_POA_MAPS == 0 */
@@ -227,9 +229,17 @@ TAO_Active_Object_Map::TAO_Active_Object_Map (
                               creation_parameters.active_object_map_size_),
                             CORBA::NO_MEMORY ());
           break;
+
+        case TAO_FLAT_HASH:
+          ACE_NEW_THROW_EX (sm,
+                            servant_flat_map (
+                              creation_parameters.active_object_map_size_),
+                            CORBA::NO_MEMORY ());
+          break;
 #else
+        case TAO_FLAT_HASH:
           TAOLIB_ERROR ((LM_ERROR,
-                      "linear option for "
+                      "linear and flat options for "
                       "-ORBUniqueidPolicyReverseDemuxStrategy "
                       "not supported with minimum POA maps. "
                       "Ignoring option to use default...\n"));
@@ -266,9 +276,17 @@ TAO_Active_Object_Map::TAO_Active_Object_Map (
                               creation_parameters.active_object_map_size_),
                             CORBA::NO_MEMORY ());
           break;
+
+        case TAO_FLAT_HASH:
+          ACE_NEW_THROW_EX (uim,
+                            user_id_flat_map (
+                              creation_parameters.active_object_map_size_),
+                            CORBA::NO_MEMORY ());
+          break;
 #else
+        case TAO_FLAT_HASH:
           TAOLIB_ERROR ((LM_ERROR,
-                      "linear option for -ORBUseridPolicyDemuxStrategy "
+                      "linear and flat options for -ORBUseridPolicyDemuxStrategy "
                       "not supported with minimum POA maps. "
                       "Ignoring option to use default...\n"));
           /* FALL THROUGH */
@@ -298,11 +316,18 @@ TAO_Active_Object_Map::TAO_Active_Object_Map (
                             user_id_hash_map (creation_parameters.active_object_map_size_),
                             CORBA::NO_MEMORY ());
           break;
+
+        case TAO_FLAT_HASH:
+          ACE_NEW_THROW_EX (uim,
+                            user_id_flat_map (creation_parameters.active_object_map_size_),
+                            CORBA::NO_MEMORY ());
+          break;
 #else
         case TAO_LINEAR:
         case TAO_DYNAMIC_HASH:
+        case TAO_FLAT_HASH:
           TAOLIB_ERROR ((LM_ERROR,
-                      "linear and dynamic options for -ORBSystemidPolicyDemuxStrategy "
+                      "linear, dynamic and flat options for -ORBSystemidPolicyDemuxStrategy "
                       "are not supported with minimum POA maps. "
                       "Ignoring option to use default...\n"));
           /* FALL THROUGH */
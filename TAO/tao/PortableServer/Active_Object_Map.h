@@ -203,6 +203,16 @@ public:
     ACE_Equal_To<PortableServer::ObjectId>,
     TAO_Incremental_Key_Generator> user_id_hash_map;
 
+#if (TAO_HAS_MINIMUM_POA_MAPS == 0)
+  /// Id flat hash map.
+  typedef ACE_Flat_Hash_Map_Ex_Adapter<
+  PortableServer::ObjectId,
+    TAO_Active_Object_Map_Entry *,
+    TAO_ObjectId_Hash,
+    ACE_Equal_To<PortableServer::ObjectId>,
+    TAO_Incremental_Key_Generator> user_id_flat_map;
+#endif /* TAO_HAS_MINIMUM_POA_MAPS == 0 */
+
   /// Id linear map.
   typedef ACE_Map_Manager_Adapter<
   PortableServer::ObjectId,
@@ -234,6 +244,14 @@ public:
   PortableServer::Servant,
     TAO_Active_Object_Map_Entry *,
     ACE_Noop_Key_Generator<PortableServer::Servant> > servant_linear_map;
+
+  /// Servant flat hash map.
+  typedef ACE_Flat_Hash_Map_Ex_Adapter<
+  PortableServer::Servant,
+    TAO_Active_Object_Map_Entry *,
+    TAO_Servant_Hash,
+    ACE_Equal_To<PortableServer::Servant>,
+    ACE_Noop_Key_Generator<PortableServer::Servant> > servant_flat_map;
 #endif /* TAO_HAS_MINIMUM_POA_MAPS == 0 */
 
   /// Id map.
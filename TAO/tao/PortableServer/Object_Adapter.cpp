@@ -120,6 +120,7 @@ TAO_Object_Adapter::set_transient_poa_name_size (const TAO_Server_Strategy_Facto
             sizeof (CORBA::ULong);
           break;
         case TAO_DYNAMIC_HASH:
+        case TAO_FLAT_HASH:
           TAO_Object_Adapter::transient_poa_name_size_ =
             sizeof (CORBA::ULong);
           break;
@@ -183,9 +184,14 @@ TAO_Object_Adapter::TAO_Object_Adapter (const TAO_Server_Strategy_Factory::Activ
                persistent_poa_name_linear_map (creation_parameters.poa_map_size_));
 
       break;
+    case TAO_FLAT_HASH:
+      ACE_NEW (ppnm,
+               persistent_poa_name_flat_map (creation_parameters.poa_map_size_));
+      break;
 #else
+    case TAO_FLAT_HASH:
       TAOLIB_ERROR ((LM_ERROR,
-                  "linear option for -ORBPersistentidPolicyDemuxStrategy "
+                  "linear and flat options for -ORBPersistentidPolicyDemuxStrategy "
                   "not supported with minimum POA maps. "
                   "Ignoring option to use default...\n"));
       /* FALL THROUGH */
@@ -215,11 +221,16 @@ TAO_Object_Adapter::TAO_Object_Adapter (const TAO_Server_Strategy_Factory::Activ
       ACE_NEW (tpm,
                transient_poa_hash_map (creation_parameters.poa_map_size_));
       break;
+    case TAO_FLAT_HASH:
+      ACE_NEW (tpm,
+               transient_poa_flat_map (creation_parameters.poa_map_size_));
+      break;
 #else
     case TAO_LINEAR:
     case TAO_DYNAMIC_HASH:
+    case TAO_FLAT_HASH:
       TAOLIB_ERROR ((LM_ERROR,
-                  "linear and dynamic options for -ORBTransientidPolicyDemuxStrategy "
+                  "linear, dynamic and flat options for -ORBTransientidPolicyDemuxStrategy "
                   "are not supported with minimum POA maps. "
                   "Ignoring option to use default...\n"));
       /* FALL THROUGH */
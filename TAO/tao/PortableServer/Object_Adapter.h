@@ -329,6 +329,16 @@ protected:
     TAO_Incremental_Key_Generator> transient_poa_linear_map;
 #endif /* TAO_HAS_MINIMUM_POA_MAPS == 0 */
 
+#if (TAO_HAS_MINIMUM_POA_MAPS == 0)
+  /// Id flat hash map.
+  typedef ACE_Flat_Hash_Map_Ex_Adapter<
+  poa_name,
+    TAO_Root_POA *,
+    TAO_ObjectId_Hash,
+    ACE_Equal_To<poa_name>,
+    TAO_Incremental_Key_Generator> transient_poa_flat_map;
+#endif /* TAO_HAS_MINIMUM_POA_MAPS == 0 */
+
   /// Id active map.
   typedef ACE_Active_Map_Manager_Adapter<
   poa_name,
@@ -354,6 +364,14 @@ protected:
   poa_name,
     TAO_Root_POA *,
     ACE_Noop_Key_Generator<poa_name> > persistent_poa_name_linear_map;
+
+  /// Id flat hash map.
+  typedef ACE_Flat_Hash_Map_Ex_Adapter<
+  poa_name,
+    TAO_Root_POA *,
+    TAO_ObjectId_Hash,
+    ACE_Equal_To<PortableServer::ObjectId>,
+    ACE_Noop_Key_Generator<poa_name> > persistent_poa_name_flat_map;
 #endif /* TAO_HAS_MINIMUM_POA_MAPS == 0 */
 
   /// Strategy for dispatching a request to a servant.
@@ -26,6 +26,7 @@
 
 #include "tao/PI/PI.h"
 #include "tao/LocalObject.h"
+#include "tao/RTCORBA/Thread_Lane_Affinity.h"
 
 // This is to remove "inherits via dominance" warnings from MSVC.
 // MSVC is being a little too paranoid.
@@ -77,7 +78,8 @@ public:
                          long sched_policy,
                          long scope_policy,
                          TAO_RT_ORBInitializer::TAO_RTCORBA_DT_LifeSpan lifespan,
-                         ACE_Time_Value const &dynamic_thread_time);
+                         ACE_Time_Value const &dynamic_thread_time,
+                         TAO_Thread_Lane_Affinity const &lane_affinity);
 
   virtual void pre_init (PortableInterceptor::ORBInitInfo_ptr info);
 
@@ -140,6 +142,10 @@ private:
    * a time can be specified
    */
   ACE_Time_Value const dynamic_thread_time_;
+
+  /// Processors the thread lanes are bound to, given with the
+  /// -RTORBLaneCPUAffinity and -RTORBLaneNUMANode options.
+  TAO_Thread_Lane_Affinity const lane_affinity_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
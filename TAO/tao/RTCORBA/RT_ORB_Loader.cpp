@@ -3,6 +3,7 @@
 #if defined (TAO_HAS_CORBA_MESSAGING) && TAO_HAS_CORBA_MESSAGING != 0
 
 #include "tao/RTCORBA/RT_ORBInitializer.h"
+#include "tao/RTCORBA/Thread_Lane_Affinity.h"
 
 #include "tao/debug.h"
 #include "tao/ORB_Constants.h"
@@ -57,6 +58,7 @@ TAO_RT_ORB_Loader::init (int argc, ACE_TCHAR* argv[])
   int curarg = 0;
   ACE_Time_Value dynamic_thread_time;
   TAO_RT_ORBInitializer::TAO_RTCORBA_DT_LifeSpan lifespan = TAO_RT_ORBInitializer::TAO_RTCORBA_DT_INFINITIVE;
+  TAO_Thread_Lane_Affinity lane_affinity;
 
   ACE_Arg_Shifter arg_shifter (argc, argv);
 
@@ -161,6 +163,49 @@ TAO_RT_ORB_Loader::init (int argc, ACE_TCHAR* argv[])
           lifespan = TAO_RT_ORBInitializer::TAO_RTCORBA_DT_FIXED;
           arg_shifter.consume_arg ();
         }
+      else if (0 != (current_arg = arg_shifter.get_the_parameter
+                                   (ACE_TEXT("-RTORBLaneCPUAffinity"))))
+        {
+          ACE_CString lane (ACE_TEXT_ALWAYS_CHAR (current_arg));
+          arg_shifter.consume_arg ();
+
+          const ACE_TCHAR *cpus = ACE_TEXT ("");
+          if (arg_shifter.is_parameter_next ())
+            {
+              cpus = arg_shifter.get_current ();
+              arg_shifter.consume_arg ();
+            }
+
+          if (lane_affinity.cpus (lane.c_str (),
+                                  ACE_TEXT_ALWAYS_CHAR (cpus)) == -1)
+            TAOLIB_ERROR ((LM_ERROR,
+                        ACE_TEXT("RT_ORB_Loader - invalid arguments")
+                        ACE_TEXT(" <%C> <%s> for -RTORBLaneCPUAffinity\n"),
+                        lane.c_str (),
+                        cpus));
+        }
+      else if (0 != (current_arg = arg_shifter.get_the_parameter
+                                   (ACE_TEXT("-RTORBLaneNUMANode"))))
+        {
+          ACE_CString lane (ACE_TEXT_ALWAYS_CHAR (current_arg));
+          arg_shifter.consume_arg ();
+
+          const ACE_TCHAR *node = ACE_TEXT ("");
+          if (arg_shifter.is_parameter_next ())
+            {
+              node = arg_shifter.get_current ();
+              arg_shifter.consume_arg ();
+            }
+
+          if (*node == 0
+              || lane_affinity.numa_node (lane.c_str (),
+                                          ACE_OS::atoi (node)) == -1)
+            TAOLIB_ERROR ((LM_ERROR,
+                        ACE_TEXT("RT_ORB_Loader - invalid arguments")
+                        ACE_TEXT(" <%C> <%s> for -RTORBLaneNUMANode\n"),
+                        lane.c_str (),
+                        node));
+        }
     else
       {
         arg_shifter.ignore_arg ();
@@ -188,7 +233,8 @@ TAO_RT_ORB_Loader::init (int argc, ACE_TCHAR* argv[])
                                                sched_policy,
                                                scope_policy,
                                                lifespan,
-                                               dynamic_thread_time),
+                                               dynamic_thread_time,
+                                               lane_affinity),
                         CORBA::NO_MEMORY (
                           CORBA::SystemException::_tao_minor_code (
                             TAO::VMCID,
@@ -0,0 +1,330 @@
+#include "tao/RTCORBA/Thread_Lane_Affinity.h"
+
+#if defined (TAO_HAS_CORBA_MESSAGING) && TAO_HAS_CORBA_MESSAGING != 0
+
+#include "tao/debug.h"
+#include "ace/OS_NS_Thread.h"
+#include "ace/OS_NS_stdio.h"
+#include "ace/OS_NS_stdlib.h"
+#include "ace/OS_NS_string.h"
+#include "ace/OS_NS_errno.h"
+
+#if (defined (ACE_HAS_PTHREAD_SETAFFINITY_NP) \
+     || defined (ACE_HAS_SCHED_SETAFFINITY)) && defined (CPU_SET)
+# define TAO_HAS_THREAD_LANE_AFFINITY
+#endif
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+#if defined (TAO_HAS_THREAD_LANE_AFFINITY)
+namespace
+{
+  /// The thread id ACE_OS::thr_get_affinity() and
+  /// ACE_OS::thr_set_affinity() expect for the calling thread.
+  ACE_hthread_t
+  affinity_self (void)
+  {
+#if defined (ACE_HAS_PTHREAD_SETAFFINITY_NP)
+    ACE_hthread_t self;
+    ACE_OS::thr_self (self);
+    return self;
+#else
+    // sched_setaffinity() binds the calling thread for a pid of 0.
+    return 0;
+#endif /* ACE_HAS_PTHREAD_SETAFFINITY_NP */
+  }
+}
+#endif /* TAO_HAS_THREAD_LANE_AFFINITY */
+
+int
+TAO_Thread_Lane_Affinity::cpus (const char *pool_lane, const char *cpus)
+{
+  CPU_List list;
+
+  if (!TAO_Thread_Lane_Affinity::valid_pool_lane (pool_lane)
+      || TAO_Thread_Lane_Affinity::parse_cpus (cpus, list) == -1)
+    {
+      return -1;
+    }
+
+  this->set (pool_lane, list);
+  return 0;
+}
+
+int
+TAO_Thread_Lane_Affinity::numa_node (const char *pool_lane,
+                                     CORBA::ULong node)
+{
+  if (!TAO_Thread_Lane_Affinity::valid_pool_lane (pool_lane))
+    {
+      return -1;
+    }
+
+#if defined (ACE_LINUX)
+  char path[64];
+  ACE_OS::sprintf (path, "/sys/devices/system/node/node%u/cpulist", node);
+
+  FILE *file = ACE_OS::fopen (path, ACE_TEXT ("r"));
+
+  if (file == 0)
+    {
+      if (TAO_debug_level > 0)
+        {
+          TAOLIB_ERROR ((LM_ERROR,
+                         ACE_TEXT ("TAO (%P|%t) - Thread_Lane_Affinity::")
+                         ACE_TEXT ("numa_node, cannot read the processors ")
+                         ACE_TEXT ("of NUMA node %u\n"),
+                         node));
+        }
+      return -1;
+    }
+
+  char line[4096];
+  char *result = ACE_OS::fgets (line, sizeof line, file);
+  ACE_OS::fclose (file);
+
+  CPU_List list;
+
+  if (result == 0 || TAO_Thread_Lane_Affinity::parse_cpus (line, list) == -1)
+    {
+      return -1;
+    }
+
+  this->set (pool_lane, list);
+  return 0;
+#else
+  ACE_UNUSED_ARG (node);
+  ACE_NOTSUP_RETURN (-1);
+#endif /* ACE_LINUX */
+}
+
+bool
+TAO_Thread_Lane_Affinity::find (CORBA::ULong pool,
+                                CORBA::ULong lane,
+                                CPU_List &cpus) const
+{
+  char keys[4][32];
+  ACE_OS::sprintf (keys[0], "%u:%u", pool, lane);
+  ACE_OS::sprintf (keys[1], "%u:*", pool);
+  ACE_OS::sprintf (keys[2], "*:%u", lane);
+  ACE_OS::strcpy (keys[3], "*:*");
+
+  // The entries are few, look for the most specific one first.
+  for (int k = 0; k != 4; ++k)
+    {
+      for (size_t i = 0; i != this->entries_.size (); ++i)
+        {
+          if (this->entries_[i].pool_lane_ == keys[k])
+            {
+              cpus = this->entries_[i].cpus_;
+              return true;
+            }
+        }
+    }
+
+  return false;
+}
+
+int
+TAO_Thread_Lane_Affinity::parse_cpus (const char *list, CPU_List &cpus)
+{
+  cpus.clear ();
+
+  const char *p = list;
+
+  while (true)
+    {
+      char *end = 0;
+      unsigned long first = ACE_OS::strtoul (p, &end, 10);
+
+      if (end == p)
+        {
+          return -1;
+        }
+
+      unsigned long last = first;
+      p = end;
+
+      if (*p == '-')
+        {
+          ++p;
+          last = ACE_OS::strtoul (p, &end, 10);
+
+          if (end == p || last < first)
+            {
+              return -1;
+            }
+
+          p = end;
+        }
+
+      // No system has that many processors, it is a typo.
+      if (last > 65535)
+        {
+          return -1;
+        }
+
+      for (unsigned long cpu = first; cpu <= last; ++cpu)
+        {
+          // Keep the list in ascending order, without duplicates.
+          size_t pos = cpus.size ();
+          while (pos > 0 && cpus[pos - 1] > cpu)
+            --pos;
+
+          if (pos > 0 && cpus[pos - 1] == cpu)
+            continue;
+
+          cpus.push_back (0);
+          for (size_t i = cpus.size () - 1; i > pos; --i)
+            cpus[i] = cpus[i - 1];
+          cpus[pos] = static_cast<CORBA::ULong> (cpu);
+        }
+
+      if (*p == ',')
+        {
+          ++p;
+          continue;
+        }
+
+      // The lists read from sysfs end with a newline.
+      while (*p == '\n' || *p == ' ')
+        ++p;
+
+      return *p == '\0' ? 0 : -1;
+    }
+}
+
+int
+TAO_Thread_Lane_Affinity::bind (const CPU_List &cpus)
+{
+#if defined (TAO_HAS_THREAD_LANE_AFFINITY)
+  cpu_set_t mask;
+  CPU_ZERO (&mask);
+
+  for (size_t i = 0; i != cpus.size (); ++i)
+    {
+      if (cpus[i] >= CPU_SETSIZE)
+        {
+          errno = EINVAL;
+          return -1;
+        }
+
+      CPU_SET (cpus[i], &mask);
+    }
+
+  return ACE_OS::thr_set_affinity (affinity_self (), sizeof mask, &mask);
+#else
+  ACE_UNUSED_ARG (cpus);
+  ACE_NOTSUP_RETURN (-1);
+#endif /* TAO_HAS_THREAD_LANE_AFFINITY */
+}
+
+int
+TAO_Thread_Lane_Affinity::thread_cpus (CPU_List &cpus)
+{
+  cpus.clear ();
+
+#if defined (TAO_HAS_THREAD_LANE_AFFINITY)
+  cpu_set_t mask;
+  CPU_ZERO (&mask);
+
+  if (ACE_OS::thr_get_affinity (affinity_self (), sizeof mask, &mask) == -1)
+    {
+      return -1;
+    }
+
+  for (CORBA::ULong cpu = 0; cpu != CPU_SETSIZE; ++cpu)
+    {
+      if (CPU_ISSET (cpu, &mask))
+        cpus.push_back (cpu);
+    }
+
+  return 0;
+#else
+  ACE_NOTSUP_RETURN (-1);
+#endif /* TAO_HAS_THREAD_LANE_AFFINITY */
+}
+
+void
+TAO_Thread_Lane_Affinity::set (const ACE_CString &pool_lane,
+                               const CPU_List &cpus)
+{
+  for (size_t i = 0; i != this->entries_.size (); ++i)
+    {
+      if (this->entries_[i].pool_lane_ == pool_lane)
+        {
+          this->entries_[i].cpus_ = cpus;
+          return;
+        }
+    }
+
+  Entry entry;
+  entry.pool_lane_ = pool_lane;
+  entry.cpus_ = cpus;
+  this->entries_.push_back (entry);
+}
+
+bool
+TAO_Thread_Lane_Affinity::valid_pool_lane (const char *pool_lane)
+{
+  // Either side of the colon is a number or a '*'.
+  const char *p = pool_lane;
+
+  for (int side = 0; side != 2; ++side)
+    {
+      if (*p == '*')
+        {
+          ++p;
+        }
+      else
+        {
+          char *end = 0;
+          ACE_OS::strtoul (p, &end, 10);
+
+          if (end == p)
+            return false;
+
+          p = end;
+        }
+
+      if (side == 0 && *p++ != ':')
+        return false;
+    }
+
+  return *p == '\0';
+}
+
+TAO_Thread_Lane_Affinity_Guard::TAO_Thread_Lane_Affinity_Guard (
+    const TAO_Thread_Lane_Affinity::CPU_List &cpus)
+  : bound_ (false)
+{
+#if defined (TAO_HAS_THREAD_LANE_AFFINITY)
+  if (cpus.size () == 0)
+    return;
+
+  if (ACE_OS::thr_get_affinity (affinity_self (),
+                                sizeof this->previous_,
+                                &this->previous_) == -1)
+    return;
+
+  this->bound_ = TAO_Thread_Lane_Affinity::bind (cpus) == 0;
+#else
+  ACE_UNUSED_ARG (cpus);
+#endif /* TAO_HAS_THREAD_LANE_AFFINITY */
+}
+
+TAO_Thread_Lane_Affinity_Guard::~TAO_Thread_Lane_Affinity_Guard (void)
+{
+#if defined (TAO_HAS_THREAD_LANE_AFFINITY)
+  if (this->bound_)
+    {
+      ACE_OS::thr_set_affinity (affinity_self (),
+                                sizeof this->previous_,
+                                &this->previous_);
+    }
+#endif /* TAO_HAS_THREAD_LANE_AFFINITY */
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* TAO_HAS_CORBA_MESSAGING && TAO_HAS_CORBA_MESSAGING != 0 */
@@ -0,0 +1,138 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Thread_Lane_Affinity.h
+ *
+ *  Processors and NUMA nodes the threads of the thread lanes run on.
+ */
+//=============================================================================
+
+#ifndef TAO_THREAD_LANE_AFFINITY_H
+#define TAO_THREAD_LANE_AFFINITY_H
+
+#include /**/ "ace/pre.h"
+#include "tao/orbconf.h"
+
+#if defined (TAO_HAS_CORBA_MESSAGING) && TAO_HAS_CORBA_MESSAGING != 0
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/RTCORBA/rtcorba_export.h"
+#include "tao/Basic_Types.h"
+#include "ace/SString.h"
+#include "ace/Vector_T.h"
+#include "ace/os_include/os_sched.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class TAO_Thread_Lane_Affinity
+ *
+ * @brief Table of the processors the threads of the thread lanes are
+ * bound to.
+ *
+ * The lanes are given as <em>thread-pool-id:thread-lane-id</em>, with
+ * <code>*</code> for all pools or all lanes, the same way as the
+ * endpoints of the lanes are given with -ORBLaneListenEndpoints.  A
+ * lane uses the most specific entry that matches it, the pool and
+ * lane ids before <code>pool:*</code>, before <code>*:lane</code>,
+ * before <code>*:*</code>.  Lanes without an entry are not bound.
+ *
+ * The lanes are bound to a NUMA node by binding them to the
+ * processors of the node.  Besides the threads of the lane, the
+ * thread creating the lane is bound to the processors of the lane
+ * while it allocates the resources of the lane, the transport cache,
+ * the reactor and the acceptors.  The CDR allocators are created by
+ * the threads of the lane when they first need them.  On systems that
+ * allocate the pages of memory on the node of the processor first
+ * touching them, like Linux, that keeps the resources of the lane
+ * local to its node.
+ *
+ * The table has to be filled in before the thread pools are created.
+ */
+class TAO_RTCORBA_Export TAO_Thread_Lane_Affinity
+{
+public:
+  /// The processors of a lane, in ascending order.
+  typedef ACE_Vector<CORBA::ULong> CPU_List;
+
+  /// Bind the lanes matching @a pool_lane to the processors in
+  /// @a cpus, a list like "0-7,16-23".  Returns -1 if either is
+  /// malformed.
+  int cpus (const char *pool_lane, const char *cpus);
+
+  /// Bind the lanes matching @a pool_lane to the processors of NUMA
+  /// node @a node.  Returns -1 if the processors of the node cannot be
+  /// found out.
+  int numa_node (const char *pool_lane, CORBA::ULong node);
+
+  /// Find the processors of lane @a lane of thread pool @a pool.
+  /// Returns false if the lane is not bound.
+  bool find (CORBA::ULong pool, CORBA::ULong lane, CPU_List &cpus) const;
+
+  /// Parse a list of processors like "0-7,16-23" into @a cpus.
+  static int parse_cpus (const char *list, CPU_List &cpus);
+
+  /// Bind the calling thread to @a cpus.  Returns -1 if the platform
+  /// does not support it or it fails.
+  static int bind (const CPU_List &cpus);
+
+  /// Get the processors the calling thread is bound to.  Returns -1
+  /// if the platform does not support it or it fails.
+  static int thread_cpus (CPU_List &cpus);
+
+private:
+  /// Set the processors of the lanes matching @a pool_lane.
+  void set (const ACE_CString &pool_lane, const CPU_List &cpus);
+
+  /// Check @a pool_lane is a valid thread-pool-id:thread-lane-id.
+  static bool valid_pool_lane (const char *pool_lane);
+
+  struct Entry
+  {
+    ACE_CString pool_lane_;
+    CPU_List cpus_;
+  };
+
+  ACE_Vector<Entry> entries_;
+};
+
+/**
+ * @class TAO_Thread_Lane_Affinity_Guard
+ *
+ * @brief Bind the calling thread to the processors of a lane for the
+ * lifetime of the guard.
+ *
+ * The resources of the lane that are allocated while the guard
+ * exists are first touched on the processors of the lane.  The
+ * previous binding of the thread is restored when the guard is
+ * destroyed.  Does nothing if @a cpus is empty.
+ */
+class TAO_RTCORBA_Export TAO_Thread_Lane_Affinity_Guard
+{
+public:
+  TAO_Thread_Lane_Affinity_Guard (const TAO_Thread_Lane_Affinity::CPU_List &cpus);
+
+  ~TAO_Thread_Lane_Affinity_Guard (void);
+
+private:
+  TAO_Thread_Lane_Affinity_Guard (const TAO_Thread_Lane_Affinity_Guard &);
+  void operator= (const TAO_Thread_Lane_Affinity_Guard &);
+
+  /// Whether the thread was bound and has to be restored.
+  bool bound_;
+
+  /// The binding of the thread before the guard was created.
+  cpu_set_t previous_;
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* TAO_HAS_CORBA_MESSAGING && TAO_HAS_CORBA_MESSAGING != 0 */
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_THREAD_LANE_AFFINITY_H */
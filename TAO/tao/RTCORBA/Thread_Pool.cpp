@@ -48,6 +48,20 @@ TAO_Thread_Pool_Threads::svc (void)
   if (orb_core.has_shutdown ())
     return 0;
 
+  // Bind the thread to the processors of the lane, the resources the
+  // thread creates for the lane are then local to them.
+  if (this->lane_.cpus ().size () != 0
+      && TAO_Thread_Lane_Affinity::bind (this->lane_.cpus ()) == -1
+      && TAO_debug_level > 0)
+    {
+      TAOLIB_ERROR ((LM_ERROR,
+                     ACE_TEXT ("TAO (%P|%t) - Pool %d Lane %d: ")
+                     ACE_TEXT ("cannot bind thread to the processors ")
+                     ACE_TEXT ("of the lane\n"),
+                     this->lane_.pool ().id (),
+                     this->lane_.id ()));
+    }
+
   // Set TSS resources for this thread.
   TAO_Thread_Pool_Threads::set_tss_resources (orb_core, this->lane_);
 
@@ -173,6 +187,7 @@ TAO_Thread_Lane::TAO_Thread_Lane (TAO_Thread_Pool &pool,
     lifespan_ (lifespan),
     dynamic_thread_time_ (dynamic_thread_time)
 {
+  pool.manager ().lane_affinity ().find (pool.id (), id, this->cpus_);
 }
 
 bool
@@ -283,6 +298,10 @@ TAO_Thread_Lane::validate_and_map_priority (void)
 void
 TAO_Thread_Lane::open (void)
 {
+  // The reactor and the acceptors are allocated on the processors of
+  // the lane.
+  TAO_Thread_Lane_Affinity_Guard affinity (this->cpus_);
+
   // Validate and map priority.
   this->validate_and_map_priority ();
 
@@ -509,6 +528,12 @@ TAO_Thread_Pool::TAO_Thread_Pool (TAO_Thread_Pool_Manager &manager,
   // Create one lane.
   ACE_NEW (this->lanes_,
            TAO_Thread_Lane *[this->number_of_lanes_]);
+
+  // Its transport cache is allocated on the processors of the lane.
+  TAO_Thread_Lane_Affinity::CPU_List cpus;
+  manager.lane_affinity ().find (id, 0, cpus);
+  TAO_Thread_Lane_Affinity_Guard affinity (cpus);
+
   ACE_NEW (this->lanes_[0],
            TAO_Thread_Lane (*this,
                             0,
@@ -554,15 +579,23 @@ TAO_Thread_Pool::TAO_Thread_Pool (TAO_Thread_Pool_Manager &manager,
   for (CORBA::ULong i = 0;
        i != this->number_of_lanes_;
        ++i)
-    ACE_NEW (this->lanes_[i],
-             TAO_Thread_Lane (*this,
-                              i,
-                              lanes[i].lane_priority,
-                              lanes[i].static_threads,
-                              lanes[i].dynamic_threads,
-                              lifespan,
-                              dynamic_thread_time
-                             ));
+    {
+      // Their transport caches are allocated on the processors of
+      // the lanes.
+      TAO_Thread_Lane_Affinity::CPU_List cpus;
+      manager.lane_affinity ().find (id, i, cpus);
+      TAO_Thread_Lane_Affinity_Guard affinity (cpus);
+
+      ACE_NEW (this->lanes_[i],
+               TAO_Thread_Lane (*this,
+                                i,
+                                lanes[i].lane_priority,
+                                lanes[i].static_threads,
+                                lanes[i].dynamic_threads,
+                                lifespan,
+                                dynamic_thread_time
+                               ));
+    }
 }
 
 void
@@ -681,6 +714,7 @@ TAO_Thread_Pool_Manager::TAO_Thread_Pool_Manager (TAO_ORB_Core &orb_core)
   : orb_core_ (orb_core),
     thread_pools_ (),
     thread_pool_id_counter_ (1),
+    lane_affinity_ (),
     lock_ ()
 {
 }
@@ -954,6 +988,12 @@ TAO_Thread_Pool_Manager::orb_core (void) const
   return this->orb_core_;
 }
 
+TAO_Thread_Lane_Affinity &
+TAO_Thread_Pool_Manager::lane_affinity (void)
+{
+  return this->lane_affinity_;
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
 
 #endif /* TAO_HAS_CORBA_MESSAGING && TAO_HAS_CORBA_MESSAGING != 0 */
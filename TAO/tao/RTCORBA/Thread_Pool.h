@@ -23,6 +23,7 @@
 
 #include "tao/RTCORBA/RTCORBA_includeC.h"
 #include "tao/RTCORBA/RT_ORBInitializer.h"
+#include "tao/RTCORBA/Thread_Lane_Affinity.h"
 #include "ace/Hash_Map_Manager.h"
 #include "tao/Thread_Lane_Resources.h"
 #include "tao/New_Leader_Generator.h"
@@ -189,6 +190,10 @@ public:
   TAO_RT_ORBInitializer::TAO_RTCORBA_DT_LifeSpan lifespan (void) const;
 
   ACE_Time_Value const &dynamic_thread_time (void) const;
+
+  /// The processors the threads of the lane are bound to, empty if
+  /// they are not bound.
+  TAO_Thread_Lane_Affinity::CPU_List const &cpus (void) const;
   // @}
 
 private:
@@ -238,6 +243,9 @@ private:
 
   ACE_Time_Value const dynamic_thread_time_;
 
+  /// The processors the threads of the lane are bound to.
+  TAO_Thread_Lane_Affinity::CPU_List cpus_;
+
   /// Lock to guard all members of the lane
   mutable TAO_SYNCH_MUTEX lock_;
 };
@@ -408,6 +416,10 @@ public:
   /// @name Accessors
   // @{
   TAO_ORB_Core &orb_core (void) const;
+
+  /// The processors the threads of the lanes are bound to.  Has to
+  /// be filled in before the thread pools are created.
+  TAO_Thread_Lane_Affinity &lane_affinity (void);
   // @}
 
 private:
@@ -446,6 +458,7 @@ private:
 
   THREAD_POOLS thread_pools_;
   RTCORBA::ThreadpoolId thread_pool_id_counter_;
+  TAO_Thread_Lane_Affinity lane_affinity_;
   TAO_SYNCH_MUTEX lock_;
 };
 
@@ -71,6 +71,13 @@ TAO_Thread_Lane::dynamic_thread_time (void) const
   return this->dynamic_thread_time_;
 }
 
+ACE_INLINE
+TAO_Thread_Lane_Affinity::CPU_List const &
+TAO_Thread_Lane::cpus (void) const
+{
+  return this->cpus_;
+}
+
 ACE_INLINE
 bool
 TAO_Thread_Pool::with_lanes (void) const
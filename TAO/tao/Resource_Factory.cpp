@@ -175,6 +175,36 @@ TAO_Resource_Factory::max_muxed_connections (void) const
   return 0;
 }
 
+int
+TAO_Resource_Factory::connection_pool_maximum (void) const
+{
+  return 0;
+}
+
+int
+TAO_Resource_Factory::connection_pool_minimum (void) const
+{
+  return 1;
+}
+
+bool
+TAO_Resource_Factory::flush_combining (void) const
+{
+  return false;
+}
+
+int
+TAO_Resource_Factory::stub_cache_maximum (void) const
+{
+  return TAO_STUB_CACHE_MAXIMUM;
+}
+
+int
+TAO_Resource_Factory::is_a_cache_maximum (void) const
+{
+  return TAO_IS_A_CACHE_MAXIMUM;
+}
+
 
 int
 TAO_Resource_Factory::get_parser_names (char **&, int &)
@@ -213,6 +213,28 @@ public:
   /// remote endpoint
   virtual int max_muxed_connections (void) const;
 
+  /// Return the number of connections to a remote endpoint that a
+  /// client may pool and balance requests over, 0 if connections are
+  /// not pooled.
+  virtual int connection_pool_maximum (void) const;
+
+  /// Return the number of pooled connections to a remote endpoint
+  /// that are kept when the load drops.
+  virtual int connection_pool_minimum (void) const;
+
+  /// Return true if threads sending synchronous requests or replies
+  /// on the same transport should combine their flushes.
+  virtual bool flush_combining (void) const;
+
+  /// Return the number of demarshaled object references the ORB
+  /// keeps the profiles of, to share with object references
+  /// demarshaled from the same octets, 0 if profiles are not shared.
+  virtual int stub_cache_maximum (void) const;
+
+  /// Return the number of _is_a() answers the ORB keeps for the type
+  /// ids of object references, 0 if they are not cached.
+  virtual int is_a_cache_maximum (void) const;
+
   virtual int get_parser_names (char **&names,
                                 int &number_of_names);
 
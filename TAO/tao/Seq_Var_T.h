@@ -21,6 +21,10 @@
 
 #include "tao/Basic_Types.h"
 
+#if defined (ACE_HAS_CPP11)
+# include <utility>
+#endif /* ACE_HAS_CPP11 */
+
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 /**
@@ -37,6 +41,10 @@ public:
   TAO_Seq_Var_Base_T (void);
   TAO_Seq_Var_Base_T (T *);
   TAO_Seq_Var_Base_T (const TAO_Seq_Var_Base_T<T> &);
+#if defined (ACE_HAS_CPP11)
+  /// Take the sequence held by the other _var.
+  TAO_Seq_Var_Base_T (TAO_Seq_Var_Base_T<T> &&) noexcept;
+#endif /* ACE_HAS_CPP11 */
 
   ~TAO_Seq_Var_Base_T (void);
 
@@ -88,6 +96,13 @@ public:
   TAO_FixedSeq_Var_T & operator= (T *);
   TAO_FixedSeq_Var_T & operator= (const TAO_FixedSeq_Var_T<T> &);
 
+#if defined (ACE_HAS_CPP11)
+  TAO_FixedSeq_Var_T (TAO_FixedSeq_Var_T<T> &&) noexcept;
+  TAO_FixedSeq_Var_T (T &&);
+  TAO_FixedSeq_Var_T & operator= (TAO_FixedSeq_Var_T<T> &&) noexcept;
+  TAO_FixedSeq_Var_T & operator= (T &&);
+#endif /* ACE_HAS_CPP11 */
+
   T_elem operator[] (CORBA::ULong index);
   T_const_elem operator[] (CORBA::ULong index) const;
 
@@ -115,6 +130,11 @@ public:
   TAO_VarSeq_Var_T & operator= (T *);
   TAO_VarSeq_Var_T & operator= (const TAO_VarSeq_Var_T<T> &);
 
+#if defined (ACE_HAS_CPP11)
+  TAO_VarSeq_Var_T (TAO_VarSeq_Var_T<T> &&) noexcept;
+  TAO_VarSeq_Var_T & operator= (TAO_VarSeq_Var_T<T> &&) noexcept;
+#endif /* ACE_HAS_CPP11 */
+
   T_elem operator[] (CORBA::ULong index);
   T_const_elem operator[] (CORBA::ULong index) const;
 
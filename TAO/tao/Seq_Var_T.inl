@@ -15,6 +15,16 @@ TAO_Seq_Var_Base_T<T>::TAO_Seq_Var_Base_T (T * p)
   : ptr_ (p)
 {}
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_Seq_Var_Base_T<T>::TAO_Seq_Var_Base_T (TAO_Seq_Var_Base_T<T> && p) noexcept
+  : ptr_ (p.ptr_)
+{
+  p.ptr_ = 0;
+}
+#endif /* ACE_HAS_CPP11 */
+
 template<typename T>
 ACE_INLINE
 TAO_Seq_Var_Base_T<T>::~TAO_Seq_Var_Base_T (void)
@@ -143,6 +153,34 @@ TAO_FixedSeq_Var_T<T>::operator= (T * p)
   return *this;
 }
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_FixedSeq_Var_T<T>::TAO_FixedSeq_Var_T (TAO_FixedSeq_Var_T<T> && p) noexcept
+  : TAO_Seq_Var_Base_T<T> (std::move (p))
+{}
+
+template<typename T>
+ACE_INLINE
+TAO_FixedSeq_Var_T<T>::TAO_FixedSeq_Var_T (T && p)
+{
+  ACE_NEW (this->ptr_,
+           T (std::move (p)));
+}
+
+template<typename T>
+ACE_INLINE
+TAO_FixedSeq_Var_T<T> &
+TAO_FixedSeq_Var_T<T>::operator= (TAO_FixedSeq_Var_T<T> && p) noexcept
+{
+  T * old_ptr = this->ptr_;
+  this->ptr_ = p.ptr_;
+  p.ptr_ = 0;
+  delete old_ptr;
+  return *this;
+}
+#endif /* ACE_HAS_CPP11 */
+
 template<typename T>
 ACE_INLINE
 typename TAO_FixedSeq_Var_T<T>::T_elem
@@ -191,6 +229,26 @@ TAO_VarSeq_Var_T<T>::operator= (T * p)
   return *this;
 }
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_VarSeq_Var_T<T>::TAO_VarSeq_Var_T (TAO_VarSeq_Var_T<T> && p) noexcept
+  : TAO_Seq_Var_Base_T<T> (std::move (p))
+{}
+
+template<typename T>
+ACE_INLINE
+TAO_VarSeq_Var_T<T> &
+TAO_VarSeq_Var_T<T>::operator= (TAO_VarSeq_Var_T<T> && p) noexcept
+{
+  T * old_ptr = this->ptr_;
+  this->ptr_ = p.ptr_;
+  p.ptr_ = 0;
+  delete old_ptr;
+  return *this;
+}
+#endif /* ACE_HAS_CPP11 */
+
 // Variable-size types only
 template<typename T>
 ACE_INLINE
@@ -31,6 +31,7 @@ enum TAO_Demux_Strategy
   TAO_LINEAR,
   TAO_DYNAMIC_HASH,
   TAO_ACTIVE_DEMUX,
+  TAO_FLAT_HASH,
   TAO_USER_DEFINED
 };
 
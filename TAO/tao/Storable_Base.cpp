@@ -29,6 +29,18 @@ TAO::Storable_Base::remove (void)
   this->do_remove ();
 }
 
+int
+TAO::Storable_Base::append (void)
+{
+  return -1;
+}
+
+bool
+TAO::Storable_Base::appendable (void) const
+{
+  return false;
+}
+
 bool
 TAO::Storable_Base::use_backup ()
 {
@@ -95,6 +95,15 @@ namespace TAO
 
     virtual void rewind (void) = 0;
 
+    /// Position the stream after the stored data so that what is
+    /// written next is added to it instead of replacing it.
+    /// Returns -1 if the stream cannot append, the default.
+    virtual int append (void);
+
+    /// Can append () be used?  When it cannot, data found after what
+    /// the last writer wrote may be left over from an earlier write.
+    virtual bool appendable (void) const;
+
     virtual bool flush (void) = 0;
 
     /// Force write of storable data to storage.
@@ -0,0 +1,1006 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ * @file  Storable_LogStream.cpp
+ */
+//=============================================================================
+
+#include "tao/Storable_LogStream.h"
+#include "tao/debug.h"
+
+#include "ace/ACE.h"
+#include "ace/Auto_Ptr.h"
+#include "ace/Functor_String.h"
+#include "ace/Guard_T.h"
+#include "ace/Hash_Map_Manager_T.h"
+#include "ace/Null_Mutex.h"
+#include "ace/OS_NS_fcntl.h"
+#include "ace/OS_NS_stdio.h"
+#include "ace/OS_NS_string.h"
+#include "ace/OS_NS_sys_stat.h"
+#include "ace/OS_NS_time.h"
+#include "ace/OS_NS_unistd.h"
+#include "ace/Truncate.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace
+{
+  /// Every record starts with the magic number, the length of the
+  /// record body and the CRC-32 of the body, all of them big endian.
+  ACE_UINT32 const record_magic = 0x54534c52;
+  size_t const header_size = 12;
+
+  /// The body holds the operation, the time stamp, and the key and
+  /// data, each one preceded by its length.
+  size_t const body_overhead = 17;
+
+  /// Do not bother compacting shards smaller than this.
+  ACE_OFF_T const compact_threshold = 64 * 1024;
+
+  enum Record_Op
+  {
+    RECORD_PUT = 1,
+    RECORD_APPEND = 2,
+    RECORD_REMOVE = 3
+  };
+
+  void put_u32 (ACE_CString & buf, ACE_UINT32 i)
+  {
+    char bytes[4];
+    bytes[0] = static_cast<char> (i >> 24);
+    bytes[1] = static_cast<char> (i >> 16);
+    bytes[2] = static_cast<char> (i >> 8);
+    bytes[3] = static_cast<char> (i);
+    buf.append (bytes, sizeof bytes);
+  }
+
+  void put_u64 (ACE_CString & buf, ACE_UINT64 i)
+  {
+    put_u32 (buf, static_cast<ACE_UINT32> (i >> 32));
+    put_u32 (buf, static_cast<ACE_UINT32> (i));
+  }
+
+  ACE_UINT32 get_u32 (const char * bytes)
+  {
+    const unsigned char *b = reinterpret_cast<const unsigned char *> (bytes);
+    return (static_cast<ACE_UINT32> (b[0]) << 24)
+      | (static_cast<ACE_UINT32> (b[1]) << 16)
+      | (static_cast<ACE_UINT32> (b[2]) << 8)
+      | static_cast<ACE_UINT32> (b[3]);
+  }
+
+  ACE_UINT64 get_u64 (const char * bytes)
+  {
+    return (static_cast<ACE_UINT64> (get_u32 (bytes)) << 32)
+      | get_u32 (bytes + 4);
+  }
+
+  /// Add a complete record to @a buf.
+  void put_record (ACE_CString & buf,
+                   char op,
+                   time_t stamp,
+                   const ACE_CString & key,
+                   const ACE_CString & data)
+  {
+    ACE_CString body;
+    body.append (&op, 1);
+    put_u64 (body, static_cast<ACE_UINT64> (stamp));
+    put_u32 (body, ACE_Utils::truncate_cast<ACE_UINT32> (key.length ()));
+    body.append (key.c_str (), key.length ());
+    put_u32 (body, ACE_Utils::truncate_cast<ACE_UINT32> (data.length ()));
+    body.append (data.c_str (), data.length ());
+
+    put_u32 (buf, record_magic);
+    put_u32 (buf, ACE_Utils::truncate_cast<ACE_UINT32> (body.length ()));
+    put_u32 (buf, ACE::crc32 (body.c_str (), body.length ()));
+    buf.append (body.c_str (), body.length ());
+  }
+
+  size_t record_size (const ACE_CString & key, size_t data_len)
+  {
+    return header_size + body_overhead + key.length () + data_len;
+  }
+
+  /// The region of the lock file used to lock a storable, byte 0
+  /// protects the log itself.
+  ACE_OFF_T key_region (const ACE_CString & key)
+  {
+    return 1 + static_cast<ACE_OFF_T> (
+      ACE::hash_pjw (key.c_str (), key.length ()) % 0x3fffffff);
+  }
+}
+
+namespace TAO
+{
+  /**
+   * @brief One of the log files of a Storable_LogFactory.
+   *
+   * The shard keeps the current data of all its storables in memory.
+   * The log is only read at start up and when another process has
+   * appended records to it, which is detected by comparing the size
+   * of the file with the offset of the last record seen.  A process
+   * compacting the log writes the live records to a new file and
+   * renames it over the log, the other processes notice the new inode
+   * and load it again.
+   */
+  class Storable_LogShard
+  {
+  public:
+    Storable_LogShard (const ACE_CString & path);
+
+    ~Storable_LogShard ();
+
+    /// Open the lock file and load the log.
+    int open (void);
+
+    /// Load the records that other processes have added to the log.
+    int refresh (void);
+
+    /// Look for @a key, copying its data and stamp when found.
+    /// Returns 0 if the storable exists, -1 otherwise.
+    int find (const ACE_CString & key, ACE_CString * data, time_t * stamp);
+
+    /// Add a record for @a key to the log.  When @a if_absent is set
+    /// the record is only added if the storable does not exist yet.
+    int commit (char op,
+                const ACE_CString & key,
+                const ACE_CString & data,
+                bool sync,
+                bool if_absent = false);
+
+    /// Force the log to storage.
+    int sync (void);
+
+    /// Lock and unlock the storable @a key for other processes.
+    int lock_key (const ACE_CString & key, bool shared);
+    int unlock_key (const ACE_CString & key);
+
+  private:
+    struct Entry
+    {
+      ACE_CString data_;
+      time_t stamp_;
+    };
+
+    typedef ACE_Hash_Map_Manager_Ex<ACE_CString,
+                                    Entry *,
+                                    ACE_Hash<ACE_CString>,
+                                    ACE_Equal_To<ACE_CString>,
+                                    ACE_Null_Mutex> Entry_Map;
+
+    /// Bring the memory image up to date with the log, @a torn is set
+    /// if the log ends with an incomplete record.
+    int refresh_i (bool & torn);
+
+    /// Open the log again and replay all of it.
+    int reload_i (bool & torn);
+
+    /// Replay the records between offset_ and @a end.
+    int replay_i (ACE_OFF_T end, bool & torn);
+
+    void apply_i (char op,
+                  const ACE_CString & key,
+                  const char * data,
+                  size_t len,
+                  time_t stamp);
+
+    /// Replace the log with one holding only the live records.
+    int compact_i (void);
+
+    void clear_i (void);
+
+    /// Lock byte 0 of the lock file, shared for reading the log and
+    /// exclusive for changing it.
+    int lock_log (bool exclusive);
+    int unlock_log (void);
+
+    ACE_CString path_;
+    ACE_CString lock_path_;
+
+    TAO_SYNCH_MUTEX lock_;
+    ACE_OS::ace_flock_t filelock_;
+    ACE_HANDLE handle_;
+
+    /// Used to detect that the log was compacted by another process.
+    ACE_UINT64 inode_;
+
+    /// The end of the last valid record
+    ACE_OFF_T offset_;
+
+    /// The size that the log would have after a compaction.
+    size_t live_bytes_;
+
+    Entry_Map entries_;
+  };
+}
+
+TAO::Storable_LogShard::Storable_LogShard (const ACE_CString & path)
+  : path_ (path + ".log")
+  , lock_path_ (path + ".lock")
+  , handle_ (ACE_INVALID_HANDLE)
+  , inode_ (0)
+  , offset_ (0)
+  , live_bytes_ (0)
+{
+  filelock_.handle_ = ACE_INVALID_HANDLE;
+  filelock_.lockname_ = 0;
+}
+
+TAO::Storable_LogShard::~Storable_LogShard ()
+{
+  this->clear_i ();
+  if (this->handle_ != ACE_INVALID_HANDLE)
+    ACE_OS::close (this->handle_);
+#ifndef ACE_WIN32
+  if (this->filelock_.handle_ != ACE_INVALID_HANDLE)
+    ACE_OS::flock_destroy (&this->filelock_, 0);
+#endif
+}
+
+int
+TAO::Storable_LogShard::open (void)
+{
+#ifndef ACE_WIN32
+  if (ACE_OS::flock_init (&this->filelock_, O_RDWR | O_CREAT,
+                          ACE_TEXT_CHAR_TO_TCHAR (this->lock_path_.c_str ()),
+                          0666) != 0)
+    TAOLIB_ERROR_RETURN ((LM_ERROR,
+                          ACE_TEXT ("(%P|%t) Storable_LogShard::open ")
+                          ACE_TEXT ("Cannot open lock file %C: %p\n"),
+                          this->lock_path_.c_str (),
+                          ACE_TEXT ("ACE_OS::flock_init")),
+                         -1);
+#endif
+  return this->refresh ();
+}
+
+int
+TAO::Storable_LogShard::refresh (void)
+{
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->lock_, -1);
+
+  if (this->lock_log (false) != 0)
+    return -1;
+  bool torn = false;
+  int const result = this->refresh_i (torn);
+  this->unlock_log ();
+  return result;
+}
+
+int
+TAO::Storable_LogShard::find (const ACE_CString & key,
+                              ACE_CString * data,
+                              time_t * stamp)
+{
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->lock_, -1);
+
+  Entry *entry = 0;
+  if (this->entries_.find (key, entry) != 0)
+    return -1;
+  if (data != 0)
+    *data = entry->data_;
+  if (stamp != 0)
+    *stamp = entry->stamp_;
+  return 0;
+}
+
+int
+TAO::Storable_LogShard::commit (char op,
+                                const ACE_CString & key,
+                                const ACE_CString & data,
+                                bool sync,
+                                bool if_absent)
+{
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->lock_, -1);
+
+  if (this->lock_log (true) != 0)
+    return -1;
+
+  bool torn = false;
+  int result = this->refresh_i (torn);
+
+  // Nobody else can be writing, an incomplete record at the end of
+  // the log was left by a crash and is dropped.
+  if (result == 0 && torn)
+    result = ACE_OS::ftruncate (this->handle_, this->offset_);
+
+  Entry *entry = 0;
+  if (result == 0
+      && !(if_absent && this->entries_.find (key, entry) == 0))
+    {
+      time_t const stamp = ACE_OS::time ();
+      ACE_CString record;
+      put_record (record, op, stamp, key, data);
+
+      ssize_t const n = ACE_OS::pwrite (this->handle_,
+                                        record.c_str (),
+                                        record.length (),
+                                        this->offset_);
+      if (n != static_cast<ssize_t> (record.length ()))
+        {
+          if (TAO_debug_level > 0)
+            {
+              TAOLIB_ERROR ((LM_ERROR,
+                             ACE_TEXT ("(%P|%t) Storable_LogShard::commit ")
+                             ACE_TEXT ("Cannot write to %C: %p\n"),
+                             this->path_.c_str (),
+                             ACE_TEXT ("ACE_OS::pwrite")));
+            }
+          result = -1;
+        }
+      else
+        {
+          this->offset_ += record.length ();
+          this->apply_i (op, key, data.c_str (), data.length (), stamp);
+
+          if (sync)
+            result = ACE_OS::fsync (this->handle_);
+
+          if (result == 0
+              && this->offset_ > compact_threshold
+              && this->offset_ > static_cast<ACE_OFF_T> (2 * this->live_bytes_)
+              && this->compact_i () != 0
+              && TAO_debug_level > 0)
+            {
+              TAOLIB_ERROR ((LM_ERROR,
+                             ACE_TEXT ("(%P|%t) Storable_LogShard::commit ")
+                             ACE_TEXT ("Cannot compact %C: %p\n"),
+                             this->path_.c_str (),
+                             ACE_TEXT ("compact")));
+            }
+        }
+    }
+
+  this->unlock_log ();
+  return result;
+}
+
+int
+TAO::Storable_LogShard::sync (void)
+{
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->lock_, -1);
+
+  return ACE_OS::fsync (this->handle_);
+}
+
+int
+TAO::Storable_LogShard::lock_key (const ACE_CString & key, bool shared)
+{
+#if defined (ACE_WIN32)
+  ACE_UNUSED_ARG (key);
+  ACE_UNUSED_ARG (shared);
+  return 0;
+#else
+  if (shared)
+    return ACE_OS::flock_rdlock (&this->filelock_, SEEK_SET,
+                                 key_region (key), 1);
+  return ACE_OS::flock_wrlock (&this->filelock_, SEEK_SET,
+                               key_region (key), 1);
+#endif
+}
+
+int
+TAO::Storable_LogShard::unlock_key (const ACE_CString & key)
+{
+#if defined (ACE_WIN32)
+  ACE_UNUSED_ARG (key);
+  return 0;
+#else
+  return ACE_OS::flock_unlock (&this->filelock_, SEEK_SET,
+                               key_region (key), 1);
+#endif
+}
+
+int
+TAO::Storable_LogShard::refresh_i (bool & torn)
+{
+  ACE_stat st;
+  if (ACE_OS::stat (this->path_.c_str (), &st) != 0
+      || this->handle_ == ACE_INVALID_HANDLE
+      || static_cast<ACE_UINT64> (st.st_ino) != this->inode_
+      || st.st_size < this->offset_)
+    {
+      return this->reload_i (torn);
+    }
+
+  if (st.st_size > this->offset_)
+    return this->replay_i (st.st_size, torn);
+
+  return 0;
+}
+
+int
+TAO::Storable_LogShard::reload_i (bool & torn)
+{
+  if (this->handle_ != ACE_INVALID_HANDLE)
+    ACE_OS::close (this->handle_);
+
+  this->clear_i ();
+  this->offset_ = 0;
+  this->handle_ = ACE_OS::open (this->path_.c_str (),
+                                O_RDWR | O_CREAT | O_BINARY,
+                                0666);
+  ACE_stat st;
+  if (this->handle_ == ACE_INVALID_HANDLE
+      || ACE_OS::fstat (this->handle_, &st) != 0)
+    TAOLIB_ERROR_RETURN ((LM_ERROR,
+                          ACE_TEXT ("(%P|%t) Storable_LogShard::reload ")
+                          ACE_TEXT ("Cannot open log %C: %p\n"),
+                          this->path_.c_str (),
+                          ACE_TEXT ("ACE_OS::open")),
+                         -1);
+
+  this->inode_ = static_cast<ACE_UINT64> (st.st_ino);
+  return this->replay_i (st.st_size, torn);
+}
+
+int
+TAO::Storable_LogShard::replay_i (ACE_OFF_T end, bool & torn)
+{
+  size_t const len = static_cast<size_t> (end - this->offset_);
+  ACE_Auto_Basic_Array_Ptr<char> buf (new char[len]);
+  ssize_t const n = ACE_OS::pread (this->handle_, buf.get (), len,
+                                   this->offset_);
+  if (n < 0)
+    return -1;
+
+  size_t const available = static_cast<size_t> (n);
+  size_t pos = 0;
+  torn = false;
+  while (pos < available)
+    {
+      const char *record = buf.get () + pos;
+      size_t const rest = available - pos;
+      if (rest < header_size || get_u32 (record) != record_magic)
+        {
+          torn = true;
+          break;
+        }
+
+      size_t const body_len = get_u32 (record + 4);
+      const char *body = record + header_size;
+      if (body_len < body_overhead
+          || body_len > rest - header_size
+          || ACE::crc32 (body, body_len) != get_u32 (record + 8))
+        {
+          torn = true;
+          break;
+        }
+
+      size_t const key_len = get_u32 (body + 9);
+      if (key_len > body_len - body_overhead
+          || get_u32 (body + 13 + key_len) != body_len - body_overhead - key_len)
+        {
+          torn = true;
+          break;
+        }
+
+      this->apply_i (body[0],
+                     ACE_CString (body + 13, key_len),
+                     body + body_overhead + key_len,
+                     body_len - body_overhead - key_len,
+                     static_cast<time_t> (get_u64 (body + 1)));
+      pos += header_size + body_len;
+    }
+
+  this->offset_ += pos;
+  return 0;
+}
+
+void
+TAO::Storable_LogShard::apply_i (char op,
+                                 const ACE_CString & key,
+                                 const char * data,
+                                 size_t len,
+                                 time_t stamp)
+{
+  if (op != RECORD_PUT && op != RECORD_APPEND && op != RECORD_REMOVE)
+    return;
+
+  Entry *entry = 0;
+  if (this->entries_.find (key, entry) == 0)
+    {
+      this->live_bytes_ -= record_size (key, entry->data_.length ());
+      if (op == RECORD_REMOVE)
+        {
+          this->entries_.unbind (key);
+          delete entry;
+          return;
+        }
+    }
+  else
+    {
+      if (op == RECORD_REMOVE)
+        return;
+      ACE_NEW (entry, Entry);
+      this->entries_.bind (key, entry);
+    }
+
+  if (op == RECORD_PUT)
+    entry->data_.set (data, len, true);
+  else
+    entry->data_.append (data, len);
+  entry->stamp_ = stamp;
+  this->live_bytes_ += record_size (key, entry->data_.length ());
+}
+
+int
+TAO::Storable_LogShard::compact_i (void)
+{
+  ACE_CString image;
+  for (Entry_Map::iterator i = this->entries_.begin ();
+       i != this->entries_.end ();
+       ++i)
+    {
+      put_record (image, RECORD_PUT, (*i).int_id_->stamp_,
+                  (*i).ext_id_, (*i).int_id_->data_);
+    }
+
+  ACE_CString const tmp_path = this->path_ + ".tmp";
+  ACE_HANDLE tmp = ACE_OS::open (tmp_path.c_str (),
+                                 O_RDWR | O_CREAT | O_TRUNC | O_BINARY,
+                                 0666);
+  if (tmp == ACE_INVALID_HANDLE)
+    return -1;
+
+  bool const written =
+    ACE::write_n (tmp, image.c_str (), image.length ())
+      == static_cast<ssize_t> (image.length ())
+    && ACE_OS::fsync (tmp) == 0;
+  ACE_OS::close (tmp);
+
+  if (!written
+      || ACE_OS::rename (tmp_path.c_str (), this->path_.c_str ()) != 0)
+    {
+      ACE_OS::unlink (tmp_path.c_str ());
+      return -1;
+    }
+
+  ACE_OS::close (this->handle_);
+  this->handle_ = ACE_OS::open (this->path_.c_str (), O_RDWR | O_BINARY);
+  ACE_stat st;
+  if (this->handle_ == ACE_INVALID_HANDLE
+      || ACE_OS::fstat (this->handle_, &st) != 0)
+    {
+      // The next refresh will open the log again.
+      this->inode_ = 0;
+      return -1;
+    }
+
+  this->inode_ = static_cast<ACE_UINT64> (st.st_ino);
+  this->offset_ = static_cast<ACE_OFF_T> (image.length ());
+  return 0;
+}
+
+void
+TAO::Storable_LogShard::clear_i (void)
+{
+  for (Entry_Map::iterator i = this->entries_.begin ();
+       i != this->entries_.end ();
+       ++i)
+    {
+      delete (*i).int_id_;
+    }
+  this->entries_.unbind_all ();
+  this->live_bytes_ = 0;
+}
+
+int
+TAO::Storable_LogShard::lock_log (bool exclusive)
+{
+#if defined (ACE_WIN32)
+  ACE_UNUSED_ARG (exclusive);
+  return 0;
+#else
+  if (exclusive)
+    return ACE_OS::flock_wrlock (&this->filelock_, SEEK_SET, 0, 1);
+  return ACE_OS::flock_rdlock (&this->filelock_, SEEK_SET, 0, 1);
+#endif
+}
+
+int
+TAO::Storable_LogShard::unlock_log (void)
+{
+#if defined (ACE_WIN32)
+  return 0;
+#else
+  return ACE_OS::flock_unlock (&this->filelock_, SEEK_SET, 0, 1);
+#endif
+}
+
+//------------------------------------------------
+
+TAO::Storable_LogStream::Storable_LogStream (Storable_LogShard & shard,
+                                             const ACE_CString & key,
+                                             const char * mode,
+                                             bool use_backup)
+  : Storable_Base (use_backup, false)
+  , shard_ (shard)
+  , key_ (key)
+  , mode_ (mode)
+  , replace_ (true)
+  , dirty_ (false)
+  , image_valid_ (false)
+  , read_pos_ (0)
+{
+}
+
+TAO::Storable_LogStream::~Storable_LogStream ()
+{
+  this->close ();
+}
+
+int
+TAO::Storable_LogStream::exists ()
+{
+  this->shard_.refresh ();
+  return this->shard_.find (this->key_, 0, 0) == 0;
+}
+
+int
+TAO::Storable_LogStream::open ()
+{
+  if (this->shard_.refresh () != 0)
+    return -1;
+
+  if (this->shard_.find (this->key_, 0, 0) != 0)
+    {
+      if (ACE_OS::strchr (this->mode_.c_str (), 'c') == 0)
+        {
+          if (TAO_debug_level > 0)
+            {
+              TAOLIB_ERROR ((LM_ERROR,
+                             ACE_TEXT ("(%P|%t) Storable_LogStream::open ")
+                             ACE_TEXT ("Cannot open %C for mode %C\n"),
+                             this->key_.c_str (), this->mode_.c_str ()));
+            }
+          return -1;
+        }
+
+      // Create an empty storable, as opening a new flat file would.
+      if (this->shard_.commit (RECORD_PUT, this->key_, ACE_CString (),
+                               false, true) != 0)
+        return -1;
+    }
+
+  this->rewind ();
+  this->clear ();
+  return 0;
+}
+
+int
+TAO::Storable_LogStream::close ()
+{
+  int const result = this->commit (false);
+  this->image_.clear (true);
+  this->image_valid_ = false;
+  return result;
+}
+
+int
+TAO::Storable_LogStream::flock (int, int, int)
+{
+  bool const shared = ACE_OS::strcmp (this->mode_.c_str (), "r") == 0;
+  int result = this->shard_.lock_key (this->key_, shared);
+  if (result != 0)
+    {
+      if (TAO_debug_level > 0)
+        {
+          TAOLIB_ERROR ((LM_ERROR,
+                         ACE_TEXT ("TAO (%P|%t) - Storable_LogStream::flock, ")
+                         ACE_TEXT ("%p\n"), ACE_TEXT ("lock")));
+        }
+      return result;
+    }
+
+  // Pick up what the previous owner of the lock committed.
+  result = this->shard_.refresh ();
+  this->image_valid_ = false;
+  return result;
+}
+
+int
+TAO::Storable_LogStream::funlock (int, int, int)
+{
+  return this->shard_.unlock_key (this->key_);
+}
+
+time_t
+TAO::Storable_LogStream::last_changed (void)
+{
+  time_t stamp = 0;
+  if (this->shard_.refresh () != 0
+      || this->shard_.find (this->key_, 0, &stamp) != 0)
+    {
+      throw Storable_Exception (this->key_);
+    }
+  return stamp;
+}
+
+void
+TAO::Storable_LogStream::rewind (void)
+{
+  this->pending_.clear ();
+  this->replace_ = true;
+  this->dirty_ = false;
+  this->image_valid_ = false;
+  this->read_pos_ = 0;
+}
+
+int
+TAO::Storable_LogStream::append (void)
+{
+  this->pending_.clear ();
+  this->replace_ = false;
+  this->dirty_ = false;
+  return 0;
+}
+
+bool
+TAO::Storable_LogStream::appendable (void) const
+{
+  return true;
+}
+
+bool
+TAO::Storable_LogStream::flush (void)
+{
+  return this->commit (false) != 0;
+}
+
+int
+TAO::Storable_LogStream::sync (void)
+{
+  return this->commit (true);
+}
+
+int
+TAO::Storable_LogStream::commit (bool sync)
+{
+  if (!this->dirty_)
+    return sync ? this->shard_.sync () : 0;
+
+  int const result =
+    this->shard_.commit (this->replace_ ? RECORD_PUT : RECORD_APPEND,
+                         this->key_, this->pending_, sync);
+
+  // Whatever is written next goes after the committed data.
+  this->pending_.clear ();
+  this->replace_ = false;
+  this->dirty_ = false;
+  this->image_valid_ = false;
+  return result;
+}
+
+void
+TAO::Storable_LogStream::get (size_t size, char * bytes)
+{
+  if (!this->image_valid_)
+    {
+      if (this->shard_.find (this->key_, &this->image_, 0) != 0)
+        this->throw_on_read_error (badbit);
+      this->image_valid_ = true;
+    }
+
+  if (size > this->image_.length () - this->read_pos_)
+    this->throw_on_read_error (eofbit);
+
+  ACE_OS::memcpy (bytes, this->image_.c_str () + this->read_pos_, size);
+  this->read_pos_ += size;
+}
+
+TAO::Storable_Base &
+TAO::Storable_LogStream::operator << (const ACE_CString& str)
+{
+  put_u32 (this->pending_,
+           ACE_Utils::truncate_cast<ACE_UINT32> (str.length ()));
+  this->pending_.append (str.c_str (), str.length ());
+  this->dirty_ = true;
+  return *this;
+}
+
+TAO::Storable_Base &
+TAO::Storable_LogStream::operator >> (ACE_CString& str)
+{
+  ACE_UINT32 len = 0;
+  *this >> len;
+  if (len > this->image_.length () - this->read_pos_)
+    this->throw_on_read_error (eofbit);
+
+  str.set (this->image_.c_str () + this->read_pos_, len, true);
+  this->read_pos_ += len;
+  return *this;
+}
+
+TAO::Storable_Base &
+TAO::Storable_LogStream::operator << (ACE_UINT32 i)
+{
+  put_u32 (this->pending_, i);
+  this->dirty_ = true;
+  return *this;
+}
+
+TAO::Storable_Base &
+TAO::Storable_LogStream::operator >> (ACE_UINT32 &i)
+{
+  char bytes[4];
+  this->get (sizeof bytes, bytes);
+  i = get_u32 (bytes);
+  return *this;
+}
+
+TAO::Storable_Base &
+TAO::Storable_LogStream::operator << (ACE_UINT64 i)
+{
+  put_u64 (this->pending_, i);
+  this->dirty_ = true;
+  return *this;
+}
+
+TAO::Storable_Base &
+TAO::Storable_LogStream::operator >> (ACE_UINT64 &i)
+{
+  char bytes[8];
+  this->get (sizeof bytes, bytes);
+  i = get_u64 (bytes);
+  return *this;
+}
+
+TAO::Storable_Base &
+TAO::Storable_LogStream::operator << (ACE_INT32 i)
+{
+  return *this << static_cast<ACE_UINT32> (i);
+}
+
+TAO::Storable_Base &
+TAO::Storable_LogStream::operator >> (ACE_INT32 &i)
+{
+  ACE_UINT32 u = 0;
+  *this >> u;
+  i = static_cast<ACE_INT32> (u);
+  return *this;
+}
+
+TAO::Storable_Base &
+TAO::Storable_LogStream::operator << (ACE_INT64 i)
+{
+  return *this << static_cast<ACE_UINT64> (i);
+}
+
+TAO::Storable_Base &
+TAO::Storable_LogStream::operator >> (ACE_INT64 &i)
+{
+  ACE_UINT64 u = 0;
+  *this >> u;
+  i = static_cast<ACE_INT64> (u);
+  return *this;
+}
+
+TAO::Storable_Base &
+TAO::Storable_LogStream::operator << (const TAO_OutputCDR & cdr)
+{
+  unsigned int const length =
+    ACE_Utils::truncate_cast<unsigned int> (cdr.total_length ());
+  *this << length;
+  for (const ACE_Message_Block *i = cdr.begin (); i != 0; i = i->cont ())
+    {
+      this->write (i->length (), i->rd_ptr ());
+    }
+  return *this;
+}
+
+size_t
+TAO::Storable_LogStream::write (size_t size, const char * bytes)
+{
+  this->pending_.append (bytes, size);
+  this->dirty_ = true;
+  return 1;
+}
+
+size_t
+TAO::Storable_LogStream::read (size_t size, char * bytes)
+{
+  try
+    {
+      this->get (size, bytes);
+    }
+  catch (const Storable_Read_Exception &)
+    {
+      return 0;
+    }
+  return 1;
+}
+
+int
+TAO::Storable_LogStream::restore_backup ()
+{
+  return -1;
+}
+
+void
+TAO::Storable_LogStream::do_remove ()
+{
+  this->shard_.commit (RECORD_REMOVE, this->key_, ACE_CString (), false);
+}
+
+void
+TAO::Storable_LogStream::remove_backup ()
+{
+}
+
+int
+TAO::Storable_LogStream::create_backup ()
+{
+  return 0;
+}
+
+void
+TAO::Storable_LogStream::throw_on_read_error (Storable_State state)
+{
+  this->setstate (state);
+
+  if (!this->good ())
+    {
+      throw Storable_Read_Exception (this->rdstate (), this->key_);
+    }
+}
+
+//------------------------------------------------
+
+TAO::Storable_LogFactory::Storable_LogFactory (const ACE_CString & directory,
+                                               size_t shards,
+                                               bool use_backup)
+  : Storable_Factory ()
+  , directory_ (directory)
+  , nshards_ (shards == 0 ? 1 : shards)
+  , shards_ (0)
+  , use_backup_ (use_backup)
+{
+  ACE_NEW (this->shards_, Storable_LogShard *[this->nshards_]);
+  for (size_t i = 0; i < this->nshards_; ++i)
+    {
+      char name[32];
+      ACE_OS::sprintf (name, "/shard_%lu", static_cast<unsigned long> (i));
+      ACE_NEW (this->shards_[i], Storable_LogShard (this->directory_ + name));
+      this->shards_[i]->open ();
+    }
+}
+
+TAO::Storable_LogFactory::~Storable_LogFactory ()
+{
+  if (this->shards_ != 0)
+    {
+      for (size_t i = 0; i < this->nshards_; ++i)
+        {
+          delete this->shards_[i];
+        }
+      delete [] this->shards_;
+    }
+}
+
+const ACE_CString &
+TAO::Storable_LogFactory::get_directory () const
+{
+  return directory_;
+}
+
+TAO::Storable_Base *
+TAO::Storable_LogFactory::create_stream (const ACE_CString & file,
+                                         const char * mode,
+                                         bool )
+{
+  size_t const index =
+    ACE::hash_pjw (file.c_str (), file.length ()) % this->nshards_;
+  TAO::Storable_Base *stream = 0;
+  ACE_NEW_RETURN (stream,
+                  TAO::Storable_LogStream (*this->shards_[index],
+                                           file,
+                                           mode,
+                                           this->use_backup_),
+                  0);
+  return stream;
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,187 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ * @file  Storable_LogStream.h
+ *
+ * A Storable_Factory that keeps all the storables in a small number
+ * of append-only log files.
+ */
+//=============================================================================
+
+#ifndef STORABLE_LOGSTREAM_H
+#define STORABLE_LOGSTREAM_H
+
+#include /**/ "ace/pre.h"
+#include "ace/config-lite.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+#pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/Storable_Base.h"
+#include "tao/Storable_Factory.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  class Storable_LogShard;
+
+  /**
+   * @brief A Storable_Base that lives in a shard of a Storable_LogFactory.
+   *
+   * The data written to the stream is buffered in memory and is
+   * committed to the shard log as a single record when the stream is
+   * flushed, synced or closed.  Data written after rewind () replaces the
+   * stored data, data written after append () is added to it, so a
+   * caller that only changes a small part of the storable does not
+   * have to rewrite all of it.
+   * Reads are served from the in-memory image of the shard, the log
+   * is only read when another process has added records to it.
+   */
+  class TAO_Export Storable_LogStream : public Storable_Base
+  {
+  public:
+
+    Storable_LogStream (Storable_LogShard & shard,
+                        const ACE_CString & key,
+                        const char * mode,
+                        bool use_backup = Storable_Base::use_backup_default);
+
+    virtual ~Storable_LogStream ();
+
+    /// Check if the storable is present in the shard
+    virtual int exists ();
+
+    virtual int open ();
+
+    /// Commit any pending data
+    virtual int close ();
+
+    /// Lock the storable, other storables in the same shard are not
+    /// affected.
+    virtual int flock (int whence, int start, int len);
+
+    virtual int funlock (int whence, int start, int len);
+
+    /// Returns the last time the storable was committed
+    virtual time_t last_changed (void);
+
+    virtual void rewind (void);
+
+    /// Position the stream after the stored data, what is written
+    /// next is appended to it.
+    virtual int append (void);
+
+    virtual bool appendable (void) const;
+
+    /// Commit the pending data
+    virtual bool flush (void);
+
+    /// Commit the pending data and force the shard log to storage.
+    virtual int sync (void);
+
+    virtual Storable_Base& operator << (const ACE_CString&);
+    virtual Storable_Base& operator >> (ACE_CString&);
+    virtual Storable_Base& operator << (ACE_UINT32 );
+    virtual Storable_Base& operator >> (ACE_UINT32 &);
+    virtual Storable_Base& operator << (ACE_UINT64 );
+    virtual Storable_Base& operator >> (ACE_UINT64 &);
+    virtual Storable_Base& operator << (ACE_INT32 );
+    virtual Storable_Base& operator >> (ACE_INT32 &);
+    virtual Storable_Base& operator << (ACE_INT64 );
+    virtual Storable_Base& operator >> (ACE_INT64 &);
+
+    virtual Storable_Base& operator << (const TAO_OutputCDR & cdr);
+
+    virtual size_t write (size_t size, const char * bytes);
+
+    virtual size_t read (size_t size, char * bytes);
+
+    /// The log keeps no backups, every record is checksummed and a
+    /// torn record is discarded instead.
+    virtual int restore_backup ();
+
+  protected:
+
+    virtual void do_remove ();
+
+    virtual void remove_backup ();
+
+    virtual int create_backup ();
+
+  private:
+
+    /// Write the pending data to the shard log.
+    int commit (bool sync);
+
+    /// Copy the next @a size bytes of the stored data into @a bytes,
+    /// throws a Storable_Read_Exception when there is not enough data.
+    void get (size_t size, char * bytes);
+
+    void throw_on_read_error (Storable_State state);
+
+    Storable_LogShard & shard_;
+    ACE_CString key_;
+    ACE_CString mode_;
+
+    /// The data written and not committed yet
+    ACE_CString pending_;
+
+    /// Does pending_ replace the stored data or is it appended to it?
+    bool replace_;
+
+    /// Has anything been written since the last commit?
+    bool dirty_;
+
+    /// A copy of the stored data, taken by the first read after
+    /// open () or rewind ().
+    ACE_CString image_;
+    bool image_valid_;
+    size_t read_pos_;
+  };
+
+  /**
+   * @brief Keep the storables in a set of append-only logs.
+   *
+   * Each storable is assigned to one of @c shards log files by hashing
+   * its name.  An update appends a checksummed record to the log of
+   * its shard, when the dead records outgrow the live ones the shard
+   * is compacted into a new log.  Several processes can share the
+   * same directory, the logs are protected by a lock file per shard.
+   */
+  class TAO_Export Storable_LogFactory : public Storable_Factory
+  {
+  public:
+
+    /// @param directory Directory to contain the shard logs.
+    /// The directory is assumed to already exist.
+    /// @param shards The number of log files.
+    Storable_LogFactory (const ACE_CString & directory,
+                         size_t shards,
+                         bool use_backup = Storable_Base::use_backup_default);
+
+    ~Storable_LogFactory ();
+
+    const ACE_CString & get_directory () const;
+
+    // Factory Methods
+
+    /// Create a stream on the storable @a file
+    virtual Storable_Base *create_stream (const ACE_CString & file,
+                                          const char * mode,
+                                          bool = false);
+  private:
+    ACE_CString directory_;
+    size_t nshards_;
+    Storable_LogShard **shards_;
+    bool use_backup_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* STORABLE_LOGSTREAM_H */
@@ -26,6 +26,8 @@ TAO_DIOP_Transport::TAO_DIOP_Transport (TAO_DIOP_Connection_Handler *handler,
                    ACE_MAX_DGRAM_SIZE)
   , connection_handler_ (handler)
 {
+  // Each message is a datagram of its own.
+  this->flush_combining_ = false;
 }
 
 TAO_DIOP_Transport::~TAO_DIOP_Transport (void)
@@ -188,6 +188,17 @@ TAO_Advanced_Resource_Factory::init (int argc, ACE_TCHAR** argv)
 #endif  /* ACE_HAS_EVENT_POLL || ACE_HAS_DEV_POLL */
             }
 
+          else if (ACE_OS::strcasecmp (current_arg,
+                                       ACE_TEXT("dev_poll_leaderless")) == 0)
+            {
+#if defined (ACE_HAS_EVENT_POLL)
+              this->reactor_type_ = TAO_REACTOR_DEV_POLL_LEADERLESS;
+#else
+              this->report_unsupported_error (
+                ACE_TEXT ("Leaderless Dev_Poll Reactor"));
+#endif  /* ACE_HAS_EVENT_POLL */
+            }
+
           else if (ACE_OS::strcasecmp (current_arg,
                                        ACE_TEXT("fl")) == 0)
             this->report_option_value_error (
@@ -481,6 +492,29 @@ TAO_Advanced_Resource_Factory::allocate_reactor_impl (void) const
       break;
 #endif  /* ACE_HAS_EVENT_POLL || ACE_HAS_DEV_POLL */
 
+#if defined (ACE_HAS_EVENT_POLL)
+    case TAO_REACTOR_DEV_POLL_LEADERLESS:
+      {
+        ACE_Dev_Poll_Reactor *dev_poll = 0;
+        ACE_NEW_RETURN (dev_poll,
+                        ACE_Dev_Poll_Reactor (ACE::max_handles (),
+                                              1,  // restart
+                                              (ACE_Sig_Handler*)0,
+                                              tmq.get (),
+                                              0, // Do not disable notify
+                                              0, // Allocate notify handler
+                                              this->reactor_mask_signals_),
+                        0);
+        impl = dev_poll;
+        if (dev_poll->leaderless (true) != 0)
+          TAOLIB_ERROR ((LM_ERROR,
+                         ACE_TEXT ("TAO (%P|%t) - Advanced_Resource_Factory, ")
+                         ACE_TEXT ("%p\n"),
+                         ACE_TEXT ("Dev_Poll_Reactor::leaderless")));
+      }
+      break;
+#endif  /* ACE_HAS_EVENT_POLL */
+
     default:
     case TAO_REACTOR_TP:
       ACE_NEW_RETURN (impl,
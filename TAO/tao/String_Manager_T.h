@@ -55,6 +55,21 @@ public:
   {
   }
 
+#if defined (ACE_HAS_CPP11)
+  /// Move constructor, @a rhs is left with an empty string.
+  inline String_Manager_T (String_Manager_T<charT> &&rhs) noexcept :
+    ptr_ (s_traits::default_initializer ())
+  {
+    std::swap (this->ptr_, rhs.ptr_);
+  }
+
+  /// Move assignment, exchanges the strings.
+  inline String_Manager_T &operator= (String_Manager_T<charT> &&rhs) noexcept {
+    std::swap (this->ptr_, rhs.ptr_);
+    return *this;
+  }
+#endif /* ACE_HAS_CPP11 */
+
   /// Destructor
   inline ~String_Manager_T (void) {
     s_traits::release (this->ptr_);
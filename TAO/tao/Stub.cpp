@@ -24,6 +24,7 @@
 
 #include "ace/Auto_Ptr.h"
 #include "ace/CORBA_macros.h"
+#include "ace/OS_NS_string.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -50,6 +51,7 @@ TAO_Stub::TAO_Stub (const char *repository_id,
   , forwarded_ior_info_ (0)
   , collocation_opt_ (orb_core->optimize_collocation_objects ())
   , forwarded_on_exception_ (false)
+  , is_a_answers_ (0)
 {
   if (this->orb_core_.get() == 0)
     {
@@ -103,6 +105,13 @@ TAO_Stub::~TAO_Stub (void)
   delete this->ior_info_;
 
   delete this->forwarded_ior_info_;
+
+  while (this->is_a_answers_ != 0)
+    {
+      Is_A_Answer *next = this->is_a_answers_->next_;
+      delete this->is_a_answers_;
+      this->is_a_answers_ = next;
+    }
 }
 
 void
@@ -576,4 +585,50 @@ TAO_Stub::marshal (TAO_OutputCDR &cdr)
   return (CORBA::Boolean) cdr.good_bit ();
 }
 
+int
+TAO_Stub::is_a_answer (const char *type_id)
+{
+  ACE_MT (ACE_GUARD_RETURN (TAO_SYNCH_MUTEX,
+                            guard,
+                            this->profile_lock_,
+                            -1));
+
+  for (Is_A_Answer *answer = this->is_a_answers_;
+       answer != 0;
+       answer = answer->next_)
+    {
+      if (ACE_OS::strcmp (answer->type_id_.in (), type_id) == 0)
+        return answer->is_a_ ? 1 : 0;
+    }
+
+  return -1;
+}
+
+void
+TAO_Stub::is_a_answer (const char *type_id, CORBA::Boolean is_a)
+{
+  Is_A_Answer *answer = 0;
+  ACE_NEW (answer, Is_A_Answer);
+
+  answer->type_id_ = CORBA::string_dup (type_id);
+  answer->is_a_ = is_a;
+
+  ACE_MT (ACE_GUARD (TAO_SYNCH_MUTEX, guard, this->profile_lock_));
+
+  // Another thread may have asked the object too.
+  for (Is_A_Answer *known = this->is_a_answers_;
+       known != 0;
+       known = known->next_)
+    {
+      if (ACE_OS::strcmp (known->type_id_.in (), type_id) == 0)
+        {
+          delete answer;
+          return;
+        }
+    }
+
+  answer->next_ = this->is_a_answers_;
+  this->is_a_answers_ = answer;
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
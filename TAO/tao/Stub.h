@@ -274,6 +274,13 @@ public:
   void forwarded_on_exception (bool forwarded);
   bool forwarded_on_exception () const;
 
+  /// Returns 1 if the object was found to support @a type_id, 0 if
+  /// it was found not to and -1 if it was not asked for @a type_id.
+  int is_a_answer (const char *type_id);
+
+  /// Remember the answer of the object to _is_a (@a type_id).
+  void is_a_answer (const char *type_id, CORBA::Boolean is_a);
+
 protected:
 
   /// Destructor is to be called only through _decr_refcnt() to
@@ -419,6 +426,18 @@ protected:
   /// True if forwarding request upon some specific exceptions
   /// (e.g. OBJECT_NOT_EXIST) already happened.
   ACE_Atomic_Op<TAO_SYNCH_MUTEX, bool> forwarded_on_exception_;
+
+  /// An answer of the object to _is_a().
+  struct Is_A_Answer
+  {
+    CORBA::String_var type_id_;
+    CORBA::Boolean is_a_;
+    Is_A_Answer *next_;
+  };
+
+  /// The answers of the object to _is_a(), protected by the profile
+  /// lock.  Objects are narrowed to few interfaces, a list will do.
+  Is_A_Answer *is_a_answers_;
 };
 
 // Define a TAO_Stub auto_ptr class.
@@ -0,0 +1,293 @@
+#include "tao/Stub_Cache.h"
+#include "tao/Profile.h"
+#include "tao/debug.h"
+
+#include "ace/ACE.h"
+#include "ace/CDR_Base.h"
+#include "ace/OS_Memory.h"
+#include "ace/OS_NS_string.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+TAO::Stub_Cache_Key::Stub_Cache_Key (void)
+  : bytes_ (0)
+  , length_ (0)
+  , byte_order_ (0)
+  , hash_ (0)
+{
+}
+
+TAO::Stub_Cache_Key::Stub_Cache_Key (const char *bytes,
+                                     size_t length,
+                                     int byte_order)
+  : bytes_ (bytes)
+  , length_ (length)
+  , byte_order_ (byte_order)
+  , hash_ (ACE::hash_pjw (bytes, length) + byte_order)
+{
+}
+
+u_long
+TAO::Stub_Cache_Key::hash (void) const
+{
+  return this->hash_;
+}
+
+bool
+TAO::Stub_Cache_Key::operator== (const Stub_Cache_Key &rhs) const
+{
+  return this->hash_ == rhs.hash_
+    && this->length_ == rhs.length_
+    && this->byte_order_ == rhs.byte_order_
+    && ACE_OS::memcmp (this->bytes_, rhs.bytes_, this->length_) == 0;
+}
+
+/********************************************************/
+TAO::Stub_Cache::Stub_Cache (void)
+  : table_ ()
+  , head_ (0)
+  , tail_ (0)
+  , maximum_ (0)
+{
+}
+
+TAO::Stub_Cache::~Stub_Cache (void)
+{
+  this->destroy ();
+}
+
+void
+TAO::Stub_Cache::maximum (size_t maximum)
+{
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+  this->maximum_ = maximum;
+}
+
+bool
+TAO::Stub_Cache::enabled (void)
+{
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->lock_, false);
+
+  return this->maximum_ != 0;
+}
+
+int
+TAO::Stub_Cache::destroy (void)
+{
+  Entry *entry = 0;
+
+  {
+    ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->lock_, 0);
+
+    this->maximum_ = 0;
+    this->table_.unbind_all ();
+    entry = this->head_;
+    this->head_ = 0;
+    this->tail_ = 0;
+  }
+
+  while (entry != 0)
+    {
+      Entry *next = entry->next_;
+      TAO::Stub_Cache::release (entry);
+      entry = next;
+    }
+
+  return 0;
+}
+
+bool
+TAO::Stub_Cache::find (const char *bytes,
+                       size_t length,
+                       int byte_order,
+                       CORBA::String_var &type_id,
+                       TAO_MProfile &profiles)
+{
+  Stub_Cache_Key const key (bytes, length, byte_order);
+
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->lock_, false);
+
+  Entry *entry = 0;
+  if (this->table_.find (key, entry) != 0)
+    return false;
+
+  this->touch_i (entry);
+  type_id = entry->type_id_.in ();
+  profiles.set (entry->profiles_);
+
+  return true;
+}
+
+int
+TAO::Stub_Cache::bind (const char *bytes,
+                       size_t length,
+                       int byte_order,
+                       const char *type_id,
+                       const TAO_MProfile &profiles)
+{
+  Entry *entry = 0;
+  ACE_NEW_RETURN (entry,
+                  Entry,
+                  -1);
+  ACE_NEW_NORETURN (entry->octets_,
+                    char[length]);
+  if (entry->octets_ == 0)
+    {
+      delete entry;
+      return -1;
+    }
+
+  ACE_OS::memcpy (entry->octets_, bytes, length);
+  entry->key_ = Stub_Cache_Key (entry->octets_, length, byte_order);
+  entry->type_id_ = type_id;
+  entry->prev_ = 0;
+  entry->next_ = 0;
+
+  Entry *victim = 0;
+  int result = -1;
+
+  {
+    ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->lock_, -1);
+
+    if (this->maximum_ != 0)
+      {
+        result = this->table_.bind (entry->key_, entry);
+      }
+
+    if (result == 0)
+      {
+        entry->profiles_.set (profiles);
+        this->touch_i (entry);
+
+        if (this->table_.current_size () > this->maximum_)
+          {
+            victim = this->tail_;
+            this->unbind_i (victim);
+          }
+      }
+  }
+
+  if (result != 0)
+    TAO::Stub_Cache::release (entry);
+
+  if (victim != 0)
+    {
+      if (TAO_debug_level > 6)
+        TAOLIB_DEBUG ((LM_DEBUG,
+                       ACE_TEXT ("TAO (%P|%t) - Stub_Cache::bind, ")
+                       ACE_TEXT ("dropping the least recently used ")
+                       ACE_TEXT ("object reference <%C>\n"),
+                       victim->type_id_.in ()));
+
+      TAO::Stub_Cache::release (victim);
+    }
+
+  return result;
+}
+
+size_t
+TAO::Stub_Cache::encoded_length (const char *begin,
+                                 size_t available,
+                                 bool swap)
+{
+  const char *const end = begin + available;
+  const char *pos = begin;
+  ACE_CDR::ULong length = 0;
+
+  // The type id.
+  if (!read_ulong (pos, end, swap, length)
+      || static_cast<size_t> (end - pos) < length)
+    return 0;
+  pos += length;
+
+  ACE_CDR::ULong profile_count = 0;
+  if (!read_ulong (pos, end, swap, profile_count) || profile_count == 0)
+    return 0;
+
+  // The tagged profiles, their encapsulations are skipped.
+  for (ACE_CDR::ULong i = 0; i != profile_count; ++i)
+    {
+      ACE_CDR::ULong tag = 0;
+      if (!read_ulong (pos, end, swap, tag)
+          || !read_ulong (pos, end, swap, length)
+          || static_cast<size_t> (end - pos) < length)
+        return 0;
+      pos += length;
+    }
+
+  return pos - begin;
+}
+
+bool
+TAO::Stub_Cache::read_ulong (const char *&pos,
+                             const char *end,
+                             bool swap,
+                             ACE_CDR::ULong &value)
+{
+  pos = ACE_ptr_align_binary (pos, ACE_CDR::LONG_ALIGN);
+  if (pos > end || static_cast<size_t> (end - pos) < ACE_CDR::LONG_SIZE)
+    return false;
+
+#if !defined (ACE_DISABLE_SWAP_ON_READ)
+  if (swap)
+    ACE_CDR::swap_4 (pos, reinterpret_cast<char *> (&value));
+  else
+#endif /* ACE_DISABLE_SWAP_ON_READ */
+    ACE_OS::memcpy (&value, pos, ACE_CDR::LONG_SIZE);
+  ACE_UNUSED_ARG (swap);
+
+  pos += ACE_CDR::LONG_SIZE;
+  return true;
+}
+
+void
+TAO::Stub_Cache::touch_i (Entry *entry)
+{
+  if (this->head_ == entry)
+    return;
+
+  // Unlink the entry, if it is in the list at all.
+  if (entry->prev_ != 0)
+    entry->prev_->next_ = entry->next_;
+  if (entry->next_ != 0)
+    entry->next_->prev_ = entry->prev_;
+  if (this->tail_ == entry)
+    this->tail_ = entry->prev_;
+
+  entry->prev_ = 0;
+  entry->next_ = this->head_;
+  if (this->head_ != 0)
+    this->head_->prev_ = entry;
+  this->head_ = entry;
+  if (this->tail_ == 0)
+    this->tail_ = entry;
+}
+
+void
+TAO::Stub_Cache::unbind_i (Entry *entry)
+{
+  this->table_.unbind (entry->key_);
+
+  if (entry->prev_ != 0)
+    entry->prev_->next_ = entry->next_;
+  else
+    this->head_ = entry->next_;
+
+  if (entry->next_ != 0)
+    entry->next_->prev_ = entry->prev_;
+  else
+    this->tail_ = entry->prev_;
+
+  entry->prev_ = 0;
+  entry->next_ = 0;
+}
+
+void
+TAO::Stub_Cache::release (Entry *entry)
+{
+  delete [] entry->octets_;
+  delete entry;
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,187 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file Stub_Cache.h
+ *
+ *  Cache of the profiles decoded from marshaled object references.
+ */
+//=============================================================================
+
+#ifndef TAO_STUB_CACHE_H
+#define TAO_STUB_CACHE_H
+
+#include /**/ "ace/pre.h"
+#include "tao/orbconf.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/Hash_Map_Manager_T.h"
+#include "ace/Null_Mutex.h"
+#include "ace/CDR_Base.h"
+
+#include "tao/TAO_Export.h"
+#include "tao/MProfile.h"
+#include "tao/CORBA_String.h"
+#include /**/ "tao/Versioned_Namespace.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  /**
+   * @class Stub_Cache_Key
+   *
+   * @brief The encoded IOR the profiles were decoded from.
+   *
+   * Does not own the octets.  The keys in the cache point into a copy
+   * held by the cache entry, the ones used for lookups into the CDR
+   * stream the IOR is read from.
+   */
+  class TAO_Export Stub_Cache_Key
+  {
+  public:
+    Stub_Cache_Key (void);
+
+    Stub_Cache_Key (const char *bytes, size_t length, int byte_order);
+
+    /// Hash value of the octets, computed once.
+    u_long hash (void) const;
+
+    bool operator== (const Stub_Cache_Key &rhs) const;
+
+    const char *bytes_;
+    size_t length_;
+    int byte_order_;
+    u_long hash_;
+  };
+
+  /**
+   * @class Stub_Cache
+   *
+   * @brief Table of the type ids and profiles decoded by the ORB for
+   * the object references it demarshaled, keyed by the encoded IORs.
+   *
+   * Services that return many object references, often the same ones
+   * over and over, spend a lot of time decoding the profiles, their
+   * endpoints, tagged components and object keys.  An object reference
+   * read again from identical octets gets a new stub for the profiles
+   * decoded the first time instead, sharing them like the stubs made
+   * for policy overrides share the profiles of the original one.  The
+   * stubs themselves are not shared, each object reference keeps its
+   * own collocation and location forwarding state.
+   *
+   * The table holds a reference on each profile and keeps the
+   * profiles of at most maximum() object references, the least
+   * recently used ones are dropped when the table is full.  With a
+   * maximum of 0 the cache is disabled.
+   *
+   * The profiles use the resources of the ORB core, destroy() must be
+   * called when the ORB is shut down.
+   */
+  class TAO_Export Stub_Cache
+  {
+  public:
+    Stub_Cache (void);
+
+    ~Stub_Cache (void);
+
+    /// Set the number of object references kept, 0 disables the
+    /// cache.
+    void maximum (size_t maximum);
+
+    /// True unless the cache is disabled or destroyed.
+    bool enabled (void);
+
+    /// Release all profiles and disable the cache.
+    int destroy (void);
+
+    /// Look up the object reference decoded from the @a length octets
+    /// starting at @a bytes.  If it is known, set @a type_id and
+    /// @a profiles to a copy of its type id and its profiles, with
+    /// their reference counts incremented, and return true.
+    bool find (const char *bytes,
+               size_t length,
+               int byte_order,
+               CORBA::String_var &type_id,
+               TAO_MProfile &profiles);
+
+    /// Remember @a type_id and @a profiles as decoded from the
+    /// @a length octets starting at @a bytes.  The cache takes its
+    /// own reference on the profiles.  Returns 0 on success, 1 if an
+    /// entry for the octets exists already and -1 on failure.
+    int bind (const char *bytes,
+              size_t length,
+              int byte_order,
+              const char *type_id,
+              const TAO_MProfile &profiles);
+
+    /// Return the length of the object reference encoded in the CDR
+    /// stream at @a begin, which must be aligned on a 4 byte
+    /// boundary.  The octets are not decoded beyond the lengths of the
+    /// type id and of the tagged profiles.  Returns 0 for a nil
+    /// reference and when the @a available octets do not hold a
+    /// complete object reference.
+    static size_t encoded_length (const char *begin,
+                                  size_t available,
+                                  bool swap);
+
+  private:
+    /// Read an aligned ULong for encoded_length().
+    static bool read_ulong (const char *&pos,
+                            const char *end,
+                            bool swap,
+                            ACE_CDR::ULong &value);
+
+    ACE_UNIMPLEMENTED_FUNC (Stub_Cache (const Stub_Cache &))
+    ACE_UNIMPLEMENTED_FUNC (Stub_Cache &operator= (const Stub_Cache &))
+
+    /// A cached object reference, in a list from the most to the
+    /// least recently used one.
+    struct Entry
+    {
+      /// Copy of the encoded IOR, the key points into it.
+      char *octets_;
+      Stub_Cache_Key key_;
+      CORBA::String_var type_id_;
+      TAO_MProfile profiles_;
+      Entry *prev_;
+      Entry *next_;
+    };
+
+    typedef ACE_Hash_Map_Manager_Ex<Stub_Cache_Key,
+                                    Entry *,
+                                    ACE_Hash<Stub_Cache_Key>,
+                                    ACE_Equal_To<Stub_Cache_Key>,
+                                    ACE_Null_Mutex> TABLE;
+
+    /// Move @a entry to the front of the list.
+    void touch_i (Entry *entry);
+
+    /// Take @a entry out of the list and the table.
+    void unbind_i (Entry *entry);
+
+    /// Free @a entry, releasing its profiles.  Called without the
+    /// lock held, since the profiles may be destroyed.
+    static void release (Entry *entry);
+
+    /// Lock for the table and the list.
+    TAO_SYNCH_MUTEX lock_;
+
+    TABLE table_;
+
+    /// The most and the least recently used entries.
+    Entry *head_;
+    Entry *tail_;
+
+    size_t maximum_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_STUB_CACHE_H */
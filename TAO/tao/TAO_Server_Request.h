@@ -276,6 +276,10 @@ public:
   /// Return a reference to the "request scope" PICurrent object.
   TAO::PICurrent_Impl *rs_pi_current (void);
 
+  /// Whether the "request scope" PICurrent object has been created,
+  /// it is only created when first used.
+  bool has_rs_pi_current (void) const;
+
   CORBA::Exception *caught_exception (void);
 
   void caught_exception (CORBA::Exception *exception);
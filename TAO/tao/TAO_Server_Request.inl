@@ -273,6 +273,12 @@ TAO_ServerRequest::interceptor_count (void)
   return this->interceptor_count_;
 }
 
+ACE_INLINE bool
+TAO_ServerRequest::has_rs_pi_current (void) const
+{
+  return this->rs_pi_current_ != 0;
+}
+
 ACE_INLINE CORBA::Exception *
 TAO_ServerRequest::caught_exception (void)
 {
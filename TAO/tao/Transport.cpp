@@ -27,6 +27,7 @@
 
 #include "ace/OS_NS_sys_time.h"
 #include "ace/OS_NS_stdio.h"
+#include "ace/OS_NS_Thread.h"
 #include "ace/Reactor.h"
 #include "ace/os_include/sys/os_uio.h"
 #include "ace/High_Res_Timer.h"
@@ -143,6 +144,7 @@ TAO_Transport::TAO_Transport (CORBA::ULong tag,
   , sent_byte_count_ (0)
   , is_connected_ (false)
   , connection_closed_on_read_ (false)
+  , flush_combining_ (orb_core->resource_factory ()->flush_combining ())
   , messaging_object_ (0)
   , char_translator_ (0)
   , wchar_translator_ (0)
@@ -163,6 +165,9 @@ TAO_Transport::TAO_Transport (CORBA::ULong tag,
   , stats_ (0)
 #endif /* TAO_HAS_TRANSPORT_CURRENT == 1 */
   , flush_in_post_open_ (false)
+#if defined (ACE_HAS_CPP11)
+  , combined_sends_ (0)
+#endif /* ACE_HAS_CPP11 */
 {
   ACE_NEW (this->messaging_object_,
             TAO_GIOP_Message_Base (orb_core,
@@ -277,6 +282,12 @@ TAO_Transport::idle_after_reply (void)
   return this->tms ()->idle_after_reply ();
 }
 
+size_t
+TAO_Transport::pending_requests (void) const
+{
+  return this->tms_ == 0 ? 0 : this->tms_->pending_requests ();
+}
+
 /*
  * A concrete transport class specializes this
  * method. This hook allows commenting this function
@@ -301,6 +312,21 @@ TAO_Transport::send_message_shared (TAO_Stub *stub,
 {
   int result = 0;
 
+#if defined (ACE_HAS_CPP11)
+  // The thread that sends the combined messages drains the queue under
+  // its own deadline and fails all messages it could not send, so
+  // messages with a deadline are sent on their own.
+  if (this->flush_combining_
+      && max_wait_time == 0
+      && message_semantics.type_ !=
+           TAO_Message_Semantics::TAO_ONEWAY_REQUEST)
+    {
+      result = this->send_combined_message (message_semantics,
+                                            message_block,
+                                            max_wait_time);
+    }
+  else
+#endif /* ACE_HAS_CPP11 */
   {
     ACE_GUARD_RETURN (ACE_Lock, ace_mon, *this->handler_lock_, -1);
 
@@ -709,6 +735,20 @@ TAO_Transport::send_synchronous_message_i (const ACE_Message_Block *mb,
 
   int const result = this->send_synch_message_helper_i (synch_message,
                                                         max_wait_time);
+
+  return this->complete_synchronous_message_i (synch_message,
+                                               total_length,
+                                               result,
+                                               max_wait_time);
+}
+
+int
+TAO_Transport::complete_synchronous_message_i (
+  TAO_Synch_Queued_Message &synch_message,
+  size_t total_length,
+  int result,
+  ACE_Time_Value *max_wait_time)
+{
   if (result == -1 && errno == ETIME)
     {
       if (total_length == synch_message.message_length ()) //none was sent
@@ -803,6 +843,14 @@ TAO_Transport::send_reply_message_i (const ACE_Message_Block *mb,
   int const n =
     this->send_synch_message_helper_i (synch_message, max_wait_time);
 
+  return this->complete_reply_message_i (synch_message, n);
+}
+
+int
+TAO_Transport::complete_reply_message_i (
+  TAO_Synch_Queued_Message &synch_message,
+  int n)
+{
   // What about partially sent messages.
   if (n == -1 || n == 1)
     {
@@ -882,6 +930,181 @@ TAO_Transport::send_synch_message_helper_i (TAO_Synch_Queued_Message &synch_mess
   return 0;
 }
 
+#if defined (ACE_HAS_CPP11)
+TAO_Transport::Combined_Send::Combined_Send (
+  TAO_Synch_Queued_Message &message)
+  : message_ (message)
+  , length_ (message.message_length ())
+  , next_ (0)
+  , state_ (CS_PUBLISHED)
+{
+}
+
+int
+TAO_Transport::send_combined_message (TAO_Message_Semantics message_semantics,
+                                      const ACE_Message_Block *mb,
+                                      ACE_Time_Value *max_wait_time)
+{
+  // The message is sent or queued before we return, so there is no
+  // need to clone the message block.
+  TAO_Synch_Queued_Message synch_message (mb, this->orb_core_);
+  Combined_Send published (synch_message);
+
+  published.next_ = this->combined_sends_.load (std::memory_order_relaxed);
+  while (!this->combined_sends_.compare_exchange_weak (
+           published.next_,
+           &published,
+           std::memory_order_release,
+           std::memory_order_relaxed))
+    {
+    }
+
+  // Wait until a thread holding the lock has taken care of the
+  // message, or until we get the lock ourselves.  A thread that holds
+  // the lock will likely send the message with its own, so only block
+  // on the lock after yielding for a while.
+  bool locked = false;
+  for (int spins = 0; !locked; ++spins)
+    {
+      int const state = published.state_.load (std::memory_order_acquire);
+      if (state == Combined_Send::CS_SENT
+          || state == Combined_Send::CS_FAILED)
+        {
+          break;
+        }
+
+      if (spins < TAO_FLUSH_COMBINING_SPINS)
+        {
+          locked = (this->handler_lock_->tryacquire () == 0);
+        }
+      else
+        {
+          // The message must not stay published once we return, so
+          // keep trying if the lock fails.
+          locked = (this->handler_lock_->acquire () == 0);
+        }
+
+      if (!locked)
+        {
+          ACE_OS::thr_yield ();
+        }
+    }
+
+  if (!locked)
+    {
+      return published.state_.load (std::memory_order_acquire) ==
+               Combined_Send::CS_SENT ? 1 : -1;
+    }
+
+  ACE_Guard<ACE_Lock> ace_mon (*this->handler_lock_, true, 1);
+
+  // If our message is still published, nobody took the published
+  // messages since we got the lock, send them all now.
+  bool combined = false;
+  if (published.state_.load (std::memory_order_relaxed) ==
+        Combined_Send::CS_PUBLISHED)
+    {
+      TAO::Transport::Drain_Constraints dc (
+        max_wait_time, this->using_blocking_io_for_synch_messages ());
+
+      (void) this->combine_i (dc);
+      combined = true;
+    }
+
+  int result = 0;
+  switch (published.state_.load (std::memory_order_relaxed))
+    {
+    case Combined_Send::CS_SENT:
+      result = 1;
+      break;
+    case Combined_Send::CS_FAILED:
+      // Only report the details of our own send.
+      if (!combined)
+        {
+          return -1;
+        }
+      result = -1;
+      break;
+    default:
+      // Queued, another thread may have sent the rest since.
+      result = synch_message.all_data_sent () ? 1 : 0;
+      break;
+    }
+
+  if (message_semantics.type_ == TAO_Message_Semantics::TAO_TWOWAY_REQUEST)
+    {
+      return this->complete_synchronous_message_i (synch_message,
+                                                   published.length_,
+                                                   result,
+                                                   max_wait_time);
+    }
+
+  return this->complete_reply_message_i (synch_message, result);
+}
+
+TAO_Transport::Drain_Result
+TAO_Transport::combine_i (TAO::Transport::Drain_Constraints const & dc)
+{
+  // Take all published messages and restore the order they were
+  // published in.
+  Combined_Send *published =
+    this->combined_sends_.exchange (0, std::memory_order_acquire);
+  Combined_Send *head = 0;
+  size_t count = 0;
+  while (published != 0)
+    {
+      Combined_Send * const next = published->next_;
+      published->next_ = head;
+      head = published;
+      published = next;
+      ++count;
+    }
+
+  for (Combined_Send *i = head; i != 0; i = i->next_)
+    {
+      i->message_.push_back (this->head_, this->tail_);
+    }
+
+  Drain_Result const retval = this->drain_queue_i (dc);
+
+  if (TAO_debug_level > 6)
+    {
+      TAOLIB_DEBUG ((LM_DEBUG,
+         ACE_TEXT ("TAO (%P|%t) - Transport[%d]::combine_i, ")
+         ACE_TEXT ("drained %B published messages, retval = %d\n"),
+         this->id (), count, static_cast<int> (retval.dre_)));
+    }
+
+  while (head != 0)
+    {
+      // Once its state changes the publishing thread may return and
+      // the message is gone.
+      Combined_Send * const next = head->next_;
+      int state = Combined_Send::CS_QUEUED;
+
+      if (head->message_.all_data_sent ())
+        {
+          state = Combined_Send::CS_SENT;
+        }
+      else if (retval == DR_ERROR)
+        {
+          head->message_.remove_from_list (this->head_, this->tail_);
+          state = Combined_Send::CS_FAILED;
+        }
+
+#if TAO_HAS_TRANSPORT_CURRENT == 1
+      if (state != Combined_Send::CS_FAILED && this->stats_ != 0)
+        this->stats_->messages_sent (head->length_);
+#endif /* TAO_HAS_TRANSPORT_CURRENT == 1 */
+
+      head->state_.store (state, std::memory_order_release);
+      head = next;
+    }
+
+  return retval;
+}
+#endif /* ACE_HAS_CPP11 */
+
 int
 TAO_Transport::schedule_output_i (void)
 {
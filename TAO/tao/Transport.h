@@ -29,6 +29,10 @@
 #include "ace/Time_Value.h"
 #include "ace/Basic_Stats.h"
 
+#if defined (ACE_HAS_CPP11)
+# include <atomic>
+#endif /* ACE_HAS_CPP11 */
+
 struct iovec;
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
@@ -566,6 +570,10 @@ public:
   /// now.
   bool idle_after_reply (void);
 
+  /// Number of requests still waiting for a reply, used by the
+  /// transport cache to balance requests over a pool of connections.
+  size_t pending_requests (void) const;
+
   /// Call the implementation method after obtaining the lock.
   virtual void close_connection (void);
 
@@ -997,6 +1005,30 @@ private:
   int send_synch_message_helper_i (TAO_Synch_Queued_Message &s,
                                    ACE_Time_Value *max_wait_time);
 
+  /// The part of send_synchronous_message_i() that follows the first
+  /// attempt to send @a s, @a result is what that attempt returned
+  /// and @a total_length the length of @a s before it.
+  int complete_synchronous_message_i (TAO_Synch_Queued_Message &s,
+                                      size_t total_length,
+                                      int result,
+                                      ACE_Time_Value *max_wait_time);
+
+  /// The part of send_reply_message_i() that follows the first attempt
+  /// to send @a s, @a result is what that attempt returned.
+  int complete_reply_message_i (TAO_Synch_Queued_Message &s, int result);
+
+#if defined (ACE_HAS_CPP11)
+  /// Implement send_message_shared() for synchronous requests and
+  /// replies when flushes are combined, see Combined_Send.
+  int send_combined_message (TAO_Message_Semantics message_semantics,
+                             const ACE_Message_Block *message_block,
+                             ACE_Time_Value *max_wait_time);
+
+  /// Move the published messages into the queue and drain it, the
+  /// handler_lock_ must be held.
+  Drain_Result combine_i (TAO::Transport::Drain_Constraints const & dc);
+#endif /* ACE_HAS_CPP11 */
+
   /// Check if the flush timer is still pending
   int flush_timer_pending (void) const;
 
@@ -1190,6 +1222,12 @@ protected:
   /// semantics.
   bool connection_closed_on_read_;
 
+  /// Combine the flushes of threads sending synchronous requests or
+  /// replies, set from TAO_Resource_Factory::flush_combining().
+  /// Datagram transports clear it, their messages must not share a
+  /// send() call.
+  bool flush_combining_;
+
 private:
 
   /// Our messaging object.
@@ -1242,6 +1280,51 @@ private:
   /// Indicate that flushing needs to be done in post_open()
   bool flush_in_post_open_;
 
+#if defined (ACE_HAS_CPP11)
+  /**
+   * @struct Combined_Send
+   *
+   * @brief A message published for a combined flush.
+   *
+   * A thread sending a synchronous request or a reply pushes one of
+   * these, allocated on its stack, onto combined_sends_ without taking
+   * the handler_lock_.  Whichever thread holds the lock moves all
+   * published messages into the queue and writes them together,
+   * gathering up to ACE_IOV_MAX buffers per send() call.  The other
+   * threads wait for the state of their message to change instead of
+   * taking the lock in turn.  Messages with a deadline are never
+   * published, the thread sending the messages could otherwise fail
+   * them all when it times out.
+   */
+  struct Combined_Send
+  {
+    enum State
+    {
+      /// Not yet taken by the thread holding the lock
+      CS_PUBLISHED,
+      /// In the queue, but not (completely) sent
+      CS_QUEUED,
+      /// Sent
+      CS_SENT,
+      /// Removed from the queue after an error
+      CS_FAILED
+    };
+
+    explicit Combined_Send (TAO_Synch_Queued_Message &message);
+
+    TAO_Synch_Queued_Message &message_;
+    size_t const length_;
+    Combined_Send *next_;
+
+    /// Changed once the thread holding the lock is done with the
+    /// message, the publishing thread may return right after that.
+    std::atomic<int> state_;
+  };
+
+  /// The published messages, the most recent first.
+  std::atomic<Combined_Send *> combined_sends_;
+#endif /* ACE_HAS_CPP11 */
+
   /// lock for synchronizing Transport OutputCDR access
   mutable TAO_SYNCH_MUTEX output_cdr_mutex_;
 
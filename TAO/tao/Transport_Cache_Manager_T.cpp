@@ -29,12 +29,14 @@ namespace TAO
     purging_strategy* purging_strategy,
     size_t cache_maximum,
     bool locked,
-    const char *orbid)
+    const char *orbid,
+    size_t pool_minimum)
     : percent_ (percent)
     , purging_strategy_ (purging_strategy)
     , cache_map_ (cache_maximum)
     , cache_lock_ (0)
     , cache_maximum_ (cache_maximum)
+    , pool_minimum_ (pool_minimum)
 #if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
     , purge_monitor_ (0)
     , size_monitor_ (0)
@@ -227,7 +229,8 @@ namespace TAO
   Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::find_transport (
     transport_descriptor_type *prop,
     transport_type *&transport,
-    size_t &busy_count)
+    size_t &busy_count,
+    size_t pool_maximum)
   {
     if (prop == 0)
       {
@@ -235,7 +238,24 @@ namespace TAO
         return CACHE_FOUND_NONE;
       }
 
-    Find_Result const find_result = this->find (prop, transport, busy_count);
+    transport_type *surplus = 0;
+    Find_Result const find_result =
+      this->find (prop, transport, busy_count, pool_maximum, surplus);
+
+    if (surplus != 0)
+      {
+        // Close the connection without the lock held, like purge ()
+        if (TAO_debug_level > 4)
+          {
+            TAOLIB_DEBUG ((LM_INFO,
+              ACE_TEXT ("TAO (%P|%t) - Transport_Cache_Manager_T::")
+              ACE_TEXT ("find_transport, closing idle pooled Transport[%d]\n"),
+              surplus->id ()));
+          }
+        surplus->close_connection ();
+        surplus->remove_reference ();
+      }
+
     if (find_result != CACHE_FOUND_NONE)
       {
         if (find_result == CACHE_FOUND_AVAILABLE)
@@ -371,6 +391,157 @@ namespace TAO
     return found;
   }
 
+  template <typename TT, typename TRDT, typename PSTRAT>
+  typename Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::Find_Result
+  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::find_pooled_i (
+    transport_descriptor_type *prop,
+    transport_type *&transport,
+    size_t &busy_count,
+    size_t pool_maximum,
+    transport_type *&surplus)
+  {
+    Cache_ExtId key (prop);
+    HASH_MAP_ENTRY *entry = 0;
+    busy_count = 0;
+    size_t entries = 0;
+
+    HASH_MAP_ENTRY *connecting_entry = 0;
+    HASH_MAP_ENTRY *busy_entry = 0;
+    HASH_MAP_ENTRY *least_loaded = 0;
+    size_t least_load = 0;
+
+    // Look at every cached connection to the endpoint, keeping the
+    // available one with the fewest requests waiting for a reply.
+    // Ties go to the lowest index, so the last connections in the
+    // pool stay idle when the load drops.
+    while (this->cache_map_.find (key, entry) == 0 && entry != 0)
+      {
+        ++entries;
+        if (this->is_entry_available_i (*entry))
+          {
+            size_t const load = entry->item ().transport ()->pending_requests ();
+            if (least_loaded == 0 || load < least_load)
+              {
+                least_loaded = entry;
+                least_load = load;
+              }
+          }
+        else if (this->is_entry_connecting_i (*entry))
+          {
+            if (connecting_entry == 0)
+              connecting_entry = entry;
+          }
+        else
+          {
+            if (busy_entry == 0)
+              busy_entry = entry;
+            ++busy_count;
+          }
+
+        key.incr_index ();
+      }
+
+    Find_Result found = CACHE_FOUND_NONE;
+    HASH_MAP_ENTRY *found_entry = 0;
+
+    if (least_loaded != 0
+        && (least_load == 0
+            || connecting_entry != 0
+            || entries >= pool_maximum))
+      {
+        found = CACHE_FOUND_AVAILABLE;
+        found_entry = least_loaded;
+      }
+    else if (least_loaded != 0)
+      {
+        // Every connection has requests waiting for a reply and the
+        // pool may grow, let the caller open another connection.
+        found = CACHE_FOUND_BUSY;
+        found_entry = least_loaded;
+        busy_count = entries;
+      }
+    else if (connecting_entry != 0)
+      {
+        found = CACHE_FOUND_CONNECTING;
+        found_entry = connecting_entry;
+      }
+    else if (busy_entry != 0)
+      {
+        found = CACHE_FOUND_BUSY;
+        found_entry = busy_entry;
+      }
+
+    if (found == CACHE_FOUND_AVAILABLE)
+      {
+        found_entry->item ().recycle_state (ENTRY_BUSY);
+        found_entry->item ().idle_lookups (0);
+
+        // Age the other idle connections, and close the last one that
+        // has not been picked for a while.
+        HASH_MAP_ENTRY *idle_entry = 0;
+        key.index (0);
+        while (this->cache_map_.find (key, entry) == 0 && entry != 0)
+          {
+            if (entry != found_entry && this->is_entry_available_i (*entry))
+              {
+                if (entry->item ().transport ()->pending_requests () == 0)
+                  {
+                    unsigned long const lookups =
+                      entry->item ().idle_lookups () + 1;
+                    entry->item ().idle_lookups (lookups);
+                    if (lookups >= TAO_CONNECTION_POOL_IDLE_LOOKUPS)
+                      idle_entry = entry;
+                  }
+                else
+                  {
+                    entry->item ().idle_lookups (0);
+                  }
+              }
+            key.incr_index ();
+          }
+
+        if (idle_entry != 0 && entries > this->pool_minimum_)
+          {
+            idle_entry->item ().recycle_state (ENTRY_BUSY);
+            surplus = idle_entry->item ().transport ();
+            surplus->add_reference ();
+          }
+
+        if (TAO_debug_level > 6)
+          {
+            TAOLIB_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("TAO (%P|%t) - Transport_Cache_Manager_T::find_pooled_i, ")
+              ACE_TEXT ("Found available Transport[%d] @hash:index {%d:%d} ")
+              ACE_TEXT ("with %d pending requests, %d in pool\n"),
+              found_entry->item ().transport ()->id (),
+              found_entry->ext_id_.hash (),
+              found_entry->ext_id_.index (),
+              least_load,
+              entries));
+          }
+      }
+    else if (found == CACHE_FOUND_BUSY && TAO_debug_level > 6)
+      {
+        TAOLIB_DEBUG ((LM_DEBUG,
+          ACE_TEXT ("TAO (%P|%t) - Transport_Cache_Manager_T::find_pooled_i, ")
+          ACE_TEXT ("%d of %d pooled Transports busy @hash {%d}\n"),
+          busy_count,
+          entries,
+          key.hash ()));
+      }
+
+    if (found_entry != 0)
+      {
+        transport = found_entry->item ().transport ();
+        transport->add_reference ();
+        if (found == CACHE_FOUND_AVAILABLE)
+          {
+            this->purging_strategy_->update_item (*transport);
+          }
+      }
+    return found;
+  }
+
   template <typename TT, typename TRDT, typename PSTRAT>
   int
   Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::make_idle_i (HASH_MAP_ENTRY *entry)
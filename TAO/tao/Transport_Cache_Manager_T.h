@@ -94,12 +94,17 @@ namespace TAO
 
     // == Public methods
     /// Constructor
+    /**
+     * @a pool_minimum is the number of connections to an endpoint
+     * that are kept when connections are pooled, see find_transport().
+     */
     Transport_Cache_Manager_T (
       int percent,
       purging_strategy* purging_strategy,
       size_t cache_maximum,
       bool locked,
-      const char *orbid);
+      const char *orbid,
+      size_t pool_minimum = 1);
 
     /// Destructor
     ~Transport_Cache_Manager_T (void);
@@ -117,10 +122,20 @@ namespace TAO
 
     /// Check the Transport Cache to check whether the connection exists
     /// in the Cache and return the connection
+    /**
+     * If @a pool_maximum is not 0 the muxed connections to the endpoint
+     * form a pool of up to @a pool_maximum connections.  The available
+     * connection with the fewest requests waiting for a reply is
+     * returned, unless all of them have requests waiting and the pool
+     * can grow, in which case CACHE_FOUND_BUSY asks the caller to open
+     * another connection.  Connections that stay idle while others
+     * are used are closed, down to the pool minimum.
+     */
     Find_Result find_transport (
       transport_descriptor_type *prop,
       transport_type *&transport,
-      size_t & busy_count);
+      size_t & busy_count,
+      size_t pool_maximum = 0);
 
     /// Remove entries from the cache depending upon the strategy.
     int purge (void);
@@ -173,7 +188,9 @@ namespace TAO
     Find_Result find (
       transport_descriptor_type *prop,
       transport_type *&transport,
-      size_t & busy_count);
+      size_t & busy_count,
+      size_t pool_maximum,
+      transport_type *&surplus);
 
     /**
      * Non-Locking version and actual implementation of bind ()
@@ -194,6 +211,18 @@ namespace TAO
       transport_type *&transport,
       size_t & busy_count);
 
+    /**
+     * Non-locking version of find () for a pool of connections to
+     * the endpoint.  A connection found to be surplus is marked busy
+     * and returned in @a surplus, to be closed without the lock held.
+     */
+    Find_Result find_pooled_i (
+      transport_descriptor_type *prop,
+      transport_type *&transport,
+      size_t & busy_count,
+      size_t pool_maximum,
+      transport_type *&surplus);
+
     /// Non-locking version and actual implementation of make_idle ().
     int make_idle_i (HASH_MAP_ENTRY *entry);
 
@@ -254,6 +283,10 @@ namespace TAO
     /// Maximum size of the cache
     size_t cache_maximum_;
 
+    /// Pooled connections to an endpoint are not closed below this
+    /// number.
+    size_t pool_minimum_;
+
 #if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
     /// Connection cache purge monitor.
     ACE::Monitor_Control::Size_Monitor *purge_monitor_;
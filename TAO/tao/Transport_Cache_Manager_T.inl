@@ -92,14 +92,20 @@ namespace TAO
   ACE_INLINE typename Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::Find_Result
   Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::find (transport_descriptor_type *prop,
                                  transport_type *&transport,
-                                 size_t &busy_count)
+                                 size_t &busy_count,
+                                 size_t pool_maximum,
+                                 transport_type *&surplus)
   {
     ACE_MT (ACE_GUARD_RETURN  (ACE_Lock,
                                guard,
                                *this->cache_lock_,
                                CACHE_FOUND_NONE));
 
-    return this->find_i (prop, transport, busy_count);
+    if (pool_maximum == 0)
+      return this->find_i (prop, transport, busy_count);
+
+    return this->find_pooled_i (prop, transport, busy_count,
+                                pool_maximum, surplus);
   }
 
   template <typename TT, typename TRDT, typename PSTRAT>
@@ -485,6 +485,13 @@ TAO_Connector::connect (TAO::Profile_Transport_Resolver *r,
   TAO::Transport_Cache_Manager &tcm =
     this->orb_core ()->lane_resources ().transport_cache ();
 
+  size_t const pool_maximum = this->connection_pool_maximum (r);
+
+  // Set when opening another pooled connection failed.  The lookups
+  // then settle for the least loaded pooled connection and, should all
+  // of them be busy, wait for one instead of opening another.
+  bool fall_back = false;
+
   // Stay in this loop until we find:
   // a usable connection, or a timeout happens
   while (true)
@@ -496,7 +503,8 @@ TAO_Connector::connect (TAO::Profile_Transport_Resolver *r,
       TAO::Transport_Cache_Manager::Find_Result found =
           tcm.find_transport (desc,
                               base_transport,
-                              busy_count);
+                              busy_count,
+                              fall_back ? 1 : pool_maximum);
 
       if (found == TAO::Transport_Cache_Manager::CACHE_FOUND_AVAILABLE)
         {
@@ -651,7 +659,10 @@ TAO_Connector::connect (TAO::Profile_Transport_Resolver *r,
           bool const make_new_connection =
             (found == TAO::Transport_Cache_Manager::CACHE_FOUND_NONE) ||
             (found == TAO::Transport_Cache_Manager::CACHE_FOUND_BUSY
-                && this->new_connection_is_ok (busy_count));
+                && !fall_back
+                && (pool_maximum == 0
+                    ? this->new_connection_is_ok (busy_count)
+                    : busy_count < pool_maximum));
 
           if (make_new_connection)
             {
@@ -671,6 +682,15 @@ TAO_Connector::connect (TAO::Profile_Transport_Resolver *r,
                         ACE_TEXT ("TAO (%P|%t) - Transport_Connector::")
                         ACE_TEXT ("connect, make_connection failed\n")));
                     }
+
+                  // Every pooled connection had requests waiting for a
+                  // reply, use the least loaded one instead.
+                  if (pool_maximum != 0
+                      && found == TAO::Transport_Cache_Manager::CACHE_FOUND_BUSY)
+                    {
+                      fall_back = true;
+                      continue;
+                    }
                   return 0;
                 }
 
@@ -1038,6 +1058,35 @@ TAO_Connector::new_connection_is_ok (size_t busy_count)
   return mux_limit == 0 || busy_count < mux_limit;
 }
 
+size_t
+TAO_Connector::connection_pool_maximum (TAO::Profile_Transport_Resolver *r)
+{
+  if (this->orb_core_ == 0)
+    return 0;
+
+  int pool_maximum =
+    this->orb_core_->resource_factory ()->connection_pool_maximum ();
+
+  bool has_pool = false;
+  CORBA::ULong policy_maximum = 0;
+  this->orb_core_->call_connection_pool_hook (r == 0 ? 0 : r->stub (),
+                                              has_pool,
+                                              policy_maximum);
+  if (has_pool)
+    pool_maximum = static_cast<int> (policy_maximum);
+
+  if (pool_maximum <= 0)
+    return 0;
+
+  // The pool never grows beyond -ORBMuxedConnectionMax
+  int const mux_limit =
+    this->orb_core_->resource_factory ()->max_muxed_connections ();
+  if (mux_limit > 0 && mux_limit < pool_maximum)
+    pool_maximum = mux_limit;
+
+  return static_cast<size_t> (pool_maximum);
+}
+
 int
 TAO_Connector::check_connection_closure (
   TAO_Connection_Handler *connection_handler)
@@ -197,6 +197,11 @@ protected:
   /// See if a new connection is allowed
   bool new_connection_is_ok (size_t busy_count);
 
+  /// Return the number of pooled connections to an endpoint allowed
+  /// for the invocation, from the ConnectionPoolPolicy or the ORB
+  /// configuration, or 0 if connections are not pooled.
+  size_t connection_pool_maximum (TAO::Profile_Transport_Resolver *r);
+
   /// Wait for a transport to be connected
   /// Note: no longer changes transport reference count
   /// @retval true if wait was uneventful
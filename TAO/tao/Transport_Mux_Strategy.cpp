@@ -12,4 +12,10 @@ TAO_Transport_Mux_Strategy::~TAO_Transport_Mux_Strategy (void)
 {
 }
 
+size_t
+TAO_Transport_Mux_Strategy::pending_requests (void) const
+{
+  return 0;
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -88,6 +88,11 @@ public:
   /// Do we have a request pending
   virtual bool has_request (void) = 0;
 
+  /// Number of requests waiting for a reply.  Read without locking,
+  /// it is only a hint used to pick the least loaded connection to an
+  /// endpoint.  The default implementation returns 0.
+  virtual size_t pending_requests (void) const;
+
 protected:
   /// Cache the transport reference.
   TAO_Transport *transport_;
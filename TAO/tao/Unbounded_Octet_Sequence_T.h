@@ -295,6 +295,33 @@ public:
     return * this;
   }
 
+#if defined (ACE_HAS_CPP11)
+  /// Take the buffer and the message block of @a rhs, leaving it
+  /// empty.
+  inline unbounded_value_sequence<CORBA::Octet> (
+      unbounded_value_sequence<CORBA::Octet> && rhs) noexcept
+    : maximum_ (rhs.maximum_)
+    , length_ (rhs.length_)
+    , buffer_ (rhs.buffer_)
+    , release_ (rhs.release_)
+    , mb_ (rhs.mb_)
+  {
+    rhs.maximum_ = allocation_traits::default_maximum ();
+    rhs.length_ = 0;
+    rhs.buffer_ = 0;
+    rhs.release_ = false;
+    rhs.mb_ = 0;
+  }
+
+  unbounded_value_sequence<CORBA::Octet> &
+  operator= (unbounded_value_sequence<CORBA::Octet> && rhs) noexcept
+  {
+    unbounded_value_sequence<CORBA::Octet> tmp(std::move (rhs));
+    swap(tmp);
+    return * this;
+  }
+#endif /* ACE_HAS_CPP11 */
+
 private:
   /// The maximum number of elements the buffer can contain.
   CORBA::ULong maximum_;
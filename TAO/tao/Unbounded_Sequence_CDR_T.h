@@ -12,10 +12,48 @@
 #include "tao/orbconf.h"
 #include "tao/CORBA_String.h"
 #include "tao/SystemException.h"
+#include "tao/CDR_Layout_Traits_T.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 namespace TAO {
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+  /// Make @a target refer to the @a new_length elements at the read
+  /// pointer of @a strm and skip them.  Returns false, leaving @a target
+  /// alone, when the elements must be copied: their layout in CDR
+  /// differs from the one in memory, they are misaligned or byte
+  /// swapped, or the data block of the stream cannot be shared.
+  template <typename stream, typename value_t>
+  bool borrow_sequence(stream & strm, TAO::unbounded_value_sequence <value_t> & target, ::CORBA::ULong new_length) {
+    typedef TAO::CDR_Layout_Traits <value_t> layout;
+    if (layout::size == 0 || sizeof (value_t) != layout::size) {
+      return false;
+    }
+    if (new_length == 0 || strm.do_byte_swap ()) {
+      return false;
+    }
+    if (!strm.data_block_shareable ()) {
+      return false;
+    }
+    if (strm.align_read_ptr (layout::read_alignment) != 0) {
+      return false;
+    }
+    char * const start = strm.rd_ptr ();
+    if (ACE_ptr_align_binary (start, layout::alignment) != start) {
+      return false;
+    }
+    size_t const available = strm.length ();
+    if (available < layout::encoded_size
+        || new_length - 1 > (available - layout::encoded_size) / layout::size) {
+      return false;
+    }
+    TAO::unbounded_value_sequence <value_t> tmp (new_length, strm.start ());
+    strm.skip_bytes ((new_length - 1) * layout::size + layout::encoded_size);
+    tmp.swap(target);
+    return true;
+  }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
+
   template <typename stream>
   bool demarshal_sequence(stream & strm, unbounded_value_sequence <CORBA::Short> & target) {
     typedef TAO::unbounded_value_sequence <CORBA::Short> sequence;
@@ -26,6 +64,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (borrow_sequence (strm, target, new_length)) {
+      return true;
+    }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -46,6 +89,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (borrow_sequence (strm, target, new_length)) {
+      return true;
+    }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -66,6 +114,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (borrow_sequence (strm, target, new_length)) {
+      return true;
+    }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -86,6 +139,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (borrow_sequence (strm, target, new_length)) {
+      return true;
+    }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -203,6 +261,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (borrow_sequence (strm, target, new_length)) {
+      return true;
+    }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -223,6 +286,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (borrow_sequence (strm, target, new_length)) {
+      return true;
+    }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -243,6 +311,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (borrow_sequence (strm, target, new_length)) {
+      return true;
+    }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -263,6 +336,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (borrow_sequence (strm, target, new_length)) {
+      return true;
+    }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -323,6 +401,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (borrow_sequence (strm, target, new_length)) {
+      return true;
+    }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
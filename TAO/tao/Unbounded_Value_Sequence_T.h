@@ -9,10 +9,15 @@
  * @author Carlos O'Ryan
  */
 
+#include "tao/orbconf.h"
 #include "tao/Unbounded_Value_Allocation_Traits_T.h"
 #include "tao/Value_Traits_T.h"
 #include "tao/Generic_Sequence_T.h"
 
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+#include "ace/Message_Block.h"
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
+
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 namespace TAO
@@ -33,6 +38,82 @@ public:
   typedef details::value_traits<value_type,true> element_traits;
   typedef details::generic_sequence<value_type, allocation_traits, element_traits> implementation_type;
 
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+  inline unbounded_value_sequence()
+    : impl_()
+    , mb_(0)
+  {}
+  inline explicit unbounded_value_sequence(CORBA::ULong maximum)
+    : impl_(maximum)
+    , mb_(0)
+  {}
+  inline unbounded_value_sequence(
+      CORBA::ULong maximum,
+      CORBA::ULong length,
+      value_type * data,
+      CORBA::Boolean release = false)
+    : impl_(maximum, length, data, release)
+    , mb_(0)
+  {}
+  /// Create a sequence of the @a length elements at the read pointer
+  /// of @a mb, which must be aligned for them.  The sequence keeps a
+  /// reference on the data block and copies the elements before they
+  /// are modified.
+  inline unbounded_value_sequence(
+      CORBA::ULong length,
+      const ACE_Message_Block * mb)
+    : impl_(length,
+            length,
+            reinterpret_cast<value_type *>(mb->rd_ptr()),
+            false)
+    , mb_(ACE_Message_Block::duplicate(mb))
+  {}
+  /// Copying a sequence that refers to a message block shares the
+  /// elements too.
+  inline unbounded_value_sequence(unbounded_value_sequence const & rhs)
+    : impl_()
+    , mb_(0)
+  {
+    if (rhs.mb_ == 0)
+      {
+        implementation_type tmp(rhs.impl_);
+        impl_.swap(tmp);
+        return;
+      }
+    implementation_type tmp(rhs.impl_.maximum(),
+                            rhs.impl_.length(),
+                            const_cast<value_type *>(rhs.impl_.get_buffer()),
+                            false);
+    impl_.swap(tmp);
+    mb_ = ACE_Message_Block::duplicate(rhs.mb_);
+  }
+  inline unbounded_value_sequence & operator=(
+      unbounded_value_sequence const & rhs)
+  {
+    unbounded_value_sequence tmp(rhs);
+    swap(tmp);
+    return * this;
+  }
+#if defined (ACE_HAS_CPP11)
+  inline unbounded_value_sequence(unbounded_value_sequence && rhs) noexcept
+    : impl_(std::move(rhs.impl_))
+    , mb_(rhs.mb_)
+  {
+    rhs.mb_ = 0;
+  }
+  inline unbounded_value_sequence & operator=(
+      unbounded_value_sequence && rhs) noexcept
+  {
+    unbounded_value_sequence tmp(std::move(rhs));
+    swap(tmp);
+    return * this;
+  }
+#endif /* ACE_HAS_CPP11 */
+  inline ~unbounded_value_sequence() {
+    if (mb_)
+      ACE_Message_Block::release(mb_);
+  }
+#else
   inline unbounded_value_sequence()
     : impl_()
   {}
@@ -47,6 +128,7 @@ public:
     : impl_(maximum, length, data, release)
   {}
   /* Use default ctor, operator= and dtor */
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
   inline CORBA::ULong maximum() const {
     return impl_.maximum();
   }
@@ -57,12 +139,14 @@ public:
     return impl_.length();
   }
   inline void length(CORBA::ULong length) {
+    detach();
     impl_.length(length);
   }
   inline value_type const & operator[](CORBA::ULong i) const {
     return impl_[i];
   }
   inline value_type & operator[](CORBA::ULong i) {
+    detach();
     return impl_[i];
   }
   inline void replace(
@@ -71,15 +155,20 @@ public:
       value_type * data,
       CORBA::Boolean release = false) {
     impl_.replace(maximum, length, data, release);
+    reset_mb();
   }
   inline value_type const * get_buffer() const {
     return impl_.get_buffer();
   }
   inline value_type * get_buffer(CORBA::Boolean orphan = false) {
+    detach();
     return impl_.get_buffer(orphan);
   }
   inline void swap(unbounded_value_sequence & rhs) throw() {
     impl_.swap(rhs.impl_);
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    std::swap(mb_, rhs.mb_);
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
   }
   static value_type * allocbuf(CORBA::ULong maximum) {
     return implementation_type::allocbuf(maximum);
@@ -88,6 +177,21 @@ public:
     implementation_type::freebuf(buffer);
   }
 
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+  /// Returns the message block the elements are in, 0 if the sequence
+  /// owns them.  The caller must *not* release it.
+  inline ACE_Message_Block * mb() const {
+    return mb_;
+  }
+
+  /// Replaces the elements with the @a length elements at the read
+  /// pointer of @a mb, taking a duplicate of it.
+  inline void replace(CORBA::ULong length, const ACE_Message_Block * mb) {
+    unbounded_value_sequence tmp(length, mb);
+    swap(tmp);
+  }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
+
 #if defined TAO_HAS_SEQUENCE_ITERATORS && TAO_HAS_SEQUENCE_ITERATORS == 1
 
   ///
@@ -104,6 +208,7 @@ public:
   // Get an iterator that points to the beginning of the sequence.
   iterator begin (void)
   {
+    detach ();
     return impl_.begin ();
   }
 
@@ -116,6 +221,7 @@ public:
   // Get an iterator that points to the end of the sequence.
   iterator end (void)
   {
+    detach ();
     return impl_.end ();
   }
 
@@ -128,6 +234,7 @@ public:
   // Get a reverse iterator that points to the end of the sequence.
   reverse_iterator rbegin (void)
   {
+    detach ();
     return impl_.rbegin ();
   }
 
@@ -141,6 +248,7 @@ public:
   // of the sequence.
   reverse_iterator rend (void)
   {
+    detach ();
     return impl_.rend ();
   }
 
@@ -154,7 +262,36 @@ public:
 #endif /* TAO_HAS_SEQUENCE_ITERATORS==1 */
 
 private:
+  /// Give the sequence its own copy of the elements it shares with a
+  /// message block, before they may be modified.
+  inline void detach() {
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (mb_ != 0)
+      {
+        implementation_type tmp(impl_);
+        impl_.swap(tmp);
+        reset_mb();
+      }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
+  }
+
+  /// Drop the message block the elements were in.
+  inline void reset_mb() {
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (mb_ != 0)
+      {
+        ACE_Message_Block::release(mb_);
+        mb_ = 0;
+      }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
+  }
+
   implementation_type impl_;
+
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+  /// The message block the elements are in, if they were not copied.
+  ACE_Message_Block * mb_;
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
 };
 
 } // namespace TAO
@@ -5,6 +5,7 @@
 #include "tao/Valuetype/Value_CORBA_methods.h"
 
 #include <algorithm>  /* For std::swap<>() */
+#include <utility>
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -31,6 +32,26 @@ TAO_Value_Var_T<T>::TAO_Value_Var_T (const TAO_Value_Var_T<T> & p)
   this->ptr_ = p.ptr ();
 }
 
+#if defined (ACE_HAS_CPP11)
+template <typename T>
+TAO_Value_Var_T<T>::TAO_Value_Var_T (TAO_Value_Var_T<T> && p) noexcept
+  : TAO_Base_var (),
+    ptr_ (p.ptr_)
+{
+  p.ptr_ = 0;
+}
+
+template <typename T>
+TAO_Value_Var_T<T> &
+TAO_Value_Var_T<T>::operator= (TAO_Value_Var_T<T> && p) noexcept
+{
+  TAO_Value_Var_T<T> tmp (std::move (p));
+  std::swap (this->ptr_, tmp.ptr_);
+
+  return *this;
+}
+#endif /* ACE_HAS_CPP11 */
+
 template <typename T>
 TAO_Value_Var_T<T>::~TAO_Value_Var_T (void)
 {
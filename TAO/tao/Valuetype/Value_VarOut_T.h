@@ -54,6 +54,13 @@ public:
   TAO_Value_Var_T &operator= (T *);
   TAO_Value_Var_T &operator= (const TAO_Value_Var_T<T> &);
 
+#if defined (ACE_HAS_CPP11)
+  /// Take the value held by the other _var, its reference count is
+  /// left unchanged.
+  TAO_Value_Var_T (TAO_Value_Var_T<T> &&) noexcept;
+  TAO_Value_Var_T &operator= (TAO_Value_Var_T<T> &&) noexcept;
+#endif /* ACE_HAS_CPP11 */
+
   T * operator-> (void) const;
 
   operator const T * () const;
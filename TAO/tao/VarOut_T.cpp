@@ -48,6 +48,22 @@ TAO_Fixed_Var_T<T>::operator= (const T & p)
   return *this;
 }
 
+#if defined (ACE_HAS_CPP11)
+// Fixed-size types only.
+template<typename T>
+TAO_Fixed_Var_T<T> &
+TAO_Fixed_Var_T<T>::operator= (T && p)
+{
+  TAO_Fixed_Var_T<T> tmp (std::move (p));
+
+  T * old_ptr = this->ptr_;
+  this->ptr_ = tmp.ptr_;
+  tmp.ptr_ = old_ptr;
+
+  return *this;
+}
+#endif /* ACE_HAS_CPP11 */
+
 // *************************************************************
 
 template<typename T>
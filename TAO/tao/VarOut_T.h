@@ -17,6 +17,10 @@
 
 #include "ace/OS_Memory.h"
 
+#if defined (ACE_HAS_CPP11)
+# include <utility>
+#endif /* ACE_HAS_CPP11 */
+
 #if !defined (ACE_LACKS_PRAGMA_ONCE)
 # pragma once
 #endif /* ACE_LACKS_PRAGMA_ONCE */
@@ -36,6 +40,10 @@ public:
   TAO_Var_Base_T (void);
   TAO_Var_Base_T (T *);
   TAO_Var_Base_T (const TAO_Var_Base_T<T> &);
+#if defined (ACE_HAS_CPP11)
+  /// Take the pointer held by the other _var.
+  TAO_Var_Base_T (TAO_Var_Base_T<T> &&) noexcept;
+#endif /* ACE_HAS_CPP11 */
 
   ~TAO_Var_Base_T (void);
 
@@ -80,6 +88,13 @@ public:
   // Fixed-size types only.
   TAO_Fixed_Var_T & operator= (const T &);
 
+#if defined (ACE_HAS_CPP11)
+  TAO_Fixed_Var_T (TAO_Fixed_Var_T<T> &&) noexcept;
+  TAO_Fixed_Var_T (T &&);
+  TAO_Fixed_Var_T & operator= (TAO_Fixed_Var_T<T> &&) noexcept;
+  TAO_Fixed_Var_T & operator= (T &&);
+#endif /* ACE_HAS_CPP11 */
+
   operator const T & () const;
   operator T & ();
   operator T & () const;
@@ -109,6 +124,11 @@ public:
   TAO_Var_Var_T & operator= (T *);
   TAO_Var_Var_T & operator= (const TAO_Var_Var_T<T> &);
 
+#if defined (ACE_HAS_CPP11)
+  TAO_Var_Var_T (TAO_Var_Var_T<T> &&) noexcept;
+  TAO_Var_Var_T & operator= (TAO_Var_Var_T<T> &&) noexcept;
+#endif /* ACE_HAS_CPP11 */
+
   operator const T & () const;
   operator T & ();
   operator T & () const;
@@ -13,6 +13,16 @@ TAO_Var_Base_T<T>::TAO_Var_Base_T (T * p)
   : ptr_ (p)
 {}
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_Var_Base_T<T>::TAO_Var_Base_T (TAO_Var_Base_T<T> && p) noexcept
+  : ptr_ (p.ptr_)
+{
+  p.ptr_ = 0;
+}
+#endif /* ACE_HAS_CPP11 */
+
 template<typename T>
 ACE_INLINE
 TAO_Var_Base_T<T>::~TAO_Var_Base_T (void)
@@ -105,6 +115,34 @@ TAO_Fixed_Var_T<T>::operator= (T * p)
   return *this;
 }
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_Fixed_Var_T<T>::TAO_Fixed_Var_T (TAO_Fixed_Var_T<T> && p) noexcept
+  : TAO_Var_Base_T<T> (std::move (p))
+{}
+
+template<typename T>
+ACE_INLINE
+TAO_Fixed_Var_T<T>::TAO_Fixed_Var_T (T && p)
+{
+  ACE_NEW (this->ptr_,
+           T (std::move (p)));
+}
+
+template<typename T>
+ACE_INLINE
+TAO_Fixed_Var_T<T> &
+TAO_Fixed_Var_T<T>::operator= (TAO_Fixed_Var_T<T> && p) noexcept
+{
+  T * old_ptr = this->ptr_;
+  this->ptr_ = p.ptr_;
+  p.ptr_ = 0;
+  delete old_ptr;
+  return *this;
+}
+#endif /* ACE_HAS_CPP11 */
+
 template<typename T>
 ACE_INLINE
 TAO_Fixed_Var_T<T>::operator const T & () const
@@ -184,6 +222,26 @@ TAO_Var_Var_T<T>::operator= (T * p)
   return *this;
 }
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_Var_Var_T<T>::TAO_Var_Var_T (TAO_Var_Var_T<T> && p) noexcept
+  : TAO_Var_Base_T<T> (std::move (p))
+{}
+
+template<typename T>
+ACE_INLINE
+TAO_Var_Var_T<T> &
+TAO_Var_Var_T<T>::operator= (TAO_Var_Var_T<T> && p) noexcept
+{
+  T * old_ptr = this->ptr_;
+  this->ptr_ = p.ptr_;
+  p.ptr_ = 0;
+  delete old_ptr;
+  return *this;
+}
+#endif /* ACE_HAS_CPP11 */
+
 template<typename T>
 ACE_INLINE
 TAO_Var_Var_T<T>::operator const T & () const
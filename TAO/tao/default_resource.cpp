@@ -108,6 +108,11 @@ TAO_Default_Resource_Factory::TAO_Default_Resource_Factory (void)
   , cache_maximum_ (TAO_CONNECTION_CACHE_MAXIMUM)
   , purge_percentage_ (TAO_PURGE_PERCENT)
   , max_muxed_connections_ (0)
+  , connection_pool_maximum_ (0)
+  , connection_pool_minimum_ (1)
+  , flush_combining_ (false)
+  , stub_cache_maximum_ (TAO_STUB_CACHE_MAXIMUM)
+  , is_a_cache_maximum_ (TAO_IS_A_CACHE_MAXIMUM)
   , reactor_mask_signals_ (1)
   , dynamically_allocated_reactor_ (false)
   , options_processed_ (0)
@@ -423,6 +428,67 @@ TAO_Default_Resource_Factory::init (int argc, ACE_TCHAR *argv[])
           this->report_option_value_error (ACE_TEXT("-ORBMuxedConnectionMax"),
                                            argv[curarg]);
       }
+    else if (ACE_OS::strcasecmp (argv[curarg],
+                                 ACE_TEXT ("-ORBConnectionPoolMax")) == 0)
+      {
+        ++curarg;
+        if (curarg < argc)
+            this->connection_pool_maximum_ =
+              ACE_OS::atoi (argv[curarg]);
+        else
+          this->report_option_value_error (ACE_TEXT("-ORBConnectionPoolMax"),
+                                           argv[curarg]);
+      }
+    else if (ACE_OS::strcasecmp (argv[curarg],
+                                 ACE_TEXT ("-ORBConnectionPoolMin")) == 0)
+      {
+        ++curarg;
+        if (curarg < argc)
+            this->connection_pool_minimum_ =
+              ACE_OS::atoi (argv[curarg]);
+        else
+          this->report_option_value_error (ACE_TEXT("-ORBConnectionPoolMin"),
+                                           argv[curarg]);
+      }
+    else if (ACE_OS::strcasecmp (argv[curarg],
+                                 ACE_TEXT ("-ORBFlushCombining")) == 0)
+      {
+        ++curarg;
+        if (curarg < argc)
+          {
+            int tmp = ACE_OS::atoi (argv[curarg]);
+
+            if (tmp == 0)
+              this->flush_combining_ = false;
+            else
+              this->flush_combining_ = true;
+          }
+        else
+          this->report_option_value_error (ACE_TEXT("-ORBFlushCombining"),
+                                           argv[curarg]);
+      }
+    else if (ACE_OS::strcasecmp (argv[curarg],
+                                 ACE_TEXT ("-ORBStubCacheMax")) == 0)
+      {
+        ++curarg;
+        if (curarg < argc)
+            this->stub_cache_maximum_ =
+              ACE_OS::atoi (argv[curarg]);
+        else
+          this->report_option_value_error (ACE_TEXT("-ORBStubCacheMax"),
+                                           argv[curarg]);
+      }
+    else if (ACE_OS::strcasecmp (argv[curarg],
+                                 ACE_TEXT ("-ORBIsACacheMax")) == 0)
+      {
+        ++curarg;
+        if (curarg < argc)
+            this->is_a_cache_maximum_ =
+              ACE_OS::atoi (argv[curarg]);
+        else
+          this->report_option_value_error (ACE_TEXT("-ORBIsACacheMax"),
+                                           argv[curarg]);
+      }
     else if (ACE_OS::strcasecmp (argv[curarg],
                                  ACE_TEXT("-ORBDropRepliesDuringShutdown")) == 0)
       {
@@ -1029,6 +1095,36 @@ TAO_Default_Resource_Factory::max_muxed_connections (void) const
   return this->max_muxed_connections_;
 }
 
+int
+TAO_Default_Resource_Factory::connection_pool_maximum (void) const
+{
+  return this->connection_pool_maximum_;
+}
+
+int
+TAO_Default_Resource_Factory::connection_pool_minimum (void) const
+{
+  return this->connection_pool_minimum_;
+}
+
+bool
+TAO_Default_Resource_Factory::flush_combining (void) const
+{
+  return this->flush_combining_;
+}
+
+int
+TAO_Default_Resource_Factory::stub_cache_maximum (void) const
+{
+  return this->stub_cache_maximum_;
+}
+
+int
+TAO_Default_Resource_Factory::is_a_cache_maximum (void) const
+{
+  return this->is_a_cache_maximum_;
+}
+
 
 ACE_Lock *
 TAO_Default_Resource_Factory::create_cached_connection_lock (void)
@@ -175,6 +175,11 @@ public:
   virtual int cache_maximum (void) const;
   virtual int purge_percentage (void) const;
   virtual int max_muxed_connections (void) const;
+  virtual int connection_pool_maximum (void) const;
+  virtual int connection_pool_minimum (void) const;
+  virtual bool flush_combining (void) const;
+  virtual int stub_cache_maximum (void) const;
+  virtual int is_a_cache_maximum (void) const;
   virtual ACE_Lock *create_cached_connection_lock (void);
   virtual int locked_transport_cache (void);
   virtual TAO_Flushing_Strategy *create_flushing_strategy (void);
@@ -243,6 +248,26 @@ protected:
   /// limit
   int max_muxed_connections_;
 
+  /// Specifies the number of muxed connections to an endpoint that
+  /// requests are balanced over.  A value of 0 disables pooling.
+  int connection_pool_maximum_;
+
+  /// Specifies the number of pooled connections that are kept when
+  /// the load drops.
+  int connection_pool_minimum_;
+
+  /// If true, threads sending on the same transport combine their
+  /// flushes.
+  bool flush_combining_;
+
+  /// Specifies the number of demarshaled object references whose
+  /// profiles are kept.  A value of 0 disables the cache.
+  int stub_cache_maximum_;
+
+  /// Specifies the number of _is_a() answers kept for the type ids of
+  /// object references.  A value of 0 disables the cache.
+  int is_a_cache_maximum_;
+
   /// If 0 then we create reactors with signal handling disabled.
   int reactor_mask_signals_;
 
@@ -211,6 +211,10 @@ TAO_Default_Server_Strategy_Factory::parse_args (int argc, ACE_TCHAR* argv[])
                                          ACE_TEXT("linear")) == 0)
               this->active_object_map_creation_parameters_.object_lookup_strategy_for_user_id_policy_ =
                 TAO_LINEAR;
+            else if (ACE_OS::strcasecmp (name,
+                                         ACE_TEXT("flat")) == 0)
+              this->active_object_map_creation_parameters_.object_lookup_strategy_for_user_id_policy_ =
+                TAO_FLAT_HASH;
             else
               this->report_option_value_error (ACE_TEXT("-ORBUseridPolicyDemuxStrategy"), name);
           }
@@ -231,6 +235,10 @@ TAO_Default_Server_Strategy_Factory::parse_args (int argc, ACE_TCHAR* argv[])
                                          ACE_TEXT("linear")) == 0)
               this->active_object_map_creation_parameters_.object_lookup_strategy_for_system_id_policy_ =
                 TAO_LINEAR;
+            else if (ACE_OS::strcasecmp (name,
+                                         ACE_TEXT("flat")) == 0)
+              this->active_object_map_creation_parameters_.object_lookup_strategy_for_system_id_policy_ =
+                TAO_FLAT_HASH;
             else if (ACE_OS::strcasecmp (name,
                                          ACE_TEXT("active")) == 0)
               this->active_object_map_creation_parameters_.object_lookup_strategy_for_system_id_policy_ =
@@ -256,6 +264,10 @@ TAO_Default_Server_Strategy_Factory::parse_args (int argc, ACE_TCHAR* argv[])
                                          ACE_TEXT("linear")) == 0)
               this->active_object_map_creation_parameters_.poa_lookup_strategy_for_persistent_id_policy_ =
                 TAO_LINEAR;
+            else if (ACE_OS::strcasecmp (name,
+                                         ACE_TEXT("flat")) == 0)
+              this->active_object_map_creation_parameters_.poa_lookup_strategy_for_persistent_id_policy_ =
+                TAO_FLAT_HASH;
             else
               this->report_option_value_error (ACE_TEXT("-ORBPersistentidPolicyDemuxStrategy"), name);
           }
@@ -276,6 +288,10 @@ TAO_Default_Server_Strategy_Factory::parse_args (int argc, ACE_TCHAR* argv[])
                                          ACE_TEXT("linear")) == 0)
               this->active_object_map_creation_parameters_.poa_lookup_strategy_for_transient_id_policy_ =
                 TAO_LINEAR;
+            else if (ACE_OS::strcasecmp (name,
+                                         ACE_TEXT("flat")) == 0)
+              this->active_object_map_creation_parameters_.poa_lookup_strategy_for_transient_id_policy_ =
+                TAO_FLAT_HASH;
             else if (ACE_OS::strcasecmp (name,
                                          ACE_TEXT("active")) == 0)
               this->active_object_map_creation_parameters_.poa_lookup_strategy_for_transient_id_policy_ =
@@ -300,6 +316,10 @@ TAO_Default_Server_Strategy_Factory::parse_args (int argc, ACE_TCHAR* argv[])
                                          ACE_TEXT("linear")) == 0)
               this->active_object_map_creation_parameters_.reverse_object_lookup_strategy_for_unique_id_policy_ =
                 TAO_LINEAR;
+            else if (ACE_OS::strcasecmp (name,
+                                         ACE_TEXT("flat")) == 0)
+              this->active_object_map_creation_parameters_.reverse_object_lookup_strategy_for_unique_id_policy_ =
+                TAO_FLAT_HASH;
             else
               this->report_option_value_error (ACE_TEXT("-ORBUniqueidPolicyReverseDemuxStrategy"), name);
           }
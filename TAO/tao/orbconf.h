@@ -186,10 +186,44 @@ const size_t TAO_DEFAULT_VALUE_FACTORY_TABLE_SIZE = 128;
 # define TAO_CONNECTION_CACHE_MAXIMUM (ACE::max_handles () / 2)
 #endif /* TAO_CONNECTION_CACHE_MAXIMUM */
 
+#if !defined (TAO_CONNECTION_POOL_IDLE_LOOKUPS)
+// When connections to an endpoint are pooled (see -ORBConnectionPoolMax),
+// a connection that stayed idle while this many lookups in a row
+// picked another connection to the same endpoint is closed.
+# define TAO_CONNECTION_POOL_IDLE_LOOKUPS 256
+#endif /* TAO_CONNECTION_POOL_IDLE_LOOKUPS */
+
+#if !defined (TAO_FLUSH_COMBINING_SPINS)
+// When flushes are combined (see -ORBFlushCombining), a thread that
+// published a message yields this many times, waiting for another
+// thread to send it, before it blocks on the transport lock.
+# define TAO_FLUSH_COMBINING_SPINS 32
+#endif /* TAO_FLUSH_COMBINING_SPINS */
+
+#if !defined (TAO_STUB_CACHE_MAXIMUM)
+// The number of object references the ORB keeps the decoded profiles
+// of, for when it demarshals them again (see -ORBStubCacheMax).
+# define TAO_STUB_CACHE_MAXIMUM 1024
+#endif /* TAO_STUB_CACHE_MAXIMUM */
+
+#if !defined (TAO_IS_A_CACHE_MAXIMUM)
+// The number of _is_a() answers the ORB keeps for the type ids of the
+// object references it narrows (see -ORBIsACacheMax).
+# define TAO_IS_A_CACHE_MAXIMUM 256
+#endif /* TAO_IS_A_CACHE_MAXIMUM */
+
 #if !defined(TAO_NO_COPY_OCTET_SEQUENCES)
 # define TAO_NO_COPY_OCTET_SEQUENCES 1
 #endif /* TAO_NO_COPY_OCTET_SEQUENCES */
 
+// Define to 1 to let unbounded sequences of fixed-size numeric types
+// and of structs with the same layout in CDR and in memory refer to
+// the octets of the CDR stream they are demarshaled from, instead of
+// copying them.  The elements are copied when they are modified.
+#if !defined(TAO_NO_COPY_VALUE_SEQUENCES)
+# define TAO_NO_COPY_VALUE_SEQUENCES 0
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES */
+
 // Define if your processor does not store words with the most significant
 // byte first.
 
@@ -539,6 +573,18 @@ const size_t TAO_DEFAULT_VALUE_FACTORY_TABLE_SIZE = 128;
              TAO_DISABLE_CORBA_MESSAGING_POLICIES == 0 */
 #endif  /* !TAO_HAS_CONNECTION_TIMEOUT_POLICY */
 
+// Default CONNECTION_POOL_POLICY settings. This is a proprietary
+// TAO policy.
+#if !defined (TAO_HAS_CONNECTION_POOL_POLICY)
+#  if (TAO_HAS_CORBA_MESSAGING == 1) && \
+      (TAO_DISABLE_CORBA_MESSAGING_POLICIES == 0)
+#    define TAO_HAS_CONNECTION_POOL_POLICY 1
+#  else
+#    define TAO_HAS_CONNECTION_POOL_POLICY 0
+#  endif  /* TAO_HAS_CORBA_MESSAGING == 1 &&
+             TAO_DISABLE_CORBA_MESSAGING_POLICIES == 0 */
+#endif  /* !TAO_HAS_CONNECTION_POOL_POLICY */
+
 
 // To explicitly disable ROUTING_POLICY support uncomment the following
 // #define TAO_HAS_ROUTING_POLICY 0
@@ -656,6 +702,14 @@ const size_t TAO_DEFAULT_VALUE_FACTORY_TABLE_SIZE = 128;
 # endif /* TAO_HAS_MINIMUM_CORBA */
 #endif
 
+/// The stubs generated by the IDL compiler register the base
+/// interfaces of each interface, so _is_a() can be answered locally
+/// for the types linked into the process.  Set to 0 to leave out the
+/// static registration objects.
+#if !defined (TAO_HAS_BASE_INTERFACE_TABLE)
+# define TAO_HAS_BASE_INTERFACE_TABLE 1
+#endif /* !TAO_HAS_BASE_INTERFACE_TABLE */
+
 /// At the moment we have sendfile support in ACE we enabled this also by
 /// default for TAO, but we can suppress it also explicitly by set
 /// TAO_HAS_SENDFILE to 0.
@@ -716,6 +770,10 @@ enum TAO_Cached_Policy_Type
   TAO_CACHED_POLICY_CONNECTION_TIMEOUT,
 #endif /* TAO_HAS_CONNECTION_TIMEOUT_POLICY == 1 */
 
+#if (TAO_HAS_CONNECTION_POOL_POLICY == 1)
+  TAO_CACHED_POLICY_CONNECTION_POOL,
+#endif /* TAO_HAS_CONNECTION_POOL_POLICY == 1 */
+
   TAO_CACHED_POLICY_BIDIRECTIONAL_GIOP,
 
   TAO_CACHED_POLICY_SERVER_NETWORK_PRIORITY,
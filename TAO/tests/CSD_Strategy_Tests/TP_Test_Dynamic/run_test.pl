@@ -9,11 +9,15 @@ use PerlACE::TestTarget;
 
 $status = 0;
 $debug_level = '0';
+$conf_file = 'svc.conf';
 
 foreach $i (@ARGV) {
     if ($i eq '-debug') {
         $debug_level = '10';
     }
+    elsif ($i eq '-steal') {
+        $conf_file = 'svc_steal.conf';
+    }
 }
 
 my $server = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
@@ -36,7 +40,9 @@ my $client_iorfile = $client->LocalFile ($iorbase);
 $server->DeleteFile($iorbase);
 $client->DeleteFile($iorbase);
 
-$SV = $server->CreateProcess ("server", "-ORBdebuglevel $debug_level -o $server_iorfile");
+my $server_conf = $server->LocalFile ($conf_file);
+
+$SV = $server->CreateProcess ("server", "-ORBSvcConf $server_conf -ORBdebuglevel $debug_level -o $server_iorfile");
 $CL = $client->CreateProcess ("client", "-k file://$client_iorfile");
 $server_status = $SV->Spawn ();
 
@@ -14,6 +14,9 @@ show_tp_config (const ACE_CString &name, const TAO_DTP_Definition &entry)
     ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("  Idle Timeout: %d (sec)\n"), entry.timeout_.sec()));
   ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("  Stack Size: %d:\n"), entry.stack_size_));
   ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("  Request queue max depth: %d\n"), entry.queue_depth_));
+  if (entry.target_latency_ != ACE_Time_Value::zero)
+    ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("  Target latency: %d (msec) over %d (msec)\n"),
+                entry.target_latency_.msec (), entry.latency_interval_.msec ()));
 }
 
 int
@@ -46,6 +49,7 @@ ACE_TMAIN(int argc, ACE_TCHAR *argv[])
       ACE_TEXT ("m5"),
       ACE_TEXT ("m6"),
       ACE_TEXT ("m7"),
+      ACE_TEXT ("m8"),
       0
     };
 
@@ -399,6 +399,45 @@ ACE_TMAIN(int argc, ACE_TCHAR *argv[])
                       "default case label value\n"));
         }
 
+#if defined (ACE_HAS_CPP11)
+      // Testing marshaling of a union whose value has been moved.
+
+      MoveUnion moved;
+      MoveLongSeq seq (2);
+      seq.length (2);
+      seq[0] = 1;
+      seq[1] = 2;
+      moved.seq (seq);
+
+      MoveUnion moved_to (std::move (moved));
+      MoveUnion assigned_to;
+      assigned_to = std::move (moved_to);
+
+      TAO_OutputCDR out_cdr;
+
+      if (!(out_cdr << moved) || !(out_cdr << moved_to)
+          || !(out_cdr << assigned_to))
+        {
+          ++error_count;
+          ACE_ERROR ((LM_ERROR,
+                      "error in marshaling of moved union\n"));
+        }
+
+      TAO_InputCDR in_cdr (out_cdr);
+      MoveUnion result;
+
+      if (!(in_cdr >> result) || !(in_cdr >> result)
+          || !(in_cdr >> result)
+          || result._d () != 2
+          || result.seq ().length () != 2
+          || result.seq ()[1] != 2)
+        {
+          ++error_count;
+          ACE_ERROR ((LM_ERROR,
+                      "error - corruption of moved union\n"));
+        }
+#endif /* ACE_HAS_CPP11 */
+
       if (SignedGen::val !=  -3)
         {
           ++error_count;
@@ -0,0 +1,45 @@
+#include "Hidden.h"
+
+Hidden::Hidden (CORBA::ORB_ptr orb, PortableServer::POA_ptr poa)
+  : orb_ (CORBA::ORB::_duplicate (orb))
+  , poa_ (PortableServer::POA::_duplicate (poa))
+  , is_a_calls_ (0)
+{
+}
+
+CORBA::Boolean
+Hidden::_is_a (const char *logical_type_id)
+{
+  ++this->is_a_calls_;
+  return POA_Test::Hidden::_is_a (logical_type_id);
+}
+
+CORBA::Long
+Hidden::is_a_calls (void)
+{
+  return this->is_a_calls_;
+}
+
+CORBA::Object_ptr
+Hidden::as_derived (void)
+{
+  PortableServer::ObjectId_var id = this->poa_->servant_to_id (this);
+
+  return this->poa_->create_reference_with_id (id.in (),
+                                               "IDL:Test/Derived:1.0");
+}
+
+CORBA::Object_ptr
+Hidden::as_base (void)
+{
+  PortableServer::ObjectId_var id = this->poa_->servant_to_id (this);
+
+  return this->poa_->create_reference_with_id (id.in (),
+                                               "IDL:Test/Base:1.0");
+}
+
+void
+Hidden::shutdown (void)
+{
+  this->orb_->shutdown (0);
+}
@@ -0,0 +1,33 @@
+#ifndef IS_A_CACHE_HIDDEN_H
+#define IS_A_CACHE_HIDDEN_H
+#include /**/ "ace/pre.h"
+
+#include "HiddenS.h"
+
+/// Implement the Test::Hidden interface, counting _is_a() requests.
+class Hidden
+  : public virtual POA_Test::Hidden
+{
+public:
+  Hidden (CORBA::ORB_ptr orb, PortableServer::POA_ptr poa);
+
+  virtual CORBA::Boolean _is_a (const char *logical_type_id);
+
+  virtual CORBA::Long is_a_calls (void);
+
+  virtual CORBA::Object_ptr as_derived (void);
+
+  virtual CORBA::Object_ptr as_base (void);
+
+  virtual void shutdown (void);
+
+private:
+  CORBA::ORB_var orb_;
+
+  PortableServer::POA_var poa_;
+
+  CORBA::Long is_a_calls_;
+};
+
+#include /**/ "ace/post.h"
+#endif /* IS_A_CACHE_HIDDEN_H */
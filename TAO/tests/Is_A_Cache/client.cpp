@@ -0,0 +1,142 @@
+#include "TestC.h"
+#include "ace/Get_Opt.h"
+
+const ACE_TCHAR *ior = ACE_TEXT ("file://test.ior");
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("k:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'k':
+        ior = get_opts.opt_arg ();
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-k <ior> "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  int result = 0;
+
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      // The type id of this IOR is Test::Hidden, which the client
+      // does not know.  Only the first narrow to each interface asks
+      // the server.
+      CORBA::Object_var hidden = orb->string_to_object (ior);
+
+      Test::Base_var base;
+      for (int i = 0; i != 3; ++i)
+        {
+          base = Test::Base::_narrow (hidden.in ());
+          if (CORBA::is_nil (base.in ()))
+            {
+              ACE_ERROR ((LM_ERROR,
+                          "ERROR: Object reference <%s> is not a Base\n",
+                          ior));
+              return 1;
+            }
+
+          Test::Unrelated_var unrelated =
+            Test::Unrelated::_narrow (hidden.in ());
+          if (!CORBA::is_nil (unrelated.in ()))
+            {
+              ACE_ERROR ((LM_ERROR,
+                          "ERROR: Object reference is Unrelated\n"));
+              ++result;
+            }
+        }
+
+      // Test::Derived is known, so its base interfaces are.  Whether
+      // it is an Unrelated is only known by the object.
+      CORBA::Object_var object = base->as_derived ();
+      CORBA::String_var derived_ior = orb->object_to_string (object.in ());
+      CORBA::Object_var derived =
+        orb->string_to_object (derived_ior.in ());
+
+      for (int i = 0; i != 3; ++i)
+        {
+          Test::Base_var derived_base = Test::Base::_narrow (derived.in ());
+          if (CORBA::is_nil (derived_base.in ()))
+            {
+              ACE_ERROR ((LM_ERROR,
+                          "ERROR: Derived object reference is not a Base\n"));
+              ++result;
+            }
+
+          Test::Unrelated_var unrelated =
+            Test::Unrelated::_narrow (derived.in ());
+          if (!CORBA::is_nil (unrelated.in ()))
+            {
+              ACE_ERROR ((LM_ERROR,
+                          "ERROR: Derived object reference is Unrelated\n"));
+              ++result;
+            }
+        }
+
+      // The IOR names a base of the actual type of the object, as
+      // references created by the POA before the servant is known do.
+      // Only the object knows it is a Derived.
+      object = base->as_base ();
+      CORBA::String_var base_ior = orb->object_to_string (object.in ());
+      CORBA::Object_var base_only =
+        orb->string_to_object (base_ior.in ());
+
+      for (int i = 0; i != 3; ++i)
+        {
+          Test::Derived_var derived_object =
+            Test::Derived::_narrow (base_only.in ());
+          if (CORBA::is_nil (derived_object.in ()))
+            {
+              ACE_ERROR ((LM_ERROR,
+                          "ERROR: Object reference with a Base IOR "
+                          "is not a Derived\n"));
+              ++result;
+            }
+        }
+
+      // Each object reference asks once for each interface that is
+      // not a base of the type named in its IOR.
+      CORBA::Long const is_a_calls = base->is_a_calls ();
+      if (is_a_calls != 4)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: Server received %d _is_a requests, "
+                      "expected 4\n",
+                      is_a_calls));
+          ++result;
+        }
+
+      base->shutdown ();
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return result;
+}
@@ -9,11 +9,15 @@ use PerlACE::TestTarget;
 
 $status = 0;
 $debug_level = '0';
+$combine = 0;
 
 foreach $i (@ARGV) {
     if ($i eq '-debug') {
         $debug_level = '10';
     }
+    elsif ($i eq '-combine') {
+        $combine = 1;
+    }
 }
 
 my $server = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
@@ -28,11 +32,34 @@ $server->DeleteFile($iorbase);
 $client1->DeleteFile($iorbase);
 $client2->DeleteFile($iorbase);
 
+# With -combine the threads replying on the same connection combine
+# their writes.
+my $server_svcconf = "";
+my $client1_svcconf = "";
+my $client2_svcconf = "";
+if ($combine) {
+    my $svcconf = "combine$PerlACE::svcconf_ext";
+    foreach my $target ($server, $client1, $client2) {
+        if ($target->PutFile ($svcconf) == -1) {
+            print STDERR "ERROR: cannot set file <$svcconf>\n";
+            exit 1;
+        }
+    }
+    $server_svcconf = "-ORBSvcConf " . $server->LocalFile ($svcconf) . " ";
+    $client1_svcconf = "-ORBSvcConf " . $client1->LocalFile ($svcconf) . " ";
+    $client2_svcconf = "-ORBSvcConf " . $client2->LocalFile ($svcconf) . " ";
+}
+
 $SV = $server->CreateProcess ("server",
                               "-ORBdebuglevel $debug_level " .
+                              $server_svcconf .
                               "-o $server_iorfile");
-$CL1 = $client1->CreateProcess ("client", "-k file://$client1_iorfile");
-$CL2 = $client2->CreateProcess ("client", "-k file://$client2_iorfile");
+$CL1 = $client1->CreateProcess ("client",
+                                $client1_svcconf .
+                                "-k file://$client1_iorfile");
+$CL2 = $client2->CreateProcess ("client",
+                                $client2_svcconf .
+                                "-k file://$client2_iorfile");
 
 $server_status = $SV->Spawn ();
 
@@ -95,7 +122,7 @@ if ($client_status != 0) {
     $status = 1;
 }
 
-$CL1->Arguments ("-k file://$client1_iorfile -x");
+$CL1->Arguments ($client1_svcconf . "-k file://$client1_iorfile -x");
 
 $client_status = $CL1->SpawnWaitKill ($client1->ProcessStartWaitInterval() + 60);
 
@@ -3,8 +3,10 @@
 #include "client_interceptors.h"
 #include "Interceptor_Type.h"
 
-Client_ORBInitializer::Client_ORBInitializer (int interceptor_type)
-  : interceptor_type_ (interceptor_type)
+Client_ORBInitializer::Client_ORBInitializer (int interceptor_type,
+                                              int interceptor_count)
+  : interceptor_type_ (interceptor_type),
+    interceptor_count_ (interceptor_count)
 {
 }
 
@@ -19,42 +21,50 @@ Client_ORBInitializer::post_init (
     PortableInterceptor::ORBInitInfo_ptr info)
 {
 
-  PortableInterceptor::ClientRequestInterceptor_ptr tmp =
-    PortableInterceptor::ClientRequestInterceptor::_nil ();
+  // Only the NOOP interceptors can be registered more than once,
+  // the others would add the same service context.
+  int const count =
+    this->interceptor_type_ == IT_NOOP ? this->interceptor_count_ : 1;
 
-  switch (this->interceptor_type_)
+  for (int i = 0; i < count; ++i)
     {
-    default:
-    case IT_NONE:
-      return;
-
-    case IT_NOOP:
-      {
-        // Installing the Vault interceptor
-        ACE_NEW_THROW_EX (tmp,
-                          Vault_Client_Request_NOOP_Interceptor (),
-                          CORBA::NO_MEMORY ());
-        break;
-      }
-    case IT_CONTEXT:
-      {
-        // Installing the Vault interceptor
-        ACE_NEW_THROW_EX (tmp,
-                          Vault_Client_Request_Context_Interceptor (),
-                          CORBA::NO_MEMORY ());
-        break;
-      }
-    case IT_DYNAMIC:
-      {
-        // Installing the Vault interceptor
-        ACE_NEW_THROW_EX (tmp,
-                          Vault_Client_Request_Dynamic_Interceptor (),
-                          CORBA::NO_MEMORY ());
-        break;
-      }
-    }
+      PortableInterceptor::ClientRequestInterceptor_ptr tmp =
+        PortableInterceptor::ClientRequestInterceptor::_nil ();
+
+      switch (this->interceptor_type_)
+        {
+        default:
+        case IT_NONE:
+          return;
 
-  PortableInterceptor::ClientRequestInterceptor_var interceptor = tmp;
+        case IT_NOOP:
+          {
+            // Installing the Vault interceptor
+            ACE_NEW_THROW_EX (tmp,
+                              Vault_Client_Request_NOOP_Interceptor (i),
+                              CORBA::NO_MEMORY ());
+            break;
+          }
+        case IT_CONTEXT:
+          {
+            // Installing the Vault interceptor
+            ACE_NEW_THROW_EX (tmp,
+                              Vault_Client_Request_Context_Interceptor (),
+                              CORBA::NO_MEMORY ());
+            break;
+          }
+        case IT_DYNAMIC:
+          {
+            // Installing the Vault interceptor
+            ACE_NEW_THROW_EX (tmp,
+                              Vault_Client_Request_Dynamic_Interceptor (),
+                              CORBA::NO_MEMORY ());
+            break;
+          }
+        }
 
-  info->add_client_request_interceptor (interceptor.in ());
+      PortableInterceptor::ClientRequestInterceptor_var interceptor = tmp;
+
+      info->add_client_request_interceptor (interceptor.in ());
+    }
 }
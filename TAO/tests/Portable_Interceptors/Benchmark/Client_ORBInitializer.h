@@ -26,7 +26,7 @@ class Client_ORBInitializer :
 {
 public:
   /// Constructor
-  Client_ORBInitializer (int interceptor_type);
+  Client_ORBInitializer (int interceptor_type, int interceptor_count);
 
   virtual void pre_init (PortableInterceptor::ORBInitInfo_ptr info);
 
@@ -35,6 +35,8 @@ public:
 private:
   int interceptor_type_;
   // The type of interceptor that this initializer will create
+  int interceptor_count_;
+  // The number of interceptors of that type it registers.
 };
 
 #if defined(_MSC_VER)
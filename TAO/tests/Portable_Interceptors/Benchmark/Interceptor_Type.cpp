@@ -1,11 +1,14 @@
 // -*- C++ -*-
 #include "Interceptor_Type.h"
 #include "ace/OS_NS_string.h"
+#include "ace/OS_NS_stdlib.h"
 
 void get_interceptor_type (int argc, ACE_TCHAR *argv[],
-                           int &interceptor_type)
+                           int &interceptor_type,
+                           int &interceptor_count)
 {
   interceptor_type = IT_NONE;
+  interceptor_count = 1;
   for (int i = 1; i < argc - 1; ++i)
     {
       if (ACE_OS_String::strcmp (argv[i], ACE_TEXT ("-r")) == 0)
@@ -19,5 +22,7 @@ void get_interceptor_type (int argc, ACE_TCHAR *argv[],
           if (ACE_OS_String::strcmp (argv[i+1], ACE_TEXT ("dynamic")) == 0)
             interceptor_type = IT_DYNAMIC;
         }
+      if (ACE_OS_String::strcmp (argv[i], ACE_TEXT ("-c")) == 0)
+        interceptor_count = ACE_OS::atoi (argv[i+1]);
     }
 }
@@ -23,8 +23,11 @@ enum Interceptor_Type
   IT_DYNAMIC
 };
 
+/// Get the type of interceptor from -r and the number of
+/// interceptors of that type to register from -c, by default one.
 void get_interceptor_type (int argc, ACE_TCHAR *argv[],
-                           int &interceptor_type);
+                           int &interceptor_type,
+                           int &interceptor_count);
 
 #include /**/ "ace/post.h"
 #endif /* TAO_INTERCEPTOR_TYPE_H */
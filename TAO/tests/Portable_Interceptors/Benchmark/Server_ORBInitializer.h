@@ -26,7 +26,7 @@ class Server_ORBInitializer :
 {
 public:
   /// Constructor
-  Server_ORBInitializer (int interceptor_type);
+  Server_ORBInitializer (int interceptor_type, int interceptor_count);
 
   virtual void pre_init (PortableInterceptor::ORBInitInfo_ptr info);
 
@@ -34,6 +34,8 @@ public:
 
 private:
   int interceptor_type_;
+  int interceptor_count_;
+  // The number of interceptors of that type it registers.
 };
 
 #if defined(_MSC_VER)
@@ -16,7 +16,7 @@ int register_interceptor = 1;
 int
 parse_args (int argc, ACE_TCHAR *argv[])
 {
-  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("ef:n:"));
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("ef:n:r:c:"));
   int c;
 
   while ((c = get_opts ()) != -1)
@@ -30,11 +30,16 @@ parse_args (int argc, ACE_TCHAR *argv[])
       case 'n':
         niterations = ACE_OS::atoi (get_opts.opt_arg ());
         break;
+      case 'r':
+      case 'c':
+        // Handled by get_interceptor_type().
+        break;
       case '?':
       default:
         ACE_ERROR_RETURN ((LM_ERROR,
                            "usage:  %s "
-                           "-v -r <register_interceptor> "
+                           "-f <ior> -n <iterations> "
+                           "-r <none|noop|context|dynamic> -c <count>"
                            "\n",
                            argv [0]),
                           -1);
@@ -167,14 +172,16 @@ ACE_TMAIN(int argc, ACE_TCHAR *argv[])
     }
 
   int interceptor_type;
-  get_interceptor_type (argc, argv, interceptor_type);
+  int interceptor_count;
+  get_interceptor_type (argc, argv, interceptor_type, interceptor_count);
 
   try
     {
       PortableInterceptor::ORBInitializer_ptr temp_initializer;
 
       ACE_NEW_RETURN (temp_initializer,
-                      Client_ORBInitializer (interceptor_type),
+                      Client_ORBInitializer (interceptor_type,
+                                             interceptor_count),
                       -1);  // No exceptions yet!
       PortableInterceptor::ORBInitializer_var initializer =
         temp_initializer;
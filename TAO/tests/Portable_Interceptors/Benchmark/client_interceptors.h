@@ -113,7 +113,7 @@ class Vault_Client_Request_NOOP_Interceptor
 {
   // = Client-side Vault interceptor.  For checking interceptor visually only.
 public:
-  Vault_Client_Request_NOOP_Interceptor (void);
+  Vault_Client_Request_NOOP_Interceptor (int index);
   // ctor.
   virtual ~Vault_Client_Request_NOOP_Interceptor ();
   // dtor.
@@ -134,7 +134,7 @@ public:
   virtual void receive_exception (PortableInterceptor::ClientRequestInfo_ptr ri);
 
 private:
-  const char *myname_;
+  CORBA::String_var myname_;
 };
 
 #if defined(_MSC_VER)
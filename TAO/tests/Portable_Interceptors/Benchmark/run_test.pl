@@ -9,6 +9,7 @@ use PerlACE::TestTarget;
 
 $status = 0;
 $debug_level = '0';
+$iterations = 1000;
 
 foreach $i (@ARGV) {
     if ($i eq '-debug') {
@@ -25,52 +26,65 @@ my $client_iorfile = $client->LocalFile ($iorbase);
 $server->DeleteFile($iorbase);
 $client->DeleteFile($iorbase);
 
-$SV = $server->CreateProcess ("server", "-ORBdebuglevel $debug_level " .
-                              "-ORBobjrefstyle url " .
-                              "-o $server_iorfile");
-$CL = $client->CreateProcess ("client",
-                              "-ORBobjrefstyle url " .
-                              "-f file://$client_iorfile");
+# Measure the latency with no interceptor, one and five interceptors
+# that do nothing, the cost of the interception points themselves.
+@configurations = ("-r none",
+                   "-r noop -c 1",
+                   "-r noop -c 5");
 
-print STDERR "\n\n==== Running interceptor Benchmark test\n";
+foreach $configuration (@configurations) {
+    $server->DeleteFile($iorbase);
+    $client->DeleteFile($iorbase);
 
-$server_status = $SV->Spawn ();
+    $SV = $server->CreateProcess ("server", "-ORBdebuglevel $debug_level " .
+                                  "-ORBobjrefstyle url " .
+                                  "-o $server_iorfile $configuration");
+    $CL = $client->CreateProcess ("client",
+                                  "-ORBobjrefstyle url " .
+                                  "-f file://$client_iorfile " .
+                                  "-n $iterations $configuration");
 
-if ($server_status != 0) {
-    print STDERR "ERROR: server returned $server_status\n";
-    exit 1;
-}
+    print STDERR "\n\n==== Running interceptor Benchmark test " .
+                 "<$configuration>\n";
 
-if ($server->WaitForFileTimed ($iorbase,
-                               $server->ProcessStartWaitInterval()) == -1) {
-    print STDERR "ERROR: cannot find file <$server_iorfile>\n";
-    $SV->Kill (); $SV->TimedWait (1);
-    exit 1;
-}
+    $server_status = $SV->Spawn ();
 
-if ($server->GetFile ($iorbase) == -1) {
-    print STDERR "ERROR: cannot retrieve file <$server_iorfile>\n";
-    $SV->Kill (); $SV->TimedWait (1);
-    exit 1;
-}
-if ($client->PutFile ($iorbase) == -1) {
-    print STDERR "ERROR: cannot set file <$client_iorfile>\n";
-    $SV->Kill (); $SV->TimedWait (1);
-    exit 1;
-}
+    if ($server_status != 0) {
+        print STDERR "ERROR: server returned $server_status\n";
+        exit 1;
+    }
 
-$client_status = $CL->SpawnWaitKill ($client->ProcessStartWaitInterval() + 45);
+    if ($server->WaitForFileTimed ($iorbase,
+                                   $server->ProcessStartWaitInterval()) == -1) {
+        print STDERR "ERROR: cannot find file <$server_iorfile>\n";
+        $SV->Kill (); $SV->TimedWait (1);
+        exit 1;
+    }
 
-if ($client_status != 0) {
-    print STDERR "ERROR: client returned $client_status\n";
-    $status = 1;
-}
+    if ($server->GetFile ($iorbase) == -1) {
+        print STDERR "ERROR: cannot retrieve file <$server_iorfile>\n";
+        $SV->Kill (); $SV->TimedWait (1);
+        exit 1;
+    }
+    if ($client->PutFile ($iorbase) == -1) {
+        print STDERR "ERROR: cannot set file <$client_iorfile>\n";
+        $SV->Kill (); $SV->TimedWait (1);
+        exit 1;
+    }
+
+    $client_status = $CL->SpawnWaitKill ($client->ProcessStartWaitInterval() + 45);
 
-$server_status = $SV->WaitKill ($server->ProcessStopWaitInterval());
+    if ($client_status != 0) {
+        print STDERR "ERROR: client returned $client_status\n";
+        $status = 1;
+    }
+
+    $server_status = $SV->WaitKill ($server->ProcessStopWaitInterval());
 
-if ($server_status != 0) {
-    print STDERR "ERROR: server returned $server_status\n";
-    $status = 1;
+    if ($server_status != 0) {
+        print STDERR "ERROR: server returned $server_status\n";
+        $status = 1;
+    }
 }
 
 $server->DeleteFile($iorbase);
@@ -13,7 +13,7 @@ int register_interceptor = 1;
 int
 parse_args (int argc, ACE_TCHAR *argv[])
 {
-  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("o:"));
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("o:r:c:"));
   int c;
 
   while ((c = get_opts ()) != -1)
@@ -22,11 +22,16 @@ parse_args (int argc, ACE_TCHAR *argv[])
       case 'o':
         ior_output_file = get_opts.opt_arg ();
         break;
+      case 'r':
+      case 'c':
+        // Handled by get_interceptor_type().
+        break;
       case '?':
       default:
         ACE_ERROR_RETURN ((LM_ERROR,
                            "usage:  %s "
-                           "-o <iorfile> -r <register_interceptor>"
+                           "-o <iorfile> "
+                           "-r <none|noop|context|dynamic> -c <count>"
                            "\n",
                            argv [0]),
                           -1);
@@ -39,14 +44,16 @@ int
 ACE_TMAIN(int argc, ACE_TCHAR *argv[])
 {
   int interceptor_type;
-  get_interceptor_type (argc, argv, interceptor_type);
+  int interceptor_count;
+  get_interceptor_type (argc, argv, interceptor_type, interceptor_count);
 
   try
     {
       PortableInterceptor::ORBInitializer_ptr temp_initializer;
 
       ACE_NEW_RETURN (temp_initializer,
-                      Server_ORBInitializer (interceptor_type),
+                      Server_ORBInitializer (interceptor_type,
+                                             interceptor_count),
                       -1);  // No exceptions yet!
       PortableInterceptor::ORBInitializer_var initializer =
         temp_initializer;
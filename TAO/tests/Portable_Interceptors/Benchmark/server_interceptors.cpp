@@ -3,6 +3,7 @@
 #include "tao/AnyTypeCode/DynamicC.h"
 #include "tao/AnyTypeCode/TypeCode.h"
 #include "ace/OS_NS_string.h"
+#include "ace/OS_NS_stdio.h"
 #include "ace/Log_Msg.h"
 
 const CORBA::ULong request_ctx_id = 0xdead;
@@ -264,9 +265,17 @@ Vault_Server_Request_Dynamic_Interceptor::send_other (
 
 //////////////////////////////NOOP///////////////////////////////////////
 
-Vault_Server_Request_NOOP_Interceptor::Vault_Server_Request_NOOP_Interceptor (void)
-  : myname_ ("Vault_Server_NOOP_Interceptor")
+Vault_Server_Request_NOOP_Interceptor::Vault_Server_Request_NOOP_Interceptor (int index)
 {
+  // Several of them are registered to measure the cost per
+  // interceptor, their names have to differ.
+  char name[64];
+  if (index == 0)
+    ACE_OS::strcpy (name, "Vault_Server_NOOP_Interceptor");
+  else
+    ACE_OS::sprintf (name, "Vault_Server_NOOP_Interceptor_%d", index);
+
+  this->myname_ = CORBA::string_dup (name);
 }
 
 Vault_Server_Request_NOOP_Interceptor::~Vault_Server_Request_NOOP_Interceptor ()
@@ -276,7 +285,7 @@ Vault_Server_Request_NOOP_Interceptor::~Vault_Server_Request_NOOP_Interceptor ()
 char *
 Vault_Server_Request_NOOP_Interceptor::name (void)
 {
-  return CORBA::string_dup (this->myname_);
+  return CORBA::string_dup (this->myname_.in ());
 }
 
 void
@@ -116,7 +116,7 @@ class Vault_Server_Request_NOOP_Interceptor
 {
   // = Server-side Vault interceptor.  For checking interceptor visually only.
 public:
-  Vault_Server_Request_NOOP_Interceptor (void);
+  Vault_Server_Request_NOOP_Interceptor (int index);
   // cotr.
   ~Vault_Server_Request_NOOP_Interceptor ();
   // dotr.
@@ -138,7 +138,7 @@ public:
   virtual void send_other (PortableInterceptor::ServerRequestInfo_ptr);
 
 private:
-  const char *myname_;
+  CORBA::String_var myname_;
 };
 
 #if defined(_MSC_VER)
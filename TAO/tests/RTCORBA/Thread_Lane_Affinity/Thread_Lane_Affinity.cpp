@@ -0,0 +1,261 @@
+#include "testS.h"
+#include "tao/RTCORBA/RT_ORB.h"
+#include "tao/RTCORBA/Thread_Pool.h"
+#include "tao/RTCORBA/Thread_Lane_Affinity.h"
+#include "tao/RTPortableServer/RTPortableServer.h"
+#include "ace/OS_NS_stdio.h"
+#include "ace/OS_NS_string.h"
+#include "../check_supported_priorities.cpp"
+
+static CORBA::ULong stacksize = 0;
+static CORBA::ULong static_threads = 1;
+static CORBA::ULong dynamic_threads = 0;
+static CORBA::Boolean allow_request_buffering = 0;
+static CORBA::ULong max_buffered_requests = 0;
+static CORBA::ULong max_request_buffer_size = 0;
+
+/// Format @a cpus like "0,1,5".
+ACE_CString
+to_string (const TAO_Thread_Lane_Affinity::CPU_List &cpus)
+{
+  ACE_CString result;
+
+  for (size_t i = 0; i != cpus.size (); ++i)
+    {
+      char cpu[16];
+      ACE_OS::sprintf (cpu, i == 0 ? "%u" : ",%u", cpus[i]);
+      result += cpu;
+    }
+
+  return result;
+}
+
+class test_i : public POA_test
+{
+public:
+  test_i (PortableServer::POA_ptr poa)
+    : poa_ (PortableServer::POA::_duplicate (poa))
+  {
+  }
+
+  char *cpus (void)
+  {
+    TAO_Thread_Lane_Affinity::CPU_List cpus;
+    TAO_Thread_Lane_Affinity::thread_cpus (cpus);
+
+    return CORBA::string_dup (to_string (cpus).c_str ());
+  }
+
+  PortableServer::POA_ptr _default_POA (void)
+  {
+    return PortableServer::POA::_duplicate (this->poa_.in ());
+  }
+
+private:
+  PortableServer::POA_var poa_;
+};
+
+test_ptr
+create_POA_and_register_servant (RTCORBA::ThreadpoolId threadpool_id,
+                                 const char *poa_name,
+                                 PortableServer::POA_ptr root_poa,
+                                 RTCORBA::RTORB_ptr rt_orb)
+{
+  CORBA::PolicyList policies (3);
+  policies.length (3);
+
+  policies[0] =
+    root_poa->create_implicit_activation_policy
+    (PortableServer::IMPLICIT_ACTIVATION);
+
+  policies[1] =
+    rt_orb->create_threadpool_policy (threadpool_id);
+
+  policies[2] =
+    rt_orb->create_priority_model_policy (RTCORBA::CLIENT_PROPAGATED, 0);
+
+  PortableServer::POAManager_var poa_manager =
+    root_poa->the_POAManager ();
+
+  PortableServer::POA_var poa =
+    root_poa->create_POA (poa_name,
+                          poa_manager.in (),
+                          policies);
+
+  for (CORBA::ULong i = 0;
+       i < policies.length ();
+       ++i)
+    {
+      policies[i]->destroy ();
+    }
+
+  test_i *servant = 0;
+  ACE_NEW_RETURN (servant,
+                  test_i (poa.in ()),
+                  test::_nil ());
+  PortableServer::ServantBase_var safe_servant (servant);
+
+  PortableServer::ObjectId_var id =
+    poa->activate_object (servant);
+
+  CORBA::Object_var object = poa->id_to_reference (id.in ());
+
+  return test::_narrow (object.in ());
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  int status = 0;
+
+  try
+    {
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      CORBA::Object_var object =
+        orb->resolve_initial_references ("RootPOA");
+
+      PortableServer::POA_var root_poa =
+        PortableServer::POA::_narrow (object.in ());
+
+      PortableServer::POAManager_var poa_manager =
+        root_poa->the_POAManager ();
+
+      object =
+        orb->resolve_initial_references ("RTORB");
+
+      RTCORBA::RTORB_var rt_orb =
+        RTCORBA::RTORB::_narrow (object.in ());
+
+      TAO_RT_ORB *tao_rt_orb =
+        dynamic_cast<TAO_RT_ORB *> (rt_orb.in ());
+
+      TAO_Thread_Lane_Affinity &lane_affinity =
+        tao_rt_orb->tp_manager ().lane_affinity ();
+
+      // The lane of thread pool 9 is bound in svc.conf.
+      TAO_Thread_Lane_Affinity::CPU_List cpus;
+      if (!lane_affinity.find (9, 0, cpus)
+          || to_string (cpus) != "0,1,2,3,6")
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: -RTORBLaneCPUAffinity 9:0 0-3,6 gives <%C>\n",
+                      to_string (cpus).c_str ()));
+          status = 1;
+        }
+
+      if (lane_affinity.find (1, 0, cpus))
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: first thread pool is bound to <%C>\n",
+                      to_string (cpus).c_str ()));
+          status = 1;
+        }
+
+      TAO_Thread_Lane_Affinity::CPU_List process_cpus;
+      if (TAO_Thread_Lane_Affinity::thread_cpus (process_cpus) == -1
+          || process_cpus.size () == 0)
+        {
+          ACE_DEBUG ((LM_DEBUG,
+                      "Binding threads to processors is not supported, "
+                      "test skipped\n"));
+          orb->destroy ();
+          return status;
+        }
+
+      // Bind the second thread pool to the first processor the
+      // process may run on.
+      char first_cpu[16];
+      ACE_OS::sprintf (first_cpu, "%u", process_cpus[0]);
+
+      if (lane_affinity.cpus ("2:*", first_cpu) == -1
+          || lane_affinity.cpus ("2:*", "1-0") != -1
+          || lane_affinity.cpus ("2", first_cpu) != -1)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: cannot bind the second thread pool\n"));
+          status = 1;
+        }
+
+      RTCORBA::Priority default_thread_priority =
+        get_implicit_thread_CORBA_priority (orb.in ());
+
+      RTCORBA::ThreadpoolId unbound_id =
+        rt_orb->create_threadpool (stacksize,
+                                   static_threads,
+                                   dynamic_threads,
+                                   default_thread_priority,
+                                   allow_request_buffering,
+                                   max_buffered_requests,
+                                   max_request_buffer_size);
+
+      RTCORBA::ThreadpoolId bound_id =
+        rt_orb->create_threadpool (stacksize,
+                                   static_threads,
+                                   dynamic_threads,
+                                   default_thread_priority,
+                                   allow_request_buffering,
+                                   max_buffered_requests,
+                                   max_request_buffer_size);
+
+      test_var unbound =
+        create_POA_and_register_servant (unbound_id,
+                                         "unbound_poa",
+                                         root_poa.in (),
+                                         rt_orb.in ());
+
+      test_var bound =
+        create_POA_and_register_servant (bound_id,
+                                         "bound_poa",
+                                         root_poa.in (),
+                                         rt_orb.in ());
+
+      poa_manager->activate ();
+
+      CORBA::String_var unbound_cpus = unbound->cpus ();
+      CORBA::String_var bound_cpus = bound->cpus ();
+
+      ACE_DEBUG ((LM_DEBUG,
+                  "Process runs on <%C>, first thread pool on <%C>, "
+                  "second thread pool on <%C>\n",
+                  to_string (process_cpus).c_str (),
+                  unbound_cpus.in (),
+                  bound_cpus.in ()));
+
+      if (to_string (process_cpus) != unbound_cpus.in ())
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: first thread pool must not be bound\n"));
+          status = 1;
+        }
+
+      if (ACE_OS::strcmp (first_cpu, bound_cpus.in ()) != 0)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: second thread pool must be bound to <%C>\n",
+                      first_cpu));
+          status = 1;
+        }
+
+      // The thread creating the thread pools is not bound anymore.
+      TAO_Thread_Lane_Affinity::thread_cpus (cpus);
+      if (to_string (cpus) != to_string (process_cpus))
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: main thread is bound to <%C>\n",
+                      to_string (cpus).c_str ()));
+          status = 1;
+        }
+
+      orb->shutdown (1);
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return -1;
+    }
+
+  return status;
+}
@@ -0,0 +1,38 @@
+eval '(exit $?0)' && eval 'exec perl -S $0 ${1+"$@"}'
+    & eval 'exec perl -S $0 $argv:q'
+    if 0;
+
+# -*- perl -*-
+
+use lib "$ENV{ACE_ROOT}/bin";
+use PerlACE::TestTarget;
+
+my $server = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
+
+my $svc_conf = 'svc.conf';
+
+if ($server->PutFile ($svc_conf) == -1) {
+    print STDERR "ERROR: cannot set file <".$server->LocalFile ($svc_conf).">\n";
+    exit 1;
+}
+if ($server->PutFile ($svc_conf.'.xml') == -1) {
+    print STDERR "ERROR: cannot set file <".$server->LocalFile ($svc_conf.'.xml').">\n";
+    exit 1;
+}
+
+print STDERR "\n********** RTCORBA Thread_Lane_Affinity Unit Test **********\n\n";
+
+# The servants are invoked through the transports, the upcalls are run
+# by the threads of the thread pools.
+$SV = $server->CreateProcess ("Thread_Lane_Affinity",
+                              "-ORBSvcConf svc$PerlACE::svcconf_ext " .
+                              "-ORBCollocation no");
+
+$server_status = $SV->SpawnWaitKill ($server->ProcessStartWaitInterval());
+
+if ($server_status != 0) {
+    print STDERR "ERROR: test returned $server_status\n";
+    exit 1;
+}
+
+exit 0;
@@ -17,6 +17,7 @@ my @testsToRun = qw(unbounded_value_sequence_ut
                bounded_string_sequence_ut
                testing_allocation_traits_ut
                unbounded_octet_sequence_ut
+               unbounded_value_sequence_nocopy_ut
                object_reference_sequence_element_ut
                unbounded_object_reference_sequence_ut
                unbounded_fwd_object_reference_sequence_ut
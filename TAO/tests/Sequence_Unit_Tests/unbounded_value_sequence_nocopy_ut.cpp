@@ -0,0 +1,295 @@
+/**
+ * @file
+ *
+ * @brief Unit test for unbounded sequences of value types that refer to
+ * the elements in a message block, see TAO_NO_COPY_VALUE_SEQUENCES.
+ */
+#define TAO_NO_COPY_VALUE_SEQUENCES 1
+
+#include "testing_allocation_traits.hpp"
+#include "testing_range_checking.hpp"
+
+#include "tao/CDR.h"
+#include "tao/Unbounded_Value_Sequence_T.h"
+#include "tao/Unbounded_Octet_Sequence_T.h"
+#include "tao/Unbounded_Object_Reference_Sequence_T.h"
+#include "tao/Unbounded_Basic_String_Sequence_T.h"
+#include "tao/Unbounded_BD_String_Sequence_T.h"
+#include "tao/Unbounded_Sequence_CDR_T.h"
+
+#include "value_sequence_tester.hpp"
+
+#include "test_macros.h"
+
+#include "ace/Message_Block.h"
+
+
+using namespace TAO_VERSIONED_NAMESPACE_NAME::TAO;
+
+typedef unbounded_value_sequence<CORBA::Long> tested_sequence;
+typedef tested_sequence::element_traits tested_element_traits;
+typedef tested_sequence::allocation_traits tested_allocation_traits;
+typedef details::range_checking<CORBA::Long,true> range;
+
+struct Tester
+{
+  typedef tested_sequence::value_type value_type;
+
+  ACE_Message_Block * alloc_and_init_mb()
+  {
+    value_type const values[] = { 1, 4, 9, 16 };
+    ACE_Message_Block * mb = 0;
+    ACE_NEW_RETURN (mb,
+        ACE_Message_Block (sizeof (values) + ACE_CDR::MAX_ALIGNMENT),
+        0);
+    ACE_CDR::mb_align (mb);
+    mb->copy (reinterpret_cast<const char *> (values), sizeof (values));
+
+    return mb;
+  }
+
+  int check_values(tested_sequence const & a)
+  {
+    CHECK_EQUAL(CORBA::ULong(4), a.length());
+    CHECK_EQUAL( 1, a[0]);
+    CHECK_EQUAL( 4, a[1]);
+    CHECK_EQUAL( 9, a[2]);
+    CHECK_EQUAL(16, a[3]);
+    return 0;
+  }
+
+  int test_message_block_constructor()
+  {
+    ACE_Message_Block * mb = alloc_and_init_mb();
+    expected_calls a(tested_allocation_traits::allocbuf_calls);
+    expected_calls f(tested_allocation_traits::freebuf_calls);
+    {
+      tested_sequence x(4, mb);
+      tested_sequence const & cx = x;
+      FAIL_RETURN_IF_NOT(a.expect(0), a);
+      CHECK_EQUAL(CORBA::ULong(4), x.maximum());
+      CHECK_EQUAL(false, x.release());
+      CHECK(x.mb() != 0);
+      CHECK_EQUAL(
+          reinterpret_cast<value_type const *>(mb->rd_ptr()),
+          cx.get_buffer());
+      FAIL_RETURN_IF(check_values(x));
+      CHECK_EQUAL(2, mb->data_block()->reference_count());
+    }
+    FAIL_RETURN_IF_NOT(a.expect(0), a);
+    FAIL_RETURN_IF_NOT(f.expect(0), f);
+    CHECK_EQUAL(1, mb->data_block()->reference_count());
+    ACE_Message_Block::release(mb);
+    return 0;
+  }
+
+  int test_copy_shares_message_block()
+  {
+    ACE_Message_Block * mb = alloc_and_init_mb();
+    expected_calls a(tested_allocation_traits::allocbuf_calls);
+    expected_calls f(tested_allocation_traits::freebuf_calls);
+    {
+      tested_sequence x(4, mb);
+      tested_sequence y(x);
+      tested_sequence z;
+      z = x;
+      FAIL_RETURN_IF_NOT(a.expect(0), a);
+      tested_sequence const & cx = x;
+      tested_sequence const & cy = y;
+      tested_sequence const & cz = z;
+      CHECK_EQUAL(cx.get_buffer(), cy.get_buffer());
+      CHECK_EQUAL(cx.get_buffer(), cz.get_buffer());
+      FAIL_RETURN_IF(check_values(y));
+      FAIL_RETURN_IF(check_values(z));
+      CHECK_EQUAL(4, mb->data_block()->reference_count());
+    }
+    FAIL_RETURN_IF_NOT(a.expect(0), a);
+    FAIL_RETURN_IF_NOT(f.expect(0), f);
+    CHECK_EQUAL(1, mb->data_block()->reference_count());
+    ACE_Message_Block::release(mb);
+    return 0;
+  }
+
+#if defined (ACE_HAS_CPP11)
+  int test_move_takes_message_block()
+  {
+    ACE_Message_Block * mb = alloc_and_init_mb();
+    expected_calls a(tested_allocation_traits::allocbuf_calls);
+    expected_calls f(tested_allocation_traits::freebuf_calls);
+    {
+      tested_sequence x(4, mb);
+      tested_sequence y(std::move(x));
+      CHECK(x.mb() == 0);
+      CHECK(y.mb() != 0);
+      CHECK_EQUAL(CORBA::ULong(0), x.length());
+      FAIL_RETURN_IF(check_values(y));
+      CHECK_EQUAL(2, mb->data_block()->reference_count());
+
+      tested_sequence z;
+      z = std::move(y);
+      CHECK(y.mb() == 0);
+      FAIL_RETURN_IF(check_values(z));
+      CHECK_EQUAL(2, mb->data_block()->reference_count());
+      FAIL_RETURN_IF_NOT(a.expect(0), a);
+    }
+    FAIL_RETURN_IF_NOT(f.expect(0), f);
+    CHECK_EQUAL(1, mb->data_block()->reference_count());
+    ACE_Message_Block::release(mb);
+    return 0;
+  }
+#endif /* ACE_HAS_CPP11 */
+
+  int test_copy_on_write()
+  {
+    ACE_Message_Block * mb = alloc_and_init_mb();
+    value_type const * const data =
+      reinterpret_cast<value_type const *>(mb->rd_ptr());
+    expected_calls a(tested_allocation_traits::allocbuf_calls);
+    expected_calls f(tested_allocation_traits::freebuf_calls);
+    {
+      tested_sequence x(4, mb);
+      tested_sequence y(x);
+      x[0] = 25;
+      FAIL_RETURN_IF_NOT(a.expect(1), a);
+      CHECK(x.mb() == 0);
+      CHECK_EQUAL(true, x.release());
+      CHECK_EQUAL(25, x[0]);
+      CHECK_EQUAL( 4, x[1]);
+      CHECK_EQUAL(1, data[0]);
+      FAIL_RETURN_IF(check_values(y));
+      CHECK_EQUAL(2, mb->data_block()->reference_count());
+
+      // Already copied.
+      x[1] = 36;
+      FAIL_RETURN_IF_NOT(a.expect(0), a);
+    }
+    FAIL_RETURN_IF_NOT(f.expect(1), f);
+    ACE_Message_Block::release(mb);
+    return 0;
+  }
+
+  int test_set_length_copies()
+  {
+    ACE_Message_Block * mb = alloc_and_init_mb();
+    expected_calls a(tested_allocation_traits::allocbuf_calls);
+    expected_calls f(tested_allocation_traits::freebuf_calls);
+    {
+      tested_sequence x(4, mb);
+      x.length(2);
+      FAIL_RETURN_IF_NOT(a.expect(1), a);
+      CHECK(x.mb() == 0);
+      CHECK_EQUAL(CORBA::ULong(2), x.length());
+      CHECK_EQUAL(4, x[1]);
+    }
+    FAIL_RETURN_IF_NOT(f.expect(1), f);
+    CHECK_EQUAL(1, mb->data_block()->reference_count());
+    ACE_Message_Block::release(mb);
+    return 0;
+  }
+
+  int test_get_buffer_copies()
+  {
+    ACE_Message_Block * mb = alloc_and_init_mb();
+    expected_calls a(tested_allocation_traits::allocbuf_calls);
+    expected_calls f(tested_allocation_traits::freebuf_calls);
+    {
+      tested_sequence x(4, mb);
+      value_type * buffer = x.get_buffer(true);
+      FAIL_RETURN_IF_NOT(a.expect(1), a);
+      CHECK(buffer != reinterpret_cast<value_type *>(mb->rd_ptr()));
+      CHECK_EQUAL(16, buffer[3]);
+      CHECK_EQUAL(CORBA::ULong(0), x.length());
+      tested_sequence::freebuf(buffer);
+    }
+    FAIL_RETURN_IF_NOT(f.expect(1), f);
+    ACE_Message_Block::release(mb);
+    return 0;
+  }
+
+  int test_replace_message_block()
+  {
+    ACE_Message_Block * mb = alloc_and_init_mb();
+    expected_calls a(tested_allocation_traits::allocbuf_calls);
+    expected_calls f(tested_allocation_traits::freebuf_calls);
+    {
+      tested_sequence x(8);
+      x.replace(4, mb);
+      FAIL_RETURN_IF_NOT(a.expect(1), a);
+      FAIL_RETURN_IF_NOT(f.expect(1), f);
+      FAIL_RETURN_IF(check_values(x));
+
+      value_type * buffer = tested_sequence::allocbuf(8);
+      x.replace(8, 0, buffer, true);
+      CHECK(x.mb() == 0);
+      CHECK_EQUAL(1, mb->data_block()->reference_count());
+    }
+    FAIL_RETURN_IF_NOT(f.expect(1), f);
+    ACE_Message_Block::release(mb);
+    return 0;
+  }
+
+  int test_demarshal_without_orb_copies()
+  {
+    tested_sequence x(4, 4, alloc_and_init_buffer(), true);
+    TAO_OutputCDR out;
+    CHECK(TAO::marshal_sequence(out, x));
+
+    TAO_InputCDR in(out);
+    tested_sequence y;
+    CHECK(TAO::demarshal_sequence(in, y));
+    CHECK(y.mb() == 0);
+    FAIL_RETURN_IF(check_values(y));
+    return 0;
+  }
+
+  value_type * alloc_and_init_buffer()
+  {
+    value_type * buf = tested_sequence::allocbuf(4);
+    buf[0] = 1; buf[1] = 4; buf[2] = 9; buf[3] = 16;
+
+    return buf;
+  }
+
+  int test_all()
+  {
+    int status = 0;
+    status += this->test_message_block_constructor();
+    status += this->test_copy_shares_message_block();
+#if defined (ACE_HAS_CPP11)
+    status += this->test_move_takes_message_block();
+#endif /* ACE_HAS_CPP11 */
+    status += this->test_copy_on_write();
+    status += this->test_set_length_copies();
+    status += this->test_get_buffer_copies();
+    status += this->test_replace_message_block();
+    status += this->test_demarshal_without_orb_copies();
+    return status;
+  }
+
+  Tester() {}
+};
+
+int ACE_TMAIN(int,ACE_TCHAR*[])
+{
+  int status = 0;
+  try
+    {
+      {
+        Tester tester;
+        status += tester.test_all();
+      }
+
+      {
+        typedef value_sequence_tester<tested_sequence,tested_allocation_traits> common;
+        common tester;
+        status += tester.test_all ();
+      }
+    }
+  catch (const ::CORBA::Exception &ex)
+    {
+      ex._tao_print_exception("ERROR : unexpected CORBA exception caugth :");
+      ++status;
+    }
+
+  return status;
+}
@@ -76,6 +76,67 @@ struct Tester
     return 0;
   }
 
+#if defined (ACE_HAS_CPP11)
+  int test_move_constructor()
+  {
+    expected_calls a(tested_allocation_traits::allocbuf_calls);
+    expected_calls f(tested_allocation_traits::freebuf_calls);
+    {
+      tested_sequence x(16);
+      x.length(8);
+      x[7] = 42;
+      FAIL_RETURN_IF_NOT(a.expect(1), a);
+      tested_sequence const & cx = x;
+      value_type const * buffer = cx.get_buffer();
+
+      tested_sequence y(std::move(x));
+      FAIL_RETURN_IF_NOT(a.expect(0), a);
+      tested_sequence const & cy = y;
+      CHECK_EQUAL(buffer, cy.get_buffer());
+      CHECK_EQUAL(CORBA::ULong(16), y.maximum());
+      CHECK_EQUAL(CORBA::ULong(8), y.length());
+      CHECK_EQUAL(true, y.release());
+      CHECK_EQUAL(42, y[7]);
+
+      CHECK_EQUAL(CORBA::ULong(0), x.maximum());
+      CHECK_EQUAL(CORBA::ULong(0), x.length());
+      CHECK_EQUAL(false, x.release());
+    }
+    FAIL_RETURN_IF_NOT(f.expect(1), f);
+    return 0;
+  }
+
+  int test_move_assignment()
+  {
+    expected_calls a(tested_allocation_traits::allocbuf_calls);
+    expected_calls f(tested_allocation_traits::freebuf_calls);
+    {
+      tested_sequence x(16);
+      x.length(8);
+      tested_sequence y(4);
+      FAIL_RETURN_IF_NOT(a.expect(2), a);
+      tested_sequence const & cx = x;
+      value_type const * buffer = cx.get_buffer();
+
+      y = std::move(x);
+      FAIL_RETURN_IF_NOT(a.expect(0), a);
+      FAIL_RETURN_IF_NOT(f.expect(1), f);
+      tested_sequence const & cy = y;
+      CHECK_EQUAL(buffer, cy.get_buffer());
+      CHECK_EQUAL(CORBA::ULong(16), y.maximum());
+      CHECK_EQUAL(CORBA::ULong(8), y.length());
+      CHECK_EQUAL(CORBA::ULong(0), x.length());
+
+      // The moved-from sequence can be used again.
+      x.length(2);
+      FAIL_RETURN_IF_NOT(a.expect(1), a);
+      CHECK_EQUAL(CORBA::ULong(2), x.length());
+    }
+    FAIL_RETURN_IF_NOT(f.expect(2), f);
+    return 0;
+  }
+#endif /* ACE_HAS_CPP11 */
+
   int test_ulong_constructor()
   {
     expected_calls a(tested_allocation_traits::allocbuf_calls);
@@ -408,6 +469,10 @@ struct Tester
     status += this->test_get_buffer_false();
     status += this->test_get_buffer_true_with_release_false();
     status += this->test_get_buffer_true_with_release_true();
+#if defined (ACE_HAS_CPP11)
+    status += this->test_move_constructor();
+    status += this->test_move_assignment();
+#endif /* ACE_HAS_CPP11 */
     return status;
   }
   Tester() {}
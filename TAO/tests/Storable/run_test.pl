@@ -98,6 +98,43 @@ if ($test1_status != 0) {
 
 $test1->DeleteFile ($persistent_file);
 
+# Repeat the test with the storable kept in a sharded log.
+my $log_shards = 4;
+sub delete_log_files()
+{
+    for (my $i = 0; $i < $log_shards; $i++) {
+        $test1->DeleteFile ("shard_$i.log");
+        $test1->DeleteFile ("shard_$i.lock");
+    }
+}
+delete_log_files();
+
+$T1 = $test1->CreateProcess ("test", "-i 0 -n $num_loops -l $log_shards");
+$T2 = $test2->CreateProcess ("test", "-i 1 -n $num_loops -s $loop_sleep_msec -l $log_shards");
+
+$test1_status = $T1->Spawn ();
+
+if ($test1_status != 0) {
+    print STDERR "ERROR: log test 1 returned $test1_status\n";
+    $status = 1;
+}
+
+$test2_status = $T2->SpawnWaitKill ($test2->ProcessStartWaitInterval());
+
+if ($test2_status != 0) {
+    print STDERR "ERROR: log test 2 returned $test2_status\n";
+    $status = 1;
+}
+
+$test1_status = $T1->WaitKill ($test1->ProcessStopWaitInterval());
+
+if ($test1_status != 0) {
+    print STDERR "ERROR: log test 1 returned $test1_status\n";
+    $status = 1;
+}
+
+delete_log_files();
+
 sub test_backup_recovery($)
 {
     my $bad_file = shift;
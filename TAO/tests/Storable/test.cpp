@@ -12,8 +12,10 @@
 #include "Savable.h"
 
 #include "tao/Storable_FlatFileStream.h"
+#include "tao/Storable_LogStream.h"
 #include "tao/SystemException.h"
 
+#include "ace/Auto_Ptr.h"
 #include "ace/Get_Opt.h"
 #include "ace/OS_NS_unistd.h"
 
@@ -25,11 +27,12 @@ int num_loops = 1;
 int sleep_msecs = 100;
 int write_index = 0;
 bool use_backup = false;
+int log_shards = 0;
 
 int
 parse_args (int argc, ACE_TCHAR *argv[])
 {
-  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("n:s:i:b"));
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("n:s:i:bl:"));
   int c;
 
   while ((c = get_opts ()) != -1)
@@ -51,6 +54,10 @@ parse_args (int argc, ACE_TCHAR *argv[])
         use_backup = true;
         break;
 
+      case 'l':
+        log_shards = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
       case '?':
       default:
         ACE_ERROR_RETURN ((LM_ERROR,
@@ -59,6 +66,7 @@ parse_args (int argc, ACE_TCHAR *argv[])
                            ACE_TEXT("-s <milliseconds-to-sleep-in-loop> ")
                            ACE_TEXT("-i <index-used-for-writing> ")
                            ACE_TEXT("-b (use backup) ")
+                           ACE_TEXT("-l <number-of-log-shards> ")
                            ACE_TEXT("\n"),
                            argv [0]),
                           -1);
@@ -88,7 +96,14 @@ ACE_TMAIN(int argc, ACE_TCHAR *argv[])
 
   TAO::Storable_Base::use_backup_default = use_backup;
 
-  TAO::Storable_FlatFileFactory factory ("./");
+  // Use the log store when asked for, the flat files otherwise.
+  TAO::Storable_Factory *factory_ptr = 0;
+  if (log_shards > 0)
+    factory_ptr = new TAO::Storable_LogFactory ("./", log_shards);
+  else
+    factory_ptr = new TAO::Storable_FlatFileFactory ("./");
+  ACE_Auto_Ptr<TAO::Storable_Factory> factory_owner (factory_ptr);
+  TAO::Storable_Factory &factory = *factory_ptr;
 
   ACE_CString str_write_value = "test_string";
   int int_write_value = -100;
@@ -0,0 +1,108 @@
+//=============================================================================
+/**
+ *  @file     Stub_Cache.cpp
+ *
+ *  Checks that object references demarshaled from the same IOR
+ *  share their profiles but not their stub, and that the least
+ *  recently used profiles are dropped from the cache (svc.conf
+ *  limits it to two).
+ */
+//=============================================================================
+
+#include "tao/ORB.h"
+#include "tao/Object.h"
+#include "tao/Stub.h"
+#include "tao/Profile.h"
+
+#include "ace/Log_Msg.h"
+
+static const TAO_Profile *
+profile (CORBA::Object_ptr obj)
+{
+  const TAO_Stub *stub = obj->_stubobj ();
+  return stub->base_profiles ().get_profile (0);
+}
+
+static int
+check (const char *what,
+       CORBA::Object_ptr lhs,
+       CORBA::Object_ptr rhs,
+       bool shared)
+{
+  if ((profile (lhs) == profile (rhs)) != shared)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "ERROR: %C %C share their profiles\n",
+                  what,
+                  shared ? "do not" : "unexpectedly"));
+      return 1;
+    }
+  if (lhs->_stubobj () == rhs->_stubobj ())
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "ERROR: %C share their stub\n",
+                  what));
+      return 1;
+    }
+  if (!lhs->_is_equivalent (rhs))
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "ERROR: %C are not equivalent\n",
+                  what));
+      return 1;
+    }
+  return 0;
+}
+
+int
+ACE_TMAIN (int argc, ACE_TCHAR *argv[])
+{
+  int result = 0;
+
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      // No connections are opened, the objects need not exist.
+      const char *locations[] =
+        {
+          "corbaloc:iiop:localhost:12345/A",
+          "corbaloc:iiop:localhost:12345/B",
+          "corbaloc:iiop:localhost:12345/C"
+        };
+      CORBA::String_var ior[3];
+      for (int i = 0; i != 3; ++i)
+        {
+          CORBA::Object_var obj = orb->string_to_object (locations[i]);
+          ior[i] = orb->object_to_string (obj.in ());
+        }
+
+      CORBA::Object_var a1 = orb->string_to_object (ior[0].in ());
+      CORBA::Object_var a2 = orb->string_to_object (ior[0].in ());
+      CORBA::Object_var b1 = orb->string_to_object (ior[1].in ());
+      result += check ("A references", a1.in (), a2.in (), true);
+
+      if (profile (a1.in ()) == profile (b1.in ()))
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: A and B share their profiles\n"));
+          ++result;
+        }
+
+      // Using B and then C drops A, the least recently used one.
+      CORBA::Object_var b2 = orb->string_to_object (ior[1].in ());
+      CORBA::Object_var c1 = orb->string_to_object (ior[2].in ());
+      CORBA::Object_var a3 = orb->string_to_object (ior[0].in ());
+      result += check ("B references", b1.in (), b2.in (), true);
+      result += check ("Dropped A references", a1.in (), a3.in (), false);
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return result;
+}
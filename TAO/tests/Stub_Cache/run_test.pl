@@ -0,0 +1,29 @@
+eval '(exit $?0)' && eval 'exec perl -S $0 ${1+"$@"}'
+    & eval 'exec perl -S $0 $argv:q'
+    if 0;
+
+# -*- perl -*-
+
+use lib "$ENV{ACE_ROOT}/bin";
+use PerlACE::TestTarget;
+
+my $client = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
+
+my $clientconf = "svc.conf";
+my $clientconffile = $client->LocalFile ($clientconf);
+
+if ($client->PutFile ($clientconf) == -1) {
+    print STDERR "ERROR: cannot set file <$clientconffile>\n";
+    exit 1;
+}
+
+$CL = $client->CreateProcess ("Stub_Cache", "-ORBSvcConf $clientconffile");
+
+$test = $CL->SpawnWaitKill ($client->ProcessStartWaitInterval());
+
+if ($test != 0) {
+    print STDERR "ERROR: test returned $test\n";
+    exit 1;
+}
+
+exit 0;
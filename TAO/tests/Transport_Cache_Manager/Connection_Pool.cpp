@@ -0,0 +1,171 @@
+#include "ace/Get_Opt.h"
+#include "ace/Argv_Type_Converter.h"
+#include "ace/SString.h"
+#include "ace/Manual_Event.h"
+
+#include "tao/Transport_Cache_Manager_T.h"
+#include "tao/ORB.h"
+#include "tao/ORB_Core.h"
+
+class mock_transport;
+class mock_tdi;
+class mock_ps;
+
+static int global_purged_count = 0;
+
+typedef TAO::Transport_Cache_Manager_T<mock_transport, mock_tdi, mock_ps> TCM;
+
+#include "mock_tdi.h"
+#include "mock_transport.h"
+#include "mock_ps.h"
+
+static int
+check (TCM &cache,
+       mock_tdi &tdi,
+       size_t pool_maximum,
+       TCM::Find_Result expected_result,
+       mock_transport *expected_transport)
+{
+  mock_transport *transport = 0;
+  size_t busy_count = 0;
+  TCM::Find_Result const result =
+    cache.find_transport (&tdi, transport, busy_count, pool_maximum);
+
+  if (result != expected_result)
+    {
+      ACE_ERROR ((LM_ERROR, "ERROR Incorrect find result %d, expected %d\n",
+                  result, expected_result));
+      return 1;
+    }
+  if (expected_transport != 0 && transport != expected_transport)
+    {
+      ACE_ERROR ((LM_ERROR, "ERROR Found transport %d, expected %d\n",
+                  transport ? transport->id () : 0, expected_transport->id ()));
+      return 1;
+    }
+  return 0;
+}
+
+static void
+make_idle (TCM &cache, mock_transport &transport)
+{
+  TCM::HASH_MAP_ENTRY *entry = transport.cache_map_entry ();
+  cache.make_idle (entry);
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  int result = 0;
+
+  try
+    {
+      // We need an ORB to get an ORB core
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      // Four connections to the same endpoint, a pool of at most four
+      // that is not shrunk below three.
+      size_t const transport_max = 4;
+      size_t const pool_maximum = 4;
+      size_t i = 0;
+      mock_transport mytransport[transport_max];
+      mock_tdi mytdi;
+      mock_ps* myps = new mock_ps(10);
+      TCM my_cache (20, myps, 10, false, 0, 3);
+
+      for (i = 0; i < transport_max; i++)
+        {
+          mytransport[i].id (i + 1);
+          mytransport[i].is_connected (true);
+        }
+
+      // Without pooling the one idle connection is used.
+      my_cache.cache_transport (&mytdi, &mytransport[0]);
+      result += check (my_cache, mytdi, 0,
+                       TCM::CACHE_FOUND_AVAILABLE, &mytransport[0]);
+      make_idle (my_cache, mytransport[0]);
+
+      // It is used as well while no request waits for a reply on it,
+      // but once one does, the pool grows.
+      result += check (my_cache, mytdi, pool_maximum,
+                       TCM::CACHE_FOUND_AVAILABLE, &mytransport[0]);
+      make_idle (my_cache, mytransport[0]);
+      mytransport[0].pending_requests (2);
+      result += check (my_cache, mytdi, pool_maximum,
+                       TCM::CACHE_FOUND_BUSY, 0);
+
+      // When opening another connection fails the connector looks
+      // again with a pool of one and settles for the loaded one.
+      result += check (my_cache, mytdi, 1,
+                       TCM::CACHE_FOUND_AVAILABLE, &mytransport[0]);
+      make_idle (my_cache, mytransport[0]);
+
+      my_cache.cache_transport (&mytdi, &mytransport[1]);
+      result += check (my_cache, mytdi, pool_maximum,
+                       TCM::CACHE_FOUND_AVAILABLE, &mytransport[1]);
+      make_idle (my_cache, mytransport[1]);
+
+      // Fill the pool, the least loaded connection is picked and the
+      // pool does not grow beyond its maximum.
+      mytransport[1].pending_requests (1);
+      my_cache.cache_transport (&mytdi, &mytransport[2]);
+      my_cache.cache_transport (&mytdi, &mytransport[3]);
+      mytransport[2].pending_requests (3);
+      mytransport[3].pending_requests (1);
+      result += check (my_cache, mytdi, pool_maximum,
+                       TCM::CACHE_FOUND_AVAILABLE, &mytransport[1]);
+      result += check (my_cache, mytdi, pool_maximum,
+                       TCM::CACHE_FOUND_AVAILABLE, &mytransport[3]);
+      result += check (my_cache, mytdi, pool_maximum,
+                       TCM::CACHE_FOUND_AVAILABLE, &mytransport[0]);
+      result += check (my_cache, mytdi, pool_maximum,
+                       TCM::CACHE_FOUND_AVAILABLE, &mytransport[2]);
+      result += check (my_cache, mytdi, pool_maximum,
+                       TCM::CACHE_FOUND_BUSY, 0);
+
+      // When the load drops the first connection takes all requests
+      // and the last one is closed after a while, but not the others,
+      // since that would shrink the pool below its minimum.
+      for (i = 0; i < transport_max; i++)
+        {
+          mytransport[i].pending_requests (0);
+          make_idle (my_cache, mytransport[i]);
+        }
+      for (i = 0; i < 2 * TAO_CONNECTION_POOL_IDLE_LOOKUPS; i++)
+        {
+          result += check (my_cache, mytdi, pool_maximum,
+                           TCM::CACHE_FOUND_AVAILABLE, &mytransport[0]);
+          make_idle (my_cache, mytransport[0]);
+
+          if (mytransport[3].purged_count () != 0)
+            {
+              // A real transport leaves the cache when it is closed.
+              TCM::HASH_MAP_ENTRY *entry = mytransport[3].cache_map_entry ();
+              my_cache.purge_entry (entry);
+              mytransport[3].cache_map_entry (0);
+            }
+        }
+
+      if (mytransport[3].purged_count () != 1)
+        {
+          ACE_ERROR ((LM_ERROR, "ERROR Idle transport 3 not closed\n"));
+          ++result;
+        }
+      for (i = 0; i < 3; i++)
+        {
+          if (mytransport[i].purged_count () != 0)
+            {
+              ACE_ERROR ((LM_ERROR, "ERROR Transport %d closed\n", i));
+              ++result;
+            }
+        }
+
+      orb->destroy ();
+
+    }
+  catch (const CORBA::Exception&)
+    {
+      // Ignore exceptions..
+    }
+  return result;
+}
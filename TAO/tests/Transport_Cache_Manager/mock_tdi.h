@@ -1,10 +1,10 @@
 class mock_tdi
 {
 public:
-  mock_tdi () {}
-  u_long hash (void) {return static_cast<u_long> (reinterpret_cast<ptrdiff_t> (this));}
-  mock_tdi *duplicate (void) {return 0;}
-  CORBA::Boolean is_equivalent (const mock_tdi *) {return true;}
-
+  mock_tdi () : hash_ (static_cast<u_long> (reinterpret_cast<ptrdiff_t> (this))) {}
+  u_long hash (void) {return hash_;}
+  mock_tdi *duplicate (void) {return new mock_tdi (*this);}
+  CORBA::Boolean is_equivalent (const mock_tdi *other) {return other != 0 && other->hash_ == this->hash_;}
+private:
+  u_long hash_;
 };
-
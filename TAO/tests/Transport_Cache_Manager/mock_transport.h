@@ -1,7 +1,14 @@
+class mock_wait_strategy
+{
+public:
+  int non_blocking (void) const {return 1;}
+  void is_registered (bool) {}
+};
+
 class mock_transport
 {
 public:
-  mock_transport () : id_(0), is_connected_(false), entry_(0), purging_order_ (0), purged_count_ (0) {}
+  mock_transport () : id_(0), is_connected_(false), entry_(0), purging_order_ (0), purged_count_ (0), pending_requests_ (0) {}
   size_t id (void) const {return id_;}
   void id (size_t id) { this->id_ = id;}
   unsigned long purging_order (void) const {return purging_order_;}
@@ -15,6 +22,11 @@ public:
   void close_connection (void) { purged_count_ = ++global_purged_count;};
   int purged_count (void) { return this->purged_count_;}
   bool can_be_purged (void) { return true;}
+  size_t pending_requests (void) const { return this->pending_requests_;}
+  void pending_requests (size_t count) { this->pending_requests_ = count;}
+  mock_wait_strategy *wait_strategy (void) { return &this->wait_strategy_;}
+  TAO_ORB_Core *orb_core (void) const { return 0;}
+  ACE_Event_Handler *event_handler_i (void) { return 0;}
 private:
   size_t id_;
   bool is_connected_;
@@ -22,6 +34,8 @@ private:
   unsigned long purging_order_;
   /// When did we got purged
   int purged_count_;
+  size_t pending_requests_;
+  mock_wait_strategy wait_strategy_;
 };
 
 
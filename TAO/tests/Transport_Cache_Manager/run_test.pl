@@ -12,6 +12,7 @@ my $final_result = 0;
 
 my @testsToRun = qw(Bug_3549_Regression
                Bug_3558_Regression
+               Connection_Pool
               );
 
 foreach my $process (@testsToRun) {